@@ -30,6 +30,7 @@ enum class BufferType
     Constant,       //!< Constant buffer type (also called "Uniform Buffer Object").
     Storage,        //!< Storage buffer type (also called "Shader Storage Buffer Object" or "Read/Write Buffer").
     StreamOutput,   //!< Stream output buffer type (also called "Transform Feedback Buffer").
+    Indirect,       //!< Indirect argument buffer type (also called "Draw Indirect Buffer").
 };
 
 /**
@@ -161,6 +162,46 @@ struct BufferDescriptor
     StorageBufferDescriptor storageBuffer;
 };
 
+/**
+\brief Argument structure for indirect draw commands.
+\remarks This is the memory layout of each draw command inside an indirect argument buffer.
+\see CommandBuffer::DrawIndirect
+\see CommandBuffer::MultiDrawIndirect
+*/
+struct DrawIndirectArguments
+{
+    unsigned int    numVertices     = 0;    //!< Number of vertices to generate.
+    unsigned int    numInstances    = 0;    //!< Number of instances to generate.
+    unsigned int    firstVertex     = 0;    //!< Zero-based offset of the first vertex from the vertex buffer.
+    unsigned int    firstInstance   = 0;    //!< Zero-based instance offset which is added to each instance ID.
+};
+
+/**
+\brief Argument structure for indirect indexed draw commands.
+\remarks This is the memory layout of each draw command inside an indirect argument buffer.
+\see CommandBuffer::DrawIndexedIndirect
+\see CommandBuffer::MultiDrawIndexedIndirect
+*/
+struct DrawIndexedIndirectArguments
+{
+    unsigned int    numIndices      = 0;    //!< Number of indices to generate.
+    unsigned int    numInstances    = 0;    //!< Number of instances to generate.
+    unsigned int    firstIndex      = 0;    //!< Zero-based offset of the first index from the index buffer.
+    int             vertexOffset    = 0;    //!< Base vertex offset which is added to each index from the index buffer.
+    unsigned int    firstInstance   = 0;    //!< Zero-based instance offset which is added to each instance ID.
+};
+
+/**
+\brief Argument structure for indirect compute commands.
+\see CommandBuffer::DispatchIndirect
+*/
+struct DispatchIndirectArguments
+{
+    unsigned int    groupSizeX      = 0;    //!< Number of thread groups in the X-dimension.
+    unsigned int    groupSizeY      = 0;    //!< Number of thread groups in the Y-dimension.
+    unsigned int    groupSizeZ      = 0;    //!< Number of thread groups in the Z-dimension.
+};
+
 /**
 \brief Constant buffer shader-view descriptor structure.
 \remarks This structure is used to describe the view of a constant buffer within a shader.
@@ -0,0 +1,164 @@
+/*
+ * BufferHeap.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_BUFFER_HEAP_H
+#define LLGL_BUFFER_HEAP_H
+
+
+#include "Export.h"
+#include "RenderSystem.h"
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Buffer heap descriptor structure.
+\see BufferHeap
+*/
+struct BufferHeapDescriptor
+{
+    //! Vertex format of all meshes in the heap. This is used for all vertex buffers of the heap.
+    VertexFormat    vertexFormat;
+
+    //! Index format of all meshes in the heap. By default DataType::UInt32.
+    IndexFormat     indexFormat         = IndexFormat(DataType::UInt32);
+
+    //! Number of vertices of each vertex buffer. This is the maximum number of vertices of a single allocation. By default 262144.
+    unsigned int    verticesPerPage     = 262144;
+
+    //! Number of indices of each index buffer. This is the maximum number of indices of a single allocation. By default 1048576.
+    unsigned int    indicesPerPage      = 1048576;
+
+    /**
+    \brief Buffer creation flags for all vertex and index buffers. By default 0.
+    \see BufferDescriptor::flags
+    */
+    long            flags               = 0;
+};
+
+/**
+\brief Buffer heap allocation structure, which refers to the vertex and index data of a single mesh inside a buffer heap.
+\remarks Draw an allocation by setting its vertex and index buffer and then calling
+CommandBuffer::DrawIndexed(numIndices, firstIndex, static_cast<int>(firstVertex)),
+or CommandBuffer::Draw(numVertices, firstVertex) for allocations without indices.
+\see BufferHeap::Alloc
+*/
+struct BufferHeapAllocation
+{
+    //! Vertex buffer which contains the vertices of this allocation. This is shared with other allocations.
+    Buffer*         vertexBuffer    = nullptr;
+
+    //! Index buffer which contains the indices of this allocation. This is shared with other allocations.
+    Buffer*         indexBuffer     = nullptr;
+
+    //! Zero-based index of the first vertex inside the vertex buffer. This is used as base vertex for indexed draw commands.
+    unsigned int    firstVertex     = 0;
+
+    //! Number of vertices.
+    unsigned int    numVertices     = 0;
+
+    //! Zero-based index of the first index inside the index buffer.
+    unsigned int    firstIndex      = 0;
+
+    //! Number of indices.
+    unsigned int    numIndices      = 0;
+
+    //! Index of the page the allocation belongs to. This is used internally by BufferHeap::Free.
+    unsigned int    page            = 0;
+};
+
+/**
+\brief Buffer heap utility class, which sub-allocates the vertex and index data of many meshes from a few large buffers.
+\remarks The heap is layered on top of the RenderSystem interface. It consists of pages, where each page is one vertex buffer and one index buffer.
+Allocations are placed into the pages by a TLSF-style allocator, and a new page is only created if no page has enough free space.
+Since all meshes of a page share the same vertex buffer (and thus the same vertex array object with OpenGL),
+drawing them requires no vertex buffer switches, only different base vertex and first index offsets.
+The vertex indices of each mesh are relative to its own vertices, i.e. they must not be rebased by the client.
+\code
+LLGL::BufferHeapDescriptor heapDesc;
+heapDesc.vertexFormat = vertexFormat;
+LLGL::BufferHeap heap(*renderer, heapDesc);
+auto mesh = heap.Alloc(numVertices, vertices, numIndices, indices);
+// ...
+commands->SetVertexBuffer(*mesh.vertexBuffer);
+commands->SetIndexBuffer(*mesh.indexBuffer);
+commands->DrawIndexed(mesh.numIndices, mesh.firstIndex, static_cast<int>(mesh.firstVertex));
+\endcode
+*/
+class LLGL_EXPORT BufferHeap
+{
+
+    public:
+
+        /**
+        \brief Constructs the buffer heap. No buffers are created until the first allocation.
+        \throws std::invalid_argument If the vertex format has a stride of zero or the number of vertices per page is zero.
+        */
+        BufferHeap(RenderSystem& renderSystem, const BufferHeapDescriptor& desc);
+
+        //! Releases all buffers of this heap.
+        ~BufferHeap();
+
+        BufferHeap(const BufferHeap&) = delete;
+        BufferHeap& operator = (const BufferHeap&) = delete;
+
+        /**
+        \brief Allocates the vertex and index data of a mesh, and writes the specified data into the buffers.
+        \param[in] numVertices Specifies the number of vertices. This must be greater than zero.
+        \param[in] vertices Optional pointer to the vertex data, which must contain 'numVertices' vertices of the heap's vertex format.
+        \param[in] numIndices Specifies the number of indices. This may be zero for non-indexed meshes.
+        \param[in] indices Optional pointer to the index data, which must contain 'numIndices' indices of the heap's index format.
+        \throws std::invalid_argument If the number of vertices or indices exceeds the size of a page.
+        */
+        BufferHeapAllocation Alloc(unsigned int numVertices, const void* vertices, unsigned int numIndices = 0, const void* indices = nullptr);
+
+        //! Releases the specified allocation. The buffers are not released, even if the page is empty.
+        void Free(const BufferHeapAllocation& allocation);
+
+        //! Releases all allocations and buffers of this heap.
+        void Clear();
+
+        //! Returns the number of pages, i.e. the number of vertex buffers.
+        inline std::size_t GetNumPages() const
+        {
+            return pages_.size();
+        }
+
+        //! Returns the heap descriptor.
+        inline const BufferHeapDescriptor& GetDescriptor() const
+        {
+            return desc_;
+        }
+
+    private:
+
+        struct Page;
+
+        using PagePtr = std::unique_ptr<Page>;
+
+        PagePtr CreatePage();
+        void ReleasePage(Page& page);
+
+        RenderSystem&           renderSystem_;
+        BufferHeapDescriptor    desc_;
+        std::vector<PagePtr>    pages_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
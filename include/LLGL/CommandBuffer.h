@@ -20,12 +20,15 @@
 #include "TextureArray.h"
 #include "Sampler.h"
 #include "SamplerArray.h"
+#include "ResourceHeap.h"
 
 #include "RenderTarget.h"
+#include "RenderPassFlags.h"
 #include "ShaderProgram.h"
 #include "GraphicsPipeline.h"
 #include "ComputePipeline.h"
 #include "Query.h"
+#include "Fence.h"
 
 
 namespace LLGL
@@ -285,23 +288,39 @@ class LLGL_EXPORT CommandBuffer
         */
         virtual void SetSamplerArray(SamplerArray& samplerArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) = 0;
 
+        /* ----- Resource Heaps ----- */
+
+        /**
+        \brief Sets all resource views of the specified resource heap for subsequent drawing and compute operations.
+        \param[in] resourceHeap Specifies the resource heap to set.
+        \remarks This is equivalent to calling SetConstantBuffer, SetStorageBuffer, SetTexture, and SetSampler
+        for each resource view of the resource heap, but the bindings are prepared when the resource heap is created.
+        \see RenderSystem::CreateResourceHeap
+        */
+        virtual void SetResourceHeap(ResourceHeap& resourceHeap) = 0;
+
         /* ----- Render Targets ----- */
 
         /**
         \brief Sets the specified render target as the new target for subsequent rendering commands.
         \param[in] renderTarget Specifies the render target to set.
+        \param[in] renderPassDesc Optional pointer to a render pass descriptor, which specifies the load and store operations for each attachment.
+        If this is null, all attachments are loaded and stored. By default null.
         \remarks Subsequent drawing operations will be rendered into the textures that are attached to the specified render target.
+        The store operations are applied when the next render target is set.
         \note If the specified render-target has not the same resolution as this render context, the viewports and scissor rectangles may be invalidated!
-        \see SetRenderTarget(RenderContext&)
+        \see SetRenderTarget(RenderContext&, const RenderPassDescriptor*)
+        \see RenderPassDescriptor
         */
-        virtual void SetRenderTarget(RenderTarget& renderTarget) = 0;
+        virtual void SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc = nullptr) = 0;
 
         /**
         \brief Sets the back buffer (or rather swap-chain) of the specified render context as the new target for subsequent rendering commands.
+        \param[in] renderPassDesc Optional pointer to a render pass descriptor. By default null.
         \remarks Subsequent drawing operations will be rendered into the main framebuffer, which can then be presented onto the screen.
-        \see SetRenderTarget(RenderTarget&)
+        \see SetRenderTarget(RenderTarget&, const RenderPassDescriptor*)
         */
-        virtual void SetRenderTarget(RenderContext& renderContext) = 0;
+        virtual void SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc = nullptr) = 0;
 
         /* ----- Pipeline States ----- */
 
@@ -427,6 +446,48 @@ class LLGL_EXPORT CommandBuffer
         */
         virtual void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) = 0;
 
+        /**
+        \brief Draws primitives from the currently set vertex buffer with the arguments taken from the specified indirect buffer.
+        \param[in] buffer Specifies the indirect argument buffer. This must have been created with the BufferType::Indirect type.
+        \param[in] offset Specifies the offset (in bytes) within the argument buffer. This must be a multiple of 4.
+        \remarks The argument buffer must contain a DrawIndirectArguments structure at the specified offset.
+        \see DrawIndirectArguments
+        \see RenderingCaps::hasIndirectDrawing
+        */
+        virtual void DrawIndirect(Buffer& buffer, unsigned int offset) = 0;
+
+        /**
+        \brief Draws primitives from the currently set vertex- and index buffers with the arguments taken from the specified indirect buffer.
+        \param[in] buffer Specifies the indirect argument buffer. This must have been created with the BufferType::Indirect type.
+        \param[in] offset Specifies the offset (in bytes) within the argument buffer. This must be a multiple of 4.
+        \remarks The argument buffer must contain a DrawIndexedIndirectArguments structure at the specified offset.
+        \see DrawIndexedIndirectArguments
+        \see RenderingCaps::hasIndirectDrawing
+        */
+        virtual void DrawIndexedIndirect(Buffer& buffer, unsigned int offset) = 0;
+
+        /**
+        \brief Draws several batches of primitives from the currently set vertex buffer with the arguments taken from the specified indirect buffer.
+        \param[in] buffer Specifies the indirect argument buffer. This must have been created with the BufferType::Indirect type.
+        \param[in] offset Specifies the offset (in bytes) of the first draw command within the argument buffer. This must be a multiple of 4.
+        \param[in] numCommands Specifies the number of draw commands.
+        \param[in] stride Specifies the stride (in bytes) between consecutive draw commands. This must be a multiple of 4 and greater than or equal to sizeof(DrawIndirectArguments).
+        \remarks If the render system does not support multi-draw-indirect natively, the draw commands are submitted one by one.
+        \see DrawIndirectArguments
+        */
+        virtual void MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) = 0;
+
+        /**
+        \brief Draws several batches of primitives from the currently set vertex- and index buffers with the arguments taken from the specified indirect buffer.
+        \param[in] buffer Specifies the indirect argument buffer. This must have been created with the BufferType::Indirect type.
+        \param[in] offset Specifies the offset (in bytes) of the first draw command within the argument buffer. This must be a multiple of 4.
+        \param[in] numCommands Specifies the number of draw commands.
+        \param[in] stride Specifies the stride (in bytes) between consecutive draw commands. This must be a multiple of 4 and greater than or equal to sizeof(DrawIndexedIndirectArguments).
+        \remarks If the render system does not support multi-draw-indirect natively, the draw commands are submitted one by one.
+        \see DrawIndexedIndirectArguments
+        */
+        virtual void MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) = 0;
+
         /* ----- Compute ----- */
 
         /**
@@ -439,9 +500,34 @@ class LLGL_EXPORT CommandBuffer
         */
         virtual void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) = 0;
 
+        /**
+        \brief Dispatches a compute command with the thread group sizes taken from the specified indirect buffer.
+        \param[in] buffer Specifies the indirect argument buffer. This must have been created with the BufferType::Indirect type.
+        \param[in] offset Specifies the offset (in bytes) within the argument buffer. This must be a multiple of 4.
+        \remarks The argument buffer must contain a DispatchIndirectArguments structure at the specified offset.
+        \see DispatchIndirectArguments
+        \see SetComputePipeline
+        */
+        virtual void DispatchIndirect(Buffer& buffer, unsigned int offset) = 0;
+
         /* ----- Misc ----- */
 
-        //! Synchronizes the GPU, i.e. waits until the GPU has completed all pending commands from this command buffer.
+        /**
+        \brief Submits the specified fence into the command stream.
+        \param[in] fence Specifies the fence which is to be signaled, once the GPU has completed all previously submitted commands.
+        If this fence has already been submitted before, it is reset and submitted again.
+        \remarks Use this instead of "SyncGPU" to synchronize the CPU with a certain point in the command stream only,
+        e.g. to recycle the memory of a ring buffer or to limit the number of frames in flight.
+        \see RenderSystem::CreateFence
+        \see RenderSystem::WaitFence
+        \see Fence::IsSignaled
+        */
+        virtual void SignalFence(Fence& fence) = 0;
+
+        /**
+        \brief Synchronizes the GPU, i.e. waits until the GPU has completed all pending commands from this command buffer.
+        \see SignalFence
+        */
         virtual void SyncGPU() = 0;
 
     protected:
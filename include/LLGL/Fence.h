@@ -0,0 +1,56 @@
+/*
+ * Fence.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_FENCE_H
+#define LLGL_FENCE_H
+
+
+#include "Export.h"
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Fence interface for CPU/GPU synchronization.
+\remarks A fence is signaled by the GPU as soon as all commands, which have been submitted before the fence, have been completed.
+In contrast to "CommandBuffer::SyncGPU", this allows to wait for a certain point in the command stream only.
+\see CommandBuffer::SignalFence
+\see RenderSystem::WaitFence
+*/
+class LLGL_EXPORT Fence
+{
+
+    public:
+
+        Fence(const Fence&) = delete;
+        Fence& operator = (const Fence&) = delete;
+
+        virtual ~Fence();
+
+        /**
+        \brief Returns true if this fence has been signaled by the GPU. This function does not block.
+        \remarks A fence which has never been submitted with "CommandBuffer::SignalFence" is considered to be signaled.
+        */
+        virtual bool IsSignaled() = 0;
+
+    protected:
+
+        Fence() = default;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
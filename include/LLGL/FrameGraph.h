@@ -0,0 +1,256 @@
+/*
+ * FrameGraph.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_FRAME_GRAPH_H
+#define LLGL_FRAME_GRAPH_H
+
+
+#include "Export.h"
+#include "RenderSystem.h"
+#include "CommandBuffer.h"
+#include <functional>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class FrameGraph;
+
+//! Frame graph resource handle.
+using FrameGraphResource = std::uint32_t;
+
+//! Frame graph pass handle.
+using FrameGraphPass = std::uint32_t;
+
+/**
+\brief Frame graph pass execution function.
+\remarks The render target of the pass (if any) is already set on the command buffer when this function is called.
+Use FrameGraph::GetTexture and FrameGraph::GetBuffer to get the resources of the pass.
+*/
+using FrameGraphExecuteFunction = std::function<void(CommandBuffer& commandBuffer, const FrameGraph& frameGraph)>;
+
+/**
+\brief Frame graph statistics structure.
+\see FrameGraph::GetStatistics
+*/
+struct FrameGraphStatistics
+{
+    //! Number of passes that have been added to the frame graph.
+    unsigned int numPasses              = 0;
+
+    //! Number of passes that have been culled, because none of their results are used.
+    unsigned int numCulledPasses        = 0;
+
+    //! Number of transient textures that are used by the remaining passes.
+    unsigned int numTransientTextures   = 0;
+
+    //! Number of texture objects that are allocated for the transient textures, i.e. after aliasing.
+    unsigned int numPhysicalTextures    = 0;
+};
+
+/**
+\brief Frame graph utility class, which schedules render passes and manages the lifetimes of their transient resources.
+\remarks The frame graph is layered on top of the RenderSystem and CommandBuffer interfaces.
+Each pass declares the resources it reads and writes. When the frame graph is compiled,
+all passes whose results are never used are culled, and the lifetime of each transient texture is determined.
+Transient textures with equal descriptors and non-overlapping lifetimes share the same texture object,
+and all texture objects and render targets are recycled from frame to frame.
+For each pass, the load and store operations of its attachments are derived from the resource lifetimes,
+i.e. attachments are only loaded if they have been written before, and only stored if they are read afterwards.
+Passes are executed in the order they have been added.
+\code
+LLGL::FrameGraph graph(*renderer);
+// Each frame:
+auto sceneTex = graph.CreateTexture(sceneTexDesc);
+auto depthTex = graph.CreateTexture(depthTexDesc);
+auto scene = graph.AddPass("Scene", [&](LLGL::CommandBuffer& cmds, const LLGL::FrameGraph&) { DrawScene(cmds); });
+graph.WriteAttachment(scene, sceneTex, true);
+graph.WriteAttachment(scene, depthTex, true);
+auto post = graph.AddPass("Post", [&](LLGL::CommandBuffer& cmds, const LLGL::FrameGraph& g) { DrawPost(cmds, g.GetTexture(sceneTex)); });
+graph.Read(post, sceneTex);
+graph.WriteRenderContext(post, *context);
+graph.Execute(*commands);
+graph.Reset();
+\endcode
+*/
+class LLGL_EXPORT FrameGraph
+{
+
+    public:
+
+        /**
+        \brief Constructs the frame graph.
+        \param[in] renderSystem Specifies the render system which is used to create and release the transient resources.
+        \param[in] maxUnusedFrames Specifies the number of frames a texture object or render target may remain unused before it is released. By default 3.
+        */
+        FrameGraph(RenderSystem& renderSystem, unsigned int maxUnusedFrames = 3);
+
+        //! Releases all texture objects and render targets of this frame graph.
+        ~FrameGraph();
+
+        FrameGraph(const FrameGraph&) = delete;
+        FrameGraph& operator = (const FrameGraph&) = delete;
+
+        /* ----- Resources ----- */
+
+        //! Declares a new transient texture, which is only allocated while it is used by a pass.
+        FrameGraphResource CreateTexture(const TextureDescriptor& desc);
+
+        //! Imports the specified texture. Passes that write to an imported resource are never culled.
+        FrameGraphResource ImportTexture(Texture& texture);
+
+        //! Imports the specified buffer. Passes that write to an imported resource are never culled.
+        FrameGraphResource ImportBuffer(Buffer& buffer);
+
+        /* ----- Passes ----- */
+
+        //! Adds a new pass with the specified name and execution function.
+        FrameGraphPass AddPass(const std::string& name, const FrameGraphExecuteFunction& execute);
+
+        //! Declares that the specified pass reads the specified resource.
+        void Read(FrameGraphPass pass, FrameGraphResource resource);
+
+        //! Declares that the specified pass writes the specified resource, e.g. a storage buffer. This does not attach the resource to a render target.
+        void Write(FrameGraphPass pass, FrameGraphResource resource);
+
+        /**
+        \brief Declares that the specified pass renders into the specified texture.
+        \param[in] clear Specifies whether the texture is to be cleared if it has not been written before.
+        The clear values of the command buffer are used (see CommandBuffer::SetClearColor etc.). By default false.
+        \remarks Textures with a depth or depth-stencil format are attached as depth attachment, all other textures as color attachments.
+        \throws std::invalid_argument If the resource is a buffer, or if the pass already has a depth attachment.
+        */
+        void WriteAttachment(FrameGraphPass pass, FrameGraphResource resource, bool clear = false);
+
+        /**
+        \brief Declares that the specified pass renders into the specified render context. Such a pass is never culled.
+        \param[in] clear Specifies whether the color and depth-stencil buffers are to be cleared. By default false.
+        \remarks A pass can either render into transient textures or into a render context.
+        */
+        void WriteRenderContext(FrameGraphPass pass, RenderContext& renderContext, bool clear = false);
+
+        /* ----- Execution ----- */
+
+        //! Culls unused passes, determines the resource lifetimes, and allocates the transient textures and render targets.
+        void Compile();
+
+        //! Executes all remaining passes on the specified command buffer. The frame graph is compiled first if necessary.
+        void Execute(CommandBuffer& commandBuffer);
+
+        //! Removes all passes and resources, and releases all texture objects and render targets which are no longer used.
+        void Reset();
+
+        //! Returns the texture of the specified resource. Transient textures are only valid while the frame graph is executed.
+        Texture& GetTexture(FrameGraphResource resource) const;
+
+        //! Returns the buffer of the specified resource.
+        Buffer& GetBuffer(FrameGraphResource resource) const;
+
+        //! Returns the statistics of the last compilation.
+        inline const FrameGraphStatistics& GetStatistics() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        static const std::uint32_t invalidIndex = ~0u;
+
+        struct ResourceEntry
+        {
+            TextureDescriptor               textureDesc;
+            Texture*                        texture         = nullptr;
+            Buffer*                         buffer          = nullptr;
+            bool                            imported        = false;
+            unsigned int                    refCount        = 0;
+            std::uint32_t                   firstPass       = invalidIndex;
+            std::uint32_t                   lastPass        = invalidIndex;
+            std::vector<FrameGraphPass>     producers;
+        };
+
+        struct AttachmentEntry
+        {
+            FrameGraphResource              resource;
+            bool                            clear;
+        };
+
+        struct PassEntry
+        {
+            std::string                     name;
+            FrameGraphExecuteFunction       execute;
+            std::vector<FrameGraphResource> reads;
+            std::vector<FrameGraphResource> writes;
+            std::vector<AttachmentEntry>    colorAttachments;
+            AttachmentEntry                 depthAttachment     = { invalidIndex, false };
+            RenderContext*                  renderContext       = nullptr;
+            bool                            clearRenderContext  = false;
+            bool                            sideEffect          = false;
+            bool                            culled              = false;
+            unsigned int                    refCount            = 0;
+            RenderTarget*                   renderTarget        = nullptr;
+        };
+
+        struct PhysicalTexture
+        {
+            TextureDescriptor               desc;
+            Texture*                        texture         = nullptr;
+            std::uint64_t                   lastFrame       = 0;
+            std::uint32_t                   lastPass        = 0;
+        };
+
+        struct PhysicalRenderTarget
+        {
+            std::vector<Texture*>           attachments;
+            RenderTarget*                   renderTarget    = nullptr;
+            std::uint64_t                   lastFrame       = 0;
+        };
+
+        ResourceEntry& GetResource(FrameGraphResource resource);
+        const ResourceEntry& GetResource(FrameGraphResource resource) const;
+        PassEntry& GetPass(FrameGraphPass pass);
+
+        void CullPasses();
+        void ComputeLifetimes();
+        void AllocateTextures();
+        void AllocateRenderTargets();
+
+        Texture* AcquireTexture(const ResourceEntry& resource);
+        RenderTarget* AcquireRenderTarget(const std::vector<Texture*>& attachments);
+
+        void ExecutePass(CommandBuffer& commandBuffer, std::uint32_t passIndex);
+        void SetPassRenderContext(CommandBuffer& commandBuffer, std::uint32_t passIndex);
+        void SetPassRenderTarget(CommandBuffer& commandBuffer, std::uint32_t passIndex);
+
+        RenderSystem&                       renderSystem_;
+        unsigned int                        maxUnusedFrames_    = 3;
+        std::uint64_t                       frame_              = 1;
+        bool                                compiled_           = false;
+
+        std::vector<ResourceEntry>          resources_;
+        std::vector<PassEntry>              passes_;
+
+        std::vector<PhysicalTexture>        physicalTextures_;
+        std::vector<PhysicalRenderTarget>   physicalRenderTargets_;
+
+        RenderPassDescriptor                renderPass_;
+        FrameGraphStatistics                stats_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -98,6 +98,36 @@ struct LLGL_EXPORT ImageDescriptor
     unsigned int    compressedSize  = 0;                    //!< Specifies the size (in bytes) of a compressed image. This must be 0 for uncompressed images.
 };
 
+/**
+\brief Texture readback descriptor structure.
+\see RenderSystem::ReadTextureAsync
+*/
+struct LLGL_EXPORT TextureReadbackDescriptor
+{
+    //! MIP-map level from which the image data is to be read. By default 0.
+    int             mipLevel        = 0;
+
+    //! Image format in which the image data is read from the texture. By default ImageFormat::RGBA.
+    ImageFormat     format          = ImageFormat::RGBA;
+
+    //! Data type in which the image data is read from the texture. By default DataType::UInt8.
+    DataType        dataType        = DataType::UInt8;
+
+    /**
+    \brief Specifies whether the image data is to be converted after the readback. By default false.
+    \remarks If this is true, the image data is converted into 'convertFormat' and 'convertDataType' on a worker thread
+    as soon as the GPU has finished the readback, so the conversion does not block the render thread either.
+    \see ConvertImageBuffer
+    */
+    bool            convert         = false;
+
+    //! Image format into which the image data is converted, if 'convert' is true. By default ImageFormat::RGBA.
+    ImageFormat     convertFormat   = ImageFormat::RGBA;
+
+    //! Data type into which the image data is converted, if 'convert' is true. By default DataType::UInt8.
+    DataType        convertDataType = DataType::UInt8;
+};
+
 
 /* ----- Functions ----- */
 
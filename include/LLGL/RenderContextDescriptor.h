@@ -104,6 +104,16 @@ struct ProfileOpenGLDescriptor
     \remarks This required 'coreProfile' to be enabled.
     */
     OpenGLVersion   version     = OpenGLVersion::OpenGL_Latest;
+
+    /**
+    \brief Specifies whether to create a headless context, i.e. without a window or display server. By default disabled.
+    \remarks This is only supported on Linux and requires LLGL to be built with EGL (see CMake option 'LLGL_GL_ENABLE_EGL').
+    If the video mode resolution is non-zero, the default framebuffer is an offscreen pbuffer of that size.
+    Otherwise the context is surfaceless and only render targets can be rendered into.
+    If a headless context is created, all other render contexts of the same render system must be headless, too.
+    \see VideoModeDescriptor::resolution
+    */
+    bool            headless    = false;
 };
 
 //! Render context descriptor structure.
@@ -0,0 +1,110 @@
+/*
+ * RenderPassFlags.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RENDER_PASS_FLAGS_H
+#define LLGL_RENDER_PASS_FLAGS_H
+
+
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Render pass attachment load operation enumeration.
+\remarks Specifies what happens to the content of an attachment when a render target is set.
+\see RenderPassAttachmentDescriptor::loadOp
+*/
+enum class AttachmentLoadOp
+{
+    Load,       //!< The previous content of the attachment is preserved.
+    Clear,      //!< The attachment is cleared with the respective clear value of the command buffer (see CommandBuffer::SetClearColor etc.).
+    DontCare,   //!< The previous content of the attachment is undefined, i.e. the renderer does not need to load it.
+};
+
+/**
+\brief Render pass attachment store operation enumeration.
+\remarks Specifies what happens to the content of an attachment when the next render target is set.
+\see RenderPassAttachmentDescriptor::storeOp
+*/
+enum class AttachmentStoreOp
+{
+    /**
+    \brief The content of the attachment is stored.
+    \remarks For multi-sampled render targets, the attachment is resolved into its texture and the multi-sampled content is preserved as well.
+    */
+    Store,
+
+    /**
+    \brief The content of the attachment is resolved into its texture, and the multi-sampled content is discarded afterwards.
+    \remarks This is equivalent to AttachmentStoreOp::Store for render targets without multi-sampling.
+    */
+    Resolve,
+
+    /**
+    \brief The content of the attachment is discarded, i.e. it is undefined after the render pass.
+    \remarks Use this for attachments that are never read back, e.g. most depth buffers.
+    */
+    Discard,
+};
+
+
+/* ----- Structures ----- */
+
+//! Render pass attachment descriptor structure.
+struct RenderPassAttachmentDescriptor
+{
+    RenderPassAttachmentDescriptor() = default;
+
+    RenderPassAttachmentDescriptor(AttachmentLoadOp loadOp, AttachmentStoreOp storeOp = AttachmentStoreOp::Store) :
+        loadOp  { loadOp  },
+        storeOp { storeOp }
+    {
+    }
+
+    //! Specifies the load operation of the attachment. By default AttachmentLoadOp::Load.
+    AttachmentLoadOp    loadOp  = AttachmentLoadOp::Load;
+
+    //! Specifies the store operation of the attachment. By default AttachmentStoreOp::Store.
+    AttachmentStoreOp   storeOp = AttachmentStoreOp::Store;
+};
+
+/**
+\brief Render pass descriptor structure.
+\remarks A render pass begins when a render target is set with this descriptor,
+and it ends when the next render target is set on the same command buffer.
+\see CommandBuffer::SetRenderTarget
+*/
+struct RenderPassDescriptor
+{
+    /**
+    \brief Specifies the load and store operations for each color attachment.
+    \remarks Color attachments without an entry in this list use the default load and store operations.
+    For a render context, only the first entry is used.
+    */
+    std::vector<RenderPassAttachmentDescriptor> colorAttachments;
+
+    //! Specifies the load and store operations for the depth attachment.
+    RenderPassAttachmentDescriptor              depthAttachment;
+
+    //! Specifies the load and store operations for the stencil attachment.
+    RenderPassAttachmentDescriptor              stencilAttachment;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
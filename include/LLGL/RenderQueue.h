@@ -0,0 +1,195 @@
+/*
+ * RenderQueue.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RENDER_QUEUE_H
+#define LLGL_RENDER_QUEUE_H
+
+
+#include "Export.h"
+#include "CommandBuffer.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Draw packet structure for the render queue.
+\remarks A draw packet describes a single draw call together with the states it requires.
+All object pointers are optional. A null pointer means that the respective state is not changed by this draw packet.
+\see RenderQueue::Submit
+*/
+struct DrawPacket
+{
+    /**
+    \brief Specifies the sort key of this draw packet. By default 0.
+    \remarks Draw packets are executed in ascending order of their sort keys.
+    \see RenderQueue::MakeSortKey
+    */
+    std::uint64_t       sortKey             = 0;
+
+    //! Render target to draw into. By default null.
+    RenderTarget*       renderTarget        = nullptr;
+
+    //! Graphics pipeline state object. By default null.
+    GraphicsPipeline*   graphicsPipeline    = nullptr;
+
+    //! Vertex buffer. By default null.
+    Buffer*             vertexBuffer        = nullptr;
+
+    //! Index buffer. If this is non-null, the draw packet is executed with an indexed draw call. By default null.
+    Buffer*             indexBuffer         = nullptr;
+
+    //! Constant buffer. By default null.
+    Buffer*             constantBuffer      = nullptr;
+
+    //! Texture. By default null.
+    Texture*            texture             = nullptr;
+
+    //! Sampler state. By default null.
+    Sampler*            sampler             = nullptr;
+
+    //! Slot for the constant buffer. By default 0.
+    unsigned int        constantBufferSlot  = 0;
+
+    //! Slot for the texture and sampler state. By default 0.
+    unsigned int        textureSlot         = 0;
+
+    //! Number of vertices (or indices if 'indexBuffer' is non-null). By default 0.
+    unsigned int        numVertices         = 0;
+
+    //! First vertex (or first index if 'indexBuffer' is non-null). By default 0.
+    unsigned int        firstVertex         = 0;
+
+    //! Base vertex offset for indexed draw calls. By default 0.
+    int                 vertexOffset        = 0;
+
+    //! Number of instances. Values greater than 1 result in an instanced draw call. By default 1.
+    unsigned int        numInstances        = 1;
+};
+
+/**
+\brief Render queue statistics structure.
+\see RenderQueue::GetStatistics
+*/
+struct RenderQueueStatistics
+{
+    //! Number of draw packets executed in the last call to "RenderQueue::Execute".
+    unsigned int numDrawCalls       = 0;
+
+    //! Number of state changes (render targets, pipelines, buffers, textures, samplers) issued in the last call to "RenderQueue::Execute".
+    unsigned int numStateChanges    = 0;
+
+    //! Number of redundant state changes, which have been filtered out in the last call to "RenderQueue::Execute".
+    unsigned int numSkippedChanges  = 0;
+};
+
+/**
+\brief Render queue utility class, which collects unsorted draw packets and executes them in a state-optimal order.
+\remarks The render queue is layered on top of the CommandBuffer interface.
+Draw packets are sorted by their 64-bit sort keys with a radix sort,
+and only those states which differ from the previous draw packet are submitted to the command buffer.
+All internal containers keep their capacity between frames, so no memory is allocated once the queue reached its peak size.
+\code
+LLGL::RenderQueue queue;
+for (const auto& obj : sceneObjects)
+{
+    LLGL::DrawPacket packet;
+    packet.sortKey          = LLGL::RenderQueue::MakeSortKey(0, 0, obj.pipelineID, obj.textureID, obj.meshID, obj.depth);
+    packet.graphicsPipeline = obj.pipeline;
+    packet.vertexBuffer     = obj.vertexBuffer;
+    packet.texture          = obj.texture;
+    packet.numVertices      = obj.numVertices;
+    queue.Submit(packet);
+}
+queue.Execute(*commands);
+queue.Reset();
+\endcode
+*/
+class LLGL_EXPORT RenderQueue
+{
+
+    public:
+
+        /**
+        \brief Builds a 64-bit sort key from the specified state identifiers.
+        \param[in] layer Specifies the layer (or render pass) index. Only the lower 4 bits are used.
+        \param[in] renderTarget Specifies the render target identifier. Only the lower 8 bits are used.
+        \param[in] pipeline Specifies the pipeline identifier. Only the lower 12 bits are used.
+        \param[in] texture Specifies the texture identifier. Only the lower 12 bits are used.
+        \param[in] vertexBuffer Specifies the vertex buffer identifier. Only the lower 12 bits are used.
+        \param[in] depth Specifies the normalized depth value in the range [0, 1]. This is quantized to 16 bits.
+        \remarks The bit layout (from most to least significant bits) is: layer, render target, pipeline, texture, vertex buffer, depth.
+        Render target changes are therefore treated as the most expensive state changes, followed by pipeline changes.
+        */
+        static std::uint64_t MakeSortKey(
+            unsigned int    layer,
+            unsigned int    renderTarget,
+            unsigned int    pipeline,
+            unsigned int    texture,
+            unsigned int    vertexBuffer,
+            float           depth           = 0.0f
+        );
+
+        //! Appends the specified draw packet to the queue.
+        void Submit(const DrawPacket& packet);
+
+        /**
+        \brief Sorts all submitted draw packets and executes them on the specified command buffer.
+        \param[in] commandBuffer Specifies the command buffer on which the draw packets will be executed.
+        \param[in] sort Specifies whether the draw packets are to be sorted. If false, the draw packets are executed in submission order. By default true.
+        \remarks The queue is not reset after execution, so the same draw packets can be executed several times.
+        The states of the command buffer are not restored after execution.
+        \see Reset
+        */
+        void Execute(CommandBuffer& commandBuffer, bool sort = true);
+
+        //! Removes all draw packets from the queue, but keeps the memory for the next frame.
+        void Reset();
+
+        //! Returns the number of draw packets in the queue.
+        inline std::size_t GetSize() const
+        {
+            return packets_.size();
+        }
+
+        //! Returns the statistics of the last call to "Execute".
+        inline const RenderQueueStatistics& GetStatistics() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        // Sort key of a draw packet, which is stored contiguously for the radix sort.
+        struct SortEntry
+        {
+            std::uint64_t key;
+            std::uint32_t index;
+        };
+
+        void SortPackets();
+
+        std::vector<DrawPacket>     packets_;
+        std::vector<SortEntry>      sortEntries_;
+        std::vector<SortEntry>      sortEntriesTemp_;
+
+        RenderQueueStatistics       stats_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
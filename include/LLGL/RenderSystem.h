@@ -22,12 +22,14 @@
 #include "TextureArray.h"
 #include "Sampler.h"
 #include "SamplerArray.h"
+#include "ResourceHeap.h"
 
 #include "RenderTarget.h"
 #include "ShaderProgram.h"
 #include "GraphicsPipeline.h"
 #include "ComputePipeline.h"
 #include "Query.h"
+#include "Fence.h"
 
 #include <string>
 #include <memory>
@@ -155,6 +157,15 @@ class LLGL_EXPORT RenderSystem
             return config_;
         }
 
+        /**
+        \brief Returns the current memory statistics of all buffers, textures, and render targets.
+        \remarks The allocations are tallied (without any locks) whenever a resource is created or released,
+        so this function is cheap enough to be called every frame, e.g. to keep a texture streaming system within a memory budget.
+        The driver-reported device memory is only queried if the renderer supports it.
+        \see MemoryStatistics
+        */
+        virtual MemoryStatistics QueryMemoryStatistics() = 0;
+
         /* ----- Render Context ----- */
 
         /**
@@ -286,6 +297,27 @@ class LLGL_EXPORT RenderSystem
         */
         virtual void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) = 0;
 
+        /**
+        \brief Updates the image data of the specified texture without waiting for the GPU.
+        \param[in] texture Specifies the texture whose data is to be updated.
+        \param[in] subTextureDesc Specifies the sub-texture descriptor.
+        \param[in] imageDesc Specifies the image data descriptor. Its "buffer" member must not be null!
+        \return Ticket of the upload, which can be passed to "IsTextureUploadComplete". A ticket of 0 denotes an upload which has already been completed.
+        \remarks The image data is copied into a staging buffer before this function returns, so the client memory can be reused immediately.
+        The copy from the staging buffer into the texture is then performed by the GPU in the background.
+        If the renderer does not support asynchronous uploads, or the image data is larger than the staging buffer, this is equivalent to "WriteTexture".
+        \see IsTextureUploadComplete
+        \see RenderSystemConfiguration::stagingBufferSize
+        */
+        virtual std::uint64_t WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) = 0;
+
+        /**
+        \brief Returns true if the specified texture upload has been completed by the GPU. This function does not block.
+        \param[in] ticket Specifies the ticket which has been returned by "WriteTextureAsync".
+        \see WriteTextureAsync
+        */
+        virtual bool IsTextureUploadComplete(std::uint64_t ticket) = 0;
+
         /**
         \brief Reads the image data from the specified texture.
         \param[in] texture Specifies the texture object to read from.
@@ -303,6 +335,45 @@ class LLGL_EXPORT RenderSystem
         */
         virtual void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) = 0;
 
+        /**
+        \brief Records an asynchronous read of the image data from the specified texture.
+        \param[in] texture Specifies the texture object to read from.
+        \param[in] desc Specifies the readback descriptor with the MIP-level, the output format, and the optional conversion.
+        \return Ticket of the readback, which can be passed to "MapTextureReadback" (even several frames later).
+        \remarks In contrast to "ReadTexture", this function does not wait until the GPU has finished all previous commands.
+        The result of each readback must be released with "UnmapTextureReadback".
+        \see MapTextureReadback
+        \see UnmapTextureReadback
+        */
+        virtual std::uint64_t ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc) = 0;
+
+        /**
+        \brief Maps the result of the specified texture readback. This function does not block.
+        \param[in] ticket Specifies the ticket which has been returned by "ReadTextureAsync".
+        \param[out] data Pointer to the image data of the readback. This remains valid until "UnmapTextureReadback" is called for this ticket.
+        \param[out] dataSize Size (in bytes) of the image data.
+        \return True if the readback (and its optional conversion) has been completed. Otherwise, the output parameters are not modified.
+        \code
+        // Read back the frame N and map the result in frame N+3
+        tickets[frame % 4] = renderSystem->ReadTextureAsync(*texture, readbackDesc);
+        const void* data = nullptr;
+        std::size_t dataSize = 0;
+        if (renderSystem->MapTextureReadback(tickets[(frame + 1) % 4], data, dataSize))
+        {
+            // Process image data ...
+            renderSystem->UnmapTextureReadback(tickets[(frame + 1) % 4]);
+        }
+        \endcode
+        \see ReadTextureAsync
+        */
+        virtual bool MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize) = 0;
+
+        /**
+        \brief Releases the result of the specified texture readback. After this call, the ticket must no longer be used.
+        \see MapTextureReadback
+        */
+        virtual void UnmapTextureReadback(std::uint64_t ticket) = 0;
+
         /**
         \brief Generates the MIP ("Multum in Parvo") maps for the specified texture.
         \see https://developer.valvesoftware.com/wiki/MIP_Mapping
@@ -333,6 +404,22 @@ class LLGL_EXPORT RenderSystem
         //! Releases the specified sampler array object. After this call, the specified object must no longer be used.
         virtual void Release(SamplerArray& samplerArray) = 0;
 
+        /* ----- Resource Heaps ----- */
+
+        /**
+        \brief Creates a new resource heap, which bundles the specified resource views.
+        \param[in] desc Specifies the resource heap descriptor.
+        
+emarks The resource heap only refers to the resources, i.e. the resources must not be released as long as the resource heap is in use.
+        \throws std::invalid_argument If 'desc.resourceViews' is empty, if any resource view refers to a null pointer or to a buffer of the wrong type,
+        or if two resource views of the same kind share the same binding slot.
+        \see CommandBuffer::SetResourceHeap
+        */
+        virtual ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) = 0;
+
+        //! Releases the specified resource heap object. After this call, the specified object must no longer be used.
+        virtual void Release(ResourceHeap& resourceHeap) = 0;
+
         /* ----- Render Targets ----- */
 
         /**
@@ -399,6 +486,29 @@ class LLGL_EXPORT RenderSystem
         //! Releases the specified Query object. After this call, the specified object must no longer be used.
         virtual void Release(Query& query) = 0;
 
+        /* ----- Fences ----- */
+
+        //! Creates a new fence.
+        virtual Fence* CreateFence() = 0;
+
+        //! Releases the specified Fence object. After this call, the specified object must no longer be used.
+        virtual void Release(Fence& fence) = 0;
+
+        /**
+        \brief Blocks until the specified fence has been signaled or the timeout has expired.
+        \param[in] fence Specifies the fence to wait for.
+        \param[in] timeout Specifies the timeout (in nanoseconds). Use ~0ull to wait without a timeout.
+        \return True if the fence has been signaled, or false if the timeout has expired.
+        \code
+        // Limit the number of frames in flight to 2
+        commands->SignalFence(*frameFences[frame % 2]);
+        renderSystem->WaitFence(*frameFences[(frame + 1) % 2], ~0ull);
+        \endcode
+        \see CommandBuffer::SignalFence
+        \see Fence::IsSignaled
+        */
+        virtual bool WaitFence(Fence& fence, std::uint64_t timeout) = 0;
+
     protected:
 
         RenderSystem() = default;
@@ -424,6 +534,9 @@ class LLGL_EXPORT RenderSystem
         //! Validates the specified arguments to be used for sampler array creation.
         void AssertCreateSamplerArray(unsigned int numSamplers, Sampler* const * samplerArray);
 
+        //! Validates the specified resource heap descriptor to be used for resource heap creation.
+        void AssertCreateResourceHeap(const ResourceHeapDescriptor& desc);
+
     private:
 
         int                         rendererID_ = 0;
@@ -12,6 +12,7 @@
 #include <Gauss/Vector3.h>
 #include "ColorRGBA.h"
 #include <cstddef>
+#include <cstdint>
 #include <string>
 
 
@@ -130,6 +131,13 @@ struct RenderSystemConfiguration
     \see maxThreadCount
     */
     size_t              threadCount         { maxThreadCount };
+
+    /**
+    \brief Specifies the size (in bytes) of the staging buffer for asynchronous texture uploads. By default 64 MB.
+    \remarks Uploads which are larger than this size are written synchronously.
+    \see RenderSystem::WriteTextureAsync
+    */
+    size_t              stagingBufferSize   { 64 * 1024 * 1024 };
 };
 
 /**
@@ -153,6 +161,8 @@ struct RendererID
     static const unsigned int Direct3D12    = 0x00000008; //!< ID number for a Direct3D 12 renderer.
     static const unsigned int Vulkan        = 0x00000009; //!< ID number for a Vulkan renderer.
     static const unsigned int Metal         = 0x0000000a; //!< ID number for a Metal renderer.
+    static const unsigned int Null          = 0x0000000b; //!< ID number for the Null renderer, which validates all commands but does not render anything.
+    static const unsigned int Software      = 0x0000000c; //!< ID number for the Software renderer, which rasterizes on the CPU with shader functions instead of compiled shaders.
 
     static const unsigned int Reserved      = 0x000000ff; //!< Highest ID number for reserved future renderers. Value is 0x000000ff.
 };
@@ -277,6 +287,13 @@ struct RenderingCaps
     */
     bool            hasStreamOutputs                = false;
 
+    /**
+    \brief Specifies whether indirect draw commands are supported.
+    \see CommandBuffer::DrawIndirect
+    \see CommandBuffer::DrawIndexedIndirect
+    */
+    bool            hasIndirectDrawing              = false;
+
     //! Specifies maximum number of texture array layers (for 1D-, 2D-, and cube textures).
     unsigned int    maxNumTextureArrayLayers        = 0;
 
@@ -317,6 +334,47 @@ struct RenderingCaps
     Gs::Vector3ui   maxComputeShaderWorkGroupSize;
 };
 
+/**
+\brief Memory statistics structure.
+\remarks The allocation sizes are estimated from the resource descriptors, i.e. the driver may allocate slightly more memory due to alignment and padding.
+\see RenderSystem::QueryMemoryStatistics
+*/
+struct MemoryStatistics
+{
+    //! Number of bytes allocated for all buffers.
+    std::uint64_t   bufferMemory                    = 0;
+
+    //! Number of buffers currently allocated.
+    std::uint64_t   numBuffers                      = 0;
+
+    //! Number of bytes allocated for all textures (including all MIP-map levels).
+    std::uint64_t   textureMemory                   = 0;
+
+    //! Number of textures currently allocated.
+    std::uint64_t   numTextures                     = 0;
+
+    /**
+    \brief Number of bytes allocated internally by all render targets.
+    \remarks This includes depth-stencil buffers and multi-sampled attachments, but not the attached textures (which are already included in 'textureMemory').
+    */
+    std::uint64_t   renderTargetMemory              = 0;
+
+    //! Number of render targets currently allocated.
+    std::uint64_t   numRenderTargets                = 0;
+
+    /**
+    \brief Total amount of dedicated video memory (in bytes) as reported by the driver, or 0 if this information is not available.
+    \remarks For OpenGL, this requires the extension "GL_NVX_gpu_memory_info".
+    */
+    std::uint64_t   totalDeviceMemory               = 0;
+
+    /**
+    \brief Currently available amount of video memory (in bytes) as reported by the driver, or 0 if this information is not available.
+    \remarks For OpenGL, this requires either the extension "GL_NVX_gpu_memory_info" or "GL_ATI_meminfo".
+    */
+    std::uint64_t   availableDeviceMemory           = 0;
+};
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,143 @@
+/*
+ * RenderTargetPool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RENDER_TARGET_POOL_H
+#define LLGL_RENDER_TARGET_POOL_H
+
+
+#include "Export.h"
+#include "RenderSystem.h"
+#include <unordered_map>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Transient render target descriptor structure.
+\remarks Two transient render targets can only be exchanged by the pool, if their descriptors are equal.
+\see RenderTargetPool::Acquire
+*/
+struct TransientRenderTargetDescriptor
+{
+    //! Render target descriptor.
+    RenderTargetDescriptor          renderTarget;
+
+    /**
+    \brief Texture descriptors for all attachments.
+    \remarks Each texture is created with its descriptor and attached to the render target with its first MIP-map level and layer.
+    */
+    std::vector<TextureDescriptor>  attachments;
+
+    //! Specifies whether an internal depth buffer is attached. By default false.
+    bool                            depthBuffer     = false;
+
+    //! Specifies whether an internal stencil buffer is attached. By default false.
+    bool                            stencilBuffer   = false;
+};
+
+/**
+\brief Transient render target structure.
+\see RenderTargetPool::Acquire
+*/
+struct TransientRenderTarget
+{
+    //! Render target object.
+    RenderTarget*           renderTarget    = nullptr;
+
+    //! Texture objects in the same order as the attachments in the descriptor.
+    std::vector<Texture*>   attachments;
+};
+
+/**
+\brief Render target pool utility class, which recycles render targets and their textures from frame to frame.
+\remarks The pool is layered on top of the RenderSystem interface.
+A render target that has been acquired is in use until the end of the current frame (see NextFrame).
+After that, it can be handed out again for an equal descriptor, so intermediate render targets
+(e.g. for a post-processing chain with dynamic resolution) are not recreated every frame.
+Entries which have not been used for a number of frames are released.
+\code
+LLGL::RenderTargetPool pool(*renderer);
+// Each frame:
+auto& blurTarget = pool.Acquire(blurTargetDesc);
+commands->SetRenderTarget(*blurTarget.renderTarget);
+// ...
+pool.NextFrame();
+\endcode
+*/
+class LLGL_EXPORT RenderTargetPool
+{
+
+    public:
+
+        /**
+        \brief Constructs the render target pool.
+        \param[in] renderSystem Specifies the render system which is used to create and release the render targets and textures.
+        \param[in] maxUnusedFrames Specifies the number of frames an entry may remain unused before it is released. By default 3.
+        */
+        RenderTargetPool(RenderSystem& renderSystem, unsigned int maxUnusedFrames = 3);
+
+        //! Releases all render targets and textures of this pool.
+        ~RenderTargetPool();
+
+        RenderTargetPool(const RenderTargetPool&) = delete;
+        RenderTargetPool& operator = (const RenderTargetPool&) = delete;
+
+        /**
+        \brief Returns a render target for the specified descriptor, which has not been acquired in the current frame yet.
+        \remarks If no such render target is available, a new one is created.
+        The returned reference is valid until the render target is released, i.e. at least until the next call to "NextFrame".
+        The content of the attachments is undefined.
+        */
+        const TransientRenderTarget& Acquire(const TransientRenderTargetDescriptor& desc);
+
+        //! Ends the current frame, i.e. all render targets can be acquired again, and releases all entries which are no longer used.
+        void NextFrame();
+
+        //! Releases all render targets and textures of this pool.
+        void Clear();
+
+        //! Returns the number of render targets in the pool.
+        inline std::size_t GetSize() const
+        {
+            return entries_.size();
+        }
+
+    private:
+
+        struct Entry
+        {
+            TransientRenderTargetDescriptor desc;
+            TransientRenderTarget           target;
+            std::uint64_t                   lastFrame   = 0;
+        };
+
+        using EntryPtr = std::unique_ptr<Entry>;
+
+        void CreateEntry(Entry& entry);
+        void ReleaseEntry(Entry& entry);
+
+        RenderSystem&                                       renderSystem_;
+        unsigned int                                        maxUnusedFrames_    = 3;
+        std::uint64_t                                       frame_              = 1;
+        std::unordered_multimap<std::size_t, EntryPtr>      entries_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
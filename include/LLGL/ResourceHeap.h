@@ -0,0 +1,54 @@
+/*
+ * ResourceHeap.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RESOURCE_HEAP_H
+#define LLGL_RESOURCE_HEAP_H
+
+
+#include "Export.h"
+#include "ResourceHeapFlags.h"
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Resource heap interface.
+\remarks A resource heap bundles a set of heterogeneous resource bindings (constant buffers, storage buffers, textures, and samplers),
+which can be bound with a single call to CommandBuffer::SetResourceHeap. This is similar to a descriptor set in Vulkan
+or a descriptor table in Direct3D 12. All resource views are validated once, when the resource heap is created.
+\see RenderSystem::CreateResourceHeap
+\see CommandBuffer::SetResourceHeap
+*/
+class LLGL_EXPORT ResourceHeap
+{
+
+    public:
+
+        ResourceHeap(const ResourceHeap&) = delete;
+        ResourceHeap& operator = (const ResourceHeap&) = delete;
+
+        virtual ~ResourceHeap()
+        {
+        }
+
+    protected:
+
+        ResourceHeap() = default;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,121 @@
+/*
+ * ResourceHeapFlags.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RESOURCE_HEAP_FLAGS_H
+#define LLGL_RESOURCE_HEAP_FLAGS_H
+
+
+#include "Export.h"
+#include "ShaderFlags.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class Buffer;
+class Texture;
+class Sampler;
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Resource type enumeration for the resource views of a resource heap.
+\see ResourceViewDescriptor::type
+*/
+enum class ResourceType
+{
+    ConstantBuffer, //!< Constant buffer resource (also "Uniform Buffer Object"). The buffer must have the type BufferType::Constant.
+    StorageBuffer,  //!< Storage buffer resource (also "Shader Storage Buffer Object"). The buffer must have the type BufferType::Storage.
+    Texture,        //!< Texture resource.
+    Sampler,        //!< Sampler state resource.
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Resource view descriptor structure.
+\remarks Depending on the resource type, exactly one of the members 'buffer', 'texture', or 'sampler' must be non-null.
+\see ResourceHeapDescriptor::resourceViews
+*/
+struct ResourceViewDescriptor
+{
+    ResourceViewDescriptor() = default;
+
+    //! Constructor to initialize a buffer resource view (type is either ResourceType::ConstantBuffer or ResourceType::StorageBuffer).
+    inline ResourceViewDescriptor(ResourceType type, Buffer* buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) :
+        type             { type             },
+        slot             { slot             },
+        shaderStageFlags { shaderStageFlags },
+        buffer           { buffer           }
+    {
+    }
+
+    //! Constructor to initialize a texture resource view.
+    inline ResourceViewDescriptor(Texture* texture, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) :
+        type             { ResourceType::Texture },
+        slot             { slot                  },
+        shaderStageFlags { shaderStageFlags      },
+        texture          { texture               }
+    {
+    }
+
+    //! Constructor to initialize a sampler resource view.
+    inline ResourceViewDescriptor(Sampler* sampler, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) :
+        type             { ResourceType::Sampler },
+        slot             { slot                  },
+        shaderStageFlags { shaderStageFlags      },
+        sampler          { sampler               }
+    {
+    }
+
+    //! Resource type. By default ResourceType::ConstantBuffer.
+    ResourceType    type                = ResourceType::ConstantBuffer;
+
+    //! Binding slot of this resource view. By default 0.
+    unsigned int    slot                = 0;
+
+    /**
+    \brief Specifies the shader stages this resource is bound to. By default ShaderStageFlags::AllStages.
+    \see ShaderStageFlags
+    */
+    long            shaderStageFlags    = ShaderStageFlags::AllStages;
+
+    //! Buffer object for constant- and storage buffer resource views. By default null.
+    Buffer*         buffer              = nullptr;
+
+    //! Texture object for texture resource views. By default null.
+    Texture*        texture             = nullptr;
+
+    //! Sampler state object for sampler resource views. By default null.
+    Sampler*        sampler             = nullptr;
+};
+
+/**
+\brief Resource heap descriptor structure.
+\see RenderSystem::CreateResourceHeap
+*/
+struct ResourceHeapDescriptor
+{
+    /**
+    \brief List of all resource views of the resource heap. This must not be empty.
+    \remarks Two resource views of the same kind (i.e. buffer, texture, or sampler) must not share the same binding slot.
+    */
+    std::vector<ResourceViewDescriptor> resourceViews;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -11,6 +11,7 @@
 
 #include "Export.h"
 #include "StreamOutputFormat.h"
+#include "SoftwareShaderFlags.h"
 #include <string>
 
 
@@ -135,6 +136,13 @@ struct ShaderDescriptor
 
     //! Optional stream output descriptor for a geometry shader (or a vertex shader when used with OpenGL).
     StreamOutput    streamOutput;
+
+    /**
+    \brief Shader functions which are used instead of the shader source code.
+    \note Only supported with: Software.
+    \see SoftwareShaderDescriptor
+    */
+    SoftwareShaderDescriptor software;
 };
 
 
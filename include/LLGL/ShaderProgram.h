@@ -65,29 +65,33 @@ class LLGL_EXPORT ShaderProgram
         //! Returns the information log after the shader linkage.
         virtual std::string QueryInfoLog() = 0;
 
-        //! Returns a list of vertex attributes, which describe all vertex attributes within this shader program.
-        virtual std::vector<VertexAttribute> QueryVertexAttributes() const = 0;
+        /**
+        \brief Returns a list of vertex attributes, which describe all vertex attributes within this shader program.
+        \remarks The reflection data of all query functions is cached by the shader program, so these functions don't allocate any memory.
+        The returned references remain valid until the shader program is linked again or released.
+        */
+        virtual const std::vector<VertexAttribute>& QueryVertexAttributes() const = 0;
 
         //! Returns a list of stream-output attributes, which describes all stream-output attributes within this shader program.
-        virtual std::vector<StreamOutputAttribute> QueryStreamOutputAttributes() const = 0;
+        virtual const std::vector<StreamOutputAttribute>& QueryStreamOutputAttributes() const = 0;
 
         /**
         \brief Returns a list of constant buffer view descriptors, which describe all constant buffers within this shader program.
         \remarks Also called "Uniform Buffer Object".
         */
-        virtual std::vector<ConstantBufferViewDescriptor> QueryConstantBuffers() const = 0;
+        virtual const std::vector<ConstantBufferViewDescriptor>& QueryConstantBuffers() const = 0;
 
         /**
         \brief Returns a list of storage buffer view descriptors, which describe all storage buffers within this shader program.
         \remarks Also called "Shader Storage Buffer Object" or "Read/Write Buffer".
         */
-        virtual std::vector<StorageBufferViewDescriptor> QueryStorageBuffers() const = 0;
+        virtual const std::vector<StorageBufferViewDescriptor>& QueryStorageBuffers() const = 0;
 
         /**
         \brief Returns a list of uniform descriptors, which describe all uniforms within this shader program.
         \remarks Shader uniforms are only supported in OpenGL 2.0+.
         */
-        virtual std::vector<UniformDescriptor> QueryUniforms() const = 0;
+        virtual const std::vector<UniformDescriptor>& QueryUniforms() const = 0;
 
         /**
         \brief Builds the input layout with the specified vertex format for this shader program.
@@ -0,0 +1,152 @@
+/*
+ * SoftwareShaderFlags.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SOFTWARE_SHADER_FLAGS_H
+#define LLGL_SOFTWARE_SHADER_FLAGS_H
+
+
+namespace LLGL
+{
+
+
+/* ----- Constants ----- */
+
+//! Maximal number of varyings (scalar components) which are interpolated between a software vertex shader and a software fragment shader.
+static const unsigned int maxSoftwareVaryings           = 16;
+
+//! Maximal number of vertex buffers which can be bound for the software renderer.
+static const unsigned int maxSoftwareVertexBuffers      = 8;
+
+//! Maximal number of constant buffer slots for the software renderer.
+static const unsigned int maxSoftwareConstantBuffers    = 16;
+
+//! Maximal number of color attachments a software fragment shader can write to.
+static const unsigned int maxSoftwareColorTargets       = 8;
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Input structure for a software vertex shader.
+\see SoftwareVertexFunction
+*/
+struct SoftwareVertexInput
+{
+    /**
+    \brief Pointers to the current vertex in each bound vertex buffer.
+    \remarks For vertex buffers with per-instance data, this points to the current instance instead.
+    The layout of each vertex is determined by the vertex format of the respective vertex buffer.
+    */
+    const void* const*  vertices;
+
+    //! Number of bound vertex buffers, i.e. number of entries in 'vertices'.
+    unsigned int        numVertexBuffers;
+
+    //! Zero-based vertex index (including the first vertex or vertex offset of the draw command).
+    unsigned int        vertexID;
+
+    //! Zero-based instance index (excluding the instance offset of the draw command).
+    unsigned int        instanceID;
+
+    /**
+    \brief Pointers to the data of the bound constant buffers, indexed by their binding slot.
+    \remarks Unbound slots are null. The array has 'maxSoftwareConstantBuffers' entries.
+    */
+    const void* const*  constantBuffers;
+
+    //! User data pointer. \see SoftwareShaderDescriptor::userData
+    void*               userData;
+};
+
+/**
+\brief Output structure for a software vertex shader.
+\see SoftwareVertexFunction
+*/
+struct SoftwareVertexOutput
+{
+    //! Vertex position in homogeneous clip space, i.e. X and Y in [-W, W] and Z in [0, W].
+    float position[4];
+
+    //! Varyings which are perspective-correctly interpolated for the fragment shader. \see SoftwareShaderDescriptor::numVaryings
+    float varyings[maxSoftwareVaryings];
+};
+
+/**
+\brief Input structure for a software fragment shader.
+\see SoftwareFragmentFunction
+*/
+struct SoftwareFragmentInput
+{
+    //! Fragment coordinate: X and Y in window space (pixel center), Z is the window depth, and W is the reciprocal of the clip space W.
+    float               fragCoord[4];
+
+    //! Interpolated varyings of the vertex shader.
+    const float*        varyings;
+
+    //! Specifies whether the fragment belongs to a front facing primitive.
+    bool                frontFacing;
+
+    //! Pointers to the data of the bound constant buffers. \see SoftwareVertexInput::constantBuffers
+    const void* const*  constantBuffers;
+
+    //! User data pointer. \see SoftwareShaderDescriptor::userData
+    void*               userData;
+};
+
+/**
+\brief Output structure for a software fragment shader.
+\see SoftwareFragmentFunction
+*/
+struct SoftwareFragmentOutput
+{
+    //! Output colors (RGBA) for each color attachment of the bound render target.
+    float colors[maxSoftwareColorTargets][4];
+};
+
+/**
+\brief Software vertex shader function type.
+\remarks This function is called concurrently from multiple threads, so it must not modify shared data without synchronization.
+*/
+using SoftwareVertexFunction = void (*)(const SoftwareVertexInput& input, SoftwareVertexOutput& output);
+
+/**
+\brief Software fragment shader function type.
+\return True if the fragment is to be written, or false if the fragment is to be discarded.
+\remarks This function is called concurrently from multiple threads, so it must not modify shared data without synchronization.
+*/
+using SoftwareFragmentFunction = bool (*)(const SoftwareFragmentInput& input, SoftwareFragmentOutput& output);
+
+/**
+\brief Software shader descriptor structure.
+\remarks The software renderer does not compile any shader code. Instead, the shader functions are registered with this descriptor,
+when "Shader::Compile" is called for a vertex or fragment shader (the source code is ignored).
+\see ShaderDescriptor::software
+*/
+struct SoftwareShaderDescriptor
+{
+    //! Vertex shader function. This is required for vertex shaders.
+    SoftwareVertexFunction      vertexFunction      = nullptr;
+
+    //! Fragment shader function. This is required for fragment shaders.
+    SoftwareFragmentFunction    fragmentFunction    = nullptr;
+
+    //! Number of varyings the vertex shader writes. This must not be greater than 'maxSoftwareVaryings'. By default 0.
+    unsigned int                numVaryings         = 0;
+
+    //! User data pointer which is passed to the shader functions. By default null.
+    void*                       userData            = nullptr;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -12,6 +12,7 @@
 #include "Export.h"
 #include <Gauss/Vector3.h>
 #include <cstddef>
+#include <cstdint>
 
 
 namespace LLGL
@@ -162,6 +163,7 @@ struct LLGL_EXPORT TextureDescriptor
     {
         type                        = TextureType::Texture1D;
         format                      = TextureFormat::RGBA;
+        mipLevels                   = 0;
         texture2DMS.width           = 0;
         texture2DMS.height          = 0;
         texture2DMS.layers          = 0;
@@ -177,6 +179,13 @@ struct LLGL_EXPORT TextureDescriptor
     TextureType                 type;           //!< Texture type. By default TextureType::Texture1D.
     TextureFormat               format;         //!< Texture hardware format. By default TextureFormat::RGBA.
 
+    /**
+    \brief Number of MIP-map levels. If this is 0, the full MIP-map chain is allocated. By default 0.
+    \remarks This is ignored for multi-sampled textures, which always have a single MIP-map level.
+    \see NumMipLevels
+    */
+    unsigned int                mipLevels;
+
     union
     {
         Texture1DDescriptor     texture1D;      //!< Descriptor for 1D- and 1D-Array textures.
@@ -298,6 +307,21 @@ LLGL_EXPORT bool IsArrayTexture(const TextureType type);
 */
 LLGL_EXPORT bool IsMultiSampleTexture(const TextureType type);
 
+/**
+\brief Returns the size (in bits) of a single texel of the specified texture format.
+\remarks For compressed formats, this is the average size per texel (e.g. 4 for TextureFormat::RGB_DXT1).
+Base formats are assumed to have 8 bits per component, and TextureFormat::DepthComponent and TextureFormat::DepthStencil are assumed to have 32 bits.
+*/
+LLGL_EXPORT unsigned int TextureFormatBitSize(const TextureFormat format);
+
+/**
+\brief Returns the estimated memory footprint (in bytes) of a texture with the specified descriptor,
+including all MIP-map levels, array layers (or cube faces), and samples.
+\remarks The actual amount of memory the driver allocates may differ due to alignment and padding.
+\see TextureFormatBitSize
+*/
+LLGL_EXPORT std::uint64_t TextureMemoryFootprint(const TextureDescriptor& desc);
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,179 @@
+/*
+ * BufferHeap.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/BufferHeap.h>
+#include "RangeAllocator.h"
+#include "../Core/Helper.h"
+#include <stdexcept>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+struct BufferHeap::Page
+{
+    Page(unsigned int numVertices, unsigned int numIndices) :
+        vertexRange { numVertices },
+        indexRange  { numIndices  }
+    {
+    }
+
+    Buffer*         vertexBuffer    = nullptr;
+    Buffer*         indexBuffer     = nullptr;
+    RangeAllocator  vertexRange;
+    RangeAllocator  indexRange;
+};
+
+BufferHeap::BufferHeap(RenderSystem& renderSystem, const BufferHeapDescriptor& desc) :
+    renderSystem_ { renderSystem },
+    desc_         { desc         }
+{
+    if (desc_.vertexFormat.stride == 0)
+        throw std::invalid_argument("cannot create buffer heap with vertex format of zero stride");
+    if (desc_.verticesPerPage == 0)
+        throw std::invalid_argument("cannot create buffer heap with zero vertices per page");
+}
+
+BufferHeap::~BufferHeap()
+{
+    Clear();
+}
+
+BufferHeapAllocation BufferHeap::Alloc(unsigned int numVertices, const void* vertices, unsigned int numIndices, const void* indices)
+{
+    if (numVertices == 0)
+        throw std::invalid_argument("cannot allocate mesh with zero vertices from buffer heap");
+    if (numVertices > desc_.verticesPerPage)
+        throw std::invalid_argument("cannot allocate " + std::to_string(numVertices) + " vertices from buffer heap with " + std::to_string(desc_.verticesPerPage) + " vertices per page");
+    if (numIndices > desc_.indicesPerPage)
+        throw std::invalid_argument("cannot allocate " + std::to_string(numIndices) + " indices from buffer heap with " + std::to_string(desc_.indicesPerPage) + " indices per page");
+
+    BufferHeapAllocation allocation;
+    allocation.numVertices  = numVertices;
+    allocation.numIndices   = numIndices;
+
+    /* Find first page with enough free vertices and indices, or create a new page */
+    Page* page = nullptr;
+
+    for (std::size_t i = 0; i < pages_.size() && !page; ++i)
+    {
+        auto& pageRef = *pages_[i];
+
+        auto firstVertex = pageRef.vertexRange.Alloc(numVertices);
+        if (firstVertex == RangeAllocator::invalidOffset)
+            continue;
+
+        auto firstIndex = pageRef.indexRange.Alloc(numIndices);
+        if (numIndices > 0 && firstIndex == RangeAllocator::invalidOffset)
+        {
+            pageRef.vertexRange.Free(firstVertex, numVertices);
+            continue;
+        }
+
+        page                    = &pageRef;
+        allocation.firstVertex  = firstVertex;
+        allocation.firstIndex   = (numIndices > 0 ? firstIndex : 0);
+        allocation.page         = static_cast<unsigned int>(i);
+    }
+
+    if (!page)
+    {
+        pages_.emplace_back(CreatePage());
+        page = pages_.back().get();
+
+        allocation.firstVertex  = page->vertexRange.Alloc(numVertices);
+        allocation.firstIndex   = (numIndices > 0 ? page->indexRange.Alloc(numIndices) : 0);
+        allocation.page         = static_cast<unsigned int>(pages_.size() - 1);
+    }
+
+    allocation.vertexBuffer = page->vertexBuffer;
+    allocation.indexBuffer  = page->indexBuffer;
+
+    /* Write vertex and index data into the sub-allocated ranges */
+    if (vertices)
+    {
+        const std::size_t stride = desc_.vertexFormat.stride;
+        renderSystem_.WriteBuffer(*page->vertexBuffer, vertices, stride * numVertices, stride * allocation.firstVertex);
+    }
+
+    if (indices && numIndices > 0)
+    {
+        const std::size_t indexSize = desc_.indexFormat.GetFormatSize();
+        renderSystem_.WriteBuffer(*page->indexBuffer, indices, indexSize * numIndices, indexSize * allocation.firstIndex);
+    }
+
+    return allocation;
+}
+
+void BufferHeap::Free(const BufferHeapAllocation& allocation)
+{
+    if (allocation.page < pages_.size())
+    {
+        auto& page = *pages_[allocation.page];
+        page.vertexRange.Free(allocation.firstVertex, allocation.numVertices);
+        page.indexRange.Free(allocation.firstIndex, allocation.numIndices);
+    }
+}
+
+void BufferHeap::Clear()
+{
+    for (auto& page : pages_)
+        ReleasePage(*page);
+    pages_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+BufferHeap::PagePtr BufferHeap::CreatePage()
+{
+    auto page = MakeUnique<Page>(desc_.verticesPerPage, desc_.indicesPerPage);
+
+    /* Create vertex buffer for the entire page */
+    BufferDescriptor vertexBufferDesc;
+    {
+        vertexBufferDesc.type                       = BufferType::Vertex;
+        vertexBufferDesc.size                       = static_cast<unsigned int>(desc_.vertexFormat.stride * desc_.verticesPerPage);
+        vertexBufferDesc.flags                      = desc_.flags;
+        vertexBufferDesc.vertexBuffer.format        = desc_.vertexFormat;
+    }
+    page->vertexBuffer = renderSystem_.CreateBuffer(vertexBufferDesc);
+
+    /* Create index buffer for the entire page */
+    if (desc_.indicesPerPage > 0)
+    {
+        BufferDescriptor indexBufferDesc;
+        {
+            indexBufferDesc.type                    = BufferType::Index;
+            indexBufferDesc.size                    = desc_.indexFormat.GetFormatSize() * desc_.indicesPerPage;
+            indexBufferDesc.flags                   = desc_.flags;
+            indexBufferDesc.indexBuffer.format      = desc_.indexFormat;
+        }
+        page->indexBuffer = renderSystem_.CreateBuffer(indexBufferDesc);
+    }
+
+    return page;
+}
+
+void BufferHeap::ReleasePage(Page& page)
+{
+    if (page.vertexBuffer)
+        renderSystem_.Release(*page.vertexBuffer);
+    if (page.indexBuffer)
+        renderSystem_.Release(*page.indexBuffer);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,76 @@
+/*
+ * CPUBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CPUBuffer.h"
+#include <stdexcept>
+#include <string>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+CPUBuffer::CPUBuffer(const BufferDescriptor& desc, const void* initialData) :
+    Buffer { desc.type             },
+    desc_  { desc                  },
+    data_  ( desc.size, char(0)    )
+{
+    if (initialData)
+        std::memcpy(data_.data(), initialData, data_.size());
+}
+
+void CPUBuffer::Write(const void* data, std::size_t dataSize, std::size_t offset)
+{
+    if (offset + dataSize > data_.size())
+    {
+        throw std::out_of_range(
+            "cannot write " + std::to_string(dataSize) + " bytes at offset " + std::to_string(offset) +
+            " into buffer of " + std::to_string(data_.size()) + " bytes"
+        );
+    }
+    if (mapped_)
+        throw std::runtime_error("cannot write into buffer while it is mapped");
+    std::memcpy(data_.data() + offset, data, dataSize);
+}
+
+void* CPUBuffer::Map(const BufferCPUAccess /*access*/)
+{
+    if (mapped_)
+        throw std::runtime_error("cannot map buffer that is already mapped");
+    mapped_ = true;
+    return data_.data();
+}
+
+void CPUBuffer::Unmap()
+{
+    if (!mapped_)
+        throw std::runtime_error("cannot unmap buffer that is not mapped");
+    mapped_ = false;
+}
+
+unsigned int CPUBuffer::GetNumElements() const
+{
+    const auto size = static_cast<unsigned int>(data_.size());
+
+    switch (GetType())
+    {
+        case BufferType::Vertex:
+            return (desc_.vertexBuffer.format.stride > 0 ? size / desc_.vertexBuffer.format.stride : 0);
+        case BufferType::Index:
+            return size / desc_.indexBuffer.format.GetFormatSize();
+        default:
+            return size;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
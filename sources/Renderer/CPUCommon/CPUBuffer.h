@@ -0,0 +1,70 @@
+/*
+ * CPUBuffer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CPU_BUFFER_H
+#define LLGL_CPU_BUFFER_H
+
+
+#include <LLGL/Buffer.h>
+#include <LLGL/BufferFlags.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Buffer whose storage is kept in system memory. Used by the renderers without GPU storage, i.e. the Null and Software renderer.
+class CPUBuffer : public Buffer
+{
+
+    public:
+
+        CPUBuffer(const BufferDescriptor& desc, const void* initialData);
+
+        // Writes the specified data into the buffer storage. Throws std::out_of_range if the range exceeds the buffer size.
+        void Write(const void* data, std::size_t dataSize, std::size_t offset);
+
+        // Maps the buffer storage. Throws std::runtime_error if the buffer is already mapped.
+        void* Map(const BufferCPUAccess access);
+        void Unmap();
+
+        // Returns the number of elements (i.e. vertices or indices) that fit into this buffer, or the size in bytes for other buffer types.
+        unsigned int GetNumElements() const;
+
+        inline const BufferDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+        inline std::size_t GetSize() const
+        {
+            return data_.size();
+        }
+
+        inline const char* GetData() const
+        {
+            return data_.data();
+        }
+
+    private:
+
+        BufferDescriptor    desc_;
+        std::vector<char>   data_;
+        bool                mapped_ = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
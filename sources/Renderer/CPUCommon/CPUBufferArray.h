@@ -0,0 +1,54 @@
+/*
+ * CPUBufferArray.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CPU_BUFFER_ARRAY_H
+#define LLGL_CPU_BUFFER_ARRAY_H
+
+
+#include <LLGL/BufferArray.h>
+#include "CPUBuffer.h"
+#include "../CheckedCast.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class CPUBufferArray : public BufferArray
+{
+
+    public:
+
+        CPUBufferArray(const BufferType type, unsigned int numBuffers, Buffer* const * bufferArray) :
+            BufferArray { type }
+        {
+            buffers_.reserve(numBuffers);
+            for (unsigned int i = 0; i < numBuffers; ++i)
+                buffers_.push_back(LLGL_CAST(CPUBuffer*, bufferArray[i]));
+        }
+
+        inline const std::vector<CPUBuffer*>& GetBuffers() const
+        {
+            return buffers_;
+        }
+
+    private:
+
+        std::vector<CPUBuffer*> buffers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,116 @@
+/*
+ * CPUResourceArrays.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CPU_RESOURCE_ARRAYS_H
+#define LLGL_CPU_RESOURCE_ARRAYS_H
+
+
+#include <LLGL/TextureArray.h>
+#include <LLGL/SamplerArray.h>
+#include <LLGL/Sampler.h>
+#include <LLGL/ResourceHeap.h>
+#include <LLGL/Texture.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class CPUTextureArray : public TextureArray
+{
+
+    public:
+
+        CPUTextureArray(unsigned int numTextures, Texture* const * textureArray) :
+            textures_ { textureArray, textureArray + numTextures }
+        {
+        }
+
+        inline const std::vector<Texture*>& GetTextures() const
+        {
+            return textures_;
+        }
+
+    private:
+
+        std::vector<Texture*> textures_;
+
+};
+
+class CPUSampler : public Sampler
+{
+
+    public:
+
+        CPUSampler(const SamplerDescriptor& desc) :
+            desc_ { desc }
+        {
+        }
+
+        inline const SamplerDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+    private:
+
+        SamplerDescriptor desc_;
+
+};
+
+class CPUSamplerArray : public SamplerArray
+{
+
+    public:
+
+        CPUSamplerArray(unsigned int numSamplers, Sampler* const * samplerArray) :
+            samplers_ { samplerArray, samplerArray + numSamplers }
+        {
+        }
+
+        inline const std::vector<Sampler*>& GetSamplers() const
+        {
+            return samplers_;
+        }
+
+    private:
+
+        std::vector<Sampler*> samplers_;
+
+};
+
+class CPUResourceHeap : public ResourceHeap
+{
+
+    public:
+
+        CPUResourceHeap(const ResourceHeapDescriptor& desc) :
+            resourceViews_ { desc.resourceViews }
+        {
+        }
+
+        inline const std::vector<ResourceViewDescriptor>& GetResourceViews() const
+        {
+            return resourceViews_;
+        }
+
+    private:
+
+        std::vector<ResourceViewDescriptor> resourceViews_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -172,6 +172,7 @@ void DXGetRenderingCaps(RenderingCaps& caps, D3D_FEATURE_LEVEL featureLevel)
     caps.hasViewportArrays              = true;
     caps.hasConservativeRasterization   = (featureLevel >= D3D_FEATURE_LEVEL_11_1);
     caps.hasStreamOutputs               = (featureLevel >= D3D_FEATURE_LEVEL_10_0);
+    caps.hasIndirectDrawing             = (featureLevel >= D3D_FEATURE_LEVEL_11_0);
     caps.maxNumTextureArrayLayers       = (featureLevel >= D3D_FEATURE_LEVEL_10_0 ? 2048 : 256);
     caps.maxNumRenderTargetAttachments  = GetMaxRenderTargets(featureLevel);
     caps.maxConstantBufferSize          = 16384;
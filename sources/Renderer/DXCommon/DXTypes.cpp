@@ -6,6 +6,7 @@
  */
 
 #include "DXTypes.h"
+#include "../MappingTable.h"
 #include <stdexcept>
 #include <string>
 
@@ -17,6 +18,8 @@ namespace DXTypes
 {
 
 
+/* ----- Internal functions ----- */
+
 [[noreturn]]
 void MapFailed(const std::string& typeName, const std::string& dxTypeName)
 {
@@ -29,159 +32,200 @@ void UnmapFailed(const std::string& typeName, const std::string& dxTypeName)
     throw std::invalid_argument("failed to unmap '" + typeName + "' from '" + dxTypeName + "' parameter");
 }
 
-DXGI_FORMAT Map(const VectorType vectorType)
-{
-    switch (vectorType)
-    {
-        case VectorType::Float:     return DXGI_FORMAT_R32_FLOAT;
-        case VectorType::Float2:    return DXGI_FORMAT_R32G32_FLOAT;
-        case VectorType::Float3:    return DXGI_FORMAT_R32G32B32_FLOAT;
-        case VectorType::Float4:    return DXGI_FORMAT_R32G32B32A32_FLOAT;
-        case VectorType::Int:       return DXGI_FORMAT_R32_SINT;
-        case VectorType::Int2:      return DXGI_FORMAT_R32G32_SINT;
-        case VectorType::Int3:      return DXGI_FORMAT_R32G32B32_SINT;
-        case VectorType::Int4:      return DXGI_FORMAT_R32G32B32A32_SINT;
-        case VectorType::UInt:      return DXGI_FORMAT_R32_UINT;
-        case VectorType::UInt2:     return DXGI_FORMAT_R32G32_UINT;
-        case VectorType::UInt3:     return DXGI_FORMAT_R32G32B32_UINT;
-        case VectorType::UInt4:     return DXGI_FORMAT_R32G32B32A32_UINT;
-    }
-    MapFailed("VectorType", "DXGI_FORMAT");
-}
+/* ----- Mapping tables ----- */
 
-DXGI_FORMAT Map(const DataType dataType)
-{
-    switch (dataType)
-    {
-        case DataType::Int8:    return DXGI_FORMAT_R8_SINT;
-        case DataType::UInt8:   return DXGI_FORMAT_R8_UINT;
-        case DataType::Int16:   return DXGI_FORMAT_R16_SINT;
-        case DataType::UInt16:  return DXGI_FORMAT_R16_UINT;
-        case DataType::Int32:   return DXGI_FORMAT_R32_SINT;
-        case DataType::UInt32:  return DXGI_FORMAT_R32_UINT;
-        case DataType::Float:   return DXGI_FORMAT_R32_FLOAT;
-        case DataType::Double:  break;
-    }
-    MapFailed("DataType", "DXGI_FORMAT");
-}
+/*
+Unmapped entries use DXGI_FORMAT_UNKNOWN and D3D_PRIMITIVE_TOPOLOGY_UNDEFINED respectively,
+since neither of them is a valid result of the map functions.
+*/
 
-DXGI_FORMAT Map(const TextureFormat textureFormat)
+static constexpr MappingEntry<VectorType, DXGI_FORMAT> g_vectorTypeMap[] =
 {
-    switch (textureFormat)
-    {
-        /* --- Base internal formats --- */
-        case TextureFormat::DepthComponent: return DXGI_FORMAT_D32_FLOAT;
-        case TextureFormat::DepthStencil:   return DXGI_FORMAT_D24_UNORM_S8_UINT;
-        case TextureFormat::R:              return DXGI_FORMAT_R8_UNORM;
-        case TextureFormat::RG:             return DXGI_FORMAT_R8G8_UNORM;
-        case TextureFormat::RGB:            break;
-        case TextureFormat::RGBA:           return DXGI_FORMAT_R8G8B8A8_UNORM;
+    { VectorType::Float,    DXGI_FORMAT_R32_FLOAT           },
+    { VectorType::Float2,   DXGI_FORMAT_R32G32_FLOAT        },
+    { VectorType::Float3,   DXGI_FORMAT_R32G32B32_FLOAT     },
+    { VectorType::Float4,   DXGI_FORMAT_R32G32B32A32_FLOAT  },
+    { VectorType::Double,   DXGI_FORMAT_UNKNOWN             },
+    { VectorType::Double2,  DXGI_FORMAT_UNKNOWN             },
+    { VectorType::Double3,  DXGI_FORMAT_UNKNOWN             },
+    { VectorType::Double4,  DXGI_FORMAT_UNKNOWN             },
+    { VectorType::Int,      DXGI_FORMAT_R32_SINT            },
+    { VectorType::Int2,     DXGI_FORMAT_R32G32_SINT         },
+    { VectorType::Int3,     DXGI_FORMAT_R32G32B32_SINT      },
+    { VectorType::Int4,     DXGI_FORMAT_R32G32B32A32_SINT   },
+    { VectorType::UInt,     DXGI_FORMAT_R32_UINT            },
+    { VectorType::UInt2,    DXGI_FORMAT_R32G32_UINT         },
+    { VectorType::UInt3,    DXGI_FORMAT_R32G32B32_UINT      },
+    { VectorType::UInt4,    DXGI_FORMAT_R32G32B32A32_UINT   },
+};
+
+static constexpr MappingEntry<DataType, DXGI_FORMAT> g_dataTypeMap[] =
+{
+    { DataType::Int8,   DXGI_FORMAT_R8_SINT     },
+    { DataType::UInt8,  DXGI_FORMAT_R8_UINT     },
+    { DataType::Int16,  DXGI_FORMAT_R16_SINT    },
+    { DataType::UInt16, DXGI_FORMAT_R16_UINT    },
+    { DataType::Int32,  DXGI_FORMAT_R32_SINT    },
+    { DataType::UInt32, DXGI_FORMAT_R32_UINT    },
+    { DataType::Float,  DXGI_FORMAT_R32_FLOAT   },
+    { DataType::Double, DXGI_FORMAT_UNKNOWN     },
+};
+
+static constexpr MappingEntry<TextureFormat, DXGI_FORMAT> g_textureFormatMap[] =
+{
+    { TextureFormat::Unknown,           DXGI_FORMAT_UNKNOWN                 },
 
-        /* --- Sized internal formats --- */
-        case TextureFormat::R8:             return DXGI_FORMAT_R8_UNORM;
-        case TextureFormat::R8Sgn:          return DXGI_FORMAT_R8_SNORM;
+    /* --- Base internal formats --- */
+    { TextureFormat::DepthComponent,    DXGI_FORMAT_D32_FLOAT               },
+    { TextureFormat::DepthStencil,      DXGI_FORMAT_D24_UNORM_S8_UINT       },
+    { TextureFormat::R,                 DXGI_FORMAT_R8_UNORM                },
+    { TextureFormat::RG,                DXGI_FORMAT_R8G8_UNORM              },
+    { TextureFormat::RGB,               DXGI_FORMAT_UNKNOWN                 },
+    { TextureFormat::RGBA,              DXGI_FORMAT_R8G8B8A8_UNORM          },
 
-        case TextureFormat::R16:            return DXGI_FORMAT_R16_UNORM;
-        case TextureFormat::R16Sgn:         return DXGI_FORMAT_R16_SNORM;
-        case TextureFormat::R16Float:       return DXGI_FORMAT_R16_FLOAT;
+    /* --- Sized internal formats --- */
+    { TextureFormat::R8,                DXGI_FORMAT_R8_UNORM                },
+    { TextureFormat::R8Sgn,             DXGI_FORMAT_R8_SNORM                },
 
-        case TextureFormat::R32UInt:        return DXGI_FORMAT_R32_UINT;
-        case TextureFormat::R32SInt:        return DXGI_FORMAT_R32_SINT;
-        case TextureFormat::R32Float:       return DXGI_FORMAT_R32_FLOAT;
+    { TextureFormat::R16,               DXGI_FORMAT_R16_UNORM               },
+    { TextureFormat::R16Sgn,            DXGI_FORMAT_R16_SNORM               },
+    { TextureFormat::R16Float,          DXGI_FORMAT_R16_FLOAT               },
 
-        case TextureFormat::RG8:            return DXGI_FORMAT_R8G8_UNORM;
-        case TextureFormat::RG8Sgn:         return DXGI_FORMAT_R8G8_SNORM;
+    { TextureFormat::R32UInt,           DXGI_FORMAT_R32_UINT                },
+    { TextureFormat::R32SInt,           DXGI_FORMAT_R32_SINT                },
+    { TextureFormat::R32Float,          DXGI_FORMAT_R32_FLOAT               },
 
-        case TextureFormat::RG16:           return DXGI_FORMAT_R16G16_UNORM;
-        case TextureFormat::RG16Sgn:        return DXGI_FORMAT_R16G16_SNORM;
-        case TextureFormat::RG16Float:      return DXGI_FORMAT_R16G16_FLOAT;
+    { TextureFormat::RG8,               DXGI_FORMAT_R8G8_UNORM              },
+    { TextureFormat::RG8Sgn,            DXGI_FORMAT_R8G8_SNORM              },
 
-        case TextureFormat::RG32UInt:       return DXGI_FORMAT_R32G32_UINT;
-        case TextureFormat::RG32SInt:       return DXGI_FORMAT_R32G32_SINT;
-        case TextureFormat::RG32Float:      return DXGI_FORMAT_R32G32_FLOAT;
+    { TextureFormat::RG16,              DXGI_FORMAT_R16G16_UNORM            },
+    { TextureFormat::RG16Sgn,           DXGI_FORMAT_R16G16_SNORM            },
+    { TextureFormat::RG16Float,         DXGI_FORMAT_R16G16_FLOAT            },
 
-        case TextureFormat::RGB8:           break;
-        case TextureFormat::RGB8Sgn:        break;
+    { TextureFormat::RG32UInt,          DXGI_FORMAT_R32G32_UINT             },
+    { TextureFormat::RG32SInt,          DXGI_FORMAT_R32G32_SINT             },
+    { TextureFormat::RG32Float,         DXGI_FORMAT_R32G32_FLOAT            },
 
-        case TextureFormat::RGB16:          break;
-        case TextureFormat::RGB16Sgn:       break;
-        case TextureFormat::RGB16Float:     break;
+    { TextureFormat::RGB8,              DXGI_FORMAT_UNKNOWN                 },
+    { TextureFormat::RGB8Sgn,           DXGI_FORMAT_UNKNOWN                 },
 
-        case TextureFormat::RGB32UInt:      return DXGI_FORMAT_R32G32B32_UINT;
-        case TextureFormat::RGB32SInt:      return DXGI_FORMAT_R32G32B32_SINT;
-        case TextureFormat::RGB32Float:     return DXGI_FORMAT_R32G32B32_FLOAT;
+    { TextureFormat::RGB16,             DXGI_FORMAT_UNKNOWN                 },
+    { TextureFormat::RGB16Sgn,          DXGI_FORMAT_UNKNOWN                 },
+    { TextureFormat::RGB16Float,        DXGI_FORMAT_UNKNOWN                 },
 
-        case TextureFormat::RGBA8:          return DXGI_FORMAT_R8G8B8A8_UNORM;
-        case TextureFormat::RGBA8Sgn:       return DXGI_FORMAT_R8G8B8A8_SNORM;
+    { TextureFormat::RGB32UInt,         DXGI_FORMAT_R32G32B32_UINT          },
+    { TextureFormat::RGB32SInt,         DXGI_FORMAT_R32G32B32_SINT          },
+    { TextureFormat::RGB32Float,        DXGI_FORMAT_R32G32B32_FLOAT         },
 
-        case TextureFormat::RGBA16:         return DXGI_FORMAT_R16G16B16A16_UNORM;
-        case TextureFormat::RGBA16Sgn:      return DXGI_FORMAT_R16G16B16A16_SNORM;
-        case TextureFormat::RGBA16Float:    return DXGI_FORMAT_R16G16B16A16_FLOAT;
+    { TextureFormat::RGBA8,             DXGI_FORMAT_R8G8B8A8_UNORM          },
+    { TextureFormat::RGBA8Sgn,          DXGI_FORMAT_R8G8B8A8_SNORM          },
 
-        case TextureFormat::RGBA32UInt:     return DXGI_FORMAT_R32G32B32A32_UINT;
-        case TextureFormat::RGBA32SInt:     return DXGI_FORMAT_R32G32B32A32_SINT;
-        case TextureFormat::RGBA32Float:    return DXGI_FORMAT_R32G32B32A32_FLOAT;
+    { TextureFormat::RGBA16,            DXGI_FORMAT_R16G16B16A16_UNORM      },
+    { TextureFormat::RGBA16Sgn,         DXGI_FORMAT_R16G16B16A16_SNORM      },
+    { TextureFormat::RGBA16Float,       DXGI_FORMAT_R16G16B16A16_FLOAT      },
 
-        /* --- Compressed formats --- */
-        case TextureFormat::RGB_DXT1:       return DXGI_FORMAT_BC1_UNORM;
-        case TextureFormat::RGBA_DXT1:      return DXGI_FORMAT_BC1_UNORM;
-        case TextureFormat::RGBA_DXT3:      return DXGI_FORMAT_BC2_UNORM;
-        case TextureFormat::RGBA_DXT5:      return DXGI_FORMAT_BC3_UNORM;
-    }
-    MapFailed("TextureFormat", "DXGI_FORMAT");
+    { TextureFormat::RGBA32UInt,        DXGI_FORMAT_R32G32B32A32_UINT       },
+    { TextureFormat::RGBA32SInt,        DXGI_FORMAT_R32G32B32A32_SINT       },
+    { TextureFormat::RGBA32Float,       DXGI_FORMAT_R32G32B32A32_FLOAT      },
+
+    /* --- Compressed formats --- */
+    { TextureFormat::RGB_DXT1,          DXGI_FORMAT_BC1_UNORM               },
+    { TextureFormat::RGBA_DXT1,         DXGI_FORMAT_BC1_UNORM               },
+    { TextureFormat::RGBA_DXT3,         DXGI_FORMAT_BC2_UNORM               },
+    { TextureFormat::RGBA_DXT5,         DXGI_FORMAT_BC3_UNORM               },
+};
+
+static constexpr MappingEntry<PrimitiveTopology, D3D_PRIMITIVE_TOPOLOGY> g_primitiveTopologyMap[] =
+{
+    { PrimitiveTopology::PointList,                 D3D_PRIMITIVE_TOPOLOGY_POINTLIST                   },
+    { PrimitiveTopology::LineList,                  D3D_PRIMITIVE_TOPOLOGY_LINELIST                    },
+    { PrimitiveTopology::LineStrip,                 D3D_PRIMITIVE_TOPOLOGY_LINESTRIP                   },
+    { PrimitiveTopology::LineLoop,                  D3D_PRIMITIVE_TOPOLOGY_UNDEFINED                   },
+    { PrimitiveTopology::LineListAdjacency,         D3D_PRIMITIVE_TOPOLOGY_LINELIST_ADJ                },
+    { PrimitiveTopology::LineStripAdjacency,        D3D_PRIMITIVE_TOPOLOGY_LINESTRIP_ADJ               },
+    { PrimitiveTopology::TriangleList,              D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST                },
+    { PrimitiveTopology::TriangleStrip,             D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP               },
+    { PrimitiveTopology::TriangleFan,               D3D_PRIMITIVE_TOPOLOGY_UNDEFINED                   },
+    { PrimitiveTopology::TriangleListAdjacency,     D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST_ADJ            },
+    { PrimitiveTopology::TriangleStripAdjacency,    D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP_ADJ           },
+    { PrimitiveTopology::Patches1,                  D3D_PRIMITIVE_TOPOLOGY_1_CONTROL_POINT_PATCHLIST   },
+    { PrimitiveTopology::Patches2,                  D3D_PRIMITIVE_TOPOLOGY_2_CONTROL_POINT_PATCHLIST   },
+    { PrimitiveTopology::Patches3,                  D3D_PRIMITIVE_TOPOLOGY_3_CONTROL_POINT_PATCHLIST   },
+    { PrimitiveTopology::Patches4,                  D3D_PRIMITIVE_TOPOLOGY_4_CONTROL_POINT_PATCHLIST   },
+    { PrimitiveTopology::Patches5,                  D3D_PRIMITIVE_TOPOLOGY_5_CONTROL_POINT_PATCHLIST   },
+    { PrimitiveTopology::Patches6,                  D3D_PRIMITIVE_TOPOLOGY_6_CONTROL_POINT_PATCHLIST   },
+    { PrimitiveTopology::Patches7,                  D3D_PRIMITIVE_TOPOLOGY_7_CONTROL_POINT_PATCHLIST   },
+    { PrimitiveTopology::Patches8,                  D3D_PRIMITIVE_TOPOLOGY_8_CONTROL_POINT_PATCHLIST   },
+    { PrimitiveTopology::Patches9,                  D3D_PRIMITIVE_TOPOLOGY_9_CONTROL_POINT_PATCHLIST   },
+    { PrimitiveTopology::Patches10,                 D3D_PRIMITIVE_TOPOLOGY_10_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches11,                 D3D_PRIMITIVE_TOPOLOGY_11_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches12,                 D3D_PRIMITIVE_TOPOLOGY_12_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches13,                 D3D_PRIMITIVE_TOPOLOGY_13_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches14,                 D3D_PRIMITIVE_TOPOLOGY_14_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches15,                 D3D_PRIMITIVE_TOPOLOGY_15_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches16,                 D3D_PRIMITIVE_TOPOLOGY_16_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches17,                 D3D_PRIMITIVE_TOPOLOGY_17_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches18,                 D3D_PRIMITIVE_TOPOLOGY_18_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches19,                 D3D_PRIMITIVE_TOPOLOGY_19_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches20,                 D3D_PRIMITIVE_TOPOLOGY_20_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches21,                 D3D_PRIMITIVE_TOPOLOGY_21_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches22,                 D3D_PRIMITIVE_TOPOLOGY_22_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches23,                 D3D_PRIMITIVE_TOPOLOGY_23_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches24,                 D3D_PRIMITIVE_TOPOLOGY_24_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches25,                 D3D_PRIMITIVE_TOPOLOGY_25_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches26,                 D3D_PRIMITIVE_TOPOLOGY_26_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches27,                 D3D_PRIMITIVE_TOPOLOGY_27_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches28,                 D3D_PRIMITIVE_TOPOLOGY_28_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches29,                 D3D_PRIMITIVE_TOPOLOGY_29_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches30,                 D3D_PRIMITIVE_TOPOLOGY_30_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches31,                 D3D_PRIMITIVE_TOPOLOGY_31_CONTROL_POINT_PATCHLIST  },
+    { PrimitiveTopology::Patches32,                 D3D_PRIMITIVE_TOPOLOGY_32_CONTROL_POINT_PATCHLIST  },
+};
+
+// Verify at compile time that each table has one entry for every enumeration entry, in the order of their underlying values
+static_assert(IsMappingTableComplete(g_vectorTypeMap,           VectorType::UInt4           ), "incomplete mapping table for LLGL::VectorType"          );
+static_assert(IsMappingTableComplete(g_dataTypeMap,             DataType::Double            ), "incomplete mapping table for LLGL::DataType"            );
+static_assert(IsMappingTableComplete(g_textureFormatMap,        TextureFormat::RGBA_DXT5    ), "incomplete mapping table for LLGL::TextureFormat"       );
+static_assert(IsMappingTableComplete(g_primitiveTopologyMap,    PrimitiveTopology::Patches32), "incomplete mapping table for LLGL::PrimitiveTopology"   );
+
+
+/* ----- Map functions ----- */
+
+DXGI_FORMAT Map(const VectorType vectorType)
+{
+    const auto format = LookupMappingTable(g_vectorTypeMap, vectorType, DXGI_FORMAT_UNKNOWN);
+    if (format == DXGI_FORMAT_UNKNOWN)
+        MapFailed("VectorType", "DXGI_FORMAT");
+    return format;
+}
+
+DXGI_FORMAT Map(const DataType dataType)
+{
+    const auto format = LookupMappingTable(g_dataTypeMap, dataType, DXGI_FORMAT_UNKNOWN);
+    if (format == DXGI_FORMAT_UNKNOWN)
+        MapFailed("DataType", "DXGI_FORMAT");
+    return format;
+}
+
+DXGI_FORMAT Map(const TextureFormat textureFormat)
+{
+    const auto format = LookupMappingTable(g_textureFormatMap, textureFormat, DXGI_FORMAT_UNKNOWN);
+    if (format == DXGI_FORMAT_UNKNOWN)
+        MapFailed("TextureFormat", "DXGI_FORMAT");
+    return format;
 }
 
 D3D_PRIMITIVE_TOPOLOGY Map(const PrimitiveTopology topology)
 {
-    switch (topology)
-    {
-        case PrimitiveTopology::PointList:              return D3D_PRIMITIVE_TOPOLOGY_POINTLIST;
-        case PrimitiveTopology::LineList:               return D3D_PRIMITIVE_TOPOLOGY_LINELIST;
-        case PrimitiveTopology::LineStrip:              return D3D_PRIMITIVE_TOPOLOGY_LINESTRIP;
-        case PrimitiveTopology::LineLoop:               break;
-        case PrimitiveTopology::LineListAdjacency:      return D3D_PRIMITIVE_TOPOLOGY_LINELIST_ADJ;
-        case PrimitiveTopology::LineStripAdjacency:     return D3D_PRIMITIVE_TOPOLOGY_LINESTRIP_ADJ;
-        case PrimitiveTopology::TriangleList:           return D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
-        case PrimitiveTopology::TriangleStrip:          return D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
-        case PrimitiveTopology::TriangleFan:            break;
-        case PrimitiveTopology::TriangleListAdjacency:  return D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST_ADJ;
-        case PrimitiveTopology::TriangleStripAdjacency: return D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP_ADJ;
-        case PrimitiveTopology::Patches1:               return D3D_PRIMITIVE_TOPOLOGY_1_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches2:               return D3D_PRIMITIVE_TOPOLOGY_2_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches3:               return D3D_PRIMITIVE_TOPOLOGY_3_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches4:               return D3D_PRIMITIVE_TOPOLOGY_4_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches5:               return D3D_PRIMITIVE_TOPOLOGY_5_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches6:               return D3D_PRIMITIVE_TOPOLOGY_6_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches7:               return D3D_PRIMITIVE_TOPOLOGY_7_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches8:               return D3D_PRIMITIVE_TOPOLOGY_8_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches9:               return D3D_PRIMITIVE_TOPOLOGY_9_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches10:              return D3D_PRIMITIVE_TOPOLOGY_10_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches11:              return D3D_PRIMITIVE_TOPOLOGY_11_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches12:              return D3D_PRIMITIVE_TOPOLOGY_12_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches13:              return D3D_PRIMITIVE_TOPOLOGY_13_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches14:              return D3D_PRIMITIVE_TOPOLOGY_14_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches15:              return D3D_PRIMITIVE_TOPOLOGY_15_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches16:              return D3D_PRIMITIVE_TOPOLOGY_16_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches17:              return D3D_PRIMITIVE_TOPOLOGY_17_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches18:              return D3D_PRIMITIVE_TOPOLOGY_18_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches19:              return D3D_PRIMITIVE_TOPOLOGY_19_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches20:              return D3D_PRIMITIVE_TOPOLOGY_20_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches21:              return D3D_PRIMITIVE_TOPOLOGY_21_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches22:              return D3D_PRIMITIVE_TOPOLOGY_22_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches23:              return D3D_PRIMITIVE_TOPOLOGY_23_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches24:              return D3D_PRIMITIVE_TOPOLOGY_24_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches25:              return D3D_PRIMITIVE_TOPOLOGY_25_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches26:              return D3D_PRIMITIVE_TOPOLOGY_26_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches27:              return D3D_PRIMITIVE_TOPOLOGY_27_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches28:              return D3D_PRIMITIVE_TOPOLOGY_28_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches29:              return D3D_PRIMITIVE_TOPOLOGY_29_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches30:              return D3D_PRIMITIVE_TOPOLOGY_30_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches31:              return D3D_PRIMITIVE_TOPOLOGY_31_CONTROL_POINT_PATCHLIST;
-        case PrimitiveTopology::Patches32:              return D3D_PRIMITIVE_TOPOLOGY_32_CONTROL_POINT_PATCHLIST;
-    }
-    MapFailed("PrimitiveTopology", "D3D_PRIMITIVE_TOPOLOGY");
+    const auto primitiveTopology = LookupMappingTable(g_primitiveTopologyMap, topology, D3D_PRIMITIVE_TOPOLOGY_UNDEFINED);
+    if (primitiveTopology == D3D_PRIMITIVE_TOPOLOGY_UNDEFINED)
+        MapFailed("PrimitiveTopology", "D3D_PRIMITIVE_TOPOLOGY");
+    return primitiveTopology;
 }
 
+
+/* ----- Unmap functions ----- */
+
 TextureFormat Unmap(const DXGI_FORMAT format)
 {
     switch (format)
@@ -321,22 +321,36 @@ void DbgCommandBuffer::SetSamplerArray(SamplerArray& samplerArray, unsigned int
     LLGL_DBG_PROFILER_DO(setSampler.Inc());
 }
 
+/* ----- Resource Heaps ----- */
+
+void DbgCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap)
+{
+    instance.SetResourceHeap(resourceHeap);
+}
+
 /* ----- Render Targets ----- */
 
-void DbgCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
+void DbgCommandBuffer::SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc)
 {
     auto& renderTargetDbg = LLGL_CAST(DbgRenderTarget&, renderTarget);
     
-    instance.SetRenderTarget(renderTargetDbg.instance);
+    instance.SetRenderTarget(renderTargetDbg.instance, renderPassDesc);
     
     LLGL_DBG_PROFILER_DO(setRenderTarget.Inc());
 }
 
-void DbgCommandBuffer::SetRenderTarget(RenderContext& renderContext)
+void DbgCommandBuffer::SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc)
 {
     auto& renderContextDbg = LLGL_CAST(DbgRenderContext&, renderContext);
     
-    instance.SetRenderTarget(renderContextDbg.instance);
+    if (debugger_ && renderPassDesc)
+    {
+        LLGL_DBG_SOURCE;
+        if (renderPassDesc->colorAttachments.size() > 1)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "render pass specifies more than one color attachment for a render context");
+    }
+
+    instance.SetRenderTarget(renderContextDbg.instance, renderPassDesc);
     
     LLGL_DBG_PROFILER_DO(setRenderTarget.Inc());
 }
@@ -536,6 +550,84 @@ void DbgCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned i
     LLGL_DBG_PROFILER_DO(RecordDrawCall(topology_, numVertices, numInstances));
 }
 
+void DbgCommandBuffer::DrawIndirect(Buffer& buffer, unsigned int offset)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugIndirectDrawing();
+        DebugGraphicsPipelineSet();
+        DebugVertexBufferSet();
+        DebugVertexLayout();
+        DebugIndirectArguments(bufferDbg, offset, 1, 0, sizeof(DrawIndirectArguments));
+    }
+
+    instance.DrawIndirect(bufferDbg.instance, offset);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc());
+}
+
+void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, unsigned int offset)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugIndirectDrawing();
+        DebugGraphicsPipelineSet();
+        DebugVertexBufferSet();
+        DebugIndexBufferSet();
+        DebugVertexLayout();
+        DebugIndirectArguments(bufferDbg, offset, 1, 0, sizeof(DrawIndexedIndirectArguments));
+    }
+
+    instance.DrawIndexedIndirect(bufferDbg.instance, offset);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc());
+}
+
+void DbgCommandBuffer::MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugIndirectDrawing();
+        DebugGraphicsPipelineSet();
+        DebugVertexBufferSet();
+        DebugVertexLayout();
+        DebugIndirectArguments(bufferDbg, offset, numCommands, stride, sizeof(DrawIndirectArguments));
+    }
+
+    instance.MultiDrawIndirect(bufferDbg.instance, offset, numCommands, stride);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc(numCommands));
+}
+
+void DbgCommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugIndirectDrawing();
+        DebugGraphicsPipelineSet();
+        DebugVertexBufferSet();
+        DebugIndexBufferSet();
+        DebugVertexLayout();
+        DebugIndirectArguments(bufferDbg, offset, numCommands, stride, sizeof(DrawIndexedIndirectArguments));
+    }
+
+    instance.MultiDrawIndexedIndirect(bufferDbg.instance, offset, numCommands, stride);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc(numCommands));
+}
+
 /* ----- Compute ----- */
 
 void DbgCommandBuffer::DebugThreadGroupLimit(unsigned int size, unsigned int limit)
@@ -559,6 +651,7 @@ void DbgCommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY
         if (groupSizeX * groupSizeY * groupSizeZ == 0)
             LLGL_DBG_WARN(WarningType::PointlessOperation, "thread group size has volume of 0 units");
 
+        DebugComputeShaders();
         DebugComputePipelineSet();
         DebugThreadGroupLimit(groupSizeX, caps_.maxNumComputeShaderWorkGroups.x);
         DebugThreadGroupLimit(groupSizeY, caps_.maxNumComputeShaderWorkGroups.y);
@@ -570,8 +663,30 @@ void DbgCommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY
     LLGL_DBG_PROFILER_DO(dispatchComputeCalls.Inc());
 }
 
+void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, unsigned int offset)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugComputeShaders();
+        DebugComputePipelineSet();
+        DebugIndirectArguments(bufferDbg, offset, 1, 0, sizeof(DispatchIndirectArguments));
+    }
+
+    instance.DispatchIndirect(bufferDbg.instance, offset);
+
+    LLGL_DBG_PROFILER_DO(dispatchComputeCalls.Inc());
+}
+
 /* ----- Misc ----- */
 
+void DbgCommandBuffer::SignalFence(Fence& fence)
+{
+    instance.SignalFence(fence);
+}
+
 void DbgCommandBuffer::SyncGPU()
 {
     instance.SyncGPU();
@@ -738,6 +853,61 @@ void DbgCommandBuffer::DebugInstancing()
         LLGL_DBG_ERROR_NOT_SUPPORTED("instancing");
 }
 
+void DbgCommandBuffer::DebugIndirectDrawing()
+{
+    if (!caps_.hasIndirectDrawing)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing");
+}
+
+void DbgCommandBuffer::DebugComputeShaders()
+{
+    if (!caps_.hasComputeShaders)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("compute shaders");
+}
+
+void DbgCommandBuffer::DebugIndirectArguments(
+    const DbgBuffer& bufferDbg, unsigned int offset, unsigned int numCommands, unsigned int stride, unsigned int argumentsSize)
+{
+    DebugBufferType(bufferDbg.GetType(), BufferType::Indirect);
+
+    if (!bufferDbg.initialized)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "uninitialized indirect argument buffer is used");
+
+    if (offset % 4 != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "indirect argument buffer offset must be a multiple of 4");
+
+    if (numCommands == 0)
+        LLGL_DBG_WARN(WarningType::PointlessOperation, "no indirect commands will be generated");
+    else if (numCommands > 1)
+    {
+        if (stride < argumentsSize)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "indirect argument stride is too small (" + std::to_string(stride) +
+                " specified but minimum is " + std::to_string(argumentsSize) + ")"
+            );
+        }
+        if (stride % 4 != 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "indirect argument stride must be a multiple of 4");
+    }
+
+    /* Check if all arguments lie inside the buffer */
+    if (numCommands > 0)
+    {
+        auto requiredSize = static_cast<std::uint64_t>(offset) + static_cast<std::uint64_t>(numCommands - 1) * stride + argumentsSize;
+        auto bufferSize = static_cast<std::uint64_t>(bufferDbg.desc.size);
+        if (requiredSize > bufferSize)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "indirect argument buffer out of bounds (" + std::to_string(requiredSize) +
+                " bytes required but buffer size is " + std::to_string(bufferSize) + ")"
+            );
+        }
+    }
+}
+
 void DbgCommandBuffer::DebugVertexLimit(unsigned int vertexCount, unsigned int vertexLimit)
 {
     if (vertexCount > vertexLimit)
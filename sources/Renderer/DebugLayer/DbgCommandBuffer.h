@@ -82,10 +82,14 @@ class DbgCommandBuffer : public CommandBuffer
         void SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetSamplerArray(SamplerArray& samplerArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
 
+        /* ----- Resource Heaps ----- */
+
+        void SetResourceHeap(ResourceHeap& resourceHeap) override;
+
         /* ----- Render Targets ----- */
 
-        void SetRenderTarget(RenderTarget& renderTarget) override;
-        void SetRenderTarget(RenderContext& renderContext) override;
+        void SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc = nullptr) override;
+        void SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc = nullptr) override;
 
         /* ----- Pipeline States ----- */
 
@@ -116,12 +120,21 @@ class DbgCommandBuffer : public CommandBuffer
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset) override;
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) override;
 
+        void DrawIndirect(Buffer& buffer, unsigned int offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, unsigned int offset) override;
+
+        void MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+        void MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, unsigned int offset) override;
 
         /* ----- Misc ----- */
 
+        void SignalFence(Fence& fence) override;
+
         void SyncGPU() override;
 
         /* ----- Debugging members ----- */
@@ -143,6 +156,9 @@ class DbgCommandBuffer : public CommandBuffer
         void DebugDrawIndexed(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset);
 
         void DebugInstancing();
+        void DebugIndirectDrawing();
+        void DebugComputeShaders();
+        void DebugIndirectArguments(const DbgBuffer& bufferDbg, unsigned int offset, unsigned int numCommands, unsigned int stride, unsigned int argumentsSize);
         void DebugVertexLimit(unsigned int vertexCount, unsigned int vertexLimit);
         void DebugThreadGroupLimit(unsigned int size, unsigned int limit);
 
@@ -42,6 +42,11 @@ void DbgRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
     instance_->SetConfiguration(config);
 }
 
+MemoryStatistics DbgRenderSystem::QueryMemoryStatistics()
+{
+    return instance_->QueryMemoryStatistics();
+}
+
 /* ----- Render Context ----- */
 
 RenderContext* DbgRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
@@ -252,6 +257,24 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor&
     instance_->WriteTexture(textureDbg.instance, subTextureDesc, imageDesc);
 }
 
+std::uint64_t DbgRenderSystem::WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugMipLevelLimit(subTextureDesc.mipLevel, textureDbg.mipLevels);
+    }
+    
+    return instance_->WriteTextureAsync(textureDbg.instance, subTextureDesc, imageDesc);
+}
+
+bool DbgRenderSystem::IsTextureUploadComplete(std::uint64_t ticket)
+{
+    return instance_->IsTextureUploadComplete(ticket);
+}
+
 void DbgRenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer)
 {
     auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
@@ -265,6 +288,29 @@ void DbgRenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageFor
     instance_->ReadTexture(textureDbg.instance, mipLevel, imageFormat, dataType, buffer);
 }
 
+std::uint64_t DbgRenderSystem::ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc)
+{
+    auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugMipLevelLimit(desc.mipLevel, textureDbg.mipLevels);
+    }
+
+    return instance_->ReadTextureAsync(textureDbg.instance, desc);
+}
+
+bool DbgRenderSystem::MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize)
+{
+    return instance_->MapTextureReadback(ticket, data, dataSize);
+}
+
+void DbgRenderSystem::UnmapTextureReadback(std::uint64_t ticket)
+{
+    instance_->UnmapTextureReadback(ticket);
+}
+
 void DbgRenderSystem::GenerateMips(Texture& texture)
 {
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
@@ -272,7 +318,10 @@ void DbgRenderSystem::GenerateMips(Texture& texture)
         instance_->GenerateMips(textureDbg.instance);
     }
     const auto& tex3DDesc = textureDbg.desc.texture3D;
-    textureDbg.mipLevels = NumMipLevels(tex3DDesc.width, tex3DDesc.height, tex3DDesc.depth);
+    if (textureDbg.desc.mipLevels > 0)
+        textureDbg.mipLevels = static_cast<int>(textureDbg.desc.mipLevels);
+    else
+        textureDbg.mipLevels = NumMipLevels(tex3DDesc.width, tex3DDesc.height, tex3DDesc.depth);
 }
 
 /* ----- Sampler States ---- */
@@ -301,6 +350,30 @@ void DbgRenderSystem::Release(SamplerArray& samplerArray)
     //RemoveFromUniqueSet(samplerArrays_, &samplerArray);
 }
 
+/* ----- Resource Heaps ----- */
+
+ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    AssertCreateResourceHeap(desc);
+
+    /* Create temporary resource heap descriptor with buffer and texture instances */
+    auto instanceDesc = desc;
+    for (auto& view : instanceDesc.resourceViews)
+    {
+        if (view.buffer)
+            view.buffer = &(LLGL_CAST(DbgBuffer*, view.buffer)->instance);
+        if (view.texture)
+            view.texture = &(LLGL_CAST(DbgTexture*, view.texture)->instance);
+    }
+
+    return instance_->CreateResourceHeap(instanceDesc);
+}
+
+void DbgRenderSystem::Release(ResourceHeap& resourceHeap)
+{
+    instance_->Release(resourceHeap);
+}
+
 /* ----- Render Targets ----- */
 
 RenderTarget* DbgRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
@@ -419,6 +492,23 @@ void DbgRenderSystem::Release(Query& query)
     ReleaseDbg(queries_, query);
 }
 
+/* ----- Fences ----- */
+
+Fence* DbgRenderSystem::CreateFence()
+{
+    return instance_->CreateFence();
+}
+
+void DbgRenderSystem::Release(Fence& fence)
+{
+    instance_->Release(fence);
+}
+
+bool DbgRenderSystem::WaitFence(Fence& fence, std::uint64_t timeout)
+{
+    return instance_->WaitFence(fence, timeout);
+}
+
 
 /*
  * ======= Private: =======
@@ -40,6 +40,8 @@ class DbgRenderSystem : public RenderSystem
 
         void SetConfiguration(const RenderSystemConfiguration& config) override;
 
+        MemoryStatistics QueryMemoryStatistics() override;
+
         /* ----- Render Context ------ */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -77,8 +79,15 @@ class DbgRenderSystem : public RenderSystem
         
         void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
 
+        std::uint64_t WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
+        bool IsTextureUploadComplete(std::uint64_t ticket) override;
+
         void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) override;
 
+        std::uint64_t ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc) override;
+        bool MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize) override;
+        void UnmapTextureReadback(std::uint64_t ticket) override;
+
         void GenerateMips(Texture& texture) override;
 
         /* ----- Sampler States ---- */
@@ -89,6 +98,12 @@ class DbgRenderSystem : public RenderSystem
         void Release(Sampler& sampler) override;
         void Release(SamplerArray& samplerArray) override;
 
+        /* ----- Resource Heaps ----- */
+
+        ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
+
+        void Release(ResourceHeap& resourceHeap) override;
+
         /* ----- Render Targets ----- */
 
         RenderTarget* CreateRenderTarget(const RenderTargetDescriptor& desc) override;
@@ -117,6 +132,14 @@ class DbgRenderSystem : public RenderSystem
 
         void Release(Query& query) override;
 
+        /* ----- Fences ----- */
+
+        Fence* CreateFence() override;
+
+        void Release(Fence& fence) override;
+
+        bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+
     private:
 
         void DebugBufferSize(std::size_t bufferSize, std::size_t dataSize, std::size_t dataOffset);
@@ -64,27 +64,27 @@ std::string DbgShaderProgram::QueryInfoLog()
     return instance.QueryInfoLog();
 }
 
-std::vector<VertexAttribute> DbgShaderProgram::QueryVertexAttributes() const
+const std::vector<VertexAttribute>& DbgShaderProgram::QueryVertexAttributes() const
 {
     return instance.QueryVertexAttributes();
 }
 
-std::vector<StreamOutputAttribute> DbgShaderProgram::QueryStreamOutputAttributes() const
+const std::vector<StreamOutputAttribute>& DbgShaderProgram::QueryStreamOutputAttributes() const
 {
     return instance.QueryStreamOutputAttributes();
 }
 
-std::vector<ConstantBufferViewDescriptor> DbgShaderProgram::QueryConstantBuffers() const
+const std::vector<ConstantBufferViewDescriptor>& DbgShaderProgram::QueryConstantBuffers() const
 {
     return instance.QueryConstantBuffers();
 }
 
-std::vector<StorageBufferViewDescriptor> DbgShaderProgram::QueryStorageBuffers() const
+const std::vector<StorageBufferViewDescriptor>& DbgShaderProgram::QueryStorageBuffers() const
 {
     return instance.QueryStorageBuffers();
 }
 
-std::vector<UniformDescriptor> DbgShaderProgram::QueryUniforms() const
+const std::vector<UniformDescriptor>& DbgShaderProgram::QueryUniforms() const
 {
     return instance.QueryUniforms();
 }
@@ -39,11 +39,11 @@ class DbgShaderProgram : public ShaderProgram
         bool LinkShaders() override;
 
         std::string QueryInfoLog() override;
-        std::vector<VertexAttribute> QueryVertexAttributes() const override;
-        std::vector<StreamOutputAttribute> QueryStreamOutputAttributes() const override;
-        std::vector<ConstantBufferViewDescriptor> QueryConstantBuffers() const override;
-        std::vector<StorageBufferViewDescriptor> QueryStorageBuffers() const override;
-        std::vector<UniformDescriptor> QueryUniforms() const override;
+        const std::vector<VertexAttribute>& QueryVertexAttributes() const override;
+        const std::vector<StreamOutputAttribute>& QueryStreamOutputAttributes() const override;
+        const std::vector<ConstantBufferViewDescriptor>& QueryConstantBuffers() const override;
+        const std::vector<StorageBufferViewDescriptor>& QueryStorageBuffers() const override;
+        const std::vector<UniformDescriptor>& QueryUniforms() const override;
 
         void BuildInputLayout(const VertexFormat& vertexFormat) override;
         void BindConstantBuffer(const std::string& name, unsigned int bindingIndex) override;
@@ -0,0 +1,31 @@
+/*
+ * D3D11IndirectBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "D3D11IndirectBuffer.h"
+
+
+namespace LLGL
+{
+
+
+D3D11IndirectBuffer::D3D11IndirectBuffer(ID3D11Device* device, const BufferDescriptor& desc, const void* initialData) :
+    D3D11Buffer { BufferType::Indirect }
+{
+    CreateResource(
+        device,
+        CD3D11_BUFFER_DESC(desc.size, 0, D3D11_USAGE_DEFAULT, 0, D3D11_RESOURCE_MISC_DRAWINDIRECT_ARGS),
+        initialData,
+        desc.flags
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,36 @@
+/*
+ * D3D11IndirectBuffer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_D3D11_INDIRECT_BUFFER_H
+#define LLGL_D3D11_INDIRECT_BUFFER_H
+
+
+#include "D3D11Buffer.h"
+
+
+namespace LLGL
+{
+
+
+class D3D11IndirectBuffer : public D3D11Buffer
+{
+
+    public:
+
+        D3D11IndirectBuffer(ID3D11Device* device, const BufferDescriptor& desc, const void* initialData = nullptr);
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -17,6 +17,8 @@
 #include "RenderState/D3D11GraphicsPipeline.h"
 #include "RenderState/D3D11ComputePipeline.h"
 #include "RenderState/D3D11Query.h"
+#include "RenderState/D3D11Fence.h"
+#include "RenderState/D3D11ResourceHeap.h"
 
 #include "Buffer/D3D11VertexBuffer.h"
 #include "Buffer/D3D11VertexBufferArray.h"
@@ -296,6 +298,31 @@ void D3D11CommandBuffer::SetSamplerArray(SamplerArray& samplerArray, unsigned in
     );
 }
 
+/* ----- Resource Heaps ----- */
+
+void D3D11CommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap)
+{
+    auto& resourceHeapD3D = LLGL_CAST(D3D11ResourceHeap&, resourceHeap);
+
+    /* Set all precomputed binding ranges to their shader stages */
+    const auto& constantBuffers = resourceHeapD3D.GetConstantBuffers();
+    for (const auto& range : resourceHeapD3D.GetConstantBufferRanges())
+        SetConstantBuffersOnStages(range.startSlot, range.count, &(constantBuffers[range.offset]), range.shaderStageFlags);
+
+    const auto& shaderResourceViews = resourceHeapD3D.GetShaderResourceViews();
+    for (const auto& range : resourceHeapD3D.GetShaderResourceRanges())
+        SetShaderResourcesOnStages(range.startSlot, range.count, &(shaderResourceViews[range.offset]), range.shaderStageFlags);
+
+    const auto& unorderedAccessViews = resourceHeapD3D.GetUnorderedAccessViews();
+    const auto& initialCounts = resourceHeapD3D.GetInitialCounts();
+    for (const auto& range : resourceHeapD3D.GetUnorderedAccessRanges())
+        SetUnorderedAccessViewsOnStages(range.startSlot, range.count, &(unorderedAccessViews[range.offset]), &(initialCounts[range.offset]), range.shaderStageFlags);
+
+    const auto& samplerStates = resourceHeapD3D.GetSamplerStates();
+    for (const auto& range : resourceHeapD3D.GetSamplerRanges())
+        SetSamplersOnStages(range.startSlot, range.count, &(samplerStates[range.offset]), range.shaderStageFlags);
+}
+
 /* ----- Render Targets ----- */
 
 //private
@@ -305,7 +332,31 @@ void D3D11CommandBuffer::ResolveBoundRenderTarget()
         boundRenderTarget_->ResolveSubresources(context_.Get());
 }
 
-void D3D11CommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
+//private
+void D3D11CommandBuffer::ClearRenderPassAttachments(const RenderPassDescriptor& renderPassDesc)
+{
+    /* Clear color attachments */
+    auto numColorOps = std::min(framebufferView_.rtvList.size(), renderPassDesc.colorAttachments.size());
+
+    for (std::size_t i = 0; i < numColorOps; ++i)
+    {
+        if (renderPassDesc.colorAttachments[i].loadOp == AttachmentLoadOp::Clear)
+            context_->ClearRenderTargetView(framebufferView_.rtvList[i], clearState_.color.Ptr());
+    }
+
+    /* Clear depth-stencil attachment */
+    UINT dsvClearFlags = 0;
+
+    if (renderPassDesc.depthAttachment.loadOp == AttachmentLoadOp::Clear)
+        dsvClearFlags |= D3D11_CLEAR_DEPTH;
+    if (renderPassDesc.stencilAttachment.loadOp == AttachmentLoadOp::Clear)
+        dsvClearFlags |= D3D11_CLEAR_STENCIL;
+
+    if (dsvClearFlags && framebufferView_.dsv != nullptr)
+        context_->ClearDepthStencilView(framebufferView_.dsv, dsvClearFlags, clearState_.depth, clearState_.stencil);
+}
+
+void D3D11CommandBuffer::SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc)
 {
     auto& renderTargetD3D = LLGL_CAST(D3D11RenderTarget&, renderTarget);
 
@@ -320,9 +371,13 @@ void D3D11CommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
 
     /* Store current render target */
     boundRenderTarget_ = &renderTargetD3D;
+
+    /* Apply clear operations of render pass (other load and store operations require D3D11.1 and are ignored) */
+    if (renderPassDesc)
+        ClearRenderPassAttachments(*renderPassDesc);
 }
 
-void D3D11CommandBuffer::SetRenderTarget(RenderContext& renderContext)
+void D3D11CommandBuffer::SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc)
 {
     auto& renderContextD3D = LLGL_CAST(D3D11RenderContext&, renderContext);
 
@@ -339,6 +394,10 @@ void D3D11CommandBuffer::SetRenderTarget(RenderContext& renderContext)
 
     /* Reset reference to render target */
     boundRenderTarget_ = nullptr;
+
+    /* Apply clear operations of render pass */
+    if (renderPassDesc)
+        ClearRenderPassAttachments(*renderPassDesc);
 }
 
 /* ----- Pipeline States ----- */
@@ -575,6 +634,34 @@ void D3D11CommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned
     context_->DrawIndexedInstanced(numVertices, numInstances, firstIndex, vertexOffset, instanceOffset);
 }
 
+void D3D11CommandBuffer::DrawIndirect(Buffer& buffer, unsigned int offset)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    context_->DrawInstancedIndirect(bufferD3D.Get(), offset);
+}
+
+void D3D11CommandBuffer::DrawIndexedIndirect(Buffer& buffer, unsigned int offset)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    context_->DrawIndexedInstancedIndirect(bufferD3D.Get(), offset);
+}
+
+void D3D11CommandBuffer::MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    /* D3D11 has no native multi-draw, so submit the draw commands one by one */
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    for (unsigned int i = 0; i < numCommands; ++i, offset += stride)
+        context_->DrawInstancedIndirect(bufferD3D.Get(), offset);
+}
+
+void D3D11CommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    /* D3D11 has no native multi-draw, so submit the draw commands one by one */
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    for (unsigned int i = 0; i < numCommands; ++i, offset += stride)
+        context_->DrawIndexedInstancedIndirect(bufferD3D.Get(), offset);
+}
+
 /* ----- Compute ----- */
 
 void D3D11CommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ)
@@ -582,8 +669,20 @@ void D3D11CommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSiz
     context_->Dispatch(groupSizeX, groupSizeY, groupSizeZ);
 }
 
+void D3D11CommandBuffer::DispatchIndirect(Buffer& buffer, unsigned int offset)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    context_->DispatchIndirect(bufferD3D.Get(), offset);
+}
+
 /* ----- Misc ----- */
 
+void D3D11CommandBuffer::SignalFence(Fence& fence)
+{
+    auto& fenceD3D = LLGL_CAST(D3D11Fence&, fence);
+    fenceD3D.Signal(context_.Get());
+}
+
 void D3D11CommandBuffer::SyncGPU()
 {
     context_->Flush();
@@ -80,10 +80,14 @@ class D3D11CommandBuffer : public CommandBuffer
         void SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetSamplerArray(SamplerArray& samplerArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
 
+        /* ----- Resource Heaps ----- */
+
+        void SetResourceHeap(ResourceHeap& resourceHeap) override;
+
         /* ----- Render Targets ----- */
 
-        void SetRenderTarget(RenderTarget& renderTarget) override;
-        void SetRenderTarget(RenderContext& renderContext) override;
+        void SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc = nullptr) override;
+        void SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc = nullptr) override;
 
         /* ----- Pipeline States ----- */
 
@@ -114,12 +118,21 @@ class D3D11CommandBuffer : public CommandBuffer
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset) override;
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) override;
 
+        void DrawIndirect(Buffer& buffer, unsigned int offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, unsigned int offset) override;
+
+        void MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+        void MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, unsigned int offset) override;
 
         /* ----- Misc ----- */
 
+        void SignalFence(Fence& fence) override;
+
         void SyncGPU() override;
 
     private:
@@ -139,6 +152,9 @@ class D3D11CommandBuffer : public CommandBuffer
 
         void ResolveBoundRenderTarget();
 
+        // Applies the clear operations of the specified render pass to the current framebuffer view.
+        void ClearRenderPassAttachments(const RenderPassDescriptor& renderPassDesc);
+
         D3D11StateManager&          stateMngr_;
         
         ComPtr<ID3D11DeviceContext> context_;
@@ -22,6 +22,7 @@
 #include "RenderState/D3D11ComputePipeline.h"
 #include "RenderState/D3D11StateManager.h"
 #include "RenderState/D3D11Query.h"
+#include "RenderState/D3D11Fence.h"
 
 #include "Shader/D3D11Shader.h"
 #include "Shader/D3D11ShaderProgram.h"
@@ -30,12 +31,15 @@
 #include "Texture/D3D11TextureArray.h"
 #include "Texture/D3D11Sampler.h"
 #include "Texture/D3D11SamplerArray.h"
+#include "RenderState/D3D11ResourceHeap.h"
 #include "Texture/D3D11RenderTarget.h"
 
 #include "../ContainerTypes.h"
+#include "../MemoryAccounting.h"
 #include "../DXCommon/ComPtr.h"
 #include <d3d11.h>
 #include <dxgi.h>
+#include <map>
 
 
 namespace LLGL
@@ -52,6 +56,8 @@ class D3D11RenderSystem : public RenderSystem
         D3D11RenderSystem();
         ~D3D11RenderSystem();
 
+        MemoryStatistics QueryMemoryStatistics() override;
+
         /* ----- Render Context ------ */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -89,8 +95,15 @@ class D3D11RenderSystem : public RenderSystem
         
         void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
 
+        std::uint64_t WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
+        bool IsTextureUploadComplete(std::uint64_t ticket) override;
+
         void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) override;
 
+        std::uint64_t ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc) override;
+        bool MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize) override;
+        void UnmapTextureReadback(std::uint64_t ticket) override;
+
         void GenerateMips(Texture& texture) override;
 
         /* ----- Sampler States ---- */
@@ -101,6 +114,12 @@ class D3D11RenderSystem : public RenderSystem
         void Release(Sampler& sampler) override;
         void Release(SamplerArray& samplerArray) override;
 
+        /* ----- Resource Heaps ----- */
+
+        ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
+
+        void Release(ResourceHeap& resourceHeap) override;
+
         /* ----- Render Targets ----- */
 
         RenderTarget* CreateRenderTarget(const RenderTargetDescriptor& desc) override;
@@ -129,6 +148,14 @@ class D3D11RenderSystem : public RenderSystem
 
         void Release(Query& query) override;
 
+        /* ----- Fences ----- */
+
+        Fence* CreateFence() override;
+
+        void Release(Fence& fence) override;
+
+        bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+
         /* ----- Extended internal functions ----- */
 
         inline D3D_FEATURE_LEVEL GetFeatureLevel() const
@@ -142,6 +169,16 @@ class D3D11RenderSystem : public RenderSystem
         }
 
     private:
+
+        struct TextureReadback
+        {
+            ComPtr<ID3D11Resource>      stagingResource;
+            TextureReadbackDescriptor   desc;
+            Gs::Vector3ui               size;
+            DataType                    srcDataType     = DataType::UInt8;
+            ImageFormat                 srcFormat       = ImageFormat::RGBA;
+            std::vector<char>           data;
+        };
         
         void CreateFactory();
         void QueryVideoAdapters();
@@ -182,19 +219,26 @@ class D3D11RenderSystem : public RenderSystem
         HWObjectContainer<D3D11TextureArray>        textureArrays_;
         HWObjectContainer<D3D11Sampler>             samplers_;
         HWObjectContainer<D3D11SamplerArray>        samplerArrays_;
+        HWObjectContainer<D3D11ResourceHeap>        resourceHeaps_;
         HWObjectContainer<D3D11RenderTarget>        renderTargets_;
         HWObjectContainer<D3D11Shader>              shaders_;
         HWObjectContainer<D3D11ShaderProgram>       shaderPrograms_;
         HWObjectContainer<D3D11GraphicsPipeline>    graphicsPipelines_;
         HWObjectContainer<D3D11ComputePipeline>     computePipelines_;
         HWObjectContainer<D3D11Query>               queries_;
+        HWObjectContainer<D3D11Fence>               fences_;
 
         /* ----- Other members ----- */
 
         std::vector<VideoAdapterDescriptor>         videoAdatperDescs_;
 
+        std::map<std::uint64_t, TextureReadback>    textureReadbacks_;
+        std::uint64_t                               nextReadbackTicket_     = 1;
+
         BufferCPUAccess                             mappedBufferCPUAccess_  = BufferCPUAccess::ReadOnly;
 
+        MemoryAccounting                            memoryAccounting_;
+
 };
 
 
@@ -23,6 +23,7 @@
 #include "Buffer/D3D11StorageBufferArray.h"
 #include "Buffer/D3D11StreamOutputBuffer.h"
 #include "Buffer/D3D11StreamOutputBufferArray.h"
+#include "Buffer/D3D11IndirectBuffer.h"
 
 
 namespace LLGL
@@ -46,6 +47,18 @@ D3D11RenderSystem::~D3D11RenderSystem()
 {
 }
 
+MemoryStatistics D3D11RenderSystem::QueryMemoryStatistics()
+{
+    MemoryStatistics stats;
+    memoryAccounting_.GetStatistics(stats);
+
+    /* Device is created with the default adapter, which is the first one */
+    if (!videoAdatperDescs_.empty())
+        stats.totalDeviceMemory = static_cast<std::uint64_t>(videoAdatperDescs_.front().videoMemory);
+
+    return stats;
+}
+
 /* ----- Render Context ----- */
 
 RenderContext* D3D11RenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
@@ -85,14 +98,29 @@ static std::unique_ptr<D3D11Buffer> MakeD3D11Buffer(ID3D11Device* device, const
         case BufferType::Constant:      return MakeUnique< D3D11ConstantBuffer     >(device, desc, initialData);
         case BufferType::Storage:       return MakeUnique< D3D11StorageBuffer      >(device, desc, initialData);
         case BufferType::StreamOutput:  return MakeUnique< D3D11StreamOutputBuffer >(device, desc, initialData);
+        case BufferType::Indirect:      return MakeUnique< D3D11IndirectBuffer     >(device, desc, initialData);
     }
     return nullptr;
 }
 
+// Returns the size (in bytes) of the native D3D11 buffer (which might be larger than requested due to alignment).
+static std::uint64_t GetD3D11BufferSize(const D3D11Buffer& bufferD3D)
+{
+    D3D11_BUFFER_DESC desc;
+    if (auto buffer = bufferD3D.Get())
+    {
+        buffer->GetDesc(&desc);
+        return desc.ByteWidth;
+    }
+    return 0;
+}
+
 Buffer* D3D11RenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
 {
     AssertCreateBuffer(desc);
-    return TakeOwnership(buffers_, MakeD3D11Buffer(device_.Get(), desc, initialData));
+    auto bufferD3D = MakeD3D11Buffer(device_.Get(), desc, initialData);
+    memoryAccounting_.Allocate(MemoryAccounting::Type::Buffer, GetD3D11BufferSize(*bufferD3D));
+    return TakeOwnership(buffers_, std::move(bufferD3D));
 }
 
 static std::unique_ptr<D3D11BufferArray> MakeD3D11BufferArray(unsigned int numBuffers, Buffer* const * bufferArray)
@@ -117,6 +145,8 @@ BufferArray* D3D11RenderSystem::CreateBufferArray(unsigned int numBuffers, Buffe
 
 void D3D11RenderSystem::Release(Buffer& buffer)
 {
+    auto& bufferD3D = LLGL_CAST(const D3D11Buffer&, buffer);
+    memoryAccounting_.Release(MemoryAccounting::Type::Buffer, GetD3D11BufferSize(bufferD3D));
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
@@ -171,15 +201,32 @@ void D3D11RenderSystem::Release(SamplerArray& samplerArray)
     RemoveFromUniqueSet(samplerArrays_, &samplerArray);
 }
 
+/* ----- Resource Heaps ----- */
+
+ResourceHeap* D3D11RenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    AssertCreateResourceHeap(desc);
+    return TakeOwnership(resourceHeaps_, MakeUnique<D3D11ResourceHeap>(desc));
+}
+
+void D3D11RenderSystem::Release(ResourceHeap& resourceHeap)
+{
+    RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
+}
+
 /* ----- Render Targets ----- */
 
 RenderTarget* D3D11RenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
 {
-    return TakeOwnership(renderTargets_, MakeUnique<D3D11RenderTarget>(device_.Get(), desc));
+    auto renderTarget = MakeUnique<D3D11RenderTarget>(device_.Get(), memoryAccounting_, desc);
+    memoryAccounting_.Allocate(MemoryAccounting::Type::RenderTarget, 0);
+    return TakeOwnership(renderTargets_, std::move(renderTarget));
 }
 
 void D3D11RenderSystem::Release(RenderTarget& renderTarget)
 {
+    /* Internal textures are removed from the tally when the render target is destroyed */
+    memoryAccounting_.Release(MemoryAccounting::Type::RenderTarget, 0);
     RemoveFromUniqueSet(renderTargets_, &renderTarget);
 }
 
@@ -239,6 +286,24 @@ void D3D11RenderSystem::Release(Query& query)
     RemoveFromUniqueSet(queries_, &query);
 }
 
+/* ----- Fences ----- */
+
+Fence* D3D11RenderSystem::CreateFence()
+{
+    return TakeOwnership(fences_, MakeUnique<D3D11Fence>(device_.Get(), context_.Get()));
+}
+
+void D3D11RenderSystem::Release(Fence& fence)
+{
+    RemoveFromUniqueSet(fences_, &fence);
+}
+
+bool D3D11RenderSystem::WaitFence(Fence& fence, std::uint64_t timeout)
+{
+    auto& fenceD3D = LLGL_CAST(D3D11Fence&, fence);
+    return fenceD3D.Wait(timeout);
+}
+
 
 /*
  * ======= Private: =======
@@ -74,7 +74,11 @@ Texture* D3D11RenderSystem::CreateTexture(const TextureDescriptor& textureDesc,
             throw std::invalid_argument("failed to create texture with invalid texture type");
             break;
     }
-    
+
+    /* Tally estimated texture memory */
+    texture->SetMemoryFootprint(TextureMemoryFootprint(textureDesc));
+    memoryAccounting_.Allocate(MemoryAccounting::Type::Texture, texture->GetMemoryFootprint());
+
     return TakeOwnership(textures_, std::move(texture));
 }
 
@@ -86,6 +90,8 @@ TextureArray* D3D11RenderSystem::CreateTextureArray(unsigned int numTextures, Te
 
 void D3D11RenderSystem::Release(Texture& texture)
 {
+    auto& textureD3D = LLGL_CAST(const D3D11Texture&, texture);
+    memoryAccounting_.Release(MemoryAccounting::Type::Texture, textureD3D.GetMemoryFootprint());
     RemoveFromUniqueSet(textures_, &texture);
 }
 
@@ -234,6 +240,18 @@ void D3D11RenderSystem::WriteTexture(Texture& texture, const SubTextureDescripto
     UpdateGenericTexture(texture, subTextureDesc.mipLevel, 0, position, size, imageDesc);
 }
 
+std::uint64_t D3D11RenderSystem::WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
+{
+    /* "UpdateSubresource" already copies the image data into driver owned memory, so the upload is not synchronized with the GPU */
+    WriteTexture(texture, subTextureDesc, imageDesc);
+    return 0;
+}
+
+bool D3D11RenderSystem::IsTextureUploadComplete(std::uint64_t ticket)
+{
+    return true;
+}
+
 void D3D11RenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer)
 {
     LLGL_ASSERT_PTR(buffer);
@@ -281,6 +299,88 @@ void D3D11RenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageF
     context_->Unmap(hwTextureCopy.resource.Get(), 0);
 }
 
+std::uint64_t D3D11RenderSystem::ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc)
+{
+    auto& textureD3D = LLGL_CAST(const D3D11Texture&, texture);
+
+    /* Create a copy of the hardware texture with CPU read access (the copy command is executed asynchronously by the GPU) */
+    D3D11HardwareTexture hwTextureCopy;
+    textureD3D.CreateSubresourceCopyWithCPUAccess(device_.Get(), context_.Get(), hwTextureCopy, D3D11_CPU_ACCESS_READ, desc.mipLevel);
+
+    auto srcTexFormat = DXGetTextureFormatDesc(textureD3D.GetFormat());
+
+    /* Store staging resource until the readback is mapped */
+    auto ticket = nextReadbackTicket_++;
+    auto& readback = textureReadbacks_[ticket];
+    {
+        readback.stagingResource    = hwTextureCopy.resource;
+        readback.desc               = desc;
+        readback.size               = texture.QueryMipLevelSize(desc.mipLevel);
+        readback.srcFormat          = srcTexFormat.format;
+        readback.srcDataType        = srcTexFormat.dataType;
+    }
+    hwTextureCopy.resource.Reset();
+
+    return ticket;
+}
+
+bool D3D11RenderSystem::MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize)
+{
+    auto it = textureReadbacks_.find(ticket);
+    if (it == textureReadbacks_.end())
+        return false;
+
+    auto& readback = it->second;
+
+    if (readback.stagingResource)
+    {
+        /* Map staging resource without waiting for the GPU */
+        D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+        auto hr = context_->Map(readback.stagingResource.Get(), 0, D3D11_MAP_READ, D3D11_MAP_FLAG_DO_NOT_WAIT, &mappedSubresource);
+        if (hr == DXGI_ERROR_WAS_STILL_DRAWING)
+            return false;
+        DXThrowIfFailed(hr, "failed to map D3D11 texture readback resource");
+
+        /* Convert mapped data into the requested format */
+        const auto& desc    = readback.desc;
+        auto dstFormat      = (desc.convert ? desc.convertFormat : desc.format);
+        auto dstDataType    = (desc.convert ? desc.convertDataType : desc.dataType);
+
+        auto numPixels      = readback.size.x*readback.size.y*readback.size.z;
+        auto srcImageSize   = numPixels * DataTypeSize(readback.srcDataType) * ImageFormatSize(readback.srcFormat);
+        auto dstImageSize   = numPixels * DataTypeSize(dstDataType) * ImageFormatSize(dstFormat);
+
+        readback.data.resize(dstImageSize);
+
+        if (readback.srcFormat != dstFormat || readback.srcDataType != dstDataType)
+        {
+            auto tempData = ConvertImageBuffer(
+                readback.srcFormat, readback.srcDataType,
+                mappedSubresource.pData, srcImageSize,
+                dstFormat, dstDataType,
+                GetConfiguration().threadCount
+            );
+            ::memcpy(readback.data.data(), tempData.get(), dstImageSize);
+        }
+        else
+            ::memcpy(readback.data.data(), mappedSubresource.pData, srcImageSize);
+
+        /* Unmap and release staging resource */
+        context_->Unmap(readback.stagingResource.Get(), 0);
+        readback.stagingResource.Reset();
+    }
+
+    data        = readback.data.data();
+    dataSize    = readback.data.size();
+
+    return true;
+}
+
+void D3D11RenderSystem::UnmapTextureReadback(std::uint64_t ticket)
+{
+    textureReadbacks_.erase(ticket);
+}
+
 void D3D11RenderSystem::GenerateMips(Texture& texture)
 {
     /* Generate MIP-maps for SRV of specified texture */
@@ -300,7 +400,7 @@ void D3D11RenderSystem::BuildGenericTexture1D(
     D3D11_TEXTURE1D_DESC texDesc;
     {
         texDesc.Width           = descD3D.texture1D.width;
-        texDesc.MipLevels       = 0;
+        texDesc.MipLevels       = descD3D.mipLevels;
         texDesc.ArraySize       = descD3D.texture1D.layers;
         texDesc.Format          = D3D11Types::Map(descD3D.format);
         texDesc.Usage           = D3D11_USAGE_DEFAULT;
@@ -343,7 +443,7 @@ void D3D11RenderSystem::BuildGenericTexture2D(
     {
         texDesc.Width               = descD3D.texture2D.width;
         texDesc.Height              = descD3D.texture2D.height;
-        texDesc.MipLevels           = 0;
+        texDesc.MipLevels           = descD3D.mipLevels;
         texDesc.ArraySize           = descD3D.texture2D.layers;
         texDesc.Format              = D3D11Types::Map(descD3D.format);
         texDesc.SampleDesc.Count    = 1;
@@ -396,7 +496,7 @@ void D3D11RenderSystem::BuildGenericTexture3D(
         texDesc.Width           = descD3D.texture3D.width;
         texDesc.Height          = descD3D.texture3D.height;
         texDesc.Depth           = descD3D.texture3D.depth;
-        texDesc.MipLevels       = 0;
+        texDesc.MipLevels       = descD3D.mipLevels;
         texDesc.Format          = D3D11Types::Map(descD3D.format);
         texDesc.Usage           = D3D11_USAGE_DEFAULT;
         texDesc.BindFlags       = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
@@ -0,0 +1,69 @@
+/*
+ * D3D11Fence.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "D3D11Fence.h"
+#include "../../DXCommon/DXCore.h"
+#include <chrono>
+#include <thread>
+
+
+namespace LLGL
+{
+
+
+D3D11Fence::D3D11Fence(ID3D11Device* device, ID3D11DeviceContext* context) :
+    context_ { context }
+{
+    /* Create D3D event query */
+    D3D11_QUERY_DESC queryDesc;
+    {
+        queryDesc.Query     = D3D11_QUERY_EVENT;
+        queryDesc.MiscFlags = 0;
+    }
+    auto hr = device->CreateQuery(&queryDesc, &query_);
+    DXThrowIfFailed(hr, "failed to create D3D11 event query for fence");
+}
+
+bool D3D11Fence::IsSignaled()
+{
+    if (pending_)
+    {
+        /* Poll event query (this also flushes the command stream) */
+        BOOL signaled = FALSE;
+        if (context_->GetData(query_.Get(), &signaled, sizeof(signaled), 0) == S_OK && signaled)
+            pending_ = false;
+    }
+    return !pending_;
+}
+
+void D3D11Fence::Signal(ID3D11DeviceContext* context)
+{
+    context->End(query_.Get());
+    pending_ = true;
+}
+
+bool D3D11Fence::Wait(std::uint64_t timeout)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    while (!IsSignaled())
+    {
+        auto elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+        if (static_cast<std::uint64_t>(elapsedTime.count()) >= timeout)
+            return false;
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
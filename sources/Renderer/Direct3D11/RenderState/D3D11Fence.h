@@ -0,0 +1,54 @@
+/*
+ * D3D11Fence.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_D3D11_FENCE_H
+#define LLGL_D3D11_FENCE_H
+
+
+#include <LLGL/Fence.h>
+#include "../../DXCommon/ComPtr.h"
+#include <d3d11.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// D3D11 has no native fence objects, so this is emulated with an event query.
+class D3D11Fence : public Fence
+{
+
+    public:
+
+        D3D11Fence(ID3D11Device* device, ID3D11DeviceContext* context);
+
+        bool IsSignaled() override;
+
+        // Inserts the event query into the command stream of the specified device context.
+        void Signal(ID3D11DeviceContext* context);
+
+        // Polls the event query until it has been signaled or the timeout (in nanoseconds) has expired.
+        bool Wait(std::uint64_t timeout);
+
+    private:
+
+        ID3D11DeviceContext*    context_    = nullptr;
+        ComPtr<ID3D11Query>     query_;
+        bool                    pending_    = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,129 @@
+/*
+ * D3D11ResourceHeap.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "D3D11ResourceHeap.h"
+#include "../Buffer/D3D11ConstantBuffer.h"
+#include "../Buffer/D3D11StorageBuffer.h"
+#include "../Texture/D3D11Texture.h"
+#include "../Texture/D3D11Sampler.h"
+#include "../../CheckedCast.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+template <typename T>
+struct D3D11BindingSlot
+{
+    UINT    slot;
+    long    shaderStageFlags;
+    T*      resource;
+    UINT    initialCount;
+};
+
+// Merges the binding slots with consecutive indices and equal shader stages into binding ranges
+template <typename T>
+static void BuildBindingRanges(
+    std::vector<D3D11BindingSlot<T>>&   slots,
+    std::vector<D3D11BindingRange>&     ranges,
+    std::vector<T*>&                    resources,
+    std::vector<UINT>*                  initialCounts = nullptr)
+{
+    std::sort(
+        slots.begin(), slots.end(),
+        [](const D3D11BindingSlot<T>& lhs, const D3D11BindingSlot<T>& rhs)
+        {
+            if (lhs.shaderStageFlags < rhs.shaderStageFlags)
+                return true;
+            if (lhs.shaderStageFlags > rhs.shaderStageFlags)
+                return false;
+            return (lhs.slot < rhs.slot);
+        }
+    );
+
+    resources.reserve(slots.size());
+
+    for (const auto& slot : slots)
+    {
+        if ( ranges.empty()                                                 ||
+             ranges.back().shaderStageFlags != slot.shaderStageFlags        ||
+             ranges.back().startSlot + ranges.back().count != slot.slot     )
+        {
+            ranges.push_back({ slot.slot, 0, resources.size(), slot.shaderStageFlags });
+        }
+
+        ++ranges.back().count;
+
+        resources.push_back(slot.resource);
+        if (initialCounts)
+            initialCounts->push_back(slot.initialCount);
+    }
+}
+
+D3D11ResourceHeap::D3D11ResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    std::vector<D3D11BindingSlot<ID3D11Buffer>>                 constantBufferSlots;
+    std::vector<D3D11BindingSlot<ID3D11ShaderResourceView>>     shaderResourceSlots;
+    std::vector<D3D11BindingSlot<ID3D11UnorderedAccessView>>    unorderedAccessSlots;
+    std::vector<D3D11BindingSlot<ID3D11SamplerState>>           samplerSlots;
+
+    /* Gather binding slots for each resource view type */
+    for (const auto& resourceViewDesc : desc.resourceViews)
+    {
+        auto slot       = static_cast<UINT>(resourceViewDesc.slot);
+        auto stageFlags = resourceViewDesc.shaderStageFlags;
+
+        switch (resourceViewDesc.type)
+        {
+            case ResourceType::ConstantBuffer:
+            {
+                auto constantBufferD3D = LLGL_CAST(D3D11ConstantBuffer*, resourceViewDesc.buffer);
+                constantBufferSlots.push_back({ slot, stageFlags, constantBufferD3D->Get(), 0 });
+            }
+            break;
+
+            case ResourceType::StorageBuffer:
+            {
+                auto storageBufferD3D = LLGL_CAST(D3D11StorageBuffer*, resourceViewDesc.buffer);
+                if (storageBufferD3D->HasUAV() && (stageFlags & ShaderStageFlags::ReadOnlyResource) == 0)
+                    unorderedAccessSlots.push_back({ slot, stageFlags, storageBufferD3D->GetUAV(), storageBufferD3D->GetInitialCount() });
+                else
+                    shaderResourceSlots.push_back({ slot, stageFlags, storageBufferD3D->GetSRV(), 0 });
+            }
+            break;
+
+            case ResourceType::Texture:
+            {
+                auto textureD3D = LLGL_CAST(D3D11Texture*, resourceViewDesc.texture);
+                shaderResourceSlots.push_back({ slot, stageFlags, textureD3D->GetSRV(), 0 });
+            }
+            break;
+
+            case ResourceType::Sampler:
+            {
+                auto samplerD3D = LLGL_CAST(D3D11Sampler*, resourceViewDesc.sampler);
+                samplerSlots.push_back({ slot, stageFlags, samplerD3D->GetSamplerState(), 0 });
+            }
+            break;
+        }
+    }
+
+    /* Precompute the resource arrays for each binding range */
+    BuildBindingRanges(constantBufferSlots, constantBufferRanges_, constantBuffers_);
+    BuildBindingRanges(shaderResourceSlots, shaderResourceRanges_, shaderResourceViews_);
+    BuildBindingRanges(unorderedAccessSlots, unorderedAccessRanges_, unorderedAccessViews_, &initialCounts_);
+    BuildBindingRanges(samplerSlots, samplerRanges_, samplerStates_);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
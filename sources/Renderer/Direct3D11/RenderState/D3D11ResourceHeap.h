@@ -0,0 +1,115 @@
+/*
+ * D3D11ResourceHeap.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_D3D11_RESOURCE_HEAP_H
+#define LLGL_D3D11_RESOURCE_HEAP_H
+
+
+#include <LLGL/ResourceHeap.h>
+#include <vector>
+#include <d3d11.h>
+
+
+namespace LLGL
+{
+
+
+// Range of consecutive binding slots with the same shader stages, which are bound with a single call.
+struct D3D11BindingRange
+{
+    UINT        startSlot;
+    UINT        count;
+    std::size_t offset;
+    long        shaderStageFlags;
+};
+
+class D3D11ResourceHeap : public ResourceHeap
+{
+
+    public:
+
+        D3D11ResourceHeap(const ResourceHeapDescriptor& desc);
+
+        /* ----- Constant buffers ----- */
+
+        inline const std::vector<D3D11BindingRange>& GetConstantBufferRanges() const
+        {
+            return constantBufferRanges_;
+        }
+
+        inline const std::vector<ID3D11Buffer*>& GetConstantBuffers() const
+        {
+            return constantBuffers_;
+        }
+
+        /* ----- Shader resource views (textures and read-only storage buffers) ----- */
+
+        inline const std::vector<D3D11BindingRange>& GetShaderResourceRanges() const
+        {
+            return shaderResourceRanges_;
+        }
+
+        inline const std::vector<ID3D11ShaderResourceView*>& GetShaderResourceViews() const
+        {
+            return shaderResourceViews_;
+        }
+
+        /* ----- Unordered access views (storage buffers) ----- */
+
+        inline const std::vector<D3D11BindingRange>& GetUnorderedAccessRanges() const
+        {
+            return unorderedAccessRanges_;
+        }
+
+        inline const std::vector<ID3D11UnorderedAccessView*>& GetUnorderedAccessViews() const
+        {
+            return unorderedAccessViews_;
+        }
+
+        inline const std::vector<UINT>& GetInitialCounts() const
+        {
+            return initialCounts_;
+        }
+
+        /* ----- Samplers ----- */
+
+        inline const std::vector<D3D11BindingRange>& GetSamplerRanges() const
+        {
+            return samplerRanges_;
+        }
+
+        inline const std::vector<ID3D11SamplerState*>& GetSamplerStates() const
+        {
+            return samplerStates_;
+        }
+
+    private:
+
+        std::vector<D3D11BindingRange>          constantBufferRanges_;
+        std::vector<ID3D11Buffer*>              constantBuffers_;
+
+        std::vector<D3D11BindingRange>          shaderResourceRanges_;
+        std::vector<ID3D11ShaderResourceView*>  shaderResourceViews_;
+
+        std::vector<D3D11BindingRange>          unorderedAccessRanges_;
+        std::vector<ID3D11UnorderedAccessView*> unorderedAccessViews_;
+        std::vector<UINT>                       initialCounts_;
+
+        std::vector<D3D11BindingRange>          samplerRanges_;
+        std::vector<ID3D11SamplerState*>        samplerStates_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
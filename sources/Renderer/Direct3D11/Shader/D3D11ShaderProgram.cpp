@@ -171,29 +171,29 @@ std::string D3D11ShaderProgram::QueryInfoLog()
     return "";
 }
 
-std::vector<VertexAttribute> D3D11ShaderProgram::QueryVertexAttributes() const
+const std::vector<VertexAttribute>& D3D11ShaderProgram::QueryVertexAttributes() const
 {
     return vertexAttributes_;
 }
 
-std::vector<StreamOutputAttribute> D3D11ShaderProgram::QueryStreamOutputAttributes() const
+const std::vector<StreamOutputAttribute>& D3D11ShaderProgram::QueryStreamOutputAttributes() const
 {
-    return {}; //todo...
+    return streamOutputAttributes_;
 }
 
-std::vector<ConstantBufferViewDescriptor> D3D11ShaderProgram::QueryConstantBuffers() const
+const std::vector<ConstantBufferViewDescriptor>& D3D11ShaderProgram::QueryConstantBuffers() const
 {
     return constantBufferDescs_;
 }
 
-std::vector<StorageBufferViewDescriptor> D3D11ShaderProgram::QueryStorageBuffers() const
+const std::vector<StorageBufferViewDescriptor>& D3D11ShaderProgram::QueryStorageBuffers() const
 {
     return storageBufferDescs_;
 }
 
-std::vector<UniformDescriptor> D3D11ShaderProgram::QueryUniforms() const
+const std::vector<UniformDescriptor>& D3D11ShaderProgram::QueryUniforms() const
 {
-    return {}; // dummy
+    return uniformDescs_;
 }
 
 static DXGI_FORMAT GetInputElementFormat(const VertexAttribute& attrib)
@@ -35,11 +35,11 @@ class D3D11ShaderProgram : public ShaderProgram
 
         std::string QueryInfoLog() override;
 
-        std::vector<VertexAttribute> QueryVertexAttributes() const override;
-        std::vector<StreamOutputAttribute> QueryStreamOutputAttributes() const override;
-        std::vector<ConstantBufferViewDescriptor> QueryConstantBuffers() const override;
-        std::vector<StorageBufferViewDescriptor> QueryStorageBuffers() const override;
-        std::vector<UniformDescriptor> QueryUniforms() const override;
+        const std::vector<VertexAttribute>& QueryVertexAttributes() const override;
+        const std::vector<StreamOutputAttribute>& QueryStreamOutputAttributes() const override;
+        const std::vector<ConstantBufferViewDescriptor>& QueryConstantBuffers() const override;
+        const std::vector<StorageBufferViewDescriptor>& QueryStorageBuffers() const override;
+        const std::vector<UniformDescriptor>& QueryUniforms() const override;
 
         void BuildInputLayout(const VertexFormat& vertexFormat) override;
         void BindConstantBuffer(const std::string& name, unsigned int bindingIndex) override;
@@ -83,8 +83,10 @@ class D3D11ShaderProgram : public ShaderProgram
         D3D11Shader*                                cs_                     = nullptr;
 
         std::vector<VertexAttribute>                vertexAttributes_;
+        std::vector<StreamOutputAttribute>          streamOutputAttributes_; // todo...
         std::vector<ConstantBufferViewDescriptor>   constantBufferDescs_;
         std::vector<StorageBufferViewDescriptor>    storageBufferDescs_;
+        std::vector<UniformDescriptor>              uniformDescs_;           // dummy
 
         LinkError                                   linkError_              = LinkError::NoError;
 
@@ -8,6 +8,7 @@
 #include "D3D11RenderTarget.h"
 #include "../D3D11RenderSystem.h"
 #include "../../DXCommon/DXCore.h"
+#include "../../DXCommon/DXTypes.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Helper.h"
 
@@ -16,12 +17,25 @@ namespace LLGL
 {
 
 
-D3D11RenderTarget::D3D11RenderTarget(ID3D11Device* device, const RenderTargetDescriptor& desc) :
-    device_       { device                           },
-    multiSamples_ { desc.multiSampling.SampleCount() }
+D3D11RenderTarget::D3D11RenderTarget(ID3D11Device* device, MemoryAccounting& memoryAccounting, const RenderTargetDescriptor& desc) :
+    device_             { device                           },
+    multiSamples_       { desc.multiSampling.SampleCount() },
+    memoryAccounting_   { memoryAccounting                 }
 {
 }
 
+D3D11RenderTarget::~D3D11RenderTarget()
+{
+    SetInternalMemory(0);
+}
+
+// Returns the estimated memory footprint (in bytes) of the specified 2D texture with a single MIP-map level.
+static std::uint64_t GetTexture2DMemory(const D3D11_TEXTURE2D_DESC& desc)
+{
+    auto bitSize = TextureFormatBitSize(DXTypes::Unmap(desc.Format));
+    return (static_cast<std::uint64_t>(desc.Width) * desc.Height * desc.ArraySize * desc.SampleDesc.Count * bitSize / 8);
+}
+
 void D3D11RenderTarget::AttachDepthBuffer(const Gs::Vector2ui& size)
 {
     CreateDepthStencilAndDSV(size, DXGI_FORMAT_D24_UNORM_S8_UINT);
@@ -167,6 +181,8 @@ void D3D11RenderTarget::AttachTexture(Texture& texture, const RenderTargetAttach
         auto hr = device_->CreateTexture2D(&texDesc, nullptr, tex2DMS.ReleaseAndGetAddressOf());
         DXThrowIfFailed(hr, "failed to create D3D11 multi-sampled 2D-texture for render-target");
 
+        SetInternalMemory(internalMemory_ + GetTexture2DMemory(texDesc));
+
         /* Store multi-sampled texture, and reference to texture target */
         multiSampledAttachments_.push_back(
             {
@@ -231,6 +247,8 @@ void D3D11RenderTarget::DetachAll()
     depthStencilView_.Reset();
 
     multiSampledAttachments_.clear();
+
+    SetInternalMemory(0);
 }
 
 /* ----- Extended Internal Functions ----- */
@@ -261,6 +279,14 @@ void D3D11RenderTarget::CreateDepthStencilAndDSV(const Gs::Vector2ui& size, DXGI
     /* Apply size to render target resolution, and create depth-stencil */
     ApplyResolution(size);
 
+    /* Remove previous depth-stencil texture from memory tally */
+    if (depthStencil_)
+    {
+        D3D11_TEXTURE2D_DESC prevTexDesc;
+        depthStencil_->GetDesc(&prevTexDesc);
+        SetInternalMemory(internalMemory_ - GetTexture2DMemory(prevTexDesc));
+    }
+
     /* Create depth stencil texture */
     D3D11_TEXTURE2D_DESC texDesc;
     {
@@ -279,6 +305,8 @@ void D3D11RenderTarget::CreateDepthStencilAndDSV(const Gs::Vector2ui& size, DXGI
     hr = device_->CreateTexture2D(&texDesc, nullptr, depthStencil_.ReleaseAndGetAddressOf());
     DXThrowIfFailed(hr, "failed to create D3D11 depth-texture for render-target");
 
+    SetInternalMemory(internalMemory_ + GetTexture2DMemory(texDesc));
+
     /* Create DSV */
     hr = device_->CreateDepthStencilView(depthStencil_.Get(), nullptr, depthStencilView_.ReleaseAndGetAddressOf());
     DXThrowIfFailed(hr, "failed to create D3D11 depth-stencil-view (DSV) for render-target");
@@ -300,6 +328,12 @@ bool D3D11RenderTarget::HasMultiSampling() const
     return (multiSamples_ > 1);
 }
 
+void D3D11RenderTarget::SetInternalMemory(std::uint64_t size)
+{
+    memoryAccounting_.Resize(MemoryAccounting::Type::RenderTarget, internalMemory_, size);
+    internalMemory_ = size;
+}
+
 
 } // /namespace LLGL
 
@@ -11,6 +11,7 @@
 
 #include <LLGL/RenderTarget.h>
 #include "../../DXCommon/ComPtr.h"
+#include "../../MemoryAccounting.h"
 #include <vector>
 #include <functional>
 #include <d3d11.h>
@@ -28,7 +29,8 @@ class D3D11RenderTarget : public RenderTarget
 
     public:
 
-        D3D11RenderTarget(ID3D11Device* device, const RenderTargetDescriptor& desc);
+        D3D11RenderTarget(ID3D11Device* device, MemoryAccounting& memoryAccounting, const RenderTargetDescriptor& desc);
+        ~D3D11RenderTarget();
 
         void AttachDepthBuffer(const Gs::Vector2ui& size) override;
         void AttachStencilBuffer(const Gs::Vector2ui& size) override;
@@ -60,6 +62,9 @@ class D3D11RenderTarget : public RenderTarget
 
         bool HasMultiSampling() const;
 
+        // Changes the tallied memory of all internal textures.
+        void SetInternalMemory(std::uint64_t size);
+
         ID3D11Device*                               device_                     = nullptr;
 
         std::vector<ComPtr<ID3D11RenderTargetView>> renderTargetViews_;
@@ -80,6 +85,9 @@ class D3D11RenderTarget : public RenderTarget
         UINT                                        multiSamples_               = 0;
         std::vector<MultiSampledAttachment>         multiSampledAttachments_;
 
+        MemoryAccounting&                           memoryAccounting_;
+        std::uint64_t                               internalMemory_             = 0;
+
 };
 
 
@@ -12,6 +12,7 @@
 #include <LLGL/Texture.h>
 #include <d3d11.h>
 #include "../../DXCommon/ComPtr.h"
+#include <cstdint>
 
 
 namespace LLGL
@@ -105,6 +106,18 @@ class D3D11Texture : public Texture
             return numMipLevels_;
         }
 
+        // Sets the estimated memory footprint (in bytes), which is used for memory accounting.
+        inline void SetMemoryFootprint(std::uint64_t size)
+        {
+            memoryFootprint_ = size;
+        }
+
+        // Returns the estimated memory footprint (in bytes).
+        inline std::uint64_t GetMemoryFootprint() const
+        {
+            return memoryFootprint_;
+        }
+
     private:
 
         void CreateSRV(ID3D11Device* device, const D3D11_SHADER_RESOURCE_VIEW_DESC* srvDesc = nullptr);
@@ -119,6 +132,7 @@ class D3D11Texture : public Texture
 
         DXGI_FORMAT                         format_             = DXGI_FORMAT_UNKNOWN;
         UINT                                numMipLevels_       = 0;
+        std::uint64_t                       memoryFootprint_    = 0;
 
 };
 
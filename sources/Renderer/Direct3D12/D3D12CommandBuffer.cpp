@@ -22,12 +22,15 @@
 
 #include "Texture/D3D12Texture.h"
 
+#include "RenderState/D3D12Fence.h"
+
 
 namespace LLGL
 {
 
 
-D3D12CommandBuffer::D3D12CommandBuffer(D3D12RenderSystem& renderSystem)
+D3D12CommandBuffer::D3D12CommandBuffer(D3D12RenderSystem& renderSystem) :
+    renderSystem_ { renderSystem }
 {
     CreateDevices(renderSystem);
     //InitStateManager();
@@ -206,20 +209,43 @@ void D3D12CommandBuffer::SetSamplerArray(SamplerArray& samplerArray, unsigned in
     //todo
 }
 
+/* ----- Resource Heaps ----- */
+
+void D3D12CommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap)
+{
+    //todo
+}
+
 /* ----- Render Targets ----- */
 
-void D3D12CommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
+void D3D12CommandBuffer::SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc)
 {
     //todo
 }
 
-void D3D12CommandBuffer::SetRenderTarget(RenderContext& renderContext)
+void D3D12CommandBuffer::SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc)
 {
     auto& renderContextD3D = LLGL_CAST(D3D12RenderContext&, renderContext);
 
     renderContextD3D.SetCommandBuffer(this);
 
     SetBackBufferRTV(renderContextD3D);
+
+    /* Apply clear operations of render pass */
+    if (renderPassDesc)
+    {
+        long clearFlags = 0;
+
+        if (!renderPassDesc->colorAttachments.empty() && renderPassDesc->colorAttachments.front().loadOp == AttachmentLoadOp::Clear)
+            clearFlags |= ClearFlags::Color;
+        if (renderPassDesc->depthAttachment.loadOp == AttachmentLoadOp::Clear)
+            clearFlags |= ClearFlags::Depth;
+        if (renderPassDesc->stencilAttachment.loadOp == AttachmentLoadOp::Clear)
+            clearFlags |= ClearFlags::Stencil;
+
+        if (clearFlags != 0)
+            Clear(clearFlags);
+    }
 }
 
 /* ----- Pipeline States ----- */
@@ -310,6 +336,26 @@ void D3D12CommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned
     commandList_->DrawIndexedInstanced(numVertices, numInstances, firstIndex, vertexOffset, instanceOffset);
 }
 
+void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, unsigned int offset)
+{
+    //todo... (requires a command signature)
+}
+
+void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, unsigned int offset)
+{
+    //todo... (requires a command signature)
+}
+
+void D3D12CommandBuffer::MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    //todo... (requires a command signature)
+}
+
+void D3D12CommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    //todo... (requires a command signature)
+}
+
 /* ----- Compute ----- */
 
 void D3D12CommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ)
@@ -317,8 +363,28 @@ void D3D12CommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSiz
     commandList_->Dispatch(groupSizeX, groupSizeY, groupSizeZ);
 }
 
+void D3D12CommandBuffer::DispatchIndirect(Buffer& buffer, unsigned int offset)
+{
+    //todo... (requires a command signature)
+}
+
 /* ----- Misc ----- */
 
+void D3D12CommandBuffer::SignalFence(Fence& fence)
+{
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+
+    /* Submit all commands recorded so far, so the fence is not signaled before they have been completed */
+    renderSystem_.CloseAndExecuteCommandList(commandList_.Get());
+    fenceD3D.Signal(renderSystem_.GetCommandQueue());
+
+    /* Continue recording with the current command allocator (pipeline states and resources must be set again) */
+    ResetCommandList(currentCommandAlloc_, nullptr);
+
+    if (rtvDescHandle_.ptr != 0)
+        commandList_->OMSetRenderTargets(1, &rtvDescHandle_, FALSE, nullptr);
+}
+
 void D3D12CommandBuffer::SyncGPU()
 {
     //renderSystem_.SyncGPU(fenceValues_[currentFrame_]);
@@ -332,6 +398,8 @@ void D3D12CommandBuffer::ResetCommandList(ID3D12CommandAllocator* commandAlloc,
     auto hr = commandList_->Reset(commandAlloc, pipelineState);
     DXThrowIfFailed(hr, "failed to reset D3D12 command list");
 
+    currentCommandAlloc_ = commandAlloc;
+
     /* If not disabled, re-submit persistent states (viewport and scissor) */
     if (!disableAutoStateSubmission_)
         SubmitPersistentStates();
@@ -347,6 +415,8 @@ void D3D12CommandBuffer::CreateDevices(D3D12RenderSystem& renderSystem)
     /* Create command allocator and graphics command list */
     commandAlloc_   = renderSystem.CreateDXCommandAllocator();
     commandList_    = renderSystem.CreateDXCommandList(commandAlloc_.Get());
+
+    currentCommandAlloc_ = commandAlloc_.Get();
 }
 
 void D3D12CommandBuffer::InitStateManager(int initialViewportWidth, int initialViewportHeight)
@@ -81,14 +81,18 @@ class D3D12CommandBuffer : public CommandBuffer
         void SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetSamplerArray(SamplerArray& samplerArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
 
+        /* ----- Resource Heaps ----- */
+
+        void SetResourceHeap(ResourceHeap& resourceHeap) override;
+
         /* ----- Resource Views ----- */
 
         //void SetResourceViewHeaps(unsigned int numHeaps, ResourceViewHeap* const * heapArray);
 
         /* ----- Render Targets ----- */
 
-        void SetRenderTarget(RenderTarget& renderTarget) override;
-        void SetRenderTarget(RenderContext& renderContext) override;
+        void SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc = nullptr) override;
+        void SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc = nullptr) override;
 
         /* ----- Pipeline States ----- */
 
@@ -119,12 +123,21 @@ class D3D12CommandBuffer : public CommandBuffer
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset) override;
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) override;
 
+        void DrawIndirect(Buffer& buffer, unsigned int offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, unsigned int offset) override;
+
+        void MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+        void MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, unsigned int offset) override;
 
         /* ----- Misc ----- */
 
+        void SignalFence(Fence& fence) override;
+
         void SyncGPU() override;
 
         /* ----- Extended functions ----- */
@@ -148,10 +161,13 @@ class D3D12CommandBuffer : public CommandBuffer
 
         void SubmitPersistentStates();
 
+        D3D12RenderSystem&                  renderSystem_;
+
         ComPtr<ID3D12CommandAllocator>      commandAlloc_;
         ComPtr<ID3D12GraphicsCommandList>   commandList_;
+        ID3D12CommandAllocator*             currentCommandAlloc_ = nullptr;
 
-        D3D12_CPU_DESCRIPTOR_HANDLE         rtvDescHandle_;
+        D3D12_CPU_DESCRIPTOR_HANDLE         rtvDescHandle_ = {};
 
         //UINT64                              fenceValues_[maxNumBuffers] = { 0 };
 
@@ -59,6 +59,13 @@ D3D12RenderSystem::~D3D12RenderSystem()
     CloseHandle(fenceEvent_);
 }
 
+MemoryStatistics D3D12RenderSystem::QueryMemoryStatistics()
+{
+    MemoryStatistics stats;
+    memoryAccounting_.GetStatistics(stats);
+    return stats;
+}
+
 /* ----- Render Context ----- */
 
 RenderContext* D3D12RenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
@@ -137,7 +144,9 @@ std::unique_ptr<D3D12Buffer> D3D12RenderSystem::MakeBufferAndInitialize(const Bu
 Buffer* D3D12RenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
 {
     AssertCreateBuffer(desc);
-    return TakeOwnership(buffers_, MakeBufferAndInitialize(desc, initialData));
+    auto bufferD3D = MakeBufferAndInitialize(desc, initialData);
+    memoryAccounting_.Allocate(MemoryAccounting::Type::Buffer, bufferD3D->GetBufferSize());
+    return TakeOwnership(buffers_, std::move(bufferD3D));
 }
 
 static std::unique_ptr<BufferArray> MakeD3D12BufferArray(unsigned int numBuffers, Buffer* const * bufferArray)
@@ -162,6 +171,8 @@ BufferArray* D3D12RenderSystem::CreateBufferArray(unsigned int numBuffers, Buffe
 
 void D3D12RenderSystem::Release(Buffer& buffer)
 {
+    auto& bufferD3D = LLGL_CAST(const D3D12Buffer&, buffer);
+    memoryAccounting_.Release(MemoryAccounting::Type::Buffer, bufferD3D.GetBufferSize());
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
@@ -212,6 +223,9 @@ Texture* D3D12RenderSystem::CreateTexture(const TextureDescriptor& textureDesc,
     ExecuteCommandList();
     SyncGPU();
 
+    /* Tally estimated texture memory (textures are not released individually yet) */
+    memoryAccounting_.Allocate(MemoryAccounting::Type::Texture, TextureMemoryFootprint(textureDesc));
+
     return TakeOwnership(textures_, std::move(textureD3D));
 }
 
@@ -245,6 +259,17 @@ void D3D12RenderSystem::WriteTexture(Texture& texture, const SubTextureDescripto
     //todo...
 }
 
+std::uint64_t D3D12RenderSystem::WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
+{
+    WriteTexture(texture, subTextureDesc, imageDesc);
+    return 0;
+}
+
+bool D3D12RenderSystem::IsTextureUploadComplete(std::uint64_t ticket)
+{
+    return true;
+}
+
 void D3D12RenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer)
 {
     LLGL_ASSERT_PTR(buffer);
@@ -252,6 +277,21 @@ void D3D12RenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageF
     //todo
 }
 
+std::uint64_t D3D12RenderSystem::ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc)
+{
+    return 0;//todo
+}
+
+bool D3D12RenderSystem::MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize)
+{
+    return false;//todo
+}
+
+void D3D12RenderSystem::UnmapTextureReadback(std::uint64_t ticket)
+{
+    //todo
+}
+
 void D3D12RenderSystem::GenerateMips(Texture& texture)
 {
     //todo
@@ -279,6 +319,18 @@ void D3D12RenderSystem::Release(SamplerArray& samplerArray)
     //RemoveFromUniqueSet(samplerArrays_, &samplerArray);
 }
 
+/* ----- Resource Heaps ----- */
+
+ResourceHeap* D3D12RenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    return nullptr;//todo (descriptor heap and descriptor table)
+}
+
+void D3D12RenderSystem::Release(ResourceHeap& resourceHeap)
+{
+    //RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
+}
+
 /* ----- Render Targets ----- */
 
 RenderTarget* D3D12RenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
@@ -347,6 +399,24 @@ void D3D12RenderSystem::Release(Query& query)
     //todo...
 }
 
+/* ----- Fences ----- */
+
+Fence* D3D12RenderSystem::CreateFence()
+{
+    return TakeOwnership(fences_, MakeUnique<D3D12Fence>(device_.Get()));
+}
+
+void D3D12RenderSystem::Release(Fence& fence)
+{
+    RemoveFromUniqueSet(fences_, &fence);
+}
+
+bool D3D12RenderSystem::WaitFence(Fence& fence, std::uint64_t timeout)
+{
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    return fenceD3D.Wait(timeout);
+}
+
 
 /* ----- Extended internal functions ----- */
 
@@ -591,6 +661,10 @@ void D3D12RenderSystem::QueryRenderingCaps()
 {
     RenderingCaps caps;
     DXGetRenderingCaps(caps, GetFeatureLevel());
+
+    /* Indirect commands are not yet implemented for D3D12 (requires command signatures) */
+    caps.hasIndirectDrawing = false;
+
     SetRenderingCaps(caps);
 }
 
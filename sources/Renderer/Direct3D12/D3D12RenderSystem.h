@@ -19,11 +19,13 @@
 #include "Texture/D3D12Texture.h"
 
 #include "RenderState/D3D12GraphicsPipeline.h"
+#include "RenderState/D3D12Fence.h"
 
 #include "Shader/D3D12Shader.h"
 #include "Shader/D3D12ShaderProgram.h"
 
 #include "../ContainerTypes.h"
+#include "../MemoryAccounting.h"
 #include "../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <dxgi1_4.h>
@@ -43,6 +45,8 @@ class D3D12RenderSystem : public RenderSystem
         D3D12RenderSystem();
         ~D3D12RenderSystem();
 
+        MemoryStatistics QueryMemoryStatistics() override;
+
         /* ----- Render Context ------ */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -80,8 +84,15 @@ class D3D12RenderSystem : public RenderSystem
         
         void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
 
+        std::uint64_t WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
+        bool IsTextureUploadComplete(std::uint64_t ticket) override;
+
         void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) override;
 
+        std::uint64_t ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc) override;
+        bool MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize) override;
+        void UnmapTextureReadback(std::uint64_t ticket) override;
+
         void GenerateMips(Texture& texture) override;
 
         /* ----- Sampler States ---- */
@@ -92,6 +103,12 @@ class D3D12RenderSystem : public RenderSystem
         void Release(Sampler& sampler) override;
         void Release(SamplerArray& samplerArray) override;
 
+        /* ----- Resource Heaps ----- */
+
+        ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
+
+        void Release(ResourceHeap& resourceHeap) override;
+
         /* ----- Render Targets ----- */
 
         RenderTarget* CreateRenderTarget(const RenderTargetDescriptor& desc) override;
@@ -120,6 +137,14 @@ class D3D12RenderSystem : public RenderSystem
 
         void Release(Query& query) override;
 
+        /* ----- Fences ----- */
+
+        Fence* CreateFence() override;
+
+        void Release(Fence& fence) override;
+
+        bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+
         /* ----- Extended internal functions ----- */
 
         ComPtr<IDXGISwapChain1> CreateDXSwapChain(const DXGI_SWAP_CHAIN_DESC1& desc, HWND wnd);
@@ -204,12 +229,15 @@ class D3D12RenderSystem : public RenderSystem
         HWObjectContainer<D3D12Shader>              shaders_;
         HWObjectContainer<D3D12ShaderProgram>       shaderPrograms_;
         HWObjectContainer<D3D12GraphicsPipeline>    graphicsPipelines_;
+        HWObjectContainer<D3D12Fence>               fences_;
         //HWObjectContainer<D3D12Sampler>             samplers_;
 
         /* ----- Other members ----- */
 
         std::vector<VideoAdapterDescriptor>         videoAdatperDescs_;
 
+        MemoryAccounting                            memoryAccounting_;
+
 };
 
 
@@ -0,0 +1,70 @@
+/*
+ * D3D12Fence.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "D3D12Fence.h"
+#include "../../DXCommon/DXCore.h"
+
+
+namespace LLGL
+{
+
+
+D3D12Fence::D3D12Fence(ID3D12Device* device)
+{
+    /* Create D3D12 fence */
+    auto hr = device->CreateFence(value_, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(fence_.ReleaseAndGetAddressOf()));
+    DXThrowIfFailed(hr, "failed to create D3D12 fence");
+
+    /* Create Win32 event */
+    event_ = CreateEventEx(nullptr, nullptr, 0, EVENT_ALL_ACCESS);
+}
+
+D3D12Fence::~D3D12Fence()
+{
+    CloseHandle(event_);
+}
+
+bool D3D12Fence::IsSignaled()
+{
+    return (fence_->GetCompletedValue() >= value_);
+}
+
+void D3D12Fence::Signal(ID3D12CommandQueue* commandQueue)
+{
+    /* Schedule signal command into the queue */
+    auto hr = commandQueue->Signal(fence_.Get(), ++value_);
+    DXThrowIfFailed(hr, "failed to signal D3D12 fence into command queue");
+}
+
+// Converts the timeout from nanoseconds into milliseconds, rounded up, for "WaitForSingleObjectEx"
+static DWORD GetTimeoutMilliseconds(std::uint64_t timeout)
+{
+    if (timeout == ~0ull)
+        return INFINITE;
+
+    auto milliseconds = (timeout / 1000000ull) + (timeout % 1000000ull != 0 ? 1 : 0);
+    return static_cast<DWORD>(milliseconds < INFINITE ? milliseconds : INFINITE - 1);
+}
+
+bool D3D12Fence::Wait(std::uint64_t timeout)
+{
+    if (IsSignaled())
+        return true;
+
+    /* Wait until the fence has been crossed or the timeout has expired */
+    auto hr = fence_->SetEventOnCompletion(value_, event_);
+    DXThrowIfFailed(hr, "failed to set 'on completion'-event for D3D12 fence");
+
+    return (WaitForSingleObjectEx(event_, GetTimeoutMilliseconds(timeout), FALSE) == WAIT_OBJECT_0);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
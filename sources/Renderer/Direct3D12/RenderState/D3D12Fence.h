@@ -0,0 +1,55 @@
+/*
+ * D3D12Fence.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_D3D12_FENCE_H
+#define LLGL_D3D12_FENCE_H
+
+
+#include <LLGL/Fence.h>
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Fence with its own D3D12 fence object, whose value is incremented each time the fence is signaled.
+class D3D12Fence : public Fence
+{
+
+    public:
+
+        D3D12Fence(ID3D12Device* device);
+        ~D3D12Fence();
+
+        bool IsSignaled() override;
+
+        // Schedules a signal command with the next fence value into the specified command queue.
+        void Signal(ID3D12CommandQueue* commandQueue);
+
+        // Waits until the last signaled fence value has been reached or the timeout (in nanoseconds) has expired.
+        bool Wait(std::uint64_t timeout);
+
+    private:
+
+        ComPtr<ID3D12Fence> fence_;
+        HANDLE              event_  = 0;
+        UINT64              value_  = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
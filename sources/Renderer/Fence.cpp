@@ -0,0 +1,24 @@
+/*
+ * Fence.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/Fence.h>
+
+
+namespace LLGL
+{
+
+
+Fence::~Fence()
+{
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,576 @@
+/*
+ * FrameGraph.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/FrameGraph.h>
+#include "TextureParams.h"
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+FrameGraph::FrameGraph(RenderSystem& renderSystem, unsigned int maxUnusedFrames) :
+    renderSystem_    { renderSystem    },
+    maxUnusedFrames_ { maxUnusedFrames }
+{
+}
+
+FrameGraph::~FrameGraph()
+{
+    for (const auto& entry : physicalRenderTargets_)
+        renderSystem_.Release(*entry.renderTarget);
+    for (const auto& entry : physicalTextures_)
+        renderSystem_.Release(*entry.texture);
+}
+
+/* ----- Resources ----- */
+
+FrameGraphResource FrameGraph::CreateTexture(const TextureDescriptor& desc)
+{
+    ResourceEntry resource;
+    resource.textureDesc = desc;
+    resources_.push_back(resource);
+    compiled_ = false;
+    return static_cast<FrameGraphResource>(resources_.size() - 1);
+}
+
+FrameGraphResource FrameGraph::ImportTexture(Texture& texture)
+{
+    ResourceEntry resource;
+    resource.texture    = &texture;
+    resource.imported   = true;
+    resources_.push_back(resource);
+    compiled_ = false;
+    return static_cast<FrameGraphResource>(resources_.size() - 1);
+}
+
+FrameGraphResource FrameGraph::ImportBuffer(Buffer& buffer)
+{
+    ResourceEntry resource;
+    resource.buffer     = &buffer;
+    resource.imported   = true;
+    resources_.push_back(resource);
+    compiled_ = false;
+    return static_cast<FrameGraphResource>(resources_.size() - 1);
+}
+
+/* ----- Passes ----- */
+
+FrameGraphPass FrameGraph::AddPass(const std::string& name, const FrameGraphExecuteFunction& execute)
+{
+    PassEntry pass;
+    pass.name       = name;
+    pass.execute    = execute;
+    passes_.push_back(pass);
+    compiled_ = false;
+    return static_cast<FrameGraphPass>(passes_.size() - 1);
+}
+
+void FrameGraph::Read(FrameGraphPass pass, FrameGraphResource resource)
+{
+    GetResource(resource);
+    GetPass(pass).reads.push_back(resource);
+    compiled_ = false;
+}
+
+void FrameGraph::Write(FrameGraphPass pass, FrameGraphResource resource)
+{
+    auto& resourceEntry = GetResource(resource);
+    auto& passEntry = GetPass(pass);
+
+    passEntry.writes.push_back(resource);
+    resourceEntry.producers.push_back(pass);
+
+    /* Writing to an imported resource is a side effect, which cannot be culled */
+    if (resourceEntry.imported)
+        passEntry.sideEffect = true;
+
+    compiled_ = false;
+}
+
+void FrameGraph::WriteAttachment(FrameGraphPass pass, FrameGraphResource resource, bool clear)
+{
+    auto& resourceEntry = GetResource(resource);
+    auto& passEntry = GetPass(pass);
+
+    if (resourceEntry.buffer != nullptr)
+        throw std::invalid_argument("cannot attach buffer to render target in frame graph pass: " + passEntry.name);
+
+    /* Determine attachment type by texture format */
+    const auto format = (resourceEntry.texture != nullptr ? renderSystem_.QueryTextureDescriptor(*resourceEntry.texture).format : resourceEntry.textureDesc.format);
+
+    if (IsDepthStencilFormat(format))
+    {
+        if (passEntry.depthAttachment.resource != invalidIndex)
+            throw std::invalid_argument("frame graph pass already has a depth attachment: " + passEntry.name);
+        passEntry.depthAttachment = { resource, clear };
+    }
+    else
+        passEntry.colorAttachments.push_back({ resource, clear });
+
+    resourceEntry.producers.push_back(pass);
+
+    if (resourceEntry.imported)
+        passEntry.sideEffect = true;
+
+    compiled_ = false;
+}
+
+void FrameGraph::WriteRenderContext(FrameGraphPass pass, RenderContext& renderContext, bool clear)
+{
+    auto& passEntry = GetPass(pass);
+
+    passEntry.renderContext         = &renderContext;
+    passEntry.clearRenderContext    = clear;
+    passEntry.sideEffect            = true;
+
+    compiled_ = false;
+}
+
+/* ----- Execution ----- */
+
+void FrameGraph::Compile()
+{
+    stats_ = FrameGraphStatistics();
+    stats_.numPasses = static_cast<unsigned int>(passes_.size());
+
+    /* Reset allocations of a previous compilation in the same frame */
+    for (auto& resource : resources_)
+    {
+        if (!resource.imported)
+            resource.texture = nullptr;
+        resource.firstPass  = invalidIndex;
+        resource.lastPass   = invalidIndex;
+    }
+
+    for (auto& entry : physicalTextures_)
+    {
+        if (entry.lastFrame == frame_)
+            entry.lastFrame = frame_ - 1;
+    }
+
+    CullPasses();
+    ComputeLifetimes();
+    AllocateTextures();
+    AllocateRenderTargets();
+
+    compiled_ = true;
+}
+
+void FrameGraph::Execute(CommandBuffer& commandBuffer)
+{
+    if (!compiled_)
+        Compile();
+
+    for (std::uint32_t i = 0; i < passes_.size(); ++i)
+    {
+        if (!passes_[i].culled)
+            ExecutePass(commandBuffer, i);
+    }
+}
+
+void FrameGraph::Reset()
+{
+    resources_.clear();
+    passes_.clear();
+    compiled_ = false;
+
+    /* Release render targets before textures, since render targets are never used longer than their attachments */
+    auto IsUnused = [this](std::uint64_t lastFrame)
+    {
+        return (frame_ - lastFrame > maxUnusedFrames_);
+    };
+
+    for (auto it = physicalRenderTargets_.begin(); it != physicalRenderTargets_.end();)
+    {
+        if (IsUnused(it->lastFrame))
+        {
+            renderSystem_.Release(*(it->renderTarget));
+            it = physicalRenderTargets_.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    for (auto it = physicalTextures_.begin(); it != physicalTextures_.end();)
+    {
+        if (IsUnused(it->lastFrame))
+        {
+            renderSystem_.Release(*(it->texture));
+            it = physicalTextures_.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    ++frame_;
+}
+
+Texture& FrameGraph::GetTexture(FrameGraphResource resource) const
+{
+    const auto& resourceEntry = GetResource(resource);
+    if (resourceEntry.texture == nullptr)
+        throw std::runtime_error("frame graph resource is not an allocated texture");
+    return *resourceEntry.texture;
+}
+
+Buffer& FrameGraph::GetBuffer(FrameGraphResource resource) const
+{
+    const auto& resourceEntry = GetResource(resource);
+    if (resourceEntry.buffer == nullptr)
+        throw std::runtime_error("frame graph resource is not a buffer");
+    return *resourceEntry.buffer;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+FrameGraph::ResourceEntry& FrameGraph::GetResource(FrameGraphResource resource)
+{
+    if (resource >= resources_.size())
+        throw std::invalid_argument("invalid frame graph resource handle");
+    return resources_[resource];
+}
+
+const FrameGraph::ResourceEntry& FrameGraph::GetResource(FrameGraphResource resource) const
+{
+    if (resource >= resources_.size())
+        throw std::invalid_argument("invalid frame graph resource handle");
+    return resources_[resource];
+}
+
+FrameGraph::PassEntry& FrameGraph::GetPass(FrameGraphPass pass)
+{
+    if (pass >= passes_.size())
+        throw std::invalid_argument("invalid frame graph pass handle");
+    return passes_[pass];
+}
+
+template <typename Function>
+static void ForEachPassResource(
+    const std::vector<FrameGraphResource>& reads, const std::vector<FrameGraphResource>& writes,
+    const std::vector<FrameGraphResource>& attachments, Function func)
+{
+    for (auto resource : reads)
+        func(resource);
+    for (auto resource : writes)
+        func(resource);
+    for (auto resource : attachments)
+        func(resource);
+}
+
+void FrameGraph::CullPasses()
+{
+    /* Initialize reference counters: passes are referenced by the resources they write, resources by the passes that read them */
+    for (auto& pass : passes_)
+    {
+        pass.culled     = false;
+        pass.refCount   = static_cast<unsigned int>(pass.writes.size() + pass.colorAttachments.size());
+        if (pass.depthAttachment.resource != invalidIndex)
+            ++pass.refCount;
+    }
+
+    for (auto& resource : resources_)
+        resource.refCount = 0;
+
+    for (const auto& pass : passes_)
+    {
+        for (auto resource : pass.reads)
+            ++resources_[resource].refCount;
+    }
+
+    std::vector<FrameGraphResource> unreferenced;
+
+    auto CullPass = [&](PassEntry& pass)
+    {
+        pass.culled = true;
+        ++stats_.numCulledPasses;
+        for (auto resource : pass.reads)
+        {
+            if (--resources_[resource].refCount == 0)
+                unreferenced.push_back(resource);
+        }
+    };
+
+    /* Gather all resources which are never read (before culling, so each resource is only queued once when its counter drops to zero) */
+    for (FrameGraphResource i = 0; i < resources_.size(); ++i)
+    {
+        if (resources_[i].refCount == 0)
+            unreferenced.push_back(i);
+    }
+
+    /* Cull all passes without any results */
+    for (auto& pass : passes_)
+    {
+        if (pass.refCount == 0 && !pass.sideEffect)
+            CullPass(pass);
+    }
+
+    /* Cull all passes whose results are never read */
+    while (!unreferenced.empty())
+    {
+        auto resource = unreferenced.back();
+        unreferenced.pop_back();
+
+        for (auto producer : resources_[resource].producers)
+        {
+            auto& pass = passes_[producer];
+            if (!pass.culled && !pass.sideEffect && --pass.refCount == 0)
+                CullPass(pass);
+        }
+    }
+}
+
+void FrameGraph::ComputeLifetimes()
+{
+    std::vector<FrameGraphResource> attachments;
+
+    for (std::uint32_t i = 0; i < passes_.size(); ++i)
+    {
+        const auto& pass = passes_[i];
+        if (pass.culled)
+            continue;
+
+        attachments.clear();
+        for (const auto& attachment : pass.colorAttachments)
+            attachments.push_back(attachment.resource);
+        if (pass.depthAttachment.resource != invalidIndex)
+            attachments.push_back(pass.depthAttachment.resource);
+
+        ForEachPassResource(
+            pass.reads, pass.writes, attachments,
+            [this, i](FrameGraphResource resource)
+            {
+                auto& resourceEntry = resources_[resource];
+                if (resourceEntry.firstPass == invalidIndex)
+                    resourceEntry.firstPass = i;
+                resourceEntry.lastPass = i;
+            }
+        );
+    }
+
+    for (const auto& resource : resources_)
+    {
+        if (!resource.imported && resource.firstPass != invalidIndex)
+            ++stats_.numTransientTextures;
+    }
+}
+
+void FrameGraph::AllocateTextures()
+{
+    /* Allocate transient textures in the order of their first use, so that textures of expired resources can be aliased */
+    std::vector<FrameGraphResource> order;
+
+    for (FrameGraphResource i = 0; i < resources_.size(); ++i)
+    {
+        if (!resources_[i].imported && resources_[i].firstPass != invalidIndex)
+            order.push_back(i);
+    }
+
+    std::stable_sort(
+        order.begin(), order.end(),
+        [this](FrameGraphResource lhs, FrameGraphResource rhs)
+        {
+            return (resources_[lhs].firstPass < resources_[rhs].firstPass);
+        }
+    );
+
+    for (auto resource : order)
+        resources_[resource].texture = AcquireTexture(resources_[resource]);
+
+    for (const auto& entry : physicalTextures_)
+    {
+        if (entry.lastFrame == frame_)
+            ++stats_.numPhysicalTextures;
+    }
+}
+
+void FrameGraph::AllocateRenderTargets()
+{
+    std::vector<Texture*> attachments;
+
+    for (auto& pass : passes_)
+    {
+        pass.renderTarget = nullptr;
+
+        if (pass.culled || pass.renderContext != nullptr)
+            continue;
+
+        /* Gather color attachments first, then the depth attachment */
+        attachments.clear();
+        for (const auto& attachment : pass.colorAttachments)
+            attachments.push_back(resources_[attachment.resource].texture);
+        if (pass.depthAttachment.resource != invalidIndex)
+            attachments.push_back(resources_[pass.depthAttachment.resource].texture);
+
+        if (!attachments.empty())
+            pass.renderTarget = AcquireRenderTarget(attachments);
+    }
+}
+
+Texture* FrameGraph::AcquireTexture(const ResourceEntry& resource)
+{
+    const auto params = GetTextureParams(resource.textureDesc);
+
+    /* Find texture with equal descriptor, which is either unused in this frame or whose previous resource has already expired */
+    for (auto& entry : physicalTextures_)
+    {
+        if ( GetTextureParams(entry.desc) == params &&
+             (entry.lastFrame != frame_ || entry.lastPass < resource.firstPass) )
+        {
+            entry.lastFrame = frame_;
+            entry.lastPass  = resource.lastPass;
+            return entry.texture;
+        }
+    }
+
+    /* Create new texture */
+    PhysicalTexture entry;
+    {
+        entry.desc      = resource.textureDesc;
+        entry.texture   = renderSystem_.CreateTexture(resource.textureDesc);
+        entry.lastFrame = frame_;
+        entry.lastPass  = resource.lastPass;
+    }
+    physicalTextures_.push_back(entry);
+
+    return entry.texture;
+}
+
+RenderTarget* FrameGraph::AcquireRenderTarget(const std::vector<Texture*>& attachments)
+{
+    /* Find render target with the same attachments */
+    for (auto& entry : physicalRenderTargets_)
+    {
+        if (entry.attachments == attachments)
+        {
+            entry.lastFrame = frame_;
+            return entry.renderTarget;
+        }
+    }
+
+    /* Create new render target; multi-sampled textures require custom multi-sampling */
+    RenderTargetDescriptor renderTargetDesc;
+    {
+        const auto type = attachments.front()->GetType();
+        if (type == TextureType::Texture2DMS || type == TextureType::Texture2DMSArray)
+        {
+            const auto firstDesc = renderSystem_.QueryTextureDescriptor(*attachments.front());
+            renderTargetDesc.multiSampling          = MultiSamplingDescriptor(firstDesc.texture2DMS.samples);
+            renderTargetDesc.customMultiSampling    = true;
+        }
+    }
+    auto renderTarget = renderSystem_.CreateRenderTarget(renderTargetDesc);
+
+    for (auto texture : attachments)
+        renderTarget->AttachTexture(*texture, {});
+
+    PhysicalRenderTarget entry;
+    {
+        entry.attachments   = attachments;
+        entry.renderTarget  = renderTarget;
+        entry.lastFrame     = frame_;
+    }
+    physicalRenderTargets_.push_back(entry);
+
+    return renderTarget;
+}
+
+void FrameGraph::ExecutePass(CommandBuffer& commandBuffer, std::uint32_t passIndex)
+{
+    const auto& pass = passes_[passIndex];
+
+    if (pass.renderContext != nullptr)
+        SetPassRenderContext(commandBuffer, passIndex);
+    else if (pass.renderTarget != nullptr)
+        SetPassRenderTarget(commandBuffer, passIndex);
+
+    if (pass.execute)
+        pass.execute(commandBuffer, *this);
+}
+
+void FrameGraph::SetPassRenderContext(CommandBuffer& commandBuffer, std::uint32_t passIndex)
+{
+    const auto& pass = passes_[passIndex];
+
+    /* Depth and stencil buffers of the render context are only stored if a later pass renders into the same render context */
+    bool storeDepthStencil = false;
+
+    for (auto i = passIndex + 1; i < passes_.size(); ++i)
+    {
+        if (!passes_[i].culled && passes_[i].renderContext == pass.renderContext)
+        {
+            storeDepthStencil = true;
+            break;
+        }
+    }
+
+    const auto loadOp = (pass.clearRenderContext ? AttachmentLoadOp::Clear : AttachmentLoadOp::Load);
+    const auto depthStencilStoreOp = (storeDepthStencil ? AttachmentStoreOp::Store : AttachmentStoreOp::Discard);
+
+    renderPass_.colorAttachments.resize(1);
+    renderPass_.colorAttachments[0]     = { loadOp, AttachmentStoreOp::Store };
+    renderPass_.depthAttachment         = { loadOp, depthStencilStoreOp };
+    renderPass_.stencilAttachment       = { loadOp, depthStencilStoreOp };
+
+    commandBuffer.SetRenderTarget(*pass.renderContext, &renderPass_);
+}
+
+void FrameGraph::SetPassRenderTarget(CommandBuffer& commandBuffer, std::uint32_t passIndex)
+{
+    const auto& pass = passes_[passIndex];
+
+    /*
+    Attachments are only loaded if they have been used before (otherwise they are cleared or their content is undefined),
+    and only stored if they are used afterwards or if they are imported
+    */
+    auto GetAttachmentOps = [this, passIndex](const AttachmentEntry& attachment) -> RenderPassAttachmentDescriptor
+    {
+        const auto& resource = resources_[attachment.resource];
+
+        auto loadOp = AttachmentLoadOp::Load;
+        if (resource.firstPass == passIndex)
+        {
+            if (attachment.clear)
+                loadOp = AttachmentLoadOp::Clear;
+            else if (!resource.imported)
+                loadOp = AttachmentLoadOp::DontCare;
+        }
+
+        auto storeOp = (resource.imported || resource.lastPass > passIndex ? AttachmentStoreOp::Store : AttachmentStoreOp::Discard);
+
+        return { loadOp, storeOp };
+    };
+
+    renderPass_.colorAttachments.resize(pass.colorAttachments.size());
+    for (std::size_t i = 0; i < pass.colorAttachments.size(); ++i)
+        renderPass_.colorAttachments[i] = GetAttachmentOps(pass.colorAttachments[i]);
+
+    if (pass.depthAttachment.resource != invalidIndex)
+    {
+        renderPass_.depthAttachment     = GetAttachmentOps(pass.depthAttachment);
+        renderPass_.stencilAttachment   = renderPass_.depthAttachment;
+    }
+    else
+    {
+        renderPass_.depthAttachment     = RenderPassAttachmentDescriptor();
+        renderPass_.stencilAttachment   = RenderPassAttachmentDescriptor();
+    }
+
+    commandBuffer.SetRenderTarget(*pass.renderTarget, &renderPass_);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
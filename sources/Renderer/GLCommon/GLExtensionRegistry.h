@@ -29,15 +29,20 @@ enum class GLExt
     ARB_clear_texture,
     ARB_texture_compression,
     ARB_texture_multisample,
+    ARB_texture_storage,
+    ARB_texture_storage_multisample,
     ARB_sampler_objects,
     ARB_multi_bind,
     ARB_vertex_buffer_object,
     ARB_instanced_arrays,
     ARB_vertex_array_object,
     ARB_framebuffer_object,
+    ARB_invalidate_subdata,
     ARB_draw_instanced,
     ARB_draw_elements_base_vertex,
     ARB_base_instance,
+    ARB_draw_indirect,
+    ARB_multi_draw_indirect,
     ARB_shader_objects,
     ARB_tessellation_shader,
     ARB_compute_shader,
@@ -45,6 +50,10 @@ enum class GLExt
     ARB_program_interface_query,
     ARB_uniform_buffer_object,
     ARB_shader_storage_buffer_object,
+    ARB_map_buffer_range,
+    ARB_sync,
+    ARB_buffer_storage,
+    ARB_vertex_attrib_binding,
     ARB_occlusion_query,
     NV_conditional_render,
     ARB_timer_query,
@@ -55,6 +64,7 @@ enum class GLExt
     EXT_transform_feedback,
     NV_transform_feedback,
     EXT_gpu_shader4,
+    ARB_direct_state_access,
 
     /* Extensions without procedures */
     ARB_texture_cube_map,
@@ -63,6 +73,8 @@ enum class GLExt
     ARB_geometry_shader4,
     NV_conservative_raster,
     INTEL_conservative_rasterization,
+    NVX_gpu_memory_info,
+    ATI_meminfo,
 
     /* Enumeration entry counter */
     Count,
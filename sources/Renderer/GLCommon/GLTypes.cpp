@@ -6,6 +6,7 @@
  */
 
 #include "GLTypes.h"
+#include "../MappingTable.h"
 #include <stdexcept>
 #include <string>
 
@@ -20,9 +21,9 @@ namespace GLTypes
 /* ----- Internal functions ----- */
 
 [[noreturn]]
-static void MapFailed(const std::string& typeName)
+static void MapFailed(const char* typeName)
 {
-    throw std::invalid_argument("failed to map '" + typeName + "' to OpenGL parameter");
+    throw std::invalid_argument("failed to map '" + std::string(typeName) + "' to OpenGL parameter");
 }
 
 [[noreturn]]
@@ -32,500 +33,560 @@ static void UnmapFailed(const std::string& typeName)
 }
 
 
-/* ----- Map functions ----- */
+/* ----- Mapping tables ----- */
 
-GLenum Map(const BufferCPUAccess cpuAccess)
+// Value of unmapped entries, which is not a valid GL enumeration value
+static constexpr GLenum g_unmapped = 0xFFFFFFFF;
+
+// Selects the value only for desktop OpenGL, i.e. the entry is unmapped for OpenGL ES
+#ifdef LLGL_OPENGL
+#   define DESKTOP_GL(VALUE) VALUE
+#else
+#   define DESKTOP_GL(VALUE) g_unmapped
+#endif
+
+static constexpr MappingEntry<BufferCPUAccess, GLenum> g_bufferCPUAccessMap[] =
 {
-    #ifdef LLGL_OPENGL
-    switch (cpuAccess)
-    {
-        case BufferCPUAccess::ReadOnly:     return GL_READ_ONLY;
-        case BufferCPUAccess::WriteOnly:    return GL_WRITE_ONLY;
-        case BufferCPUAccess::ReadWrite:    return GL_READ_WRITE;
-    }
-    #endif
-    MapFailed("BufferCPUAccess");
-}
+    { BufferCPUAccess::ReadOnly,    DESKTOP_GL( GL_READ_ONLY  ) },
+    { BufferCPUAccess::WriteOnly,   DESKTOP_GL( GL_WRITE_ONLY ) },
+    { BufferCPUAccess::ReadWrite,   DESKTOP_GL( GL_READ_WRITE ) },
+};
 
-GLenum Map(const DataType dataType)
+static constexpr MappingEntry<DataType, GLenum> g_dataTypeMap[] =
 {
-    switch (dataType)
-    {
-        case DataType::Int8:    return GL_BYTE;
-        case DataType::UInt8:   return GL_UNSIGNED_BYTE;
-        case DataType::Int16:   return GL_SHORT;
-        case DataType::UInt16:  return GL_UNSIGNED_SHORT;
-        case DataType::Int32:   return GL_INT;
-        case DataType::UInt32:  return GL_UNSIGNED_INT;
-        case DataType::Float:   return GL_FLOAT;
-        #ifdef LLGL_OPENGL
-        case DataType::Double:  return GL_DOUBLE;
-        #else
-        default:                break;
-        #endif
-    }
-    MapFailed("DataType");
-}
+    { DataType::Int8,   GL_BYTE                     },
+    { DataType::UInt8,  GL_UNSIGNED_BYTE            },
+    { DataType::Int16,  GL_SHORT                    },
+    { DataType::UInt16, GL_UNSIGNED_SHORT           },
+    { DataType::Int32,  GL_INT                      },
+    { DataType::UInt32, GL_UNSIGNED_INT             },
+    { DataType::Float,  GL_FLOAT                    },
+    { DataType::Double, DESKTOP_GL( GL_DOUBLE )     },
+};
+
+static constexpr MappingEntry<PrimitiveType, GLenum> g_primitiveTypeMap[] =
+{
+    { PrimitiveType::Points,    GL_POINTS    },
+    { PrimitiveType::Lines,     GL_LINES     },
+    { PrimitiveType::Triangles, GL_TRIANGLES },
+};
 
-GLenum Map(const PrimitiveType primitiveType)
+static constexpr MappingEntry<PrimitiveTopology, GLenum> g_primitiveTopologyMap[] =
 {
-    switch (primitiveType)
-    {
-        case PrimitiveType::Points:     return GL_POINTS;
-        case PrimitiveType::Lines:      return GL_LINES;
-        case PrimitiveType::Triangles:  return GL_TRIANGLES;
-    }
-    MapFailed("PrimitiveType");
-}
+    { PrimitiveTopology::PointList,                 GL_POINTS                                   },
+    { PrimitiveTopology::LineList,                  GL_LINES                                    },
+    { PrimitiveTopology::LineStrip,                 GL_LINE_STRIP                               },
+    { PrimitiveTopology::LineLoop,                  GL_LINE_LOOP                                },
+    { PrimitiveTopology::LineListAdjacency,         DESKTOP_GL( GL_LINES_ADJACENCY )            },
+    { PrimitiveTopology::LineStripAdjacency,        DESKTOP_GL( GL_LINE_STRIP_ADJACENCY )       },
+    { PrimitiveTopology::TriangleList,              GL_TRIANGLES                                },
+    { PrimitiveTopology::TriangleStrip,             GL_TRIANGLE_STRIP                           },
+    { PrimitiveTopology::TriangleFan,               GL_TRIANGLE_FAN                             },
+    { PrimitiveTopology::TriangleListAdjacency,     DESKTOP_GL( GL_TRIANGLES_ADJACENCY )        },
+    { PrimitiveTopology::TriangleStripAdjacency,    DESKTOP_GL( GL_TRIANGLE_STRIP_ADJACENCY )   },
+    { PrimitiveTopology::Patches1,                  DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches2,                  DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches3,                  DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches4,                  DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches5,                  DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches6,                  DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches7,                  DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches8,                  DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches9,                  DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches10,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches11,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches12,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches13,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches14,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches15,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches16,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches17,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches18,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches19,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches20,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches21,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches22,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches23,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches24,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches25,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches26,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches27,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches28,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches29,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches30,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches31,                 DESKTOP_GL( GL_PATCHES )                    },
+    { PrimitiveTopology::Patches32,                 DESKTOP_GL( GL_PATCHES )                    },
+};
+
+static constexpr MappingEntry<TextureType, GLenum> g_textureTypeMap[] =
+{
+    { TextureType::Texture1D,           DESKTOP_GL( GL_TEXTURE_1D )                     },
+    { TextureType::Texture2D,           GL_TEXTURE_2D                                   },
+    { TextureType::Texture3D,           GL_TEXTURE_3D                                   },
+    { TextureType::TextureCube,         GL_TEXTURE_CUBE_MAP                             },
+    { TextureType::Texture1DArray,      DESKTOP_GL( GL_TEXTURE_1D_ARRAY )               },
+    { TextureType::Texture2DArray,      GL_TEXTURE_2D_ARRAY                             },
+    { TextureType::TextureCubeArray,    DESKTOP_GL( GL_TEXTURE_CUBE_MAP_ARRAY )         },
+    { TextureType::Texture2DMS,         DESKTOP_GL( GL_TEXTURE_2D_MULTISAMPLE )         },
+    { TextureType::Texture2DMSArray,    DESKTOP_GL( GL_TEXTURE_2D_MULTISAMPLE_ARRAY )   },
+};
+
+static constexpr MappingEntry<TextureFormat, GLenum> g_textureFormatMap[] =
+{
+    { TextureFormat::Unknown,           g_unmapped                                          },
 
-GLenum Map(const PrimitiveTopology primitiveTopology)
+    /* --- Base internal formats --- */
+    { TextureFormat::DepthComponent,    GL_DEPTH_COMPONENT                                  },
+    { TextureFormat::DepthStencil,      GL_DEPTH_STENCIL                                    },
+    { TextureFormat::R,                 GL_RED                                              },
+    { TextureFormat::RG,                GL_RG                                               },
+    { TextureFormat::RGB,               GL_RGB                                              },
+    { TextureFormat::RGBA,              GL_RGBA                                             },
+
+    /* --- Sized internal formats --- */
+    { TextureFormat::R8,                GL_R8                                               },
+    { TextureFormat::R8Sgn,             GL_R8_SNORM                                         },
+
+    { TextureFormat::R16,               DESKTOP_GL( GL_R16 )                                },
+    { TextureFormat::R16Sgn,            DESKTOP_GL( GL_R16_SNORM )                          },
+    { TextureFormat::R16Float,          GL_R16F                                             },
+
+    { TextureFormat::R32UInt,           GL_R32I                                             },
+    { TextureFormat::R32SInt,           GL_R32UI                                            },
+    { TextureFormat::R32Float,          GL_R32F                                             },
+
+    { TextureFormat::RG8,               GL_RG8                                              },
+    { TextureFormat::RG8Sgn,            GL_RG8_SNORM                                        },
+
+    { TextureFormat::RG16,              DESKTOP_GL( GL_RG16 )                               },
+    { TextureFormat::RG16Sgn,           DESKTOP_GL( GL_RG16_SNORM )                         },
+    { TextureFormat::RG16Float,         GL_RG16F                                            },
+
+    { TextureFormat::RG32UInt,          GL_RG32UI                                           },
+    { TextureFormat::RG32SInt,          GL_RG32I                                            },
+    { TextureFormat::RG32Float,         GL_RG32F                                            },
+
+    { TextureFormat::RGB8,              GL_RGB8                                             },
+    { TextureFormat::RGB8Sgn,           GL_RGB8_SNORM                                       },
+
+    { TextureFormat::RGB16,             DESKTOP_GL( GL_RGB16 )                              },
+    { TextureFormat::RGB16Sgn,          DESKTOP_GL( GL_RGB16_SNORM )                        },
+    { TextureFormat::RGB16Float,        GL_RGB16F                                           },
+
+    { TextureFormat::RGB32UInt,         GL_RGB32UI                                          },
+    { TextureFormat::RGB32SInt,         GL_RGB32I                                           },
+    { TextureFormat::RGB32Float,        GL_RGB32F                                           },
+
+    { TextureFormat::RGBA8,             GL_RGBA8                                            },
+    { TextureFormat::RGBA8Sgn,          GL_RGBA8_SNORM                                      },
+
+    { TextureFormat::RGBA16,            DESKTOP_GL( GL_RGBA16 )                             },
+    { TextureFormat::RGBA16Sgn,         DESKTOP_GL( GL_RGBA16_SNORM )                       },
+    { TextureFormat::RGBA16Float,       GL_RGBA16F                                          },
+
+    { TextureFormat::RGBA32UInt,        GL_RGBA32UI                                         },
+    { TextureFormat::RGBA32SInt,        GL_RGBA32I                                          },
+    { TextureFormat::RGBA32Float,       GL_RGBA32F                                          },
+
+    /* --- Compressed formats --- */
+    { TextureFormat::RGB_DXT1,          DESKTOP_GL( GL_COMPRESSED_RGB_S3TC_DXT1_EXT )       },
+    { TextureFormat::RGBA_DXT1,         DESKTOP_GL( GL_COMPRESSED_RGBA_S3TC_DXT1_EXT )      },
+    { TextureFormat::RGBA_DXT3,         DESKTOP_GL( GL_COMPRESSED_RGBA_S3TC_DXT3_EXT )      },
+    { TextureFormat::RGBA_DXT5,         DESKTOP_GL( GL_COMPRESSED_RGBA_S3TC_DXT5_EXT )      },
+};
+
+static constexpr MappingEntry<ImageFormat, GLenum> g_imageFormatMap[] =
 {
-    switch (primitiveTopology)
-    {
-        case PrimitiveTopology::PointList:              return GL_POINTS;
-        case PrimitiveTopology::LineList:               return GL_LINES;
-        case PrimitiveTopology::LineStrip:              return GL_LINE_STRIP;
-        case PrimitiveTopology::LineLoop:               return GL_LINE_LOOP;
-        #ifdef LLGL_OPENGL
-        case PrimitiveTopology::LineListAdjacency:      return GL_LINES_ADJACENCY;
-        case PrimitiveTopology::LineStripAdjacency:     return GL_LINE_STRIP_ADJACENCY;
-        #endif
-        case PrimitiveTopology::TriangleList:           return GL_TRIANGLES;
-        case PrimitiveTopology::TriangleStrip:          return GL_TRIANGLE_STRIP;
-        case PrimitiveTopology::TriangleFan:            return GL_TRIANGLE_FAN;
-        #ifdef LLGL_OPENGL
-        case PrimitiveTopology::TriangleListAdjacency:  return GL_TRIANGLES_ADJACENCY;
-        case PrimitiveTopology::TriangleStripAdjacency: return GL_TRIANGLE_STRIP_ADJACENCY;
-        #endif
-        default:
-            #ifdef LLGL_OPENGL
-            if (primitiveTopology >= PrimitiveTopology::Patches1 && primitiveTopology <= PrimitiveTopology::Patches32)
-                return GL_PATCHES;
-            #endif
-            break;
-    }
-    MapFailed("PrimitiveTopology");
-}
+    { ImageFormat::R,               GL_RED                                  },
+    { ImageFormat::RG,              GL_RG                                   },
+    { ImageFormat::RGB,             GL_RGB                                  },
+    { ImageFormat::BGR,             DESKTOP_GL( GL_BGR )                    },
+    { ImageFormat::RGBA,            GL_RGBA                                 },
+    { ImageFormat::BGRA,            GL_BGRA                                 },
+    { ImageFormat::ARGB,            g_unmapped                              },
+    { ImageFormat::ABGR,            g_unmapped                              },
+    { ImageFormat::Depth,           GL_DEPTH_COMPONENT                      },
+    { ImageFormat::DepthStencil,    GL_DEPTH_STENCIL                        },
+    { ImageFormat::CompressedRGB,   DESKTOP_GL( GL_COMPRESSED_RGB )         },
+    { ImageFormat::CompressedRGBA,  DESKTOP_GL( GL_COMPRESSED_RGBA )        },
+};
+
+static constexpr MappingEntry<CompareOp, GLenum> g_compareOpMap[] =
+{
+    { CompareOp::Never,         GL_NEVER    },
+    { CompareOp::Less,          GL_LESS     },
+    { CompareOp::Equal,         GL_EQUAL    },
+    { CompareOp::LessEqual,     GL_LEQUAL   },
+    { CompareOp::Greater,       GL_GREATER  },
+    { CompareOp::NotEqual,      GL_NOTEQUAL },
+    { CompareOp::GreaterEqual,  GL_GEQUAL   },
+    { CompareOp::Ever,          GL_ALWAYS   },
+};
+
+static constexpr MappingEntry<StencilOp, GLenum> g_stencilOpMap[] =
+{
+    { StencilOp::Keep,      GL_KEEP         },
+    { StencilOp::Zero,      GL_ZERO         },
+    { StencilOp::Replace,   GL_REPLACE      },
+    { StencilOp::IncClamp,  GL_INCR         },
+    { StencilOp::DecClamp,  GL_DECR         },
+    { StencilOp::Invert,    GL_INVERT       },
+    { StencilOp::IncWrap,   GL_INCR_WRAP    },
+    { StencilOp::DecWrap,   GL_DECR_WRAP    },
+};
+
+static constexpr MappingEntry<BlendOp, GLenum> g_blendOpMap[] =
+{
+    { BlendOp::Zero,                GL_ZERO                                 },
+    { BlendOp::One,                 GL_ONE                                  },
+    { BlendOp::SrcColor,            GL_SRC_COLOR                            },
+    { BlendOp::InvSrcColor,         GL_ONE_MINUS_SRC_COLOR                  },
+    { BlendOp::SrcAlpha,            GL_SRC_ALPHA                            },
+    { BlendOp::InvSrcAlpha,         GL_ONE_MINUS_SRC_ALPHA                  },
+    { BlendOp::DestColor,           GL_DST_COLOR                            },
+    { BlendOp::InvDestColor,        GL_ONE_MINUS_DST_COLOR                  },
+    { BlendOp::DestAlpha,           GL_DST_ALPHA                            },
+    { BlendOp::InvDestAlpha,        GL_ONE_MINUS_DST_ALPHA                  },
+    { BlendOp::SrcAlphaSaturate,    GL_SRC_ALPHA_SATURATE                   },
+    { BlendOp::BlendFactor,         GL_CONSTANT_COLOR                       },
+    { BlendOp::InvBlendFactor,      GL_ONE_MINUS_CONSTANT_COLOR             },
+    { BlendOp::Src1Color,           DESKTOP_GL( GL_SRC1_COLOR )             },
+    { BlendOp::InvSrc1Color,        DESKTOP_GL( GL_ONE_MINUS_SRC1_COLOR )   },
+    { BlendOp::Src1Alpha,           DESKTOP_GL( GL_SRC1_ALPHA )             },
+    { BlendOp::InvSrc1Alpha,        DESKTOP_GL( GL_ONE_MINUS_SRC1_ALPHA )   },
+};
+
+static constexpr MappingEntry<BlendArithmetic, GLenum> g_blendArithmeticMap[] =
+{
+    { BlendArithmetic::Add,         GL_FUNC_ADD                 },
+    { BlendArithmetic::Subtract,    GL_FUNC_SUBTRACT            },
+    { BlendArithmetic::RevSubtract, GL_FUNC_REVERSE_SUBTRACT    },
+    { BlendArithmetic::Min,         GL_MIN                      },
+    { BlendArithmetic::Max,         GL_MAX                      },
+};
+
+static constexpr MappingEntry<PolygonMode, GLenum> g_polygonModeMap[] =
+{
+    { PolygonMode::Fill,        DESKTOP_GL( GL_FILL )   },
+    { PolygonMode::Wireframe,   DESKTOP_GL( GL_LINE )   },
+    { PolygonMode::Points,      DESKTOP_GL( GL_POINT )  },
+};
 
-GLenum Map(const TextureType textureType)
+static constexpr MappingEntry<CullMode, GLenum> g_cullModeMap[] =
 {
-    #ifdef LLGL_OPENGL
-    switch (textureType)
-    {
-        case TextureType::Texture1D:        return GL_TEXTURE_1D;
-        case TextureType::Texture2D:        return GL_TEXTURE_2D;
-        case TextureType::Texture3D:        return GL_TEXTURE_3D;
-        case TextureType::TextureCube:      return GL_TEXTURE_CUBE_MAP;
-        case TextureType::Texture1DArray:   return GL_TEXTURE_1D_ARRAY;
-        case TextureType::Texture2DArray:   return GL_TEXTURE_2D_ARRAY;
-        case TextureType::TextureCubeArray: return GL_TEXTURE_CUBE_MAP_ARRAY;
-        case TextureType::Texture2DMS:      return GL_TEXTURE_2D_MULTISAMPLE;
-        case TextureType::Texture2DMSArray: return GL_TEXTURE_2D_MULTISAMPLE_ARRAY;
-    }
-    #else
-    switch (textureType)
-    {
-        case TextureType::Texture2D:        return GL_TEXTURE_2D;
-        case TextureType::Texture3D:        return GL_TEXTURE_3D;
-        case TextureType::TextureCube:      return GL_TEXTURE_CUBE_MAP;
-        case TextureType::Texture2DArray:   return GL_TEXTURE_2D_ARRAY;
-        default:                            break;
-    }
-    #endif
-    MapFailed("TextureType");
-}
+    { CullMode::Disabled,   0           },
+    { CullMode::Front,      GL_FRONT    },
+    { CullMode::Back,       GL_BACK     },
+};
 
-GLenum Map(const TextureFormat textureFormat)
+static constexpr MappingEntry<AxisDirection, GLenum> g_axisDirectionMap[] =
+{
+    { AxisDirection::XPos, GL_TEXTURE_CUBE_MAP_POSITIVE_X },
+    { AxisDirection::XNeg, GL_TEXTURE_CUBE_MAP_NEGATIVE_X },
+    { AxisDirection::YPos, GL_TEXTURE_CUBE_MAP_POSITIVE_Y },
+    { AxisDirection::YNeg, GL_TEXTURE_CUBE_MAP_NEGATIVE_Y },
+    { AxisDirection::ZPos, GL_TEXTURE_CUBE_MAP_POSITIVE_Z },
+    { AxisDirection::ZNeg, GL_TEXTURE_CUBE_MAP_NEGATIVE_Z },
+};
+
+static constexpr MappingEntry<TextureWrap, GLenum> g_textureWrapMap[] =
+{
+    { TextureWrap::Repeat,      GL_REPEAT                               },
+    { TextureWrap::Mirror,      GL_MIRRORED_REPEAT                      },
+    { TextureWrap::Clamp,       GL_CLAMP_TO_EDGE                        },
+    { TextureWrap::Border,      DESKTOP_GL( GL_CLAMP_TO_BORDER )        },
+    { TextureWrap::MirrorOnce,  DESKTOP_GL( GL_MIRROR_CLAMP_TO_EDGE )   },
+};
+
+static constexpr MappingEntry<TextureFilter, GLenum> g_textureFilterMap[] =
+{
+    { TextureFilter::Nearest,   GL_NEAREST  },
+    { TextureFilter::Linear,    GL_LINEAR   },
+};
+
+// Minification filters, indexed by the MIP-map filter first
+static constexpr MappingEntry<TextureFilter, GLenum> g_textureMinFilterMap[][2] =
 {
-    switch (textureFormat)
     {
-        case TextureFormat::Unknown:        break;
-        
-        /* --- Base internal formats --- */
-        case TextureFormat::DepthComponent: return GL_DEPTH_COMPONENT;
-        case TextureFormat::DepthStencil:   return GL_DEPTH_STENCIL;
-        case TextureFormat::R:              return GL_RED;
-        case TextureFormat::RG:             return GL_RG;
-        case TextureFormat::RGB:            return GL_RGB;
-        case TextureFormat::RGBA:           return GL_RGBA;
+        { TextureFilter::Nearest,   GL_NEAREST_MIPMAP_NEAREST   },
+        { TextureFilter::Linear,    GL_LINEAR_MIPMAP_NEAREST    },
+    },
+    {
+        { TextureFilter::Nearest,   GL_NEAREST_MIPMAP_LINEAR    },
+        { TextureFilter::Linear,    GL_LINEAR_MIPMAP_LINEAR     },
+    },
+};
 
-        /* --- Sized internal formats --- */
-        case TextureFormat::R8:             return GL_R8;
-        case TextureFormat::R8Sgn:          return GL_R8_SNORM;
+static constexpr MappingEntry<ShaderType, GLenum> g_shaderTypeMap[] =
+{
+    { ShaderType::Vertex,           GL_VERTEX_SHADER            },
+    #if defined(GL_VERSION_4_0) || defined(GL_ES_VERSION_3_2)
+    { ShaderType::TessControl,      GL_TESS_CONTROL_SHADER      },
+    { ShaderType::TessEvaluation,   GL_TESS_EVALUATION_SHADER   },
+    #else
+    { ShaderType::TessControl,      g_unmapped                  },
+    { ShaderType::TessEvaluation,   g_unmapped                  },
+    #endif
+    #if defined(GL_VERSION_3_2) || defined(GL_ES_VERSION_3_2)
+    { ShaderType::Geometry,         GL_GEOMETRY_SHADER          },
+    #else
+    { ShaderType::Geometry,         g_unmapped                  },
+    #endif
+    { ShaderType::Fragment,         GL_FRAGMENT_SHADER          },
+    #if defined(GL_VERSION_4_3) || defined(GL_ES_VERSION_3_1)
+    { ShaderType::Compute,          GL_COMPUTE_SHADER           },
+    #else
+    { ShaderType::Compute,          g_unmapped                  },
+    #endif
+};
 
-        #ifdef LLGL_OPENGL
-        case TextureFormat::R16:            return GL_R16;
-        case TextureFormat::R16Sgn:         return GL_R16_SNORM;
-        #endif
-        case TextureFormat::R16Float:       return GL_R16F;
+// for pipeline statistice query:
+// see https://www.opengl.org/registry/specs/ARB/pipeline_statistics_query.txt
+static constexpr MappingEntry<QueryType, GLenum> g_queryTypeMap[] =
+{
+    { QueryType::SamplesPassed,                     DESKTOP_GL( GL_SAMPLES_PASSED )                 },
+    { QueryType::AnySamplesPassed,                  GL_ANY_SAMPLES_PASSED                           },
+    { QueryType::AnySamplesPassedConservative,      GL_ANY_SAMPLES_PASSED_CONSERVATIVE              },
+    { QueryType::PrimitivesGenerated,               DESKTOP_GL( GL_PRIMITIVES_GENERATED )           },
+    { QueryType::TimeElapsed,                       DESKTOP_GL( GL_TIME_ELAPSED )                   },
+    { QueryType::StreamOutPrimitivesWritten,        GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN        },
+    #ifdef GL_ARB_transform_feedback_overflow_query
+    { QueryType::StreamOutOverflow,                 GL_TRANSFORM_FEEDBACK_OVERFLOW_ARB              },
+    #else
+    { QueryType::StreamOutOverflow,                 g_unmapped                                      },
+    #endif
+    #ifdef GL_ARB_pipeline_statistics_query
+    { QueryType::VerticesSubmitted,                 GL_VERTICES_SUBMITTED_ARB                       },
+    { QueryType::PrimitivesSubmitted,               GL_PRIMITIVES_SUBMITTED_ARB                     },
+    { QueryType::VertexShaderInvocations,           GL_VERTEX_SHADER_INVOCATIONS_ARB                },
+    { QueryType::TessControlShaderInvocations,      GL_TESS_CONTROL_SHADER_PATCHES_ARB              },
+    { QueryType::TessEvaluationShaderInvocations,   GL_TESS_EVALUATION_SHADER_INVOCATIONS_ARB       },
+    { QueryType::GeometryShaderInvocations,         GL_GEOMETRY_SHADER_INVOCATIONS                  },
+    { QueryType::FragmentShaderInvocations,         GL_FRAGMENT_SHADER_INVOCATIONS_ARB              },
+    { QueryType::ComputeShaderInvocations,          GL_COMPUTE_SHADER_INVOCATIONS_ARB               },
+    { QueryType::GeometryPrimitivesGenerated,       GL_GEOMETRY_SHADER_PRIMITIVES_EMITTED_ARB       },
+    { QueryType::ClippingInputPrimitives,           GL_CLIPPING_INPUT_PRIMITIVES_ARB                },
+    { QueryType::ClippingOutputPrimitives,          GL_CLIPPING_OUTPUT_PRIMITIVES_ARB               },
+    #else
+    { QueryType::VerticesSubmitted,                 g_unmapped                                      },
+    { QueryType::PrimitivesSubmitted,               g_unmapped                                      },
+    { QueryType::VertexShaderInvocations,           g_unmapped                                      },
+    { QueryType::TessControlShaderInvocations,      g_unmapped                                      },
+    { QueryType::TessEvaluationShaderInvocations,   g_unmapped                                      },
+    { QueryType::GeometryShaderInvocations,         g_unmapped                                      },
+    { QueryType::FragmentShaderInvocations,         g_unmapped                                      },
+    { QueryType::ComputeShaderInvocations,          g_unmapped                                      },
+    { QueryType::GeometryPrimitivesGenerated,       g_unmapped                                      },
+    { QueryType::ClippingInputPrimitives,           g_unmapped                                      },
+    { QueryType::ClippingOutputPrimitives,          g_unmapped                                      },
+    #endif
+};
 
-        case TextureFormat::R32UInt:        return GL_R32I;
-        case TextureFormat::R32SInt:        return GL_R32UI;
-        case TextureFormat::R32Float:       return GL_R32F;
+static constexpr MappingEntry<BufferType, GLenum> g_bufferTypeMap[] =
+{
+    { BufferType::Vertex,       GL_ARRAY_BUFFER                         },
+    { BufferType::Index,        GL_ELEMENT_ARRAY_BUFFER                 },
+    { BufferType::Constant,     GL_UNIFORM_BUFFER                       },
+    { BufferType::Storage,      DESKTOP_GL( GL_SHADER_STORAGE_BUFFER )  },
+    { BufferType::StreamOutput, GL_TRANSFORM_FEEDBACK_BUFFER            },
+    { BufferType::Indirect,     DESKTOP_GL( GL_DRAW_INDIRECT_BUFFER )   },
+};
+
+static constexpr MappingEntry<RenderConditionMode, GLenum> g_renderConditionModeMap[] =
+{
+    { RenderConditionMode::Wait,                    DESKTOP_GL( GL_QUERY_WAIT )                         },
+    { RenderConditionMode::NoWait,                  DESKTOP_GL( GL_QUERY_NO_WAIT )                      },
+    { RenderConditionMode::ByRegionWait,            DESKTOP_GL( GL_QUERY_BY_REGION_WAIT )               },
+    { RenderConditionMode::ByRegionNoWait,          DESKTOP_GL( GL_QUERY_BY_REGION_NO_WAIT )            },
+    #ifndef __APPLE__
+    { RenderConditionMode::WaitInverted,            DESKTOP_GL( GL_QUERY_WAIT_INVERTED )                },
+    { RenderConditionMode::NoWaitInverted,          DESKTOP_GL( GL_QUERY_NO_WAIT_INVERTED )             },
+    { RenderConditionMode::ByRegionWaitInverted,    DESKTOP_GL( GL_QUERY_BY_REGION_WAIT_INVERTED )      },
+    { RenderConditionMode::ByRegionNoWaitInverted,  DESKTOP_GL( GL_QUERY_BY_REGION_NO_WAIT_INVERTED )   },
+    #else
+    { RenderConditionMode::WaitInverted,            g_unmapped                                          },
+    { RenderConditionMode::NoWaitInverted,          g_unmapped                                          },
+    { RenderConditionMode::ByRegionWaitInverted,    g_unmapped                                          },
+    { RenderConditionMode::ByRegionNoWaitInverted,  g_unmapped                                          },
+    #endif
+};
 
-        case TextureFormat::RG8:            return GL_RG8;
-        case TextureFormat::RG8Sgn:         return GL_RG8_SNORM;
+static constexpr MappingEntry<LogicOp, GLenum> g_logicOpMap[] =
+{
+    { LogicOp::Keep,            g_unmapped                      },
+    { LogicOp::Disabled,        g_unmapped                      },
+    { LogicOp::Clear,           DESKTOP_GL( GL_CLEAR )          },
+    { LogicOp::Set,             DESKTOP_GL( GL_SET )            },
+    { LogicOp::Copy,            DESKTOP_GL( GL_COPY )           },
+    { LogicOp::InvertedCopy,    DESKTOP_GL( GL_COPY_INVERTED )  },
+    { LogicOp::Noop,            DESKTOP_GL( GL_NOOP )           },
+    { LogicOp::Invert,          DESKTOP_GL( GL_INVERT )         },
+    { LogicOp::AND,             DESKTOP_GL( GL_AND )            },
+    { LogicOp::NAND,            DESKTOP_GL( GL_NAND )           },
+    { LogicOp::OR,              DESKTOP_GL( GL_OR )             },
+    { LogicOp::NOR,             DESKTOP_GL( GL_NOR )            },
+    { LogicOp::XOR,             DESKTOP_GL( GL_XOR )            },
+    { LogicOp::Equiv,           DESKTOP_GL( GL_EQUIV )          },
+    { LogicOp::ReverseAND,      DESKTOP_GL( GL_AND_REVERSE )    },
+    { LogicOp::InvertedAND,     DESKTOP_GL( GL_AND_INVERTED )   },
+    { LogicOp::ReverseOR,       DESKTOP_GL( GL_OR_REVERSE )     },
+    { LogicOp::InvertedOR,      DESKTOP_GL( GL_OR_INVERTED )    },
+};
+
+#undef DESKTOP_GL
 
-        #ifdef LLGL_OPENGL
-        case TextureFormat::RG16:           return GL_RG16;
-        case TextureFormat::RG16Sgn:        return GL_RG16_SNORM;
-        #endif
-        case TextureFormat::RG16Float:      return GL_RG16F;
+/*
+Verify at compile time that each table has one entry for every enumeration entry, in the order of their underlying values.
+If one of these assertions fails, an enumeration entry was added or reordered without updating the respective table.
+*/
+static_assert(IsMappingTableComplete(g_bufferCPUAccessMap,      BufferCPUAccess::ReadWrite                  ), "incomplete mapping table for LLGL::BufferCPUAccess"     );
+static_assert(IsMappingTableComplete(g_dataTypeMap,             DataType::Double                            ), "incomplete mapping table for LLGL::DataType"            );
+static_assert(IsMappingTableComplete(g_primitiveTypeMap,        PrimitiveType::Triangles                    ), "incomplete mapping table for LLGL::PrimitiveType"       );
+static_assert(IsMappingTableComplete(g_primitiveTopologyMap,    PrimitiveTopology::Patches32                ), "incomplete mapping table for LLGL::PrimitiveTopology"   );
+static_assert(IsMappingTableComplete(g_textureTypeMap,          TextureType::Texture2DMSArray               ), "incomplete mapping table for LLGL::TextureType"         );
+static_assert(IsMappingTableComplete(g_textureFormatMap,        TextureFormat::RGBA_DXT5                    ), "incomplete mapping table for LLGL::TextureFormat"       );
+static_assert(IsMappingTableComplete(g_imageFormatMap,          ImageFormat::CompressedRGBA                 ), "incomplete mapping table for LLGL::ImageFormat"         );
+static_assert(IsMappingTableComplete(g_compareOpMap,            CompareOp::Ever                             ), "incomplete mapping table for LLGL::CompareOp"           );
+static_assert(IsMappingTableComplete(g_stencilOpMap,            StencilOp::DecWrap                          ), "incomplete mapping table for LLGL::StencilOp"           );
+static_assert(IsMappingTableComplete(g_blendOpMap,              BlendOp::InvSrc1Alpha                       ), "incomplete mapping table for LLGL::BlendOp"             );
+static_assert(IsMappingTableComplete(g_blendArithmeticMap,      BlendArithmetic::Max                        ), "incomplete mapping table for LLGL::BlendArithmetic"     );
+static_assert(IsMappingTableComplete(g_polygonModeMap,          PolygonMode::Points                         ), "incomplete mapping table for LLGL::PolygonMode"         );
+static_assert(IsMappingTableComplete(g_cullModeMap,             CullMode::Back                              ), "incomplete mapping table for LLGL::CullMode"            );
+static_assert(IsMappingTableComplete(g_axisDirectionMap,        AxisDirection::ZNeg                         ), "incomplete mapping table for LLGL::AxisDirection"       );
+static_assert(IsMappingTableComplete(g_textureWrapMap,          TextureWrap::MirrorOnce                     ), "incomplete mapping table for LLGL::TextureWrap"         );
+static_assert(IsMappingTableComplete(g_textureFilterMap,        TextureFilter::Linear                       ), "incomplete mapping table for LLGL::TextureFilter"       );
+static_assert(IsMappingTableComplete(g_textureMinFilterMap[0],  TextureFilter::Linear                       ), "incomplete mapping table for LLGL::TextureFilter"       );
+static_assert(IsMappingTableComplete(g_textureMinFilterMap[1],  TextureFilter::Linear                       ), "incomplete mapping table for LLGL::TextureFilter"       );
+static_assert(IsMappingTableComplete(g_shaderTypeMap,           ShaderType::Compute                         ), "incomplete mapping table for LLGL::ShaderType"          );
+static_assert(IsMappingTableComplete(g_queryTypeMap,            QueryType::ClippingOutputPrimitives         ), "incomplete mapping table for LLGL::QueryType"           );
+static_assert(IsMappingTableComplete(g_bufferTypeMap,           BufferType::Indirect                        ), "incomplete mapping table for LLGL::BufferType"          );
+static_assert(IsMappingTableComplete(g_renderConditionModeMap,  RenderConditionMode::ByRegionNoWaitInverted ), "incomplete mapping table for LLGL::RenderConditionMode" );
+static_assert(IsMappingTableComplete(g_logicOpMap,              LogicOp::InvertedOR                         ), "incomplete mapping table for LLGL::LogicOp"             );
+
+// Returns the mapped value of the specified key, or throws an exception if the key is unmapped.
+template <typename TKey, std::size_t N>
+static GLenum MapWithTable(const MappingEntry<TKey, GLenum> (&table)[N], const TKey key, const char* typeName)
+{
+    const auto value = LookupMappingTable(table, key, g_unmapped);
+    if (value == g_unmapped)
+        MapFailed(typeName);
+    return value;
+}
 
-        case TextureFormat::RG32UInt:       return GL_RG32UI;
-        case TextureFormat::RG32SInt:       return GL_RG32I;
-        case TextureFormat::RG32Float:      return GL_RG32F;
 
-        case TextureFormat::RGB8:           return GL_RGB8;
-        case TextureFormat::RGB8Sgn:        return GL_RGB8_SNORM;
+/* ----- Map functions ----- */
 
-        #ifdef LLGL_OPENGL
-        case TextureFormat::RGB16:          return GL_RGB16;
-        case TextureFormat::RGB16Sgn:       return GL_RGB16_SNORM;
-        #endif
-        case TextureFormat::RGB16Float:     return GL_RGB16F;
+GLenum Map(const BufferCPUAccess cpuAccess)
+{
+    return MapWithTable(g_bufferCPUAccessMap, cpuAccess, "BufferCPUAccess");
+}
 
-        case TextureFormat::RGB32UInt:      return GL_RGB32UI;
-        case TextureFormat::RGB32SInt:      return GL_RGB32I;
-        case TextureFormat::RGB32Float:     return GL_RGB32F;
+GLenum Map(const DataType dataType)
+{
+    return MapWithTable(g_dataTypeMap, dataType, "DataType");
+}
 
-        case TextureFormat::RGBA8:          return GL_RGBA8;
-        case TextureFormat::RGBA8Sgn:       return GL_RGBA8_SNORM;
+GLenum Map(const PrimitiveType primitiveType)
+{
+    return MapWithTable(g_primitiveTypeMap, primitiveType, "PrimitiveType");
+}
 
-        #ifdef LLGL_OPENGL
-        case TextureFormat::RGBA16:         return GL_RGBA16;
-        case TextureFormat::RGBA16Sgn:      return GL_RGBA16_SNORM;
-        #endif
-        case TextureFormat::RGBA16Float:    return GL_RGBA16F;
+GLenum Map(const PrimitiveTopology primitiveTopology)
+{
+    return MapWithTable(g_primitiveTopologyMap, primitiveTopology, "PrimitiveTopology");
+}
 
-        case TextureFormat::RGBA32UInt:     return GL_RGBA32UI;
-        case TextureFormat::RGBA32SInt:     return GL_RGBA32I;
-        case TextureFormat::RGBA32Float:    return GL_RGBA32F;
+GLenum Map(const TextureType textureType)
+{
+    return MapWithTable(g_textureTypeMap, textureType, "TextureType");
+}
 
-        #ifdef LLGL_OPENGL
-        /* --- Compressed formats --- */
-        case TextureFormat::RGB_DXT1:       return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
-        case TextureFormat::RGBA_DXT1:      return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
-        case TextureFormat::RGBA_DXT3:      return GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
-        case TextureFormat::RGBA_DXT5:      return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
-        #endif
-        
-        default:                            break;
-    }
-    MapFailed("TextureFormat");
+GLenum Map(const TextureFormat textureFormat)
+{
+    return MapWithTable(g_textureFormatMap, textureFormat, "TextureFormat");
 }
 
 GLenum Map(const ImageFormat colorFormat)
 {
-    switch (colorFormat)
-    {
-        case ImageFormat::R:                return GL_RED;
-        case ImageFormat::RG:               return GL_RG;
-        case ImageFormat::RGB:              return GL_RGB;
-        #ifdef LLGL_OPENGL
-        case ImageFormat::BGR:              return GL_BGR;
-        #endif
-        case ImageFormat::RGBA:             return GL_RGBA;
-        case ImageFormat::BGRA:             return GL_BGRA;
-        case ImageFormat::Depth:            return GL_DEPTH_COMPONENT;  
-        case ImageFormat::DepthStencil:     return GL_DEPTH_STENCIL;
-        #ifdef LLGL_OPENGL
-        case ImageFormat::CompressedRGB:    return GL_COMPRESSED_RGB;
-        case ImageFormat::CompressedRGBA:   return GL_COMPRESSED_RGBA;
-        #endif
-        default:                            break;
-    }
-    MapFailed("ImageFormat");
+    return MapWithTable(g_imageFormatMap, colorFormat, "ImageFormat");
 }
 
 GLenum Map(const CompareOp compareOp)
 {
-    switch (compareOp)
-    {
-        case CompareOp::Never:          return GL_NEVER;
-        case CompareOp::Less:           return GL_LESS;
-        case CompareOp::Equal:          return GL_EQUAL;
-        case CompareOp::LessEqual:      return GL_LEQUAL;
-        case CompareOp::Greater:        return GL_GREATER;
-        case CompareOp::NotEqual:       return GL_NOTEQUAL;
-        case CompareOp::GreaterEqual:   return GL_GEQUAL;
-        case CompareOp::Ever:           return GL_ALWAYS;
-    }
-    MapFailed("CompareOp");
+    return MapWithTable(g_compareOpMap, compareOp, "CompareOp");
 }
 
 GLenum Map(const StencilOp stencilOp)
 {
-    switch (stencilOp)
-    {
-        case StencilOp::Keep:       return GL_KEEP;
-        case StencilOp::Zero:       return GL_ZERO;
-        case StencilOp::Replace:    return GL_REPLACE;
-        case StencilOp::IncClamp:   return GL_INCR;
-        case StencilOp::DecClamp:   return GL_DECR;
-        case StencilOp::Invert:     return GL_INVERT;
-        case StencilOp::IncWrap:    return GL_INCR_WRAP;
-        case StencilOp::DecWrap:    return GL_DECR_WRAP;
-    }
-    MapFailed("StencilOp");
+    return MapWithTable(g_stencilOpMap, stencilOp, "StencilOp");
 }
 
 GLenum Map(const BlendOp blendOp)
 {
-    switch (blendOp)
-    {
-        case BlendOp::Zero:             return GL_ZERO;
-        case BlendOp::One:              return GL_ONE;
-        case BlendOp::SrcColor:         return GL_SRC_COLOR;
-        case BlendOp::InvSrcColor:      return GL_ONE_MINUS_SRC_COLOR;
-        case BlendOp::SrcAlpha:         return GL_SRC_ALPHA;
-        case BlendOp::InvSrcAlpha:      return GL_ONE_MINUS_SRC_ALPHA;
-        case BlendOp::DestColor:        return GL_DST_COLOR;
-        case BlendOp::InvDestColor:     return GL_ONE_MINUS_DST_COLOR;
-        case BlendOp::DestAlpha:        return GL_DST_ALPHA;
-        case BlendOp::InvDestAlpha:     return GL_ONE_MINUS_DST_ALPHA;
-        case BlendOp::SrcAlphaSaturate: return GL_SRC_ALPHA_SATURATE;
-        case BlendOp::BlendFactor:      return GL_CONSTANT_COLOR;
-        case BlendOp::InvBlendFactor:   return GL_ONE_MINUS_CONSTANT_COLOR;
-        #ifdef LLGL_OPENGL
-        case BlendOp::Src1Color:        return GL_SRC1_COLOR;
-        case BlendOp::InvSrc1Color:     return GL_ONE_MINUS_SRC1_COLOR;
-        case BlendOp::Src1Alpha:        return GL_SRC1_ALPHA;
-        case BlendOp::InvSrc1Alpha:     return GL_ONE_MINUS_SRC1_ALPHA;
-        #else
-        default:                        break;
-        #endif
-    }
-    MapFailed("BlendOp");
+    return MapWithTable(g_blendOpMap, blendOp, "BlendOp");
 }
 
 GLenum Map(const BlendArithmetic blendArithmetic)
 {
-    switch (blendArithmetic)
-    {
-        case BlendArithmetic::Add:          return GL_FUNC_ADD;
-        case BlendArithmetic::Subtract:     return GL_FUNC_SUBTRACT;
-        case BlendArithmetic::RevSubtract:  return GL_FUNC_REVERSE_SUBTRACT;
-        case BlendArithmetic::Min:          return GL_MIN;
-        case BlendArithmetic::Max:          return GL_MAX;
-    }
-    MapFailed("BlendArithmetic");
+    return MapWithTable(g_blendArithmeticMap, blendArithmetic, "BlendArithmetic");
 }
 
 GLenum Map(const PolygonMode polygonMode)
 {
-    #ifdef LLGL_OPENGL
-    switch (polygonMode)
-    {
-        case PolygonMode::Fill:         return GL_FILL;
-        case PolygonMode::Wireframe:    return GL_LINE;
-        case PolygonMode::Points:       return GL_POINT;
-    }
-    #endif
-    MapFailed("PolygonMode");
+    return MapWithTable(g_polygonModeMap, polygonMode, "PolygonMode");
 }
 
 GLenum Map(const CullMode cullMode)
 {
-    switch (cullMode)
-    {
-        case CullMode::Disabled:    return 0;
-        case CullMode::Front:       return GL_FRONT;
-        case CullMode::Back:        return GL_BACK;
-    }
-    MapFailed("CullMode");
+    return MapWithTable(g_cullModeMap, cullMode, "CullMode");
 }
 
 GLenum Map(const AxisDirection cubeFace)
 {
-    switch (cubeFace)
-    {
-        case AxisDirection::XPos: return GL_TEXTURE_CUBE_MAP_POSITIVE_X;
-        case AxisDirection::XNeg: return GL_TEXTURE_CUBE_MAP_NEGATIVE_X;
-        case AxisDirection::YPos: return GL_TEXTURE_CUBE_MAP_POSITIVE_Y;
-        case AxisDirection::YNeg: return GL_TEXTURE_CUBE_MAP_NEGATIVE_Y;
-        case AxisDirection::ZPos: return GL_TEXTURE_CUBE_MAP_POSITIVE_Z;
-        case AxisDirection::ZNeg: return GL_TEXTURE_CUBE_MAP_NEGATIVE_Z;
-    }
-    MapFailed("AxisDirection");
+    return MapWithTable(g_axisDirectionMap, cubeFace, "AxisDirection");
 }
-    
+
 GLenum Map(const TextureWrap textureWrap)
 {
-    switch (textureWrap)
-    {
-        case TextureWrap::Repeat:       return GL_REPEAT;
-        case TextureWrap::Mirror:       return GL_MIRRORED_REPEAT;
-        case TextureWrap::Clamp:        return GL_CLAMP_TO_EDGE;
-        #ifdef LLGL_OPENGL
-        case TextureWrap::Border:       return GL_CLAMP_TO_BORDER;
-        case TextureWrap::MirrorOnce:   return GL_MIRROR_CLAMP_TO_EDGE;
-        #else
-        default:                        break;
-        #endif
-    }
-    MapFailed("TextureWrap");
+    return MapWithTable(g_textureWrapMap, textureWrap, "TextureWrap");
 }
 
 GLenum Map(const TextureFilter textureFilter)
 {
-    switch (textureFilter)
-    {
-        case TextureFilter::Nearest:    return GL_NEAREST;
-        case TextureFilter::Linear:     return GL_LINEAR;
-    }
-    MapFailed("TextureFilter");
+    return MapWithTable(g_textureFilterMap, textureFilter, "TextureFilter");
 }
 
 GLenum Map(const TextureFilter textureMinFilter, const TextureFilter textureMipMapFilter)
 {
-    switch (textureMinFilter)
-    {
-        case TextureFilter::Nearest:
-            switch (textureMipMapFilter)
-            {
-                case TextureFilter::Nearest:    return GL_NEAREST_MIPMAP_NEAREST;
-                case TextureFilter::Linear:     return GL_NEAREST_MIPMAP_LINEAR;
-            }
-            break;
-
-        case TextureFilter::Linear:
-            switch (textureMipMapFilter)
-            {
-                case TextureFilter::Nearest:    return GL_LINEAR_MIPMAP_NEAREST;
-                case TextureFilter::Linear:     return GL_LINEAR_MIPMAP_LINEAR;
-            }
-            break;
-    }
-    MapFailed("Min/MipMap TextureFilter");
+    const auto mipMapIndex = static_cast<std::size_t>(textureMipMapFilter);
+    if (mipMapIndex >= sizeof(g_textureMinFilterMap)/sizeof(g_textureMinFilterMap[0]))
+        MapFailed("Min/MipMap TextureFilter");
+    return MapWithTable(g_textureMinFilterMap[mipMapIndex], textureMinFilter, "Min/MipMap TextureFilter");
 }
 
 GLenum Map(const ShaderType shaderType)
 {
-    switch (shaderType)
-    {
-        case ShaderType::Vertex:            return GL_VERTEX_SHADER;
-        #if defined(GL_VERSION_3_2) || defined(GL_ES_VERSION_3_2)
-        case ShaderType::Geometry:          return GL_GEOMETRY_SHADER;
-        #endif
-        #if defined(GL_VERSION_4_0) || defined(GL_ES_VERSION_3_2)
-        case ShaderType::TessControl:       return GL_TESS_CONTROL_SHADER;
-        case ShaderType::TessEvaluation:    return GL_TESS_EVALUATION_SHADER;
-        #endif
-        case ShaderType::Fragment:          return GL_FRAGMENT_SHADER;
-        #if defined(GL_VERSION_4_3) || defined(GL_ES_VERSION_3_1)
-        case ShaderType::Compute:           return GL_COMPUTE_SHADER;
-        #endif
-        default:                            break;
-    }
-    MapFailed("ShaderType");
+    return MapWithTable(g_shaderTypeMap, shaderType, "ShaderType");
 }
 
-// for pipeline statistice query:
-// see https://www.opengl.org/registry/specs/ARB/pipeline_statistics_query.txt
 GLenum Map(const QueryType queryType)
 {
-    switch (queryType)
-    {
-        #ifdef LLGL_OPENGL
-        case QueryType::SamplesPassed:                      return GL_SAMPLES_PASSED;
-        #endif
-        case QueryType::AnySamplesPassed:                   return GL_ANY_SAMPLES_PASSED;
-        case QueryType::AnySamplesPassedConservative:       return GL_ANY_SAMPLES_PASSED_CONSERVATIVE;
-        #ifdef LLGL_OPENGL
-        case QueryType::PrimitivesGenerated:                return GL_PRIMITIVES_GENERATED;
-        case QueryType::TimeElapsed:                        return GL_TIME_ELAPSED;
-        #endif
-        case QueryType::StreamOutPrimitivesWritten:         return GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN;
-
-        #ifdef GL_ARB_transform_feedback_overflow_query
-        case QueryType::StreamOutOverflow:                  return GL_TRANSFORM_FEEDBACK_OVERFLOW_ARB;
-        //GL_TRANSFORM_FEEDBACK_STREAM_OVERFLOW_ARB;
-        #endif
-
-        #ifdef GL_ARB_pipeline_statistics_query
-        case QueryType::VerticesSubmitted:                  return GL_VERTICES_SUBMITTED_ARB;
-        case QueryType::PrimitivesSubmitted:                return GL_PRIMITIVES_SUBMITTED_ARB;
-        case QueryType::VertexShaderInvocations:            return GL_VERTEX_SHADER_INVOCATIONS_ARB;
-        case QueryType::TessControlShaderInvocations:       return GL_TESS_CONTROL_SHADER_PATCHES_ARB;
-        case QueryType::TessEvaluationShaderInvocations:    return GL_TESS_EVALUATION_SHADER_INVOCATIONS_ARB;
-        case QueryType::GeometryShaderInvocations:          return GL_GEOMETRY_SHADER_INVOCATIONS;
-        case QueryType::FragmentShaderInvocations:          return GL_FRAGMENT_SHADER_INVOCATIONS_ARB;
-        case QueryType::ComputeShaderInvocations:           return GL_COMPUTE_SHADER_INVOCATIONS_ARB;
-        case QueryType::GeometryPrimitivesGenerated:        return GL_GEOMETRY_SHADER_PRIMITIVES_EMITTED_ARB;
-        case QueryType::ClippingInputPrimitives:            return GL_CLIPPING_INPUT_PRIMITIVES_ARB;
-        case QueryType::ClippingOutputPrimitives:           return GL_CLIPPING_OUTPUT_PRIMITIVES_ARB;
-        #endif
-        
-        default:                                            break;
-    }
-    MapFailed("QueryType");
+    return MapWithTable(g_queryTypeMap, queryType, "QueryType");
 }
 
 GLenum Map(const BufferType bufferType)
 {
-    switch (bufferType)
-    {
-        case BufferType::Vertex:        return GL_ARRAY_BUFFER;
-        case BufferType::Index:         return GL_ELEMENT_ARRAY_BUFFER;
-        case BufferType::Constant:      return GL_UNIFORM_BUFFER;
-        #ifdef LLGL_OPENGL
-        case BufferType::Storage:       return GL_SHADER_STORAGE_BUFFER;
-        #endif
-        case BufferType::StreamOutput:  return GL_TRANSFORM_FEEDBACK_BUFFER;
-        default:                        break;
-    }
-    MapFailed("BufferType");
+    return MapWithTable(g_bufferTypeMap, bufferType, "BufferType");
 }
 
 GLenum Map(const RenderConditionMode renderConditionMode)
 {
-    #ifdef LLGL_OPENGL
-    switch (renderConditionMode)
-    {
-        case RenderConditionMode::Wait:                     return GL_QUERY_WAIT;
-        case RenderConditionMode::NoWait:                   return GL_QUERY_NO_WAIT;
-        case RenderConditionMode::ByRegionWait:             return GL_QUERY_BY_REGION_WAIT;
-        case RenderConditionMode::ByRegionNoWait:           return GL_QUERY_BY_REGION_NO_WAIT;
-        #ifndef __APPLE__
-        case RenderConditionMode::WaitInverted:             return GL_QUERY_WAIT_INVERTED;
-        case RenderConditionMode::NoWaitInverted:           return GL_QUERY_NO_WAIT_INVERTED;
-        case RenderConditionMode::ByRegionWaitInverted:     return GL_QUERY_BY_REGION_WAIT_INVERTED;
-        case RenderConditionMode::ByRegionNoWaitInverted:   return GL_QUERY_BY_REGION_NO_WAIT_INVERTED;
-        #else
-        default:                                            break;
-        #endif
-    }
-    #endif
-    MapFailed("RenderConditionMode");
+    return MapWithTable(g_renderConditionModeMap, renderConditionMode, "RenderConditionMode");
 }
 
 GLenum Map(const LogicOp logicOp)
 {
-    #ifdef LLGL_OPENGL
-    switch (logicOp)
-    {
-        case LogicOp::Keep:         break;
-        case LogicOp::Disabled:     break;
-        case LogicOp::Clear:        return GL_CLEAR;
-        case LogicOp::Set:          return GL_SET;
-        case LogicOp::Copy:         return GL_COPY;
-        case LogicOp::InvertedCopy: return GL_COPY_INVERTED;
-        case LogicOp::Noop:         return GL_NOOP;
-        case LogicOp::Invert:       return GL_INVERT;
-        case LogicOp::AND:          return GL_AND;
-        case LogicOp::NAND:         return GL_NAND;
-        case LogicOp::OR:           return GL_OR;
-        case LogicOp::NOR:          return GL_NOR;
-        case LogicOp::XOR:          return GL_XOR;
-        case LogicOp::Equiv:        return GL_EQUIV;
-        case LogicOp::ReverseAND:   return GL_AND_REVERSE;
-        case LogicOp::InvertedAND:  return GL_AND_INVERTED;
-        case LogicOp::ReverseOR:    return GL_OR_REVERSE;
-        case LogicOp::InvertedOR:   return GL_OR_INVERTED;
-    }
-    #endif
-    MapFailed("RenderConditionMode");
+    return MapWithTable(g_logicOpMap, logicOp, "LogicOp");
 }
 
 
@@ -9,7 +9,10 @@
 #include "../GLTypes.h"
 #include "../GLImport.h"
 #include "../GLImportExt.h"
+#include "../GLExtensionRegistry.h"
 #include <array>
+#include <vector>
+#include <algorithm>
 
 
 namespace LLGL
@@ -23,16 +26,6 @@ void GLTexImageInitialization(const ImageInitialization& imageInitialization)
     g_imageInitialization = imageInitialization;
 }
 
-static std::vector<ColorRGBAub> GenImageDataRGBAub(int numPixels, const ColorRGBAub& color)
-{
-    return std::vector<ColorRGBAub>(static_cast<std::size_t>(numPixels), color);
-}
-
-static std::vector<float> GenImageDataRf(int numPixels, float value)
-{
-    return std::vector<float>(static_cast<std::size_t>(numPixels), value);
-}
-
 [[noreturn]]
 void ErrIllegalUseOfDepthFormat()
 {
@@ -42,10 +35,32 @@ void ErrIllegalUseOfDepthFormat()
 #ifdef LLGL_OPENGL
 
 static void GLTexImage1DBase(
-    GLenum target, const TextureFormat internalFormat, unsigned int width,
+    bool immutable, GLenum target, const TextureFormat internalFormat, unsigned int width,
     GLenum format, GLenum type, const void* data, unsigned int compressedSize)
 {
-    if (IsCompressedFormat(internalFormat))
+    if (immutable)
+    {
+        /* Upload image data into immutable texture storage, which has already been allocated */
+        if (!data)
+            return;
+        if (IsCompressedFormat(internalFormat))
+        {
+            glCompressedTexSubImage1D(
+                target, 0, 0,
+                static_cast<GLsizei>(width),
+                GLTypes::Map(internalFormat), static_cast<GLsizei>(compressedSize), data
+            );
+        }
+        else
+        {
+            glTexSubImage1D(
+                target, 0, 0,
+                static_cast<GLsizei>(width),
+                format, type, data
+            );
+        }
+    }
+    else if (IsCompressedFormat(internalFormat))
     {
         glCompressedTexImage1D(
             target, 0, GLTypes::Map(internalFormat),
@@ -66,10 +81,34 @@ static void GLTexImage1DBase(
 #endif
 
 static void GLTexImage2DBase(
-    GLenum target, const TextureFormat internalFormat, unsigned int width, unsigned int height,
+    bool immutable, GLenum target, const TextureFormat internalFormat, unsigned int width, unsigned int height,
     GLenum format, GLenum type, const void* data, unsigned int compressedSize)
 {
-    if (IsCompressedFormat(internalFormat))
+    if (immutable)
+    {
+        /* Upload image data into immutable texture storage, which has already been allocated */
+        if (!data)
+            return;
+        if (IsCompressedFormat(internalFormat))
+        {
+            glCompressedTexSubImage2D(
+                target, 0, 0, 0,
+                static_cast<GLsizei>(width),
+                static_cast<GLsizei>(height),
+                GLTypes::Map(internalFormat), static_cast<GLsizei>(compressedSize), data
+            );
+        }
+        else
+        {
+            glTexSubImage2D(
+                target, 0, 0, 0,
+                static_cast<GLsizei>(width),
+                static_cast<GLsizei>(height),
+                format, type, data
+            );
+        }
+    }
+    else if (IsCompressedFormat(internalFormat))
     {
         glCompressedTexImage2D(
             target, 0, GLTypes::Map(internalFormat),
@@ -90,10 +129,36 @@ static void GLTexImage2DBase(
 }
 
 static void GLTexImage3DBase(
-    GLenum target, const TextureFormat internalFormat, unsigned int width, unsigned int height, unsigned int depth,
+    bool immutable, GLenum target, const TextureFormat internalFormat, unsigned int width, unsigned int height, unsigned int depth,
     GLenum format, GLenum type, const void* data, unsigned int compressedSize)
 {
-    if (IsCompressedFormat(internalFormat))
+    if (immutable)
+    {
+        /* Upload image data into immutable texture storage, which has already been allocated */
+        if (!data)
+            return;
+        if (IsCompressedFormat(internalFormat))
+        {
+            glCompressedTexSubImage3D(
+                target, 0, 0, 0, 0,
+                static_cast<GLsizei>(width),
+                static_cast<GLsizei>(height),
+                static_cast<GLsizei>(depth),
+                GLTypes::Map(internalFormat), static_cast<GLsizei>(compressedSize), data
+            );
+        }
+        else
+        {
+            glTexSubImage3D(
+                target, 0, 0, 0, 0,
+                static_cast<GLsizei>(width),
+                static_cast<GLsizei>(height),
+                static_cast<GLsizei>(depth),
+                format, type, data
+            );
+        }
+    }
+    else if (IsCompressedFormat(internalFormat))
     {
         glCompressedTexImage3D(
             target, 0, GLTypes::Map(internalFormat),
@@ -145,60 +210,60 @@ static void GLTexImage3DMultisampleBase(
 }
 
 static void GLTexImage1D(
-    const TextureFormat internalFormat, unsigned int width,
+    bool immutable, const TextureFormat internalFormat, unsigned int width,
     GLenum format, GLenum type, const void* data, unsigned int compressedSize = 0)
 {
-    GLTexImage1DBase(GL_TEXTURE_1D, internalFormat, width, format, type, data, compressedSize);
+    GLTexImage1DBase(immutable, GL_TEXTURE_1D, internalFormat, width, format, type, data, compressedSize);
 }
 
 #endif
 
 static void GLTexImage2D(
-    const TextureFormat internalFormat, unsigned int width, unsigned int height,
+    bool immutable, const TextureFormat internalFormat, unsigned int width, unsigned int height,
     GLenum format, GLenum type, const void* data, unsigned int compressedSize = 0)
 {
-    GLTexImage2DBase(GL_TEXTURE_2D, internalFormat, width, height, format, type, data, compressedSize);
+    GLTexImage2DBase(immutable, GL_TEXTURE_2D, internalFormat, width, height, format, type, data, compressedSize);
 }
 
 static void GLTexImage3D(
-    const TextureFormat internalFormat, unsigned int width, unsigned int height, unsigned int depth,
+    bool immutable, const TextureFormat internalFormat, unsigned int width, unsigned int height, unsigned int depth,
     GLenum format, GLenum type, const void* data, unsigned int compressedSize = 0)
 {
-    GLTexImage3DBase(GL_TEXTURE_3D, internalFormat, width, height, depth, format, type, data, compressedSize);
+    GLTexImage3DBase(immutable, GL_TEXTURE_3D, internalFormat, width, height, depth, format, type, data, compressedSize);
 }
 
 static void GLTexImageCube(
-    const TextureFormat internalFormat, unsigned int width, unsigned int height, AxisDirection cubeFace,
+    bool immutable, const TextureFormat internalFormat, unsigned int width, unsigned int height, AxisDirection cubeFace,
     GLenum format, GLenum type, const void* data, unsigned int compressedSize = 0)
 {
-    GLTexImage2DBase(GLTypes::Map(cubeFace), internalFormat, width, height, format, type, data, compressedSize);
+    GLTexImage2DBase(immutable, GLTypes::Map(cubeFace), internalFormat, width, height, format, type, data, compressedSize);
 }
 
 #ifdef LLGL_OPENGL
 
 static void GLTexImage1DArray(
-    const TextureFormat internalFormat, unsigned int width, unsigned int layers,
+    bool immutable, const TextureFormat internalFormat, unsigned int width, unsigned int layers,
     GLenum format, GLenum type, const void* data, unsigned int compressedSize = 0)
 {
-    GLTexImage2DBase(GL_TEXTURE_1D_ARRAY, internalFormat, width, layers, format, type, data, compressedSize);
+    GLTexImage2DBase(immutable, GL_TEXTURE_1D_ARRAY, internalFormat, width, layers, format, type, data, compressedSize);
 }
 
 #endif
 
 static void GLTexImage2DArray(
-    const TextureFormat internalFormat, unsigned int width, unsigned int height, unsigned int layers,
+    bool immutable, const TextureFormat internalFormat, unsigned int width, unsigned int height, unsigned int layers,
     GLenum format, GLenum type, const void* data, unsigned int compressedSize = 0)
 {
-    GLTexImage3DBase(GL_TEXTURE_2D_ARRAY, internalFormat, width, height, layers, format, type, data, compressedSize);
+    GLTexImage3DBase(immutable, GL_TEXTURE_2D_ARRAY, internalFormat, width, height, layers, format, type, data, compressedSize);
 }
 
 #ifdef LLGL_OPENGL
 
 static void GLTexImageCubeArray(
-    const TextureFormat internalFormat, unsigned int width, unsigned int height, unsigned int layers,
+    bool immutable, const TextureFormat internalFormat, unsigned int width, unsigned int height, unsigned int layers,
     GLenum format, GLenum type, const void* data, unsigned int compressedSize = 0)
 {
-    GLTexImage3DBase(GL_TEXTURE_CUBE_MAP_ARRAY, internalFormat, width, height, layers*6, format, type, data, compressedSize);
+    GLTexImage3DBase(immutable, GL_TEXTURE_CUBE_MAP_ARRAY, internalFormat, width, height, layers*6, format, type, data, compressedSize);
 }
 
 static void GLTexImage2DMultisample(
@@ -213,13 +278,99 @@ static void GLTexImage2DMultisampleArray(
     GLTexImage3DMultisampleBase(GL_TEXTURE_2D_MULTISAMPLE_ARRAY, samples, internalFormat, width, height, depth, fixedSamples);
 }
 
+#endif
+
+// Returns the number of MIP-map levels for the specified texture descriptor and the extent of its first MIP-map level.
+static GLsizei GLTexStorageLevels(const TextureDescriptor& desc, unsigned int width, unsigned int height = 1, unsigned int depth = 1)
+{
+    return static_cast<GLsizei>(desc.mipLevels > 0 ? desc.mipLevels : NumMipLevels(width, height, depth));
+}
+
+// Limits the MIP-map chain of mutable texture storage, since it can not be allocated in advance.
+static void GLTexMaxLevel(GLenum target, const TextureDescriptor& desc)
+{
+    if (desc.mipLevels > 0)
+        glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(desc.mipLevels - 1));
+}
+
+/*
+Returns the internal format for immutable texture storage. The base formats are mapped to their sized counterparts,
+since "glTexStorage..." only accepts sized internal formats, and fails with GL_INVALID_ENUM otherwise.
+*/
+static GLenum GLTexStorageFormat(const TextureFormat format)
+{
+    switch (format)
+    {
+        case TextureFormat::DepthComponent: return GL_DEPTH_COMPONENT24;
+        case TextureFormat::DepthStencil:   return GL_DEPTH24_STENCIL8;
+        case TextureFormat::R:              return GL_R8;
+        case TextureFormat::RG:             return GL_RG8;
+        case TextureFormat::RGB:            return GL_RGB8;
+        case TextureFormat::RGBA:           return GL_RGBA8;
+        default:                            return GLTypes::Map(format);
+    }
+}
+
+/*
+The "GLTexStorage..." functions allocate immutable texture storage for all MIP-map levels in a single call,
+if the extension "GL_ARB_texture_storage" is available, and return true in this case.
+Otherwise, the texture storage is allocated with the "glTexImage..." functions afterwards.
+*/
+
+#ifdef LLGL_OPENGL
+
+static bool GLTexStorage1D(GLenum target, const TextureDescriptor& desc, unsigned int width, GLsizei levels)
+{
+    #ifdef GL_ARB_texture_storage
+    if (HasExtension(GLExt::ARB_texture_storage))
+    {
+        glTexStorage1D(target, levels, GLTexStorageFormat(desc.format), static_cast<GLsizei>(width));
+        return true;
+    }
+    #endif
+    GLTexMaxLevel(target, desc);
+    return false;
+}
+
+#endif
+
+static bool GLTexStorage2D(GLenum target, const TextureDescriptor& desc, unsigned int width, unsigned int height, GLsizei levels)
+{
+    #ifdef GL_ARB_texture_storage
+    if (HasExtension(GLExt::ARB_texture_storage))
+    {
+        glTexStorage2D(target, levels, GLTexStorageFormat(desc.format), static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+        return true;
+    }
+    #endif
+    GLTexMaxLevel(target, desc);
+    return false;
+}
+
+static bool GLTexStorage3D(GLenum target, const TextureDescriptor& desc, unsigned int width, unsigned int height, unsigned int depth, GLsizei levels)
+{
+    #ifdef GL_ARB_texture_storage
+    if (HasExtension(GLExt::ARB_texture_storage))
+    {
+        glTexStorage3D(target, levels, GLTexStorageFormat(desc.format), static_cast<GLsizei>(width), static_cast<GLsizei>(height), static_cast<GLsizei>(depth));
+        return true;
+    }
+    #endif
+    GLTexMaxLevel(target, desc);
+    return false;
+}
+
+#ifdef LLGL_OPENGL
+
 void GLTexImage1D(const TextureDescriptor& desc, const ImageDescriptor* imageDesc)
 {
+    const bool immutable = GLTexStorage1D(GL_TEXTURE_1D, desc, desc.texture1D.width, GLTexStorageLevels(desc, desc.texture1D.width));
+
     if (imageDesc)
     {
         /* Setup texture image from descriptor */
         GLTexImage1D(
-            desc.format,
+            immutable, desc.format,
             desc.texture1D.width,
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
@@ -229,102 +380,67 @@ void GLTexImage1D(const TextureDescriptor& desc, const ImageDescriptor* imageDes
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImage1D(
-            desc.format,
+            immutable, desc.format,
             desc.texture1D.width,
             GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
-    else
-    {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAub(
-            desc.texture1D.width,
-            g_imageInitialization.color
-        );
-
-        GLTexImage1D(
-            desc.format,
-            desc.texture1D.width,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
-        );
-    }
 }
 
 #endif
 
 void GLTexImage2D(const TextureDescriptor& desc, const ImageDescriptor* imageDesc)
 {
+    const bool immutable = GLTexStorage2D(
+        GL_TEXTURE_2D, desc, desc.texture2D.width, desc.texture2D.height,
+        GLTexStorageLevels(desc, desc.texture2D.width, desc.texture2D.height)
+    );
+
     if (imageDesc)
     {
         /* Setup texture image from descriptor */
         GLTexImage2D(
-            desc.format,
+            immutable, desc.format,
             desc.texture2D.width, desc.texture2D.height,
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
     }
     else if (IsDepthStencilFormat(desc.format))
     {
-        if (g_imageInitialization.enabled)
-        {
-            /* Initialize depth texture image with default depth */
-            auto image = GenImageDataRf(
-                desc.texture2D.width * desc.texture2D.height,
-                g_imageInitialization.depth
-            );
-
-            GLTexImage2D(
-                desc.format,
-                desc.texture2D.width, desc.texture2D.height,
-                GL_DEPTH_COMPONENT, GL_FLOAT, image.data()
-            );
-        }
-        else
-        {
-            /* Allocate depth texture image without initial data */
-            GLTexImage2D(
-                desc.format,
-                desc.texture2D.width, desc.texture2D.height,
-                GL_DEPTH_COMPONENT, GL_FLOAT, nullptr
-            );
-        }
-    }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
-    {
-        /* Allocate texture without initial data */
+        /* Allocate depth texture image without initial data */
         GLTexImage2D(
-            desc.format,
+            immutable, desc.format,
             desc.texture2D.width, desc.texture2D.height,
-            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
+            GL_DEPTH_COMPONENT, GL_FLOAT, nullptr
         );
     }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAub(
-            desc.texture2D.width * desc.texture2D.height,
-            g_imageInitialization.color
-        );
-
+        /* Allocate texture without initial data */
         GLTexImage2D(
-            desc.format,
+            immutable, desc.format,
             desc.texture2D.width, desc.texture2D.height,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
+            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
 }
 
 void GLTexImage3D(const TextureDescriptor& desc, const ImageDescriptor* imageDesc)
 {
+    const bool immutable = GLTexStorage3D(
+        GL_TEXTURE_3D, desc, desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth,
+        GLTexStorageLevels(desc, desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth)
+    );
+
     if (imageDesc)
     {
         /* Setup texture image from descriptor */
         GLTexImage3D(
-            desc.format,
+            immutable, desc.format,
             desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth,
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
@@ -334,33 +450,24 @@ void GLTexImage3D(const TextureDescriptor& desc, const ImageDescriptor* imageDes
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImage3D(
-            desc.format,
+            immutable, desc.format,
             desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth,
             GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
-    else
-    {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAub(
-            desc.texture3D.width * desc.texture3D.height * desc.texture3D.depth,
-            g_imageInitialization.color
-        );
-
-        GLTexImage3D(
-            desc.format,
-            desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
-        );
-    }
 }
 
 void GLTexImageCube(const TextureDescriptor& desc, const ImageDescriptor* imageDesc)
 {
+    const bool immutable = GLTexStorage2D(
+        GL_TEXTURE_CUBE_MAP, desc, desc.textureCube.width, desc.textureCube.height,
+        GLTexStorageLevels(desc, desc.textureCube.width, desc.textureCube.height)
+    );
+
     const std::array<AxisDirection, 6> cubeFaces
     {{
         AxisDirection::XPos,
@@ -386,7 +493,7 @@ void GLTexImageCube(const TextureDescriptor& desc, const ImageDescriptor* imageD
         for (auto face : cubeFaces)
         {
             GLTexImageCube(
-                desc.format,
+                immutable, desc.format,
                 desc.textureCube.width, desc.textureCube.height, face,
                 dataFormatGL, dataTypeGL, imageFace, imageDesc->compressedSize
             );
@@ -398,46 +505,34 @@ void GLTexImageCube(const TextureDescriptor& desc, const ImageDescriptor* imageD
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         for (auto face : cubeFaces)
         {
             GLTexImageCube(
-                desc.format,
+                immutable, desc.format,
                 desc.textureCube.width, desc.textureCube.height, face,
                 GL_RGBA, GL_UNSIGNED_BYTE, nullptr
             );
         }
     }
-    else
-    {
-        /* Initialize texture image cube-faces with default color */
-        auto image = GenImageDataRGBAub(
-            desc.textureCube.width * desc.textureCube.height,
-            g_imageInitialization.color
-        );
-
-        for (auto face : cubeFaces)
-        {
-            GLTexImageCube(
-                desc.format,
-                desc.textureCube.width, desc.textureCube.height, face,
-                GL_RGBA, GL_UNSIGNED_BYTE, image.data()
-            );
-        }
-    }
 }
 
 #ifdef LLGL_OPENGL
 
 void GLTexImage1DArray(const TextureDescriptor& desc, const ImageDescriptor* imageDesc)
 {
+    const bool immutable = GLTexStorage2D(
+        GL_TEXTURE_1D_ARRAY, desc, desc.texture1D.width, desc.texture1D.layers,
+        GLTexStorageLevels(desc, desc.texture1D.width)
+    );
+
     if (imageDesc)
     {
         /* Setup texture image from descriptor */
         GLTexImage1DArray(
-            desc.format,
+            immutable, desc.format,
             desc.texture1D.width, desc.texture1D.layers,
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
@@ -447,91 +542,51 @@ void GLTexImage1DArray(const TextureDescriptor& desc, const ImageDescriptor* ima
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImage1DArray(
-            desc.format,
+            immutable, desc.format,
             desc.texture1D.width, desc.texture1D.layers,
             GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
-    else
-    {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAub(
-            desc.texture1D.width * static_cast<int>(desc.texture1D.layers),
-            g_imageInitialization.color
-        );
-
-        GLTexImage1DArray(
-            desc.format,
-            desc.texture1D.width, desc.texture1D.layers,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
-        );
-    }
 }
 
 #endif
 
 void GLTexImage2DArray(const TextureDescriptor& desc, const ImageDescriptor* imageDesc)
 {
+    const bool immutable = GLTexStorage3D(
+        GL_TEXTURE_2D_ARRAY, desc, desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers,
+        GLTexStorageLevels(desc, desc.texture2D.width, desc.texture2D.height)
+    );
+
     if (imageDesc)
     {
         /* Setup texture image from descriptor */
         GLTexImage2DArray(
-            desc.format,
+            immutable, desc.format,
             desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers,
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
     }
     else if (IsDepthStencilFormat(desc.format))
     {
-        if (g_imageInitialization.enabled)
-        {
-            /* Initialize depth texture image with default depth */
-            auto image = GenImageDataRf(
-                desc.texture2D.width * desc.texture2D.height * static_cast<int>(desc.texture2D.layers),
-                g_imageInitialization.depth
-            );
-
-            GLTexImage2DArray(
-                desc.format,
-                desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers,
-                GL_DEPTH_COMPONENT, GL_FLOAT, image.data()
-            );
-        }
-        else
-        {
-            /* Allocate depth texture image without initial data */
-            GLTexImage2DArray(
-                desc.format,
-                desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers,
-                GL_DEPTH_COMPONENT, GL_FLOAT, nullptr
-            );
-        }
-    }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
-    {
-        /* Allocate texture without initial data */
+        /* Allocate depth texture image without initial data */
         GLTexImage2DArray(
-            desc.format,
+            immutable, desc.format,
             desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers,
-            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
+            GL_DEPTH_COMPONENT, GL_FLOAT, nullptr
         );
     }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAub(
-            desc.texture2D.width * desc.texture2D.height * static_cast<int>(desc.texture2D.layers),
-            g_imageInitialization.color
-        );
-
+        /* Allocate texture without initial data */
         GLTexImage2DArray(
-            desc.format,
+            immutable, desc.format,
             desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
+            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
 }
@@ -540,11 +595,16 @@ void GLTexImage2DArray(const TextureDescriptor& desc, const ImageDescriptor* ima
 
 void GLTexImageCubeArray(const TextureDescriptor& desc, const ImageDescriptor* imageDesc)
 {
+    const bool immutable = GLTexStorage3D(
+        GL_TEXTURE_CUBE_MAP_ARRAY, desc, desc.textureCube.width, desc.textureCube.height, desc.textureCube.layers*6,
+        GLTexStorageLevels(desc, desc.textureCube.width, desc.textureCube.height)
+    );
+
     if (imageDesc)
     {
         /* Setup texture image cube-faces from descriptor */
         GLTexImageCubeArray(
-            desc.format,
+            immutable, desc.format,
             desc.textureCube.width, desc.textureCube.height, desc.textureCube.layers,
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
@@ -554,33 +614,35 @@ void GLTexImageCubeArray(const TextureDescriptor& desc, const ImageDescriptor* i
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImageCubeArray(
-            desc.format,
+            immutable, desc.format,
             desc.textureCube.width, desc.textureCube.height, desc.textureCube.layers,
             GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
-    else
-    {
-        /* Initialize texture image cube-faces with default color */
-        auto image = GenImageDataRGBAub(
-            desc.textureCube.width * desc.textureCube.height * static_cast<int>(desc.textureCube.layers*6),
-            g_imageInitialization.color
-        );
-
-        GLTexImageCubeArray(
-            desc.format,
-            desc.textureCube.width, desc.textureCube.height, desc.textureCube.layers,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
-        );
-    }
 }
 
 void GLTexImage2DMS(const TextureDescriptor& desc)
 {
+    #ifdef GL_ARB_texture_storage_multisample
+    if (HasExtension(GLExt::ARB_texture_storage_multisample))
+    {
+        /* Allocate immutable multi-sampled texture storage from descriptor */
+        glTexStorage2DMultisample(
+            GL_TEXTURE_2D_MULTISAMPLE,
+            static_cast<GLsizei>(desc.texture2DMS.samples),
+            GLTexStorageFormat(desc.format),
+            static_cast<GLsizei>(desc.texture2DMS.width),
+            static_cast<GLsizei>(desc.texture2DMS.height),
+            (desc.texture2DMS.fixedSamples ? GL_TRUE : GL_FALSE)
+        );
+        return;
+    }
+    #endif
+
     /* Setup multi-sampled texture storage from descriptor */
     GLTexImage2DMultisample(
         desc.texture2DMS.samples, desc.format,
@@ -591,6 +653,23 @@ void GLTexImage2DMS(const TextureDescriptor& desc)
 
 void GLTexImage2DMSArray(const TextureDescriptor& desc)
 {
+    #ifdef GL_ARB_texture_storage_multisample
+    if (HasExtension(GLExt::ARB_texture_storage_multisample))
+    {
+        /* Allocate immutable multi-sampled array texture storage from descriptor */
+        glTexStorage3DMultisample(
+            GL_TEXTURE_2D_MULTISAMPLE_ARRAY,
+            static_cast<GLsizei>(desc.texture2DMS.samples),
+            GLTexStorageFormat(desc.format),
+            static_cast<GLsizei>(desc.texture2DMS.width),
+            static_cast<GLsizei>(desc.texture2DMS.height),
+            static_cast<GLsizei>(desc.texture2DMS.layers),
+            (desc.texture2DMS.fixedSamples ? GL_TRUE : GL_FALSE)
+        );
+        return;
+    }
+    #endif
+
     /* Setup multi-sampled array texture storage from descriptor */
     GLTexImage2DMultisampleArray(
         desc.texture2DMS.samples, desc.format,
@@ -601,6 +680,121 @@ void GLTexImage2DMSArray(const TextureDescriptor& desc)
 
 #endif
 
+// Maximal number of texels in the fill buffer for the default image initialization (i.e. 256 KB for RGBA8 texels).
+static const unsigned int g_maxFillBufferTexels = 65536;
+
+// Fills the first MIP-map level of the bound texture with the specified value, and uploads as many rows at once as fit into a small fill buffer.
+template <typename T>
+static void GLTexSubImageFill(
+    GLenum target, int dimensions, unsigned int width, unsigned int height, unsigned int depth,
+    GLenum format, GLenum type, const T& value)
+{
+    const auto rowsPerChunk = std::max(1u, std::min(height, g_maxFillBufferTexels / std::max(1u, width)));
+    const std::vector<T> fillBuffer(static_cast<std::size_t>(width) * rowsPerChunk, value);
+
+    for (unsigned int z = 0; z < depth; ++z)
+    {
+        for (unsigned int y = 0; y < height; y += rowsPerChunk)
+        {
+            auto rows = std::min(rowsPerChunk, height - y);
+            switch (dimensions)
+            {
+                #ifdef LLGL_OPENGL
+                case 1:
+                    glTexSubImage1D(
+                        target, 0, 0,
+                        static_cast<GLsizei>(width),
+                        format, type, fillBuffer.data()
+                    );
+                    break;
+                #endif
+                case 2:
+                    glTexSubImage2D(
+                        target, 0, 0, static_cast<GLint>(y),
+                        static_cast<GLsizei>(width), static_cast<GLsizei>(rows),
+                        format, type, fillBuffer.data()
+                    );
+                    break;
+                case 3:
+                    glTexSubImage3D(
+                        target, 0, 0, static_cast<GLint>(y), static_cast<GLint>(z),
+                        static_cast<GLsizei>(width), static_cast<GLsizei>(rows), 1,
+                        format, type, fillBuffer.data()
+                    );
+                    break;
+            }
+        }
+    }
+}
+
+template <typename T>
+static void GLTexImageFillBase(GLuint texID, const TextureDescriptor& desc, GLenum format, GLenum type, const T& value)
+{
+    #ifdef GL_ARB_clear_texture
+    if (HasExtension(GLExt::ARB_clear_texture))
+    {
+        /* Clear first MIP-map level without any image data on the CPU side */
+        glClearTexImage(texID, 0, format, type, &value);
+        return;
+    }
+    #endif
+
+    switch (desc.type)
+    {
+        #ifdef LLGL_OPENGL
+        case TextureType::Texture1D:
+            GLTexSubImageFill(GL_TEXTURE_1D, 1, desc.texture1D.width, 1, 1, format, type, value);
+            break;
+        #endif
+
+        case TextureType::Texture2D:
+            GLTexSubImageFill(GL_TEXTURE_2D, 2, desc.texture2D.width, desc.texture2D.height, 1, format, type, value);
+            break;
+
+        case TextureType::Texture3D:
+            GLTexSubImageFill(GL_TEXTURE_3D, 3, desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth, format, type, value);
+            break;
+
+        case TextureType::TextureCube:
+            for (GLenum face = GL_TEXTURE_CUBE_MAP_POSITIVE_X; face <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z; ++face)
+                GLTexSubImageFill(face, 2, desc.textureCube.width, desc.textureCube.height, 1, format, type, value);
+            break;
+
+        #ifdef LLGL_OPENGL
+        case TextureType::Texture1DArray:
+            GLTexSubImageFill(GL_TEXTURE_1D_ARRAY, 2, desc.texture1D.width, desc.texture1D.layers, 1, format, type, value);
+            break;
+        #endif
+
+        case TextureType::Texture2DArray:
+            GLTexSubImageFill(GL_TEXTURE_2D_ARRAY, 3, desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers, format, type, value);
+            break;
+
+        #ifdef LLGL_OPENGL
+        case TextureType::TextureCubeArray:
+            GLTexSubImageFill(GL_TEXTURE_CUBE_MAP_ARRAY, 3, desc.textureCube.width, desc.textureCube.height, desc.textureCube.layers*6, format, type, value);
+            break;
+        #endif
+
+        default:
+            break;
+    }
+}
+
+void GLTexImageFillDefault(GLuint texID, const TextureDescriptor& desc)
+{
+    /* Compressed and multi-sampled textures are not initialized */
+    if (!g_imageInitialization.enabled || IsCompressedFormat(desc.format))
+        return;
+    if (desc.type == TextureType::Texture2DMS || desc.type == TextureType::Texture2DMSArray)
+        return;
+
+    if (IsDepthStencilFormat(desc.format))
+        GLTexImageFillBase(texID, desc, GL_DEPTH_COMPONENT, GL_FLOAT, g_imageInitialization.depth);
+    else
+        GLTexImageFillBase(texID, desc, GL_RGBA, GL_UNSIGNED_BYTE, g_imageInitialization.color);
+}
+
 
 } // /namespace LLGL
 
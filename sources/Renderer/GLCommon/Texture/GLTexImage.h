@@ -12,6 +12,7 @@
 #include <LLGL/Image.h>
 #include <LLGL/TextureFlags.h>
 #include <LLGL/RenderSystemFlags.h>
+#include "../GLImport.h"
 
 
 namespace LLGL
@@ -41,6 +42,12 @@ void GLTexImage2DArray(const TextureDescriptor& desc, const ImageDescriptor* ima
 
 #endif
 
+/*
+Fills the first MIP-map level of the specified (bound) texture with the default image initialization, if enabled.
+This uses "glClearTexImage" if available, or a small fill buffer otherwise.
+*/
+void GLTexImageFillDefault(GLuint texID, const TextureDescriptor& desc);
+
 
 } // /namespace LLGL
 
@@ -243,6 +243,174 @@ void GLTexSubImageCubeArray(const SubTextureDescriptor& desc, const ImageDescrip
 #endif
 
 
+#if defined LLGL_OPENGL && defined GL_ARB_direct_state_access
+
+static void GLTextureSubImage1DBase(
+    GLuint texture, unsigned int mipLevel, unsigned int x, unsigned int width, const ImageDescriptor& imageDesc)
+{
+    if (IsCompressedFormat(imageDesc.format))
+    {
+        glCompressedTextureSubImage1D(
+            texture,
+            static_cast<GLint>(mipLevel),
+            static_cast<GLint>(x),
+            static_cast<GLsizei>(width),
+            GLTypes::Map(imageDesc.format),
+            static_cast<GLsizei>(imageDesc.compressedSize),
+            imageDesc.buffer
+        );
+    }
+    else
+    {
+        glTextureSubImage1D(
+            texture,
+            static_cast<GLint>(mipLevel),
+            static_cast<GLint>(x),
+            static_cast<GLsizei>(width),
+            GLTypes::Map(imageDesc.format),
+            GLTypes::Map(imageDesc.dataType),
+            imageDesc.buffer
+        );
+    }
+}
+
+static void GLTextureSubImage2DBase(
+    GLuint texture, unsigned int mipLevel, unsigned int x, unsigned int y,
+    unsigned int width, unsigned int height, const ImageDescriptor& imageDesc)
+{
+    if (IsCompressedFormat(imageDesc.format))
+    {
+        glCompressedTextureSubImage2D(
+            texture,
+            static_cast<GLint>(mipLevel),
+            static_cast<GLint>(x),
+            static_cast<GLint>(y),
+            static_cast<GLsizei>(width),
+            static_cast<GLsizei>(height),
+            GLTypes::Map(imageDesc.format),
+            static_cast<GLsizei>(imageDesc.compressedSize),
+            imageDesc.buffer
+        );
+    }
+    else
+    {
+        glTextureSubImage2D(
+            texture,
+            static_cast<GLint>(mipLevel),
+            static_cast<GLint>(x),
+            static_cast<GLint>(y),
+            static_cast<GLsizei>(width),
+            static_cast<GLsizei>(height),
+            GLTypes::Map(imageDesc.format),
+            GLTypes::Map(imageDesc.dataType),
+            imageDesc.buffer
+        );
+    }
+}
+
+static void GLTextureSubImage3DBase(
+    GLuint texture, unsigned int mipLevel, unsigned int x, unsigned int y, unsigned int z,
+    unsigned int width, unsigned int height, unsigned int depth, const ImageDescriptor& imageDesc)
+{
+    if (IsCompressedFormat(imageDesc.format))
+    {
+        glCompressedTextureSubImage3D(
+            texture,
+            static_cast<GLint>(mipLevel),
+            static_cast<GLint>(x),
+            static_cast<GLint>(y),
+            static_cast<GLint>(z),
+            static_cast<GLsizei>(width),
+            static_cast<GLsizei>(height),
+            static_cast<GLsizei>(depth),
+            GLTypes::Map(imageDesc.format),
+            static_cast<GLsizei>(imageDesc.compressedSize),
+            imageDesc.buffer
+        );
+    }
+    else
+    {
+        glTextureSubImage3D(
+            texture,
+            static_cast<GLint>(mipLevel),
+            static_cast<GLint>(x),
+            static_cast<GLint>(y),
+            static_cast<GLint>(z),
+            static_cast<GLsizei>(width),
+            static_cast<GLsizei>(height),
+            static_cast<GLsizei>(depth),
+            GLTypes::Map(imageDesc.format),
+            GLTypes::Map(imageDesc.dataType),
+            imageDesc.buffer
+        );
+    }
+}
+
+void GLTextureSubImage(GLuint texture, const TextureType type, const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc)
+{
+    /*
+    Without a texture target, array layers and cube faces are addressed by the next higher dimension,
+    i.e. the cube face is the z-offset of a cube texture and "layer * 6 + face" for cube arrays.
+    */
+    switch (type)
+    {
+        case TextureType::Texture1D:
+            GLTextureSubImage1DBase(
+                texture, desc.mipLevel, desc.texture1D.x, desc.texture1D.width, imageDesc
+            );
+            break;
+
+        case TextureType::Texture2D:
+            GLTextureSubImage2DBase(
+                texture, desc.mipLevel, desc.texture2D.x, desc.texture2D.y,
+                desc.texture2D.width, desc.texture2D.height, imageDesc
+            );
+            break;
+
+        case TextureType::Texture3D:
+            GLTextureSubImage3DBase(
+                texture, desc.mipLevel, desc.texture3D.x, desc.texture3D.y, desc.texture3D.z,
+                desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth, imageDesc
+            );
+            break;
+
+        case TextureType::TextureCube:
+            GLTextureSubImage3DBase(
+                texture, desc.mipLevel, desc.textureCube.x, desc.textureCube.y, static_cast<unsigned int>(desc.textureCube.cubeFaceOffset),
+                desc.textureCube.width, desc.textureCube.height, 1, imageDesc
+            );
+            break;
+
+        case TextureType::Texture1DArray:
+            GLTextureSubImage2DBase(
+                texture, desc.mipLevel, desc.texture1D.x, desc.texture1D.layerOffset,
+                desc.texture1D.width, desc.texture1D.layers, imageDesc
+            );
+            break;
+
+        case TextureType::Texture2DArray:
+            GLTextureSubImage3DBase(
+                texture, desc.mipLevel, desc.texture2D.x, desc.texture2D.y, desc.texture2D.layerOffset,
+                desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers, imageDesc
+            );
+            break;
+
+        case TextureType::TextureCubeArray:
+            GLTextureSubImage3DBase(
+                texture, desc.mipLevel, desc.textureCube.x, desc.textureCube.y,
+                desc.textureCube.layerOffset * 6 + static_cast<unsigned int>(desc.textureCube.cubeFaceOffset),
+                desc.textureCube.width, desc.textureCube.height, desc.textureCube.cubeFaces, imageDesc
+            );
+            break;
+
+        default:
+            break;
+    }
+}
+
+#endif
+
+
 } // /namespace LLGL
 
 
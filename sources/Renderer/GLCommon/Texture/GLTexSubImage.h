@@ -11,6 +11,7 @@
 
 #include <LLGL/Image.h>
 #include <LLGL/TextureFlags.h>
+#include "../GLImport.h"
 
 
 namespace LLGL
@@ -27,6 +28,13 @@ void GLTexSubImage1DArray(const SubTextureDescriptor& desc, const ImageDescripto
 void GLTexSubImage2DArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
 void GLTexSubImageCubeArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
 
+#ifdef GL_ARB_direct_state_access
+
+// Writes the sub image of the specified texture with direct state access, i.e. the texture does not need to be bound.
+void GLTextureSubImage(GLuint texture, const TextureType type, const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
+
+#endif
+
 #else
 
 void GLTexSubImage2D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
@@ -0,0 +1,60 @@
+/*
+ * MappingTable.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_MAPPING_TABLE_H
+#define LLGL_MAPPING_TABLE_H
+
+
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Entry of a dense mapping table from an enumeration to a native type.
+The key is only stored to verify the order of the table at compile time (see IsMappingTableComplete).
+*/
+template <typename TKey, typename TValue>
+struct MappingEntry
+{
+    TKey    key;
+    TValue  value;
+};
+
+// Returns true if each entry of the mapping table is located at the underlying value of its key.
+template <typename TKey, typename TValue, std::size_t N>
+constexpr bool IsMappingTableOrdered(const MappingEntry<TKey, TValue> (&table)[N], std::size_t index = 0)
+{
+    return (index == N || (static_cast<std::size_t>(table[index].key) == index && IsMappingTableOrdered(table, index + 1)));
+}
+
+// Returns true if the mapping table is ordered and has exactly one entry for each enumeration entry up to and including 'lastKey'.
+template <typename TKey, typename TValue, std::size_t N>
+constexpr bool IsMappingTableComplete(const MappingEntry<TKey, TValue> (&table)[N], const TKey lastKey)
+{
+    return (static_cast<std::size_t>(lastKey) + 1 == N && IsMappingTableOrdered(table));
+}
+
+// Returns the value the specified key is mapped to, or 'invalidValue' if the key is out of range.
+template <typename TKey, typename TValue, std::size_t N>
+inline TValue LookupMappingTable(const MappingEntry<TKey, TValue> (&table)[N], const TKey key, const TValue invalidValue)
+{
+    const auto index = static_cast<std::size_t>(key);
+    return (index < N ? table[index].value : invalidValue);
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
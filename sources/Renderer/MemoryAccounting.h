@@ -0,0 +1,104 @@
+/*
+ * MemoryAccounting.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_MEMORY_ACCOUNTING_H
+#define LLGL_MEMORY_ACCOUNTING_H
+
+
+#include <LLGL/RenderSystemFlags.h>
+#include <atomic>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Tally of the memory which is allocated for each type of hardware resource.
+All counters are atomics with relaxed memory order, so resources can be created and released on any thread without locks.
+*/
+class MemoryAccounting
+{
+
+    public:
+
+        enum class Type
+        {
+            Buffer,
+            Texture,
+            RenderTarget,
+        };
+
+        // Adds a new resource of the specified type and size (in bytes) to the tally.
+        inline void Allocate(const Type type, std::uint64_t size)
+        {
+            auto& counter = counters_[static_cast<int>(type)];
+            counter.memory.fetch_add(size, std::memory_order_relaxed);
+            counter.count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Removes a resource of the specified type and size (in bytes) from the tally.
+        inline void Release(const Type type, std::uint64_t size)
+        {
+            auto& counter = counters_[static_cast<int>(type)];
+            counter.memory.fetch_sub(size, std::memory_order_relaxed);
+            counter.count.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // Changes the memory of an existing resource of the specified type, e.g. when a render target allocates or releases internal attachments.
+        inline void Resize(const Type type, std::uint64_t oldSize, std::uint64_t newSize)
+        {
+            auto& counter = counters_[static_cast<int>(type)];
+            if (newSize > oldSize)
+                counter.memory.fetch_add(newSize - oldSize, std::memory_order_relaxed);
+            else
+                counter.memory.fetch_sub(oldSize - newSize, std::memory_order_relaxed);
+        }
+
+        // Returns the statistics of all tallied resources. The driver-reported device memory is left unchanged.
+        inline void GetStatistics(MemoryStatistics& stats) const
+        {
+            stats.bufferMemory          = GetMemory(Type::Buffer);
+            stats.numBuffers            = GetCount(Type::Buffer);
+            stats.textureMemory         = GetMemory(Type::Texture);
+            stats.numTextures           = GetCount(Type::Texture);
+            stats.renderTargetMemory    = GetMemory(Type::RenderTarget);
+            stats.numRenderTargets      = GetCount(Type::RenderTarget);
+        }
+
+    private:
+
+        struct Counter
+        {
+            std::atomic<std::uint64_t> memory { 0 };
+            std::atomic<std::uint64_t> count  { 0 };
+        };
+
+        inline std::uint64_t GetMemory(const Type type) const
+        {
+            return counters_[static_cast<int>(type)].memory.load(std::memory_order_relaxed);
+        }
+
+        inline std::uint64_t GetCount(const Type type) const
+        {
+            return counters_[static_cast<int>(type)].count.load(std::memory_order_relaxed);
+        }
+
+        Counter counters_[3];
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
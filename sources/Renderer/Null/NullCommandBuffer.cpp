@@ -0,0 +1,479 @@
+/*
+ * NullCommandBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullCommandBuffer.h"
+#include "NullRenderTarget.h"
+#include "NullRenderStates.h"
+#include "../CPUCommon/CPUBuffer.h"
+#include "../CPUCommon/CPUBufferArray.h"
+#include "../CheckedCast.h"
+#include <LLGL/ShaderFlags.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+/* ----- Common ----- */
+
+NullCommandBuffer::NullCommandBuffer(const RenderingCaps& caps) :
+    caps_ { caps }
+{
+}
+
+/* ----- Configuration ----- */
+
+void NullCommandBuffer::SetGraphicsAPIDependentState(const GraphicsAPIDependentStateDescriptor& /*state*/)
+{
+    // dummy
+}
+
+void NullCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    if (viewport.width < 0.0f || viewport.height < 0.0f)
+        throw std::invalid_argument("viewport must not have a negative size");
+}
+
+void NullCommandBuffer::SetViewportArray(unsigned int numViewports, const Viewport* viewportArray)
+{
+    if (numViewports > 1 && !caps_.hasViewportArrays)
+        throw std::runtime_error("viewport arrays are not supported");
+    for (unsigned int i = 0; i < numViewports; ++i)
+        SetViewport(viewportArray[i]);
+}
+
+void NullCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    if (scissor.width < 0 || scissor.height < 0)
+        throw std::invalid_argument("scissor rectangle must not have a negative size");
+}
+
+void NullCommandBuffer::SetScissorArray(unsigned int numScissors, const Scissor* scissorArray)
+{
+    if (numScissors > 1 && !caps_.hasViewportArrays)
+        throw std::runtime_error("scissor arrays are not supported");
+    for (unsigned int i = 0; i < numScissors; ++i)
+        SetScissor(scissorArray[i]);
+}
+
+void NullCommandBuffer::SetClearColor(const ColorRGBAf& /*color*/)
+{
+    // dummy
+}
+
+void NullCommandBuffer::SetClearDepth(float /*depth*/)
+{
+    // dummy
+}
+
+void NullCommandBuffer::SetClearStencil(int /*stencil*/)
+{
+    // dummy
+}
+
+void NullCommandBuffer::Clear(long /*flags*/)
+{
+    // dummy
+}
+
+void NullCommandBuffer::ClearTarget(unsigned int targetIndex, const LLGL::ColorRGBAf& /*color*/)
+{
+    if (targetIndex >= caps_.maxNumRenderTargetAttachments)
+        throw std::out_of_range("render target attachment index out of range: " + std::to_string(targetIndex));
+}
+
+/* ----- Buffers ------ */
+
+void NullCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    auto& bufferNull = LLGL_CAST(CPUBuffer&, buffer);
+    ValidateBufferType(bufferNull, BufferType::Vertex, __FUNCTION__);
+
+    ResetVertexLimits();
+    UpdateVertexLimits(bufferNull);
+}
+
+void NullCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    auto& bufferArrayNull = LLGL_CAST(CPUBufferArray&, bufferArray);
+
+    ResetVertexLimits();
+    for (auto buffer : bufferArrayNull.GetBuffers())
+    {
+        ValidateBufferType(*buffer, BufferType::Vertex, __FUNCTION__);
+        UpdateVertexLimits(*buffer);
+    }
+}
+
+void NullCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    auto& bufferNull = LLGL_CAST(CPUBuffer&, buffer);
+    ValidateBufferType(bufferNull, BufferType::Index, __FUNCTION__);
+
+    indexLimit_     = bufferNull.GetNumElements();
+    indexBufferSet_ = true;
+}
+
+void NullCommandBuffer::SetConstantBuffer(Buffer& buffer, unsigned int /*slot*/, long shaderStageFlags)
+{
+    ValidateBufferType(LLGL_CAST(CPUBuffer&, buffer), BufferType::Constant, __FUNCTION__);
+    ValidateShaderStageFlags(shaderStageFlags, __FUNCTION__);
+}
+
+void NullCommandBuffer::SetConstantBufferArray(BufferArray& bufferArray, unsigned int /*startSlot*/, long shaderStageFlags)
+{
+    ValidateBufferType(*LLGL_CAST(CPUBufferArray&, bufferArray).GetBuffers().front(), BufferType::Constant, __FUNCTION__);
+    ValidateShaderStageFlags(shaderStageFlags, __FUNCTION__);
+}
+
+void NullCommandBuffer::SetStorageBuffer(Buffer& buffer, unsigned int /*slot*/, long shaderStageFlags)
+{
+    ValidateBufferType(LLGL_CAST(CPUBuffer&, buffer), BufferType::Storage, __FUNCTION__);
+    ValidateShaderStageFlags(shaderStageFlags, __FUNCTION__);
+}
+
+void NullCommandBuffer::SetStorageBufferArray(BufferArray& bufferArray, unsigned int /*startSlot*/, long shaderStageFlags)
+{
+    ValidateBufferType(*LLGL_CAST(CPUBufferArray&, bufferArray).GetBuffers().front(), BufferType::Storage, __FUNCTION__);
+    ValidateShaderStageFlags(shaderStageFlags, __FUNCTION__);
+}
+
+void NullCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
+{
+    if (streamOutputBusy_)
+        throw std::runtime_error("cannot change stream-output buffer while stream-output is active");
+    ValidateBufferType(LLGL_CAST(CPUBuffer&, buffer), BufferType::StreamOutput, __FUNCTION__);
+}
+
+void NullCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
+{
+    if (streamOutputBusy_)
+        throw std::runtime_error("cannot change stream-output buffers while stream-output is active");
+    ValidateBufferType(*LLGL_CAST(CPUBufferArray&, bufferArray).GetBuffers().front(), BufferType::StreamOutput, __FUNCTION__);
+}
+
+void NullCommandBuffer::BeginStreamOutput(const PrimitiveType /*primitiveType*/)
+{
+    if (streamOutputBusy_)
+        throw std::runtime_error("stream-output is already active");
+    streamOutputBusy_ = true;
+}
+
+void NullCommandBuffer::EndStreamOutput()
+{
+    if (!streamOutputBusy_)
+        throw std::runtime_error("stream-output has not started");
+    streamOutputBusy_ = false;
+}
+
+/* ----- Textures ----- */
+
+void NullCommandBuffer::SetTexture(Texture& /*texture*/, unsigned int /*slot*/, long shaderStageFlags)
+{
+    ValidateShaderStageFlags(shaderStageFlags, __FUNCTION__);
+}
+
+void NullCommandBuffer::SetTextureArray(TextureArray& /*textureArray*/, unsigned int /*startSlot*/, long shaderStageFlags)
+{
+    ValidateShaderStageFlags(shaderStageFlags, __FUNCTION__);
+}
+
+/* ----- Sampler States ----- */
+
+void NullCommandBuffer::SetSampler(Sampler& /*sampler*/, unsigned int /*slot*/, long shaderStageFlags)
+{
+    ValidateShaderStageFlags(shaderStageFlags, __FUNCTION__);
+}
+
+void NullCommandBuffer::SetSamplerArray(SamplerArray& /*samplerArray*/, unsigned int /*startSlot*/, long shaderStageFlags)
+{
+    ValidateShaderStageFlags(shaderStageFlags, __FUNCTION__);
+}
+
+/* ----- Resource Heaps ----- */
+
+void NullCommandBuffer::SetResourceHeap(ResourceHeap& /*resourceHeap*/)
+{
+    // dummy
+}
+
+/* ----- Render Targets ----- */
+
+void NullCommandBuffer::SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* /*renderPassDesc*/)
+{
+    auto& renderTargetNull = LLGL_CAST(NullRenderTarget&, renderTarget);
+    if (renderTargetNull.GetNumColorAttachments() == 0 && renderTarget.GetResolution().x == 0)
+        throw std::runtime_error("cannot set render target without attachments");
+}
+
+void NullCommandBuffer::SetRenderTarget(RenderContext& /*renderContext*/, const RenderPassDescriptor* /*renderPassDesc*/)
+{
+    // dummy
+}
+
+/* ----- Pipeline States ----- */
+
+void NullCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
+{
+    graphicsPipeline_ = LLGL_CAST(NullGraphicsPipeline*, &graphicsPipeline);
+}
+
+void NullCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
+{
+    computePipeline_ = LLGL_CAST(NullComputePipeline*, &computePipeline);
+}
+
+/* ----- Queries ----- */
+
+void NullCommandBuffer::BeginQuery(Query& query)
+{
+    auto& queryNull = LLGL_CAST(NullQuery&, query);
+    if (queryNull.active)
+        throw std::runtime_error("query is already active");
+    queryNull.active    = true;
+    queryNull.finished  = false;
+}
+
+void NullCommandBuffer::EndQuery(Query& query)
+{
+    auto& queryNull = LLGL_CAST(NullQuery&, query);
+    if (!queryNull.active)
+        throw std::runtime_error("query has not started");
+    queryNull.active    = false;
+    queryNull.finished  = true;
+}
+
+bool NullCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
+{
+    auto& queryNull = LLGL_CAST(NullQuery&, query);
+    if (!queryNull.finished)
+        return false;
+
+    /* Nothing is rendered, so every query result is zero */
+    result = 0;
+    return true;
+}
+
+void NullCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode /*mode*/)
+{
+    if (renderCondition_)
+        throw std::runtime_error("render condition is already active");
+    renderCondition_ = LLGL_CAST(NullQuery*, &query);
+}
+
+void NullCommandBuffer::EndRenderCondition()
+{
+    if (!renderCondition_)
+        throw std::runtime_error("render condition has not started");
+    renderCondition_ = nullptr;
+}
+
+/* ----- Drawing ----- */
+
+void NullCommandBuffer::Draw(unsigned int numVertices, unsigned int firstVertex)
+{
+    ValidateDraw(numVertices, firstVertex, 1, 0);
+}
+
+void NullCommandBuffer::DrawIndexed(unsigned int numVertices, unsigned int firstIndex)
+{
+    ValidateDrawIndexed(numVertices, firstIndex, 1, 0);
+}
+
+void NullCommandBuffer::DrawIndexed(unsigned int numVertices, unsigned int firstIndex, int /*vertexOffset*/)
+{
+    ValidateDrawIndexed(numVertices, firstIndex, 1, 0);
+}
+
+void NullCommandBuffer::DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances)
+{
+    ValidateDraw(numVertices, firstVertex, numInstances, 0);
+}
+
+void NullCommandBuffer::DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset)
+{
+    ValidateDraw(numVertices, firstVertex, numInstances, instanceOffset);
+}
+
+void NullCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex)
+{
+    ValidateDrawIndexed(numVertices, firstIndex, numInstances, 0);
+}
+
+void NullCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int /*vertexOffset*/)
+{
+    ValidateDrawIndexed(numVertices, firstIndex, numInstances, 0);
+}
+
+void NullCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int /*vertexOffset*/, unsigned int instanceOffset)
+{
+    ValidateDrawIndexed(numVertices, firstIndex, numInstances, instanceOffset);
+}
+
+void NullCommandBuffer::DrawIndirect(Buffer& buffer, unsigned int offset)
+{
+    ValidateGraphicsPipeline();
+    ValidateIndirectArguments(buffer, offset, 1, 0, sizeof(DrawIndirectArguments));
+    ++numDrawCommands_;
+}
+
+void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, unsigned int offset)
+{
+    ValidateGraphicsPipeline();
+    ValidateIndexBuffer();
+    ValidateIndirectArguments(buffer, offset, 1, 0, sizeof(DrawIndexedIndirectArguments));
+    ++numDrawCommands_;
+}
+
+void NullCommandBuffer::MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    ValidateGraphicsPipeline();
+    ValidateIndirectArguments(buffer, offset, numCommands, stride, sizeof(DrawIndirectArguments));
+    numDrawCommands_ += numCommands;
+}
+
+void NullCommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    ValidateGraphicsPipeline();
+    ValidateIndexBuffer();
+    ValidateIndirectArguments(buffer, offset, numCommands, stride, sizeof(DrawIndexedIndirectArguments));
+    numDrawCommands_ += numCommands;
+}
+
+/* ----- Compute ----- */
+
+void NullCommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ)
+{
+    if (!computePipeline_)
+        throw std::runtime_error("no compute pipeline is bound");
+
+    const auto& limit = caps_.maxNumComputeShaderWorkGroups;
+    if (groupSizeX > limit.x || groupSizeY > limit.y || groupSizeZ > limit.z)
+        throw std::out_of_range("number of thread groups exceeds limit");
+}
+
+void NullCommandBuffer::DispatchIndirect(Buffer& buffer, unsigned int offset)
+{
+    if (!computePipeline_)
+        throw std::runtime_error("no compute pipeline is bound");
+    ValidateIndirectArguments(buffer, offset, 1, 0, sizeof(DispatchIndirectArguments));
+}
+
+/* ----- Misc ----- */
+
+void NullCommandBuffer::SignalFence(Fence& fence)
+{
+    /* Commands are never deferred, so the fence is signaled immediately */
+    LLGL_CAST(NullFence&, fence).signaled = true;
+}
+
+void NullCommandBuffer::SyncGPU()
+{
+    // dummy
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void NullCommandBuffer::ValidateBufferType(const CPUBuffer& buffer, const BufferType type, const char* source)
+{
+    if (buffer.GetType() != type)
+        throw std::invalid_argument(std::string(source) + ": invalid buffer type");
+}
+
+void NullCommandBuffer::ValidateShaderStageFlags(long shaderStageFlags, const char* source)
+{
+    if ((shaderStageFlags & ShaderStageFlags::AllStages) == 0)
+        throw std::invalid_argument(std::string(source) + ": no shader stage is specified");
+}
+
+void NullCommandBuffer::ValidateGraphicsPipeline()
+{
+    if (!graphicsPipeline_)
+        throw std::runtime_error("no graphics pipeline is bound");
+}
+
+void NullCommandBuffer::ValidateIndexBuffer()
+{
+    if (!indexBufferSet_)
+        throw std::runtime_error("no index buffer is bound");
+}
+
+void NullCommandBuffer::ValidateDraw(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset)
+{
+    ValidateGraphicsPipeline();
+
+    /* Compare in 64-bit to avoid overflow of large offsets */
+    if (static_cast<std::uint64_t>(firstVertex) + numVertices > vertexLimit_)
+        throw std::out_of_range("vertex range exceeds bound vertex buffers");
+    if (static_cast<std::uint64_t>(instanceOffset) + numInstances > instanceLimit_)
+        throw std::out_of_range("instance range exceeds bound instance buffers");
+
+    ++numDrawCommands_;
+}
+
+void NullCommandBuffer::ValidateDrawIndexed(unsigned int numIndices, unsigned int firstIndex, unsigned int numInstances, unsigned int instanceOffset)
+{
+    ValidateGraphicsPipeline();
+    ValidateIndexBuffer();
+
+    if (static_cast<std::uint64_t>(firstIndex) + numIndices > indexLimit_)
+        throw std::out_of_range("index range exceeds bound index buffer");
+    if (static_cast<std::uint64_t>(instanceOffset) + numInstances > instanceLimit_)
+        throw std::out_of_range("instance range exceeds bound instance buffers");
+
+    ++numDrawCommands_;
+}
+
+void NullCommandBuffer::ValidateIndirectArguments(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride, unsigned int argumentsSize)
+{
+    auto& bufferNull = LLGL_CAST(CPUBuffer&, buffer);
+    ValidateBufferType(bufferNull, BufferType::Indirect, __FUNCTION__);
+
+    if (numCommands > 1 && stride < argumentsSize)
+        throw std::invalid_argument("stride of indirect arguments is too small");
+
+    if (numCommands > 0)
+    {
+        const auto requiredSize = static_cast<std::uint64_t>(offset) + static_cast<std::uint64_t>(stride) * (numCommands - 1) + argumentsSize;
+        if (requiredSize > bufferNull.GetSize())
+            throw std::out_of_range("indirect arguments exceed buffer size");
+    }
+}
+
+void NullCommandBuffer::ResetVertexLimits()
+{
+    vertexLimit_    = ~0u;
+    instanceLimit_  = ~0u;
+}
+
+void NullCommandBuffer::UpdateVertexLimits(const CPUBuffer& buffer)
+{
+    const auto& format = buffer.GetDesc().vertexBuffer.format;
+    const auto numElements = buffer.GetNumElements();
+
+    /* Buffers with instance data limit the number of instances instead of vertices */
+    if (!format.attributes.empty() && format.attributes.front().instanceDivisor > 0)
+    {
+        const auto divisor = static_cast<std::uint64_t>(format.attributes.front().instanceDivisor);
+        instanceLimit_ = static_cast<unsigned int>(std::min<std::uint64_t>(instanceLimit_, numElements * divisor));
+    }
+    else
+        vertexLimit_ = std::min(vertexLimit_, numElements);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,186 @@
+/*
+ * NullCommandBuffer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_COMMAND_BUFFER_H
+#define LLGL_NULL_COMMAND_BUFFER_H
+
+
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/RenderSystemFlags.h>
+
+
+namespace LLGL
+{
+
+
+class CPUBuffer;
+class NullGraphicsPipeline;
+class NullComputePipeline;
+class NullQuery;
+
+/*
+Command buffer which validates all commands against the currently bound states, but does not record or execute them.
+All limits that are required to validate draw commands are determined when the respective states are bound,
+so that the draw commands themselves only need a few comparisons.
+*/
+class NullCommandBuffer : public CommandBuffer
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        NullCommandBuffer(const RenderingCaps& caps);
+
+        /* ----- Configuration ----- */
+
+        void SetGraphicsAPIDependentState(const GraphicsAPIDependentStateDescriptor& state) override;
+
+        void SetViewport(const Viewport& viewport) override;
+        void SetViewportArray(unsigned int numViewports, const Viewport* viewportArray) override;
+
+        void SetScissor(const Scissor& scissor) override;
+        void SetScissorArray(unsigned int numScissors, const Scissor* scissorArray) override;
+
+        void SetClearColor(const ColorRGBAf& color) override;
+        void SetClearDepth(float depth) override;
+        void SetClearStencil(int stencil) override;
+
+        void Clear(long flags) override;
+        void ClearTarget(unsigned int targetIndex, const LLGL::ColorRGBAf& color) override;
+
+        /* ----- Buffers ------ */
+
+        void SetVertexBuffer(Buffer& buffer) override;
+        void SetVertexBufferArray(BufferArray& bufferArray) override;
+
+        void SetIndexBuffer(Buffer& buffer) override;
+
+        void SetConstantBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetConstantBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        void SetStorageBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetStorageBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        void SetStreamOutputBuffer(Buffer& buffer) override;
+        void SetStreamOutputBufferArray(BufferArray& bufferArray) override;
+
+        void BeginStreamOutput(const PrimitiveType primitiveType) override;
+        void EndStreamOutput() override;
+
+        /* ----- Textures ----- */
+
+        void SetTexture(Texture& texture, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetTextureArray(TextureArray& textureArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        /* ----- Sampler States ----- */
+
+        void SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetSamplerArray(SamplerArray& samplerArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        /* ----- Resource Heaps ----- */
+
+        void SetResourceHeap(ResourceHeap& resourceHeap) override;
+
+        /* ----- Render Targets ----- */
+
+        void SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc = nullptr) override;
+        void SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc = nullptr) override;
+
+        /* ----- Pipeline States ----- */
+
+        void SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline) override;
+        void SetComputePipeline(ComputePipeline& computePipeline) override;
+
+        /* ----- Queries ----- */
+
+        void BeginQuery(Query& query) override;
+        void EndQuery(Query& query) override;
+
+        bool QueryResult(Query& query, std::uint64_t& result) override;
+
+        void BeginRenderCondition(Query& query, const RenderConditionMode mode) override;
+        void EndRenderCondition() override;
+
+        /* ----- Drawing ----- */
+
+        void Draw(unsigned int numVertices, unsigned int firstVertex) override;
+
+        void DrawIndexed(unsigned int numVertices, unsigned int firstIndex) override;
+        void DrawIndexed(unsigned int numVertices, unsigned int firstIndex, int vertexOffset) override;
+
+        void DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances) override;
+        void DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset) override;
+
+        void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex) override;
+        void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset) override;
+        void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) override;
+
+        void DrawIndirect(Buffer& buffer, unsigned int offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, unsigned int offset) override;
+
+        void MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+        void MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+
+        /* ----- Compute ----- */
+
+        void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, unsigned int offset) override;
+
+        /* ----- Misc ----- */
+
+        void SignalFence(Fence& fence) override;
+
+        void SyncGPU() override;
+
+        /* ----- Statistics ----- */
+
+        // Returns the number of draw commands that have passed validation.
+        inline std::uint64_t GetNumDrawCommands() const
+        {
+            return numDrawCommands_;
+        }
+
+    private:
+
+        void ValidateBufferType(const CPUBuffer& buffer, const BufferType type, const char* source);
+        void ValidateShaderStageFlags(long shaderStageFlags, const char* source);
+        void ValidateGraphicsPipeline();
+        void ValidateIndexBuffer();
+
+        void ValidateDraw(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset);
+        void ValidateDrawIndexed(unsigned int numIndices, unsigned int firstIndex, unsigned int numInstances, unsigned int instanceOffset);
+        void ValidateIndirectArguments(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride, unsigned int argumentsSize);
+
+        void ResetVertexLimits();
+        void UpdateVertexLimits(const CPUBuffer& buffer);
+
+        const RenderingCaps&    caps_;
+
+        NullGraphicsPipeline*   graphicsPipeline_   = nullptr;
+        NullComputePipeline*    computePipeline_    = nullptr;
+        NullQuery*              renderCondition_    = nullptr;
+
+        unsigned int            vertexLimit_        = ~0u;
+        unsigned int            instanceLimit_      = ~0u;
+        unsigned int            indexLimit_         = 0;
+        bool                    indexBufferSet_     = false;
+        bool                    streamOutputBusy_   = false;
+
+        std::uint64_t           numDrawCommands_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
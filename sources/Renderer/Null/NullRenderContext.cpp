@@ -0,0 +1,73 @@
+/*
+ * NullRenderContext.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullRenderContext.h"
+#include <LLGL/Platform/NativeHandle.h>
+
+
+namespace LLGL
+{
+
+
+/* ----- NullSurface class ----- */
+
+NullSurface::NullSurface(const Size& size) :
+    size_ { size }
+{
+}
+
+void NullSurface::GetNativeHandle(void* nativeHandle) const
+{
+    *reinterpret_cast<NativeHandle*>(nativeHandle) = NativeHandle();
+}
+
+void NullSurface::Recreate()
+{
+    // dummy
+}
+
+Size NullSurface::GetContentSize() const
+{
+    return size_;
+}
+
+bool NullSurface::AdaptForVideoMode(VideoModeDescriptor& videoModeDesc)
+{
+    size_ = videoModeDesc.resolution;
+    return true;
+}
+
+
+/* ----- NullRenderContext class ----- */
+
+NullRenderContext::NullRenderContext(RenderContextDescriptor desc, const std::shared_ptr<Surface>& surface)
+{
+    /* Use surface without a window if no surface is specified */
+    if (surface)
+        SetOrCreateSurface(surface, desc.videoMode, nullptr);
+    else
+        SetOrCreateSurface(std::make_shared<NullSurface>(desc.videoMode.resolution), desc.videoMode, nullptr);
+
+    desc_ = desc;
+}
+
+void NullRenderContext::Present()
+{
+    ++numFrames_;
+}
+
+void NullRenderContext::SetVsync(const VsyncDescriptor& vsyncDesc)
+{
+    desc_.vsync = vsyncDesc;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,75 @@
+/*
+ * NullRenderContext.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RENDER_CONTEXT_H
+#define LLGL_NULL_RENDER_CONTEXT_H
+
+
+#include <LLGL/RenderContext.h>
+#include <LLGL/Surface.h>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+// Surface without a window, which is used when no surface is passed to a Null render context.
+class NullSurface : public Surface
+{
+
+    public:
+
+        NullSurface(const Size& size);
+
+        void GetNativeHandle(void* nativeHandle) const override;
+
+        void Recreate() override;
+
+        Size GetContentSize() const override;
+
+        bool AdaptForVideoMode(VideoModeDescriptor& videoModeDesc) override;
+
+    private:
+
+        Size size_;
+
+};
+
+class NullRenderContext : public RenderContext
+{
+
+    public:
+
+        NullRenderContext(RenderContextDescriptor desc, const std::shared_ptr<Surface>& surface);
+
+        void Present() override;
+
+        void SetVsync(const VsyncDescriptor& vsyncDesc) override;
+
+        // Returns the number of frames that have been presented.
+        inline std::uint64_t GetNumFrames() const
+        {
+            return numFrames_;
+        }
+
+    private:
+
+        RenderContextDescriptor desc_;
+        std::uint64_t           numFrames_  = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
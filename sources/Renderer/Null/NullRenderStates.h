@@ -0,0 +1,112 @@
+/*
+ * NullRenderStates.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RENDER_STATES_H
+#define LLGL_NULL_RENDER_STATES_H
+
+
+#include <LLGL/GraphicsPipeline.h>
+#include <LLGL/ComputePipeline.h>
+#include <LLGL/Query.h>
+#include <LLGL/Fence.h>
+#include "NullShader.h"
+#include "../CheckedCast.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+class NullGraphicsPipeline : public GraphicsPipeline
+{
+
+    public:
+
+        NullGraphicsPipeline(const GraphicsPipelineDescriptor& desc) :
+            desc_ { desc }
+        {
+            if (!desc.shaderProgram)
+                throw std::invalid_argument("cannot create graphics pipeline without shader program");
+
+            auto shaderProgramNull = LLGL_CAST(NullShaderProgram*, desc.shaderProgram);
+            if (!shaderProgramNull->IsLinked())
+                throw std::invalid_argument("cannot create graphics pipeline with shader program that is not linked");
+            if (shaderProgramNull->HasComputeShader())
+                throw std::invalid_argument("cannot create graphics pipeline with compute shader program");
+        }
+
+        inline const GraphicsPipelineDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+    private:
+
+        GraphicsPipelineDescriptor desc_;
+
+};
+
+class NullComputePipeline : public ComputePipeline
+{
+
+    public:
+
+        NullComputePipeline(const ComputePipelineDescriptor& desc)
+        {
+            if (!desc.shaderProgram)
+                throw std::invalid_argument("cannot create compute pipeline without shader program");
+
+            auto shaderProgramNull = LLGL_CAST(NullShaderProgram*, desc.shaderProgram);
+            if (!shaderProgramNull->IsLinked())
+                throw std::invalid_argument("cannot create compute pipeline with shader program that is not linked");
+            if (!shaderProgramNull->HasComputeShader())
+                throw std::invalid_argument("cannot create compute pipeline without compute shader");
+        }
+
+};
+
+// Query whose result is always zero, since nothing is rendered.
+class NullQuery : public Query
+{
+
+    public:
+
+        NullQuery(const QueryDescriptor& desc) :
+            Query { desc.type }
+        {
+        }
+
+        bool active     = false;
+        bool finished   = false;
+
+};
+
+// Fence which is signaled as soon as it is submitted, since there is no GPU to wait for.
+class NullFence : public Fence
+{
+
+    public:
+
+        bool IsSignaled() override
+        {
+            return signaled;
+        }
+
+        bool signaled = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
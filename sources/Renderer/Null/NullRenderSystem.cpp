@@ -0,0 +1,405 @@
+/*
+ * NullRenderSystem.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullRenderSystem.h"
+#include "../CheckedCast.h"
+#include "../Assertion.h"
+#include "../../Core/Helper.h"
+#include <LLGL/Image.h>
+#include <LLGL/Format.h>
+#include <stdexcept>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/* ----- Render System ----- */
+
+NullRenderSystem::NullRenderSystem()
+{
+    RendererInfo info;
+    {
+        info.rendererName           = "Null";
+        info.deviceName             = "Null Device";
+        info.vendorName             = "LLGL";
+        info.shadingLanguageName    = "None";
+    }
+    SetRendererInfo(info);
+
+    QueryRenderingCaps();
+}
+
+MemoryStatistics NullRenderSystem::QueryMemoryStatistics()
+{
+    MemoryStatistics stats;
+    memoryAccounting_.GetStatistics(stats);
+    return stats;
+}
+
+/* ----- Render Context ----- */
+
+RenderContext* NullRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
+{
+    return TakeOwnership(renderContexts_, MakeUnique<NullRenderContext>(desc, surface));
+}
+
+void NullRenderSystem::Release(RenderContext& renderContext)
+{
+    RemoveFromUniqueSet(renderContexts_, &renderContext);
+}
+
+/* ----- Command buffers ----- */
+
+CommandBuffer* NullRenderSystem::CreateCommandBuffer()
+{
+    return TakeOwnership(commandBuffers_, MakeUnique<NullCommandBuffer>(GetRenderingCaps()));
+}
+
+void NullRenderSystem::Release(CommandBuffer& commandBuffer)
+{
+    RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
+}
+
+/* ----- Buffers ------ */
+
+Buffer* NullRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
+{
+    AssertCreateBuffer(desc);
+
+    /* Validate buffer formats, since the command buffer derives its vertex and index limits from them */
+    if (desc.type == BufferType::Vertex && desc.vertexBuffer.format.stride == 0)
+        throw std::invalid_argument("cannot create vertex buffer with zero vertex stride");
+    if (desc.type == BufferType::Index && desc.indexBuffer.format.GetFormatSize() == 0)
+        throw std::invalid_argument("cannot create index buffer with invalid index format");
+
+    auto buffer = MakeUnique<CPUBuffer>(desc, initialData);
+    memoryAccounting_.Allocate(MemoryAccounting::Type::Buffer, desc.size);
+    return TakeOwnership(buffers_, std::move(buffer));
+}
+
+BufferArray* NullRenderSystem::CreateBufferArray(unsigned int numBuffers, Buffer* const * bufferArray)
+{
+    AssertCreateBufferArray(numBuffers, bufferArray);
+    return TakeOwnership(bufferArrays_, MakeUnique<CPUBufferArray>((*bufferArray)->GetType(), numBuffers, bufferArray));
+}
+
+void NullRenderSystem::Release(Buffer& buffer)
+{
+    auto& bufferNull = LLGL_CAST(CPUBuffer&, buffer);
+    memoryAccounting_.Release(MemoryAccounting::Type::Buffer, static_cast<std::uint64_t>(bufferNull.GetSize()));
+    RemoveFromUniqueSet(buffers_, &buffer);
+}
+
+void NullRenderSystem::Release(BufferArray& bufferArray)
+{
+    RemoveFromUniqueSet(bufferArrays_, &bufferArray);
+}
+
+void NullRenderSystem::WriteBuffer(Buffer& buffer, const void* data, std::size_t dataSize, std::size_t offset)
+{
+    LLGL_ASSERT_PTR(data);
+    auto& bufferNull = LLGL_CAST(CPUBuffer&, buffer);
+    bufferNull.Write(data, dataSize, offset);
+}
+
+void* NullRenderSystem::MapBuffer(Buffer& buffer, const BufferCPUAccess access)
+{
+    auto& bufferNull = LLGL_CAST(CPUBuffer&, buffer);
+    return bufferNull.Map(access);
+}
+
+void NullRenderSystem::UnmapBuffer(Buffer& buffer)
+{
+    auto& bufferNull = LLGL_CAST(CPUBuffer&, buffer);
+    bufferNull.Unmap();
+}
+
+/* ----- Textures ----- */
+
+Texture* NullRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* /*imageDesc*/)
+{
+    auto texture = MakeUnique<NullTexture>(textureDesc);
+    memoryAccounting_.Allocate(MemoryAccounting::Type::Texture, TextureMemoryFootprint(texture->GetDesc()));
+    return TakeOwnership(textures_, std::move(texture));
+}
+
+TextureArray* NullRenderSystem::CreateTextureArray(unsigned int numTextures, Texture* const * textureArray)
+{
+    AssertCreateTextureArray(numTextures, textureArray);
+    return TakeOwnership(textureArrays_, MakeUnique<CPUTextureArray>(numTextures, textureArray));
+}
+
+void NullRenderSystem::Release(Texture& texture)
+{
+    auto& textureNull = LLGL_CAST(NullTexture&, texture);
+    memoryAccounting_.Release(MemoryAccounting::Type::Texture, TextureMemoryFootprint(textureNull.GetDesc()));
+    RemoveFromUniqueSet(textures_, &texture);
+}
+
+void NullRenderSystem::Release(TextureArray& textureArray)
+{
+    RemoveFromUniqueSet(textureArrays_, &textureArray);
+}
+
+TextureDescriptor NullRenderSystem::QueryTextureDescriptor(const Texture& texture)
+{
+    auto& textureNull = LLGL_CAST(const NullTexture&, texture);
+    return textureNull.GetDesc();
+}
+
+void NullRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
+{
+    LLGL_ASSERT_PTR(imageDesc.buffer);
+    auto& textureNull = LLGL_CAST(const NullTexture&, texture);
+    textureNull.AssertMipLevel(subTextureDesc.mipLevel);
+}
+
+std::uint64_t NullRenderSystem::WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
+{
+    /* Uploads complete immediately, which is reported with ticket 0 */
+    WriteTexture(texture, subTextureDesc, imageDesc);
+    return 0;
+}
+
+bool NullRenderSystem::IsTextureUploadComplete(std::uint64_t /*ticket*/)
+{
+    return true;
+}
+
+void NullRenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer)
+{
+    LLGL_ASSERT_PTR(buffer);
+
+    auto& textureNull = LLGL_CAST(const NullTexture&, texture);
+    textureNull.AssertMipLevel(static_cast<unsigned int>(mipLevel));
+
+    /* Textures have no image data, so the readback is always zero-initialized */
+    auto size = textureNull.QueryMipLevelSize(static_cast<unsigned int>(mipLevel));
+    auto dataSize = static_cast<std::size_t>(size.x) * size.y * size.z * ImageFormatSize(imageFormat) * DataTypeSize(dataType);
+    std::memset(buffer, 0, dataSize);
+}
+
+std::uint64_t NullRenderSystem::ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc)
+{
+    auto& textureNull = LLGL_CAST(const NullTexture&, texture);
+    textureNull.AssertMipLevel(static_cast<unsigned int>(desc.mipLevel));
+
+    /* Determine size of readback in the final format */
+    const auto format   = (desc.convert ? desc.convertFormat : desc.format);
+    const auto dataType = (desc.convert ? desc.convertDataType : desc.dataType);
+
+    auto size = textureNull.QueryMipLevelSize(static_cast<unsigned int>(desc.mipLevel));
+    auto dataSize = static_cast<std::size_t>(size.x) * size.y * size.z * ImageFormatSize(format) * DataTypeSize(dataType);
+
+    /* Store zero-initialized readback under a new ticket */
+    auto ticket = nextReadbackTicket_++;
+    readbacks_[ticket].resize(dataSize, 0);
+
+    return ticket;
+}
+
+bool NullRenderSystem::MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize)
+{
+    auto it = readbacks_.find(ticket);
+    if (it != readbacks_.end())
+    {
+        data        = it->second.data();
+        dataSize    = it->second.size();
+        return true;
+    }
+    return false;
+}
+
+void NullRenderSystem::UnmapTextureReadback(std::uint64_t ticket)
+{
+    readbacks_.erase(ticket);
+}
+
+void NullRenderSystem::GenerateMips(Texture& /*texture*/)
+{
+    // dummy
+}
+
+/* ----- Sampler States ---- */
+
+Sampler* NullRenderSystem::CreateSampler(const SamplerDescriptor& desc)
+{
+    return TakeOwnership(samplers_, MakeUnique<CPUSampler>(desc));
+}
+
+SamplerArray* NullRenderSystem::CreateSamplerArray(unsigned int numSamplers, Sampler* const * samplerArray)
+{
+    AssertCreateSamplerArray(numSamplers, samplerArray);
+    return TakeOwnership(samplerArrays_, MakeUnique<CPUSamplerArray>(numSamplers, samplerArray));
+}
+
+void NullRenderSystem::Release(Sampler& sampler)
+{
+    RemoveFromUniqueSet(samplers_, &sampler);
+}
+
+void NullRenderSystem::Release(SamplerArray& samplerArray)
+{
+    RemoveFromUniqueSet(samplerArrays_, &samplerArray);
+}
+
+/* ----- Resource Heaps ----- */
+
+ResourceHeap* NullRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    AssertCreateResourceHeap(desc);
+    return TakeOwnership(resourceHeaps_, MakeUnique<CPUResourceHeap>(desc));
+}
+
+void NullRenderSystem::Release(ResourceHeap& resourceHeap)
+{
+    RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
+}
+
+/* ----- Render Targets ----- */
+
+RenderTarget* NullRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
+{
+    auto renderTarget = MakeUnique<NullRenderTarget>(desc);
+    memoryAccounting_.Allocate(MemoryAccounting::Type::RenderTarget, 0);
+    return TakeOwnership(renderTargets_, std::move(renderTarget));
+}
+
+void NullRenderSystem::Release(RenderTarget& renderTarget)
+{
+    memoryAccounting_.Release(MemoryAccounting::Type::RenderTarget, 0);
+    RemoveFromUniqueSet(renderTargets_, &renderTarget);
+}
+
+/* ----- Shader ----- */
+
+Shader* NullRenderSystem::CreateShader(const ShaderType type)
+{
+    return TakeOwnership(shaders_, MakeUnique<NullShader>(type));
+}
+
+ShaderProgram* NullRenderSystem::CreateShaderProgram()
+{
+    return TakeOwnership(shaderPrograms_, MakeUnique<NullShaderProgram>());
+}
+
+void NullRenderSystem::Release(Shader& shader)
+{
+    RemoveFromUniqueSet(shaders_, &shader);
+}
+
+void NullRenderSystem::Release(ShaderProgram& shaderProgram)
+{
+    RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
+}
+
+/* ----- Pipeline States ----- */
+
+GraphicsPipeline* NullRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
+{
+    return TakeOwnership(graphicsPipelines_, MakeUnique<NullGraphicsPipeline>(desc));
+}
+
+ComputePipeline* NullRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
+{
+    return TakeOwnership(computePipelines_, MakeUnique<NullComputePipeline>(desc));
+}
+
+void NullRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
+{
+    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+}
+
+void NullRenderSystem::Release(ComputePipeline& computePipeline)
+{
+    RemoveFromUniqueSet(computePipelines_, &computePipeline);
+}
+
+/* ----- Queries ----- */
+
+Query* NullRenderSystem::CreateQuery(const QueryDescriptor& desc)
+{
+    return TakeOwnership(queries_, MakeUnique<NullQuery>(desc));
+}
+
+void NullRenderSystem::Release(Query& query)
+{
+    RemoveFromUniqueSet(queries_, &query);
+}
+
+/* ----- Fences ----- */
+
+Fence* NullRenderSystem::CreateFence()
+{
+    return TakeOwnership(fences_, MakeUnique<NullFence>());
+}
+
+void NullRenderSystem::Release(Fence& fence)
+{
+    RemoveFromUniqueSet(fences_, &fence);
+}
+
+bool NullRenderSystem::WaitFence(Fence& fence, std::uint64_t /*timeout*/)
+{
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    return fenceNull.IsSignaled();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void NullRenderSystem::QueryRenderingCaps()
+{
+    RenderingCaps caps;
+    {
+        caps.screenOrigin                       = ScreenOrigin::LowerLeft;
+        caps.clippingRange                      = ClippingRange::MinusOneToOne;
+        caps.shadingLanguage                    = ShadingLanguage::GLSL_450; // Shaders are never compiled, so any source is accepted
+        caps.hasRenderTargets                   = true;
+        caps.has3DTextures                      = true;
+        caps.hasCubeTextures                    = true;
+        caps.hasTextureArrays                   = true;
+        caps.hasCubeTextureArrays               = true;
+        caps.hasMultiSampleTextures             = true;
+        caps.hasSamplers                        = true;
+        caps.hasConstantBuffers                 = true;
+        caps.hasStorageBuffers                  = true;
+        caps.hasUniforms                        = true;
+        caps.hasGeometryShaders                 = true;
+        caps.hasTessellationShaders             = true;
+        caps.hasComputeShaders                  = true;
+        caps.hasInstancing                      = true;
+        caps.hasOffsetInstancing                = true;
+        caps.hasViewportArrays                  = true;
+        caps.hasConservativeRasterization       = true;
+        caps.hasStreamOutputs                   = true;
+        caps.hasIndirectDrawing                 = true;
+        caps.maxNumTextureArrayLayers           = 2048;
+        caps.maxNumRenderTargetAttachments      = 8;
+        caps.maxConstantBufferSize              = 65536;
+        caps.maxPatchVertices                   = 32;
+        caps.max1DTextureSize                   = 16384;
+        caps.max2DTextureSize                   = 16384;
+        caps.max3DTextureSize                   = 2048;
+        caps.maxCubeTextureSize                 = 16384;
+        caps.maxAnisotropy                      = 16;
+        caps.maxNumComputeShaderWorkGroups      = { 65535, 65535, 65535 };
+        caps.maxComputeShaderWorkGroupSize      = { 1024, 1024, 64 };
+    }
+    SetRenderingCaps(caps);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
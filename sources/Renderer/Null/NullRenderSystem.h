@@ -0,0 +1,187 @@
+/*
+ * NullRenderSystem.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RENDER_SYSTEM_H
+#define LLGL_NULL_RENDER_SYSTEM_H
+
+
+#include <LLGL/RenderSystem.h>
+#include "../ContainerTypes.h"
+#include "../MemoryAccounting.h"
+#include "../CPUCommon/CPUBuffer.h"
+#include "../CPUCommon/CPUBufferArray.h"
+#include "../CPUCommon/CPUResourceArrays.h"
+
+#include "NullCommandBuffer.h"
+#include "NullRenderContext.h"
+#include "NullTexture.h"
+#include "NullRenderTarget.h"
+#include "NullShader.h"
+#include "NullRenderStates.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Render system which validates all resource creations and commands, but does not render anything.
+It is intended to measure the CPU overhead of the LLGL front-end without driver or GPU cost.
+*/
+class NullRenderSystem : public RenderSystem
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        NullRenderSystem();
+
+        MemoryStatistics QueryMemoryStatistics() override;
+
+        /* ----- Render Context ----- */
+
+        RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
+
+        void Release(RenderContext& renderContext) override;
+
+        /* ----- Command buffers ----- */
+
+        CommandBuffer* CreateCommandBuffer() override;
+
+        void Release(CommandBuffer& commandBuffer) override;
+
+        /* ----- Buffers ------ */
+
+        Buffer* CreateBuffer(const BufferDescriptor& desc, const void* initialData = nullptr) override;
+        BufferArray* CreateBufferArray(unsigned int numBuffers, Buffer* const * bufferArray) override;
+
+        void Release(Buffer& buffer) override;
+        void Release(BufferArray& bufferArray) override;
+
+        void WriteBuffer(Buffer& buffer, const void* data, std::size_t dataSize, std::size_t offset) override;
+
+        void* MapBuffer(Buffer& buffer, const BufferCPUAccess access) override;
+        void UnmapBuffer(Buffer& buffer) override;
+
+        /* ----- Textures ----- */
+
+        Texture* CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* imageDesc = nullptr) override;
+        TextureArray* CreateTextureArray(unsigned int numTextures, Texture* const * textureArray) override;
+
+        void Release(Texture& texture) override;
+        void Release(TextureArray& textureArray) override;
+
+        TextureDescriptor QueryTextureDescriptor(const Texture& texture) override;
+
+        void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
+
+        std::uint64_t WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
+        bool IsTextureUploadComplete(std::uint64_t ticket) override;
+
+        void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) override;
+
+        std::uint64_t ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc) override;
+        bool MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize) override;
+        void UnmapTextureReadback(std::uint64_t ticket) override;
+
+        void GenerateMips(Texture& texture) override;
+
+        /* ----- Sampler States ---- */
+
+        Sampler* CreateSampler(const SamplerDescriptor& desc) override;
+        SamplerArray* CreateSamplerArray(unsigned int numSamplers, Sampler* const * samplerArray) override;
+
+        void Release(Sampler& sampler) override;
+        void Release(SamplerArray& samplerArray) override;
+
+        /* ----- Resource Heaps ----- */
+
+        ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
+
+        void Release(ResourceHeap& resourceHeap) override;
+
+        /* ----- Render Targets ----- */
+
+        RenderTarget* CreateRenderTarget(const RenderTargetDescriptor& desc) override;
+
+        void Release(RenderTarget& renderTarget) override;
+
+        /* ----- Shader ----- */
+
+        Shader* CreateShader(const ShaderType type) override;
+        ShaderProgram* CreateShaderProgram() override;
+
+        void Release(Shader& shader) override;
+        void Release(ShaderProgram& shaderProgram) override;
+
+        /* ----- Pipeline States ----- */
+
+        GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
+        ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) override;
+
+        void Release(GraphicsPipeline& graphicsPipeline) override;
+        void Release(ComputePipeline& computePipeline) override;
+
+        /* ----- Queries ----- */
+
+        Query* CreateQuery(const QueryDescriptor& desc) override;
+
+        void Release(Query& query) override;
+
+        /* ----- Fences ----- */
+
+        Fence* CreateFence() override;
+
+        void Release(Fence& fence) override;
+
+        bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+
+    private:
+
+        void QueryRenderingCaps();
+
+        /* ----- Hardware object containers ----- */
+
+        HWObjectContainer<NullRenderContext>    renderContexts_;
+        HWObjectContainer<NullCommandBuffer>    commandBuffers_;
+        HWObjectContainer<CPUBuffer>            buffers_;
+        HWObjectContainer<CPUBufferArray>       bufferArrays_;
+        HWObjectContainer<NullTexture>          textures_;
+        HWObjectContainer<CPUTextureArray>      textureArrays_;
+        HWObjectContainer<CPUSampler>           samplers_;
+        HWObjectContainer<CPUSamplerArray>      samplerArrays_;
+        HWObjectContainer<CPUResourceHeap>      resourceHeaps_;
+        HWObjectContainer<NullRenderTarget>     renderTargets_;
+        HWObjectContainer<NullShader>           shaders_;
+        HWObjectContainer<NullShaderProgram>    shaderPrograms_;
+        HWObjectContainer<NullGraphicsPipeline> graphicsPipelines_;
+        HWObjectContainer<NullComputePipeline>  computePipelines_;
+        HWObjectContainer<NullQuery>            queries_;
+        HWObjectContainer<NullFence>            fences_;
+
+        std::map<std::uint64_t, std::vector<char>> readbacks_;
+        std::uint64_t                           nextReadbackTicket_ = 1;
+
+        MemoryAccounting                        memoryAccounting_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
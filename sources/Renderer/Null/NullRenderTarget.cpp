@@ -0,0 +1,86 @@
+/*
+ * NullRenderTarget.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullRenderTarget.h"
+#include "NullTexture.h"
+#include "../CheckedCast.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+NullRenderTarget::NullRenderTarget(const RenderTargetDescriptor& desc) :
+    desc_ { desc }
+{
+}
+
+void NullRenderTarget::AttachDepthBuffer(const Gs::Vector2ui& size)
+{
+    AttachDepthStencil(size);
+}
+
+void NullRenderTarget::AttachStencilBuffer(const Gs::Vector2ui& size)
+{
+    AttachDepthStencil(size);
+}
+
+void NullRenderTarget::AttachDepthStencilBuffer(const Gs::Vector2ui& size)
+{
+    AttachDepthStencil(size);
+}
+
+void NullRenderTarget::AttachTexture(Texture& texture, const RenderTargetAttachmentDescriptor& attachmentDesc)
+{
+    auto& textureNull = LLGL_CAST(NullTexture&, texture);
+
+    /* Validate multi-sampling of texture against the render target (see RenderTargetDescriptor::customMultiSampling) */
+    const bool isMultiSampled = IsMultiSampleTexture(texture.GetType());
+
+    if (desc_.multiSampling.enabled && desc_.customMultiSampling && !isMultiSampled)
+        throw std::invalid_argument("cannot attach non-multi-sample texture to render target with custom multi-sampling");
+    if ((!desc_.multiSampling.enabled || !desc_.customMultiSampling) && isMultiSampled)
+        throw std::invalid_argument("cannot attach multi-sample texture to render target without custom multi-sampling");
+
+    /* Apply resolution of the attached MIP-map level (multi-sample textures only have one level) */
+    const auto mipLevel = (isMultiSampled ? 0u : attachmentDesc.mipLevel);
+    textureNull.AssertMipLevel(mipLevel);
+    ApplyMipResolution(texture, mipLevel);
+
+    if (IsDepthStencilFormat(textureNull.GetDesc().format))
+        AttachDepthStencil(GetResolution());
+    else
+        ++numColorAttachments_;
+}
+
+void NullRenderTarget::DetachAll()
+{
+    ResetResolution();
+    numColorAttachments_    = 0;
+    hasDepthStencil_        = false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void NullRenderTarget::AttachDepthStencil(const Gs::Vector2ui& size)
+{
+    if (hasDepthStencil_)
+        throw std::invalid_argument("cannot attach more than one depth or stencil buffer to render target");
+    ApplyResolution(size);
+    hasDepthStencil_ = true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,58 @@
+/*
+ * NullRenderTarget.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_RENDER_TARGET_H
+#define LLGL_NULL_RENDER_TARGET_H
+
+
+#include <LLGL/RenderTarget.h>
+
+
+namespace LLGL
+{
+
+
+class NullRenderTarget : public RenderTarget
+{
+
+    public:
+
+        NullRenderTarget(const RenderTargetDescriptor& desc);
+
+        void AttachDepthBuffer(const Gs::Vector2ui& size) override;
+        void AttachStencilBuffer(const Gs::Vector2ui& size) override;
+        void AttachDepthStencilBuffer(const Gs::Vector2ui& size) override;
+
+        void AttachTexture(Texture& texture, const RenderTargetAttachmentDescriptor& attachmentDesc) override;
+
+        void DetachAll() override;
+
+        // Returns the number of color attachments.
+        inline unsigned int GetNumColorAttachments() const
+        {
+            return numColorAttachments_;
+        }
+
+    private:
+
+        void AttachDepthStencil(const Gs::Vector2ui& size);
+
+        RenderTargetDescriptor  desc_;
+        unsigned int            numColorAttachments_    = 0;
+        bool                    hasDepthStencil_        = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
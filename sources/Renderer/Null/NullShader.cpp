@@ -0,0 +1,166 @@
+/*
+ * NullShader.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullShader.h"
+#include "../CheckedCast.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/* ----- NullShader class ----- */
+
+NullShader::NullShader(const ShaderType type) :
+    Shader { type }
+{
+}
+
+bool NullShader::Compile(const std::string& sourceCode, const ShaderDescriptor& /*shaderDesc*/)
+{
+    sourceCode_ = sourceCode;
+    compiled_   = !sourceCode.empty();
+    infoLog_    = (compiled_ ? "" : "empty shader source code");
+    return compiled_;
+}
+
+bool NullShader::LoadBinary(std::vector<char>&& binaryCode, const ShaderDescriptor& /*shaderDesc*/)
+{
+    binaryCode_ = std::move(binaryCode);
+    compiled_   = !binaryCode_.empty();
+    infoLog_    = (compiled_ ? "" : "empty shader binary code");
+    return compiled_;
+}
+
+std::string NullShader::Disassemble(int /*flags*/)
+{
+    return sourceCode_;
+}
+
+std::string NullShader::QueryInfoLog()
+{
+    return infoLog_;
+}
+
+
+/* ----- NullShaderProgram class ----- */
+
+void NullShaderProgram::AttachShader(Shader& shader)
+{
+    shaders_.push_back(LLGL_CAST(NullShader*, &shader));
+    linked_ = false;
+}
+
+void NullShaderProgram::DetachAll()
+{
+    shaders_.clear();
+    linked_ = false;
+}
+
+bool NullShaderProgram::LinkShaders()
+{
+    infoLog_.clear();
+
+    if (shaders_.empty())
+        infoLog_ = "no shaders attached";
+
+    for (std::size_t i = 0; i < shaders_.size() && infoLog_.empty(); ++i)
+    {
+        /* Validate that each shader is compiled, and that each shader stage is attached only once */
+        if (!shaders_[i]->IsCompiled())
+            infoLog_ = "attached shader is not compiled";
+
+        for (std::size_t j = 0; j < i && infoLog_.empty(); ++j)
+        {
+            if (shaders_[i]->GetType() == shaders_[j]->GetType())
+                infoLog_ = "shader stage is attached more than once";
+        }
+    }
+
+    /* Compute shaders can not be combined with other shader stages */
+    if (infoLog_.empty() && HasComputeShader() && shaders_.size() > 1)
+        infoLog_ = "compute shader can not be linked with other shader stages";
+
+    linked_ = infoLog_.empty();
+
+    return linked_;
+}
+
+std::string NullShaderProgram::QueryInfoLog()
+{
+    return infoLog_;
+}
+
+const std::vector<VertexAttribute>& NullShaderProgram::QueryVertexAttributes() const
+{
+    return vertexFormat_.attributes;
+}
+
+const std::vector<StreamOutputAttribute>& NullShaderProgram::QueryStreamOutputAttributes() const
+{
+    static const std::vector<StreamOutputAttribute> empty;
+    return empty;
+}
+
+const std::vector<ConstantBufferViewDescriptor>& NullShaderProgram::QueryConstantBuffers() const
+{
+    static const std::vector<ConstantBufferViewDescriptor> empty;
+    return empty;
+}
+
+const std::vector<StorageBufferViewDescriptor>& NullShaderProgram::QueryStorageBuffers() const
+{
+    static const std::vector<StorageBufferViewDescriptor> empty;
+    return empty;
+}
+
+const std::vector<UniformDescriptor>& NullShaderProgram::QueryUniforms() const
+{
+    static const std::vector<UniformDescriptor> empty;
+    return empty;
+}
+
+void NullShaderProgram::BuildInputLayout(const VertexFormat& vertexFormat)
+{
+    vertexFormat_ = vertexFormat;
+}
+
+void NullShaderProgram::BindConstantBuffer(const std::string& /*name*/, unsigned int /*bindingIndex*/)
+{
+    // dummy
+}
+
+void NullShaderProgram::BindStorageBuffer(const std::string& /*name*/, unsigned int /*bindingIndex*/)
+{
+    // dummy
+}
+
+ShaderUniform* NullShaderProgram::LockShaderUniform()
+{
+    return nullptr; // dummy
+}
+
+void NullShaderProgram::UnlockShaderUniform()
+{
+    // dummy
+}
+
+bool NullShaderProgram::HasComputeShader() const
+{
+    return std::any_of(
+        shaders_.begin(), shaders_.end(),
+        [](const NullShader* shader) { return (shader->GetType() == ShaderType::Compute); }
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,104 @@
+/*
+ * NullShader.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_SHADER_H
+#define LLGL_NULL_SHADER_H
+
+
+#include <LLGL/Shader.h>
+#include <LLGL/ShaderProgram.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Shader which only keeps its source code or binary, without compiling it.
+class NullShader : public Shader
+{
+
+    public:
+
+        NullShader(const ShaderType type);
+
+        bool Compile(const std::string& sourceCode, const ShaderDescriptor& shaderDesc = {}) override;
+
+        bool LoadBinary(std::vector<char>&& binaryCode, const ShaderDescriptor& shaderDesc = {}) override;
+
+        std::string Disassemble(int flags = 0) override;
+
+        std::string QueryInfoLog() override;
+
+        inline bool IsCompiled() const
+        {
+            return compiled_;
+        }
+
+    private:
+
+        std::string         sourceCode_;
+        std::vector<char>   binaryCode_;
+        std::string         infoLog_;
+        bool                compiled_   = false;
+
+};
+
+// Shader program which only validates the attached shaders.
+class NullShaderProgram : public ShaderProgram
+{
+
+    public:
+
+        void AttachShader(Shader& shader) override;
+        void DetachAll() override;
+
+        bool LinkShaders() override;
+
+        std::string QueryInfoLog() override;
+
+        const std::vector<VertexAttribute>& QueryVertexAttributes() const override;
+        const std::vector<StreamOutputAttribute>& QueryStreamOutputAttributes() const override;
+        const std::vector<ConstantBufferViewDescriptor>& QueryConstantBuffers() const override;
+        const std::vector<StorageBufferViewDescriptor>& QueryStorageBuffers() const override;
+        const std::vector<UniformDescriptor>& QueryUniforms() const override;
+
+        void BuildInputLayout(const VertexFormat& vertexFormat) override;
+
+        void BindConstantBuffer(const std::string& name, unsigned int bindingIndex) override;
+        void BindStorageBuffer(const std::string& name, unsigned int bindingIndex) override;
+
+        ShaderUniform* LockShaderUniform() override;
+        void UnlockShaderUniform() override;
+
+        // Returns true if this shader program has been linked successfully.
+        inline bool IsLinked() const
+        {
+            return linked_;
+        }
+
+        // Returns true if a compute shader is attached.
+        bool HasComputeShader() const;
+
+    private:
+
+        std::vector<NullShader*>    shaders_;
+        VertexFormat                vertexFormat_;
+        std::string                 infoLog_;
+        bool                        linked_     = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
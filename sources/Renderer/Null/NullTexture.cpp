@@ -0,0 +1,103 @@
+/*
+ * NullTexture.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "NullTexture.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+// Returns the size of the first MIP-map level, where the Z component is the number of array layers for array textures.
+static Gs::Vector3ui GetTextureSize(const TextureDescriptor& desc)
+{
+    switch (desc.type)
+    {
+        case TextureType::Texture1D:        return { desc.texture1D.width, 1, 1 };
+        case TextureType::Texture1DArray:   return { desc.texture1D.width, desc.texture1D.layers, 1 };
+        case TextureType::Texture2D:        return { desc.texture2D.width, desc.texture2D.height, 1 };
+        case TextureType::Texture2DArray:   return { desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers };
+        case TextureType::Texture3D:        return { desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth };
+        case TextureType::TextureCube:      return { desc.textureCube.width, desc.textureCube.height, 6 };
+        case TextureType::TextureCubeArray: return { desc.textureCube.width, desc.textureCube.height, desc.textureCube.layers * 6 };
+        case TextureType::Texture2DMS:      return { desc.texture2DMS.width, desc.texture2DMS.height, 1 };
+        case TextureType::Texture2DMSArray: return { desc.texture2DMS.width, desc.texture2DMS.height, desc.texture2DMS.layers };
+    }
+    return { 0, 0, 0 };
+}
+
+NullTexture::NullTexture(const TextureDescriptor& desc) :
+    Texture { desc.type },
+    desc_   { desc      }
+{
+    const auto size = GetTextureSize(desc);
+
+    if (size.x == 0 || size.y == 0 || size.z == 0)
+        throw std::invalid_argument("cannot create texture with size of zero");
+
+    /* Resolve number of MIP-map levels (array layers are not reduced per MIP-map level) */
+    if (IsMultiSampleTexture(desc.type))
+        desc_.mipLevels = 1;
+    else
+    {
+        const bool hasDepth = (desc.type == TextureType::Texture3D);
+        const auto maxMipLevels = NumMipLevels(size.x, (desc.type == TextureType::Texture1DArray ? 1 : size.y), (hasDepth ? size.z : 1));
+
+        if (desc_.mipLevels == 0)
+            desc_.mipLevels = maxMipLevels;
+        else
+            desc_.mipLevels = std::min(desc_.mipLevels, maxMipLevels);
+    }
+}
+
+Gs::Vector3ui NullTexture::QueryMipLevelSize(unsigned int mipLevel) const
+{
+    if (mipLevel >= desc_.mipLevels)
+        return { 0, 0, 0 };
+
+    auto size = GetTextureSize(desc_);
+
+    switch (desc_.type)
+    {
+        case TextureType::Texture1D:
+        case TextureType::Texture1DArray:
+            size.x = std::max(1u, size.x >> mipLevel);
+            break;
+        case TextureType::Texture3D:
+            size.x = std::max(1u, size.x >> mipLevel);
+            size.y = std::max(1u, size.y >> mipLevel);
+            size.z = std::max(1u, size.z >> mipLevel);
+            break;
+        default:
+            size.x = std::max(1u, size.x >> mipLevel);
+            size.y = std::max(1u, size.y >> mipLevel);
+            break;
+    }
+
+    return size;
+}
+
+void NullTexture::AssertMipLevel(unsigned int mipLevel) const
+{
+    if (mipLevel >= desc_.mipLevels)
+    {
+        throw std::out_of_range(
+            "MIP-map level " + std::to_string(mipLevel) + " out of range for texture with " +
+            std::to_string(desc_.mipLevels) + " MIP-map level(s)"
+        );
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
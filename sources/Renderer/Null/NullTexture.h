@@ -0,0 +1,56 @@
+/*
+ * NullTexture.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_NULL_TEXTURE_H
+#define LLGL_NULL_TEXTURE_H
+
+
+#include <LLGL/Texture.h>
+
+
+namespace LLGL
+{
+
+
+// Texture which only keeps its descriptor, but no image data.
+class NullTexture : public Texture
+{
+
+    public:
+
+        NullTexture(const TextureDescriptor& desc);
+
+        Gs::Vector3ui QueryMipLevelSize(unsigned int mipLevel) const override;
+
+        // Throws std::out_of_range if the MIP-map level is not less than the number of MIP-map levels.
+        void AssertMipLevel(unsigned int mipLevel) const;
+
+        inline const TextureDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+        inline unsigned int GetNumMipLevels() const
+        {
+            return desc_.mipLevels;
+        }
+
+    private:
+
+        TextureDescriptor desc_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
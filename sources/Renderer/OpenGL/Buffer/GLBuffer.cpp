@@ -8,6 +8,7 @@
 #include "GLBuffer.h"
 #include "../../GLCommon/GLTypes.h"
 #include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
 
 
 namespace LLGL
@@ -17,6 +18,14 @@ namespace LLGL
 GLBuffer::GLBuffer(const BufferType type) :
     Buffer { type }
 {
+    #ifdef GL_ARB_direct_state_access
+    if (HasDirectStateAccess())
+    {
+        /* Create buffer object immediately, so it can be modified without being bound first */
+        glCreateBuffers(1, &id_);
+        return;
+    }
+    #endif
     glGenBuffers(1, &id_);
 }
 
@@ -27,16 +36,32 @@ GLBuffer::~GLBuffer()
 
 void GLBuffer::BufferData(const void* data, GLsizeiptr size, GLenum usage)
 {
-    glBufferData(GetTarget(), size, data, usage);
+    #ifdef GL_ARB_direct_state_access
+    if (HasDirectStateAccess())
+        glNamedBufferData(id_, size, data, usage);
+    else
+    #endif
+        glBufferData(GetTarget(), size, data, usage);
+    size_ = size;
 }
 
 void GLBuffer::BufferSubData(const void* data, GLsizeiptr size, GLintptr offset)
 {
-    glBufferSubData(GetTarget(), offset, size, data);
+    #ifdef GL_ARB_direct_state_access
+    if (HasDirectStateAccess())
+        glNamedBufferSubData(id_, offset, size, data);
+    else
+    #endif
+        glBufferSubData(GetTarget(), offset, size, data);
 }
 
 void* GLBuffer::MapBuffer(GLenum access)
 {
+    #ifdef GL_ARB_direct_state_access
+    if (HasDirectStateAccess())
+        return glMapNamedBuffer(id_, access);
+    #endif
+
     #ifdef LLGL_GL_OPENGLES
     //TODO: move this into "Renderer/OpenGLES2/Buffer/GLES2Buffer.cpp"
     return glMapBufferOES(GetTarget(), access);
@@ -47,6 +72,11 @@ void* GLBuffer::MapBuffer(GLenum access)
 
 GLboolean GLBuffer::UnmapBuffer()
 {
+    #ifdef GL_ARB_direct_state_access
+    if (HasDirectStateAccess())
+        return glUnmapNamedBuffer(id_);
+    #endif
+
     #ifdef LLGL_GL_OPENGLES
     //TODO: move this into "Renderer/OpenGLES2/Buffer/GLES2Buffer.cpp"
     return glUnmapBufferOES(GetTarget());
@@ -55,6 +85,15 @@ GLboolean GLBuffer::UnmapBuffer()
     #endif
 }
 
+bool GLBuffer::HasDirectStateAccess()
+{
+    #ifdef GL_ARB_direct_state_access
+    return HasExtension(GLExt::ARB_direct_state_access);
+    #else
+    return false;
+    #endif
+}
+
 
 /*
  * ======= Private: =======
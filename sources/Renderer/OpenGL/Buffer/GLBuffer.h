@@ -31,18 +31,31 @@ class GLBuffer : public Buffer
         void* MapBuffer(GLenum access);
         GLboolean UnmapBuffer();
 
+        /*
+        Returns true if buffers are created and modified with direct state access (GL_ARB_direct_state_access).
+        In this case, the functions above do not require the buffer to be bound.
+        */
+        static bool HasDirectStateAccess();
+
         //! Returns the hardware buffer ID.
         inline GLuint GetID() const
         {
             return id_;
         }
 
+        //! Returns the size (in bytes) of the buffer storage, which was last specified with "BufferData".
+        inline GLsizeiptr GetSize() const
+        {
+            return size_;
+        }
+
     private:
 
         //! Returns the buffer target.
         GLenum GetTarget() const;
 
-        GLuint id_ = 0;
+        GLuint      id_     = 0;
+        GLsizeiptr  size_   = 0;
 
 };
 
@@ -0,0 +1,200 @@
+/*
+ * GLStagingBufferRing.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLStagingBufferRing.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../../../Core/Helper.h"
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Alignment of each region, which satisfies the alignment requirements of all pixel data types
+static const GLintptr g_regionAlignment = 16;
+
+static GLenum GetGLPixelBufferTarget(const GLBufferTarget target)
+{
+    return (target == GLBufferTarget::PIXEL_PACK_BUFFER ? GL_PIXEL_PACK_BUFFER : GL_PIXEL_UNPACK_BUFFER);
+}
+
+GLStagingBufferRing::GLStagingBufferRing(const GLBufferTarget target, GLsizeiptr size) :
+    target_ { target },
+    size_   { size   }
+{
+    auto targetGL = GetGLPixelBufferTarget(target);
+    auto accessBit = (target == GLBufferTarget::PIXEL_PACK_BUFFER ? GL_MAP_READ_BIT : GL_MAP_WRITE_BIT);
+
+    glGenBuffers(1, &id_);
+    GLStateManager::active->BindBuffer(target_, id_);
+
+    #ifdef GL_ARB_buffer_storage
+    if (HasExtension(GLExt::ARB_buffer_storage))
+    {
+        /* Allocate immutable storage and map it persistently */
+        const GLbitfield flags = (accessBit | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+        glBufferStorage(targetGL, size, nullptr, flags);
+        mappedData_ = reinterpret_cast<char*>(glMapBufferRange(targetGL, 0, size, flags));
+    }
+    else
+    #endif
+    {
+        /* Allocate mutable storage, which is mapped for each transfer */
+        glBufferData(targetGL, size, nullptr, (target == GLBufferTarget::PIXEL_PACK_BUFFER ? GL_STREAM_READ : GL_STREAM_DRAW));
+    }
+
+    GLStateManager::active->BindBuffer(target_, 0);
+}
+
+GLStagingBufferRing::~GLStagingBufferRing()
+{
+    /* Delete all pending fences (the buffer itself stays alive until all transfers are completed) */
+    for (const auto& region : regions_)
+        glDeleteSync(region.fence);
+
+    GLStateManager::active->NotifyBufferRelease(id_);
+    glDeleteBuffers(1, &id_);
+}
+
+GLintptr GLStagingBufferRing::Alloc(GLsizeiptr size)
+{
+    /* Recycle all regions whose transfers are already completed */
+    RetireCompletedRegions();
+
+    if (regions_.empty())
+        head_ = 0;
+
+    auto offset = GetAlignedSize(head_, g_regionAlignment);
+
+    if (offset + size > size_)
+    {
+        /* Wait for all regions at the end of the ring, then wrap around */
+        while (!regions_.empty() && regions_.front().offset >= head_)
+            RetireFrontRegion();
+        offset = 0;
+    }
+
+    /* Wait for all regions which overlap with the new region */
+    while (!regions_.empty() && regions_.front().offset >= offset && regions_.front().offset < offset + size)
+        RetireFrontRegion();
+
+    head_ = offset + size;
+
+    pendingRegion_.offset   = offset;
+    pendingRegion_.size     = size;
+
+    return offset;
+}
+
+GLintptr GLStagingBufferRing::Write(const void* data, GLsizeiptr size)
+{
+    auto offset = Alloc(size);
+
+    if (mappedData_)
+    {
+        /* Copy data into persistently mapped memory */
+        std::memcpy(mappedData_ + offset, data, static_cast<std::size_t>(size));
+    }
+    else
+    {
+        /* Map region without synchronization, since it is guaranteed to be unused by the GPU */
+        auto targetGL = GetGLPixelBufferTarget(target_);
+        GLStateManager::active->BindBuffer(target_, id_);
+
+        const GLbitfield flags = (GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (auto dst = glMapBufferRange(targetGL, offset, size, flags))
+        {
+            std::memcpy(dst, data, static_cast<std::size_t>(size));
+            glUnmapBuffer(targetGL);
+        }
+        else
+            glBufferSubData(targetGL, offset, size, data);
+    }
+
+    return offset;
+}
+
+void GLStagingBufferRing::Read(GLintptr offset, void* data, GLsizeiptr size)
+{
+    if (mappedData_)
+    {
+        /* Copy data from persistently mapped memory */
+        std::memcpy(data, mappedData_ + offset, static_cast<std::size_t>(size));
+    }
+    else
+    {
+        /* Map region for reading, which does not stall since the transfer has already been completed */
+        auto targetGL = GetGLPixelBufferTarget(target_);
+        GLStateManager::active->BindBuffer(target_, id_);
+
+        if (auto src = glMapBufferRange(targetGL, offset, size, GL_MAP_READ_BIT))
+        {
+            std::memcpy(data, src, static_cast<std::size_t>(size));
+            glUnmapBuffer(targetGL);
+        }
+    }
+}
+
+std::uint64_t GLStagingBufferRing::InsertFence()
+{
+    pendingRegion_.fence    = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    pendingRegion_.ticket   = nextTicket_++;
+
+    regions_.push_back(pendingRegion_);
+
+    return pendingRegion_.ticket;
+}
+
+bool GLStagingBufferRing::IsComplete(std::uint64_t ticket)
+{
+    if (ticket > completedTicket_)
+        RetireCompletedRegions();
+    return (ticket <= completedTicket_);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLStagingBufferRing::RetireCompletedRegions()
+{
+    while (!regions_.empty())
+    {
+        /* Poll fence of the oldest region without waiting, but flush the commands, so the fence is eventually signaled by polling alone */
+        auto result = glClientWaitSync(regions_.front().fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+            break;
+        RetireFrontRegion();
+    }
+}
+
+void GLStagingBufferRing::RetireFrontRegion()
+{
+    auto& region = regions_.front();
+
+    /* Wait until the transfer of the oldest region has been completed */
+    while (glClientWaitSync(region.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull) == GL_TIMEOUT_EXPIRED)
+    {
+        // wait
+    }
+
+    glDeleteSync(region.fence);
+    completedTicket_ = region.ticket;
+
+    regions_.pop_front();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
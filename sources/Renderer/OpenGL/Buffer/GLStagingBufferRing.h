@@ -0,0 +1,105 @@
+/*
+ * GLStagingBufferRing.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_STAGING_BUFFER_RING_H
+#define LLGL_GL_STAGING_BUFFER_RING_H
+
+
+#include "../OpenGL.h"
+#include "../RenderState/GLState.h"
+#include <deque>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Ring of staging memory inside a single pixel buffer object (PBO) for asynchronous pixel transfers.
+Each transfer occupies a region of the ring, which is recycled as soon as the fence behind the transfer has been signaled.
+If the extension "GL_ARB_buffer_storage" is available, the buffer is mapped persistently.
+Pixel unpack buffers are mapped for writing (uploads), and pixel pack buffers are mapped for reading (readbacks).
+*/
+class GLStagingBufferRing
+{
+
+    public:
+
+        // Creates the staging buffer for the specified target, which must be either PIXEL_PACK_BUFFER or PIXEL_UNPACK_BUFFER.
+        GLStagingBufferRing(const GLBufferTarget target, GLsizeiptr size);
+        ~GLStagingBufferRing();
+
+        GLStagingBufferRing(const GLStagingBufferRing&) = delete;
+        GLStagingBufferRing& operator = (const GLStagingBufferRing&) = delete;
+
+        /*
+        Allocates the next free region of the ring and returns the offset of this region.
+        This only blocks if the ring is full. Each call must be followed by "InsertFence" after the transfer has been issued.
+        */
+        GLintptr Alloc(GLsizeiptr size);
+
+        // Allocates the next free region of the ring, copies the specified data into it, and returns the offset of this region.
+        GLintptr Write(const void* data, GLsizeiptr size);
+
+        // Copies the data of the specified region into the output buffer. The transfer into this region must have been completed.
+        void Read(GLintptr offset, void* data, GLsizeiptr size);
+
+        // Inserts a fence behind the transfer of the last written region and returns the ticket of this transfer.
+        std::uint64_t InsertFence();
+
+        // Returns true if the transfer of the specified ticket has been completed. This does not block.
+        bool IsComplete(std::uint64_t ticket);
+
+        //! Returns the hardware buffer ID.
+        inline GLuint GetID() const
+        {
+            return id_;
+        }
+
+        //! Returns the size (in bytes) of the entire ring.
+        inline GLsizeiptr GetSize() const
+        {
+            return size_;
+        }
+
+    private:
+
+        struct Region
+        {
+            GLintptr        offset;
+            GLsizeiptr      size;
+            GLsync          fence;
+            std::uint64_t   ticket;
+        };
+
+        void RetireCompletedRegions();
+        void RetireFrontRegion();
+
+        GLBufferTarget      target_;
+        GLuint              id_                 = 0;
+        GLsizeiptr          size_               = 0;
+        char*               mappedData_         = nullptr;
+
+        GLintptr            head_               = 0;
+        Region              pendingRegion_      = { 0, 0, nullptr, 0 };
+        std::deque<Region>  regions_;
+
+        std::uint64_t       nextTicket_         = 1;
+        std::uint64_t       completedTicket_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
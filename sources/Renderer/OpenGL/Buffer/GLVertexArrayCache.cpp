@@ -0,0 +1,186 @@
+/*
+ * GLVertexArrayCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLVertexArrayCache.h"
+#include "../Ext/GLExtensions.h"
+#include "../RenderState/GLStateManager.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../../../Core/Helper.h"
+#include <functional>
+
+
+namespace LLGL
+{
+
+
+/* ----- GLSharedVertexArray class ----- */
+
+GLSharedVertexArray::GLSharedVertexArray(const std::vector<VertexFormat>& vertexFormats) :
+    strides_      ( vertexFormats.size(), 0 ),
+    boundBuffers_ ( vertexFormats.size(), 0 )
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+
+    GLStateManager::active->BindVertexArray(GetID());
+    {
+        GLuint attribIndex = 0;
+
+        for (GLuint bindingIndex = 0; bindingIndex < static_cast<GLuint>(vertexFormats.size()); ++bindingIndex)
+        {
+            const auto& vertexFormat = vertexFormats[bindingIndex];
+
+            /* Build attribute formats for this binding point (all attributes of a format have the same instance divisor) */
+            for (const auto& attrib : vertexFormat.attributes)
+                vao_.BuildVertexAttributeFormat(attrib, attribIndex++, bindingIndex);
+
+            if (!vertexFormat.attributes.empty())
+                glVertexBindingDivisor(bindingIndex, vertexFormat.attributes.front().instanceDivisor);
+
+            strides_[bindingIndex] = static_cast<GLsizei>(vertexFormat.stride);
+        }
+    }
+    GLStateManager::active->BindVertexArray(0);
+
+    #endif
+}
+
+void GLSharedVertexArray::NotifyBufferRelease(GLuint buffer)
+{
+    for (auto& boundBuffer : boundBuffers_)
+    {
+        if (boundBuffer == buffer)
+            boundBuffer = 0;
+    }
+}
+
+void GLSharedVertexArray::BindVertexBufferGL(GLuint bindingIndex, GLuint buffer)
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+    glBindVertexBuffer(bindingIndex, buffer, 0, strides_[bindingIndex]);
+    boundBuffers_[bindingIndex] = buffer;
+    #endif
+}
+
+
+/* ----- GLVertexArrayCache class ----- */
+
+template <typename T>
+static void HashCombine(std::size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// Returns the hash of all vertex format properties which are relevant for a VAO (i.e. without attribute names).
+static std::size_t GetVertexFormatsHash(const std::vector<VertexFormat>& vertexFormats)
+{
+    std::size_t seed = 0;
+
+    for (const auto& vertexFormat : vertexFormats)
+    {
+        HashCombine(seed, vertexFormat.stride);
+        HashCombine(seed, vertexFormat.attributes.size());
+
+        for (const auto& attrib : vertexFormat.attributes)
+        {
+            HashCombine(seed, static_cast<int>(attrib.vectorType));
+            HashCombine(seed, attrib.instanceDivisor);
+            HashCombine(seed, attrib.conversion);
+            HashCombine(seed, attrib.offset);
+        }
+    }
+
+    return seed;
+}
+
+static bool CompareVertexFormats(const std::vector<VertexFormat>& lhs, const std::vector<VertexFormat>& rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        const auto& lhsAttribs = lhs[i].attributes;
+        const auto& rhsAttribs = rhs[i].attributes;
+
+        if (lhs[i].stride != rhs[i].stride || lhsAttribs.size() != rhsAttribs.size())
+            return false;
+
+        for (std::size_t j = 0; j < lhsAttribs.size(); ++j)
+        {
+            if ( lhsAttribs[j].vectorType      != rhsAttribs[j].vectorType      ||
+                 lhsAttribs[j].instanceDivisor != rhsAttribs[j].instanceDivisor ||
+                 lhsAttribs[j].conversion      != rhsAttribs[j].conversion      ||
+                 lhsAttribs[j].offset          != rhsAttribs[j].offset )
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Returns true if all attributes of each vertex format have the same instance divisor, which is required for a binding point.
+static bool HasUniformInstanceDivisors(const std::vector<VertexFormat>& vertexFormats)
+{
+    for (const auto& vertexFormat : vertexFormats)
+    {
+        for (const auto& attrib : vertexFormat.attributes)
+        {
+            if (attrib.instanceDivisor != vertexFormat.attributes.front().instanceDivisor)
+                return false;
+        }
+    }
+    return true;
+}
+
+GLVertexArrayCache::Entry::Entry(const std::vector<VertexFormat>& vertexFormats) :
+    vertexFormats { vertexFormats },
+    vertexArray   { vertexFormats }
+{
+}
+
+GLSharedVertexArray* GLVertexArrayCache::GetOrCreate(const std::vector<VertexFormat>& vertexFormats)
+{
+    if (!HasExtension(GLExt::ARB_vertex_attrib_binding) || !HasUniformInstanceDivisors(vertexFormats))
+        return nullptr;
+
+    /* Find shared VAO with equal vertex formats */
+    auto hash = GetVertexFormatsHash(vertexFormats);
+    auto range = entries_.equal_range(hash);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (CompareVertexFormats(it->second->vertexFormats, vertexFormats))
+            return &(it->second->vertexArray);
+    }
+
+    /* Create new shared VAO */
+    auto entry = MakeUnique<Entry>(vertexFormats);
+    auto vertexArray = &(entry->vertexArray);
+    entries_.emplace(hash, std::move(entry));
+
+    return vertexArray;
+}
+
+void GLVertexArrayCache::NotifyBufferRelease(GLuint buffer)
+{
+    for (auto& entry : entries_)
+        entry.second->vertexArray.NotifyBufferRelease(buffer);
+}
+
+void GLVertexArrayCache::Clear()
+{
+    entries_.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
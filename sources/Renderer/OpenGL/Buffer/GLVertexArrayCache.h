@@ -0,0 +1,112 @@
+/*
+ * GLVertexArrayCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_VERTEX_ARRAY_CACHE_H
+#define LLGL_GL_VERTEX_ARRAY_CACHE_H
+
+
+#include <LLGL/VertexFormat.h>
+#include "GLVertexArrayObject.h"
+#include <unordered_map>
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Vertex array object (VAO) which is shared between all vertex buffers (or vertex buffer arrays) with the same vertex formats.
+The attribute formats are specified once, and the vertex buffers are only bound to the binding points (one per vertex format).
+*/
+class GLSharedVertexArray
+{
+
+    public:
+
+        GLSharedVertexArray(const std::vector<VertexFormat>& vertexFormats);
+
+        GLSharedVertexArray(const GLSharedVertexArray&) = delete;
+        GLSharedVertexArray& operator = (const GLSharedVertexArray&) = delete;
+
+        // Binds the specified buffer to the binding point, unless it is already bound. This VAO must be bound.
+        inline void BindVertexBuffer(GLuint bindingIndex, GLuint buffer)
+        {
+            if (boundBuffers_[bindingIndex] != buffer)
+                BindVertexBufferGL(bindingIndex, buffer);
+        }
+
+        // Resets the binding points of the specified buffer, since its ID might be reused after the buffer has been deleted.
+        void NotifyBufferRelease(GLuint buffer);
+
+        // Returns the ID of the hardware vertex-array-object (VAO).
+        inline GLuint GetID() const
+        {
+            return vao_.GetID();
+        }
+
+    private:
+
+        void BindVertexBufferGL(GLuint bindingIndex, GLuint buffer);
+
+        GLVertexArrayObject     vao_;
+        std::vector<GLsizei>    strides_;
+        std::vector<GLuint>     boundBuffers_;
+
+};
+
+/*
+Cache of shared vertex array objects, which are keyed by their vertex formats.
+This requires the extension "GL_ARB_vertex_attrib_binding", since the vertex formats are specified separately from the buffer bindings.
+The vertex formats are only hashed when a buffer is created, so switching between meshes of the same layout only changes a buffer binding.
+*/
+class GLVertexArrayCache
+{
+
+    public:
+
+        GLVertexArrayCache() = default;
+
+        GLVertexArrayCache(const GLVertexArrayCache&) = delete;
+        GLVertexArrayCache& operator = (const GLVertexArrayCache&) = delete;
+
+        /*
+        Returns the shared VAO for the specified vertex formats, or null if shared VAOs are not supported for these formats,
+        i.e. if the extension is unavailable or the attributes of a vertex format have different instance divisors.
+        */
+        GLSharedVertexArray* GetOrCreate(const std::vector<VertexFormat>& vertexFormats);
+
+        // Resets the binding points of the specified buffer in all shared VAOs, since a buffer can be bound to several of them (e.g. in a vertex buffer array).
+        void NotifyBufferRelease(GLuint buffer);
+
+        // Releases all shared VAOs.
+        void Clear();
+
+    private:
+
+        struct Entry
+        {
+            Entry(const std::vector<VertexFormat>& vertexFormats);
+
+            std::vector<VertexFormat>   vertexFormats;
+            GLSharedVertexArray         vertexArray;
+        };
+
+        std::unordered_multimap<std::size_t, std::unique_ptr<Entry>> entries_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
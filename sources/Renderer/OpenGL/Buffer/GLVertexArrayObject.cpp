@@ -47,10 +47,7 @@ void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute,
     /* Use currently bound VBO for VertexAttribPointer functions */
     if (!attribute.conversion && dataType != DataType::Float && dataType != DataType::Double)
     {
-        if (!HasExtension(GLExt::EXT_gpu_shader4))
-            ThrowNotSupported("integral vertex attributes");
-
-        glVertexAttribIPointer(
+        GLStateManager::active->GetDispatchTable().vertexAttribIPointer(
             index,
             components,
             GLTypes::Map(dataType),
@@ -71,6 +68,48 @@ void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute,
     }
 }
 
+void GLVertexArrayObject::BuildVertexAttributeFormat(const VertexAttribute& attribute, GLuint attribIndex, GLuint bindingIndex)
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+
+    /* Enable array index in currently bound VAO */
+    glEnableVertexAttribArray(attribIndex);
+
+    /* Get data type and components of vector type */
+    DataType        dataType    = DataType::Float;
+    unsigned int    components  = 0;
+    VectorTypeFormat(attribute.vectorType, dataType, components);
+
+    /* Specify attribute format relative to the binding point */
+    if (!attribute.conversion && dataType != DataType::Float && dataType != DataType::Double)
+    {
+        GLStateManager::active->GetDispatchTable().vertexAttribIFormat(
+            attribIndex,
+            static_cast<GLint>(components),
+            GLTypes::Map(dataType),
+            attribute.offset
+        );
+    }
+    else
+    {
+        glVertexAttribFormat(
+            attribIndex,
+            static_cast<GLint>(components),
+            GLTypes::Map(dataType),
+            GL_FALSE,
+            attribute.offset
+        );
+    }
+
+    glVertexAttribBinding(attribIndex, bindingIndex);
+
+    #else
+
+    ThrowNotSupported("separate vertex attribute format and binding");
+
+    #endif
+}
+
 
 } // /namespace LLGL
 
@@ -27,6 +27,13 @@ class GLVertexArrayObject
 
         void BuildVertexAttribute(const VertexAttribute& attribute, unsigned int stride, unsigned int index);
 
+        /*
+        Builds the specified vertex attribute with a separate format and binding point, i.e. no buffer is bound to the attribute.
+        The instance divisor must be specified per binding point with "glVertexBindingDivisor".
+        This requires the extension "GL_ARB_vertex_attrib_binding".
+        */
+        void BuildVertexAttributeFormat(const VertexAttribute& attribute, GLuint attribIndex, GLuint bindingIndex);
+
         //! Returns the ID of the hardware vertex-array-object (VAO)
         inline GLuint GetID() const
         {
@@ -7,6 +7,7 @@
 
 #include "GLVertexBuffer.h"
 #include "../RenderState/GLStateManager.h"
+#include "../../../Core/Helper.h"
 
 
 namespace LLGL
@@ -18,19 +19,27 @@ GLVertexBuffer::GLVertexBuffer() :
 {
 }
 
-void GLVertexBuffer::BuildVertexArray(const VertexFormat& vertexFormat)
+void GLVertexBuffer::BuildVertexArray(const VertexFormat& vertexFormat, GLVertexArrayCache& vertexArrayCache)
 {
-    /* Bind VAO */
-    GLStateManager::active->BindVertexArray(GetVaoID());
-    {
-        /* Bind VBO */
-        GLStateManager::active->BindBuffer(GLBufferTarget::ARRAY_BUFFER, GetID());
+    /* Try to use the shared VAO of this vertex format, which gets this buffer bound when it is set */
+    sharedVao_ = vertexArrayCache.GetOrCreate({ vertexFormat });
 
-        /* Build each vertex attribute */
-        for (unsigned int i = 0, n = static_cast<unsigned int>(vertexFormat.attributes.size()); i < n; ++i)
-            vao_.BuildVertexAttribute(vertexFormat.attributes[i], vertexFormat.stride, i);
+    if (!sharedVao_)
+    {
+        vao_ = MakeUnique<GLVertexArrayObject>();
+
+        /* Bind VAO */
+        GLStateManager::active->BindVertexArray(GetVaoID());
+        {
+            /* Bind VBO */
+            GLStateManager::active->BindBuffer(GLBufferTarget::ARRAY_BUFFER, GetID());
+
+            /* Build each vertex attribute */
+            for (unsigned int i = 0, n = static_cast<unsigned int>(vertexFormat.attributes.size()); i < n; ++i)
+                vao_->BuildVertexAttribute(vertexFormat.attributes[i], vertexFormat.stride, i);
+        }
+        GLStateManager::active->BindVertexArray(0);
     }
-    GLStateManager::active->BindVertexArray(0);
 
     /* Store vertex format (required if this buffer is used in a buffer array) */
     vertexFormat_ = vertexFormat;
@@ -11,6 +11,8 @@
 
 #include "GLBuffer.h"
 #include "GLVertexArrayObject.h"
+#include "GLVertexArrayCache.h"
+#include <memory>
 
 
 namespace LLGL
@@ -24,12 +26,22 @@ class GLVertexBuffer : public GLBuffer
 
         GLVertexBuffer();
 
-        void BuildVertexArray(const VertexFormat& vertexFormat);
+        /*
+        Builds the vertex array for the specified vertex format. The VAO is shared with all vertex buffers of the same format if the cache supports it,
+        otherwise an own VAO is created with this buffer bound to all attributes.
+        */
+        void BuildVertexArray(const VertexFormat& vertexFormat, GLVertexArrayCache& vertexArrayCache);
 
         //! Returns the ID of the vertex-array-object (VAO)
         inline GLuint GetVaoID() const
         {
-            return vao_.GetID();
+            return (sharedVao_ != nullptr ? sharedVao_->GetID() : vao_->GetID());
+        }
+
+        //! Returns the shared VAO of this buffer's vertex format, or null if this buffer has its own VAO.
+        inline GLSharedVertexArray* GetSharedVertexArray() const
+        {
+            return sharedVao_;
         }
 
         //! Returns the vertex format.
@@ -40,8 +52,9 @@ class GLVertexBuffer : public GLBuffer
 
     private:
 
-        GLVertexArrayObject vao_;
-        VertexFormat        vertexFormat_;
+        std::unique_ptr<GLVertexArrayObject>    vao_;
+        GLSharedVertexArray*                    sharedVao_      = nullptr;
+        VertexFormat                            vertexFormat_;
 
 };
 
@@ -9,6 +9,7 @@
 #include "GLVertexBuffer.h"
 #include "../RenderState/GLStateManager.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/Helper.h"
 
 
 namespace LLGL
@@ -20,8 +21,26 @@ GLVertexBufferArray::GLVertexBufferArray() :
 {
 }
 
-void GLVertexBufferArray::BuildVertexArray(unsigned int numBuffers, Buffer* const * bufferArray)
+void GLVertexBufferArray::BuildVertexArray(unsigned int numBuffers, Buffer* const * bufferArray, GLVertexArrayCache& vertexArrayCache)
 {
+    /* Try to use the shared VAO of these vertex formats (one binding point per buffer) */
+    std::vector<VertexFormat> vertexFormats;
+    vertexFormats.reserve(numBuffers);
+
+    for (unsigned int i = 0; i < numBuffers; ++i)
+    {
+        auto vertexBufferGL = LLGL_CAST(GLVertexBuffer*, bufferArray[i]);
+        vertexFormats.push_back(vertexBufferGL->GetVertexFormat());
+        vertexBufferIDs_.push_back(vertexBufferGL->GetID());
+    }
+
+    sharedVao_ = vertexArrayCache.GetOrCreate(vertexFormats);
+    if (sharedVao_)
+        return;
+
+    vao_ = MakeUnique<GLVertexArrayObject>();
+    vertexBufferIDs_.clear();
+
     /* Bind VAO */
     GLStateManager::active->BindVertexArray(GetVaoID());
     {
@@ -36,7 +55,7 @@ void GLVertexBufferArray::BuildVertexArray(unsigned int numBuffers, Buffer* cons
 
                 /* Build each vertex attribute */
                 for (unsigned int j = 0, n = static_cast<unsigned int>(vertexFormat.attributes.size()); j < n; ++j, ++i)
-                    vao_.BuildVertexAttribute(vertexFormat.attributes[j], vertexFormat.stride, i);
+                    vao_->BuildVertexAttribute(vertexFormat.attributes[j], vertexFormat.stride, i);
             }
             ++bufferArray;
         }
@@ -11,6 +11,9 @@
 
 #include "GLBufferArray.h"
 #include "GLVertexArrayObject.h"
+#include "GLVertexArrayCache.h"
+#include <memory>
+#include <vector>
 
 
 namespace LLGL
@@ -24,17 +27,31 @@ class GLVertexBufferArray : public GLBufferArray
 
         GLVertexBufferArray();
 
-        void BuildVertexArray(unsigned int numBuffers, Buffer* const * bufferArray);
+        void BuildVertexArray(unsigned int numBuffers, Buffer* const * bufferArray, GLVertexArrayCache& vertexArrayCache);
 
         //! Returns the ID of the vertex-array-object (VAO)
         inline GLuint GetVaoID() const
         {
-            return vao_.GetID();
+            return (sharedVao_ != nullptr ? sharedVao_->GetID() : vao_->GetID());
+        }
+
+        //! Returns the shared VAO of this buffer array's vertex formats, or null if this buffer array has its own VAO.
+        inline GLSharedVertexArray* GetSharedVertexArray() const
+        {
+            return sharedVao_;
+        }
+
+        //! Returns the IDs of the vertex buffers, which must be bound to the binding points of the shared VAO.
+        inline const std::vector<GLuint>& GetVertexBufferIDs() const
+        {
+            return vertexBufferIDs_;
         }
 
     private:
 
-        GLVertexArrayObject vao_;
+        std::unique_ptr<GLVertexArrayObject>    vao_;
+        GLSharedVertexArray*                    sharedVao_      = nullptr;
+        std::vector<GLuint>                     vertexBufferIDs_;
 
 };
 
@@ -0,0 +1,169 @@
+/*
+ * GLDispatchTable.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLDispatchTable.h"
+#include "GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../../../Core/Exception.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Fallback procedures ----- */
+
+static void APIENTRY Unsupported_glBeginTransformFeedback(GLenum /*primitiveMode*/)
+{
+    ThrowNotSupported("stream-outputs");
+}
+
+static void APIENTRY Unsupported_glEndTransformFeedback()
+{
+    ThrowNotSupported("stream-outputs");
+}
+
+static void APIENTRY Unsupported_glDrawArraysInstancedBaseInstance(GLenum, GLint, GLsizei, GLsizei, GLuint)
+{
+    ThrowNotSupported("instance offset for draw commands");
+}
+
+static void APIENTRY Unsupported_glDrawElementsInstancedBaseVertexBaseInstance(GLenum, GLsizei, GLenum, const GLvoid*, GLsizei, GLint, GLuint)
+{
+    ThrowNotSupported("instance offset for draw commands");
+}
+
+static void APIENTRY Unsupported_glVertexAttribIPointer(GLuint, GLint, GLenum, GLsizei, const GLvoid*)
+{
+    ThrowNotSupported("integral vertex attributes");
+}
+
+static void APIENTRY Unsupported_glVertexAttribIFormat(GLuint, GLint, GLenum, GLuint)
+{
+    ThrowNotSupported("integral vertex attributes");
+}
+
+// Size (in bytes) of the structures "DrawArraysIndirectCommand" and "DrawElementsIndirectCommand", used for a stride of zero.
+static const GLsizei drawArraysIndirectCommandSize      = sizeof(GLuint) * 4;
+static const GLsizei drawElementsIndirectCommandSize    = sizeof(GLuint) * 5;
+
+static void APIENTRY Emulated_glMultiDrawArraysIndirect(GLenum mode, const GLvoid* indirect, GLsizei drawcount, GLsizei stride)
+{
+    if (stride == 0)
+        stride = drawArraysIndirectCommandSize;
+
+    /* Submit draw commands one by one */
+    auto offset = reinterpret_cast<GLintptr>(indirect);
+    for (GLsizei i = 0; i < drawcount; ++i, offset += stride)
+        glDrawArraysIndirect(mode, reinterpret_cast<const GLvoid*>(offset));
+}
+
+static void APIENTRY Emulated_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const GLvoid* indirect, GLsizei drawcount, GLsizei stride)
+{
+    if (stride == 0)
+        stride = drawElementsIndirectCommandSize;
+
+    /* Submit draw commands one by one */
+    auto offset = reinterpret_cast<GLintptr>(indirect);
+    for (GLsizei i = 0; i < drawcount; ++i, offset += stride)
+        glDrawElementsIndirect(mode, type, reinterpret_cast<const GLvoid*>(offset));
+}
+
+
+/* ----- Functions ----- */
+
+void LoadGLDispatchTable(GLDispatchTable& table)
+{
+    /* Stream-outputs */
+    #ifdef __APPLE__
+    table.beginTransformFeedback    = glBeginTransformFeedback;
+    table.endTransformFeedback      = glEndTransformFeedback;
+    #else
+    if (HasExtension(GLExt::EXT_transform_feedback))
+    {
+        table.beginTransformFeedback    = glBeginTransformFeedback;
+        table.endTransformFeedback      = glEndTransformFeedback;
+    }
+    else if (HasExtension(GLExt::NV_transform_feedback))
+    {
+        table.beginTransformFeedback    = glBeginTransformFeedbackNV;
+        table.endTransformFeedback      = glEndTransformFeedbackNV;
+    }
+    else
+    {
+        table.beginTransformFeedback    = Unsupported_glBeginTransformFeedback;
+        table.endTransformFeedback      = Unsupported_glEndTransformFeedback;
+    }
+    #endif
+
+    /* Draw commands with instance offset */
+    #ifndef __APPLE__
+    if (HasExtension(GLExt::ARB_base_instance))
+    {
+        table.drawArraysInstancedBaseInstance               = glDrawArraysInstancedBaseInstance;
+        table.drawElementsInstancedBaseVertexBaseInstance   = glDrawElementsInstancedBaseVertexBaseInstance;
+    }
+    else
+    #endif
+    {
+        table.drawArraysInstancedBaseInstance               = Unsupported_glDrawArraysInstancedBaseInstance;
+        table.drawElementsInstancedBaseVertexBaseInstance   = Unsupported_glDrawElementsInstancedBaseVertexBaseInstance;
+    }
+
+    /* Multi-draw indirect commands */
+    #ifdef GL_ARB_multi_draw_indirect
+    if (HasExtension(GLExt::ARB_multi_draw_indirect))
+    {
+        table.multiDrawArraysIndirect   = glMultiDrawArraysIndirect;
+        table.multiDrawElementsIndirect = glMultiDrawElementsIndirect;
+    }
+    else
+    #endif
+    {
+        table.multiDrawArraysIndirect   = Emulated_glMultiDrawArraysIndirect;
+        table.multiDrawElementsIndirect = Emulated_glMultiDrawElementsIndirect;
+    }
+
+    /* Multi-bind */
+    #ifdef GL_ARB_multi_bind
+    if (HasExtension(GLExt::ARB_multi_bind))
+    {
+        table.bindBuffersBase   = glBindBuffersBase;
+        table.bindTextures      = glBindTextures;
+        table.bindSamplers      = glBindSamplers;
+    }
+    else
+    #endif
+    {
+        table.bindBuffersBase   = nullptr;
+        table.bindTextures      = nullptr;
+        table.bindSamplers      = nullptr;
+    }
+
+    /* Integral vertex attributes */
+    if (HasExtension(GLExt::EXT_gpu_shader4))
+    {
+        table.vertexAttribIPointer  = glVertexAttribIPointer;
+        #ifdef GL_ARB_vertex_attrib_binding
+        table.vertexAttribIFormat   = glVertexAttribIFormat;
+        #else
+        table.vertexAttribIFormat   = Unsupported_glVertexAttribIFormat;
+        #endif
+    }
+    else
+    {
+        table.vertexAttribIPointer  = Unsupported_glVertexAttribIPointer;
+        table.vertexAttribIFormat   = Unsupported_glVertexAttribIFormat;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,73 @@
+/*
+ * GLDispatchTable.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_DISPATCH_TABLE_H
+#define LLGL_GL_DISPATCH_TABLE_H
+
+
+#include "../OpenGL.h"
+
+
+#if defined(LLGL_OS_MACOS) && !defined(APIENTRY)
+#   define APIENTRY
+#endif
+
+
+namespace LLGL
+{
+
+
+/*
+Table of GL entry points whose implementation depends on the available extensions.
+The choice between core, EXT, and NV procedures (or an emulation) is made once per GL context in "LoadGLDispatchTable",
+so the hot commands are a single indirect call instead of querying the extension registry each time.
+Entries that must stay null when the extension is unavailable are documented below, all others are always valid.
+*/
+struct GLDispatchTable
+{
+    /* ----- Stream-outputs ----- */
+
+    // GL_EXT_transform_feedback or GL_NV_transform_feedback; throws if neither is supported.
+    void (APIENTRY* beginTransformFeedback)(GLenum primitiveMode)   = nullptr;
+    void (APIENTRY* endTransformFeedback)()                         = nullptr;
+
+    /* ----- Drawing ----- */
+
+    // GL_ARB_base_instance; throws if not supported.
+    void (APIENTRY* drawArraysInstancedBaseInstance)(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) = nullptr;
+    void (APIENTRY* drawElementsInstancedBaseVertexBaseInstance)(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) = nullptr;
+
+    // GL_ARB_multi_draw_indirect; emulated with one "glDraw*Indirect" call per command if not supported.
+    void (APIENTRY* multiDrawArraysIndirect)(GLenum mode, const GLvoid* indirect, GLsizei drawcount, GLsizei stride) = nullptr;
+    void (APIENTRY* multiDrawElementsIndirect)(GLenum mode, GLenum type, const GLvoid* indirect, GLsizei drawcount, GLsizei stride) = nullptr;
+
+    /* ----- Multi-bind ----- */
+
+    // GL_ARB_multi_bind; null if not supported, because the fallback depends on the state manager.
+    void (APIENTRY* bindBuffersBase)(GLenum target, GLuint first, GLsizei count, const GLuint* buffers) = nullptr;
+    void (APIENTRY* bindTextures)(GLuint first, GLsizei count, const GLuint* textures)                 = nullptr;
+    void (APIENTRY* bindSamplers)(GLuint first, GLsizei count, const GLuint* samplers)                 = nullptr;
+
+    /* ----- Vertex attributes ----- */
+
+    // GL_EXT_gpu_shader4; throws if not supported.
+    void (APIENTRY* vertexAttribIPointer)(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid* pointer) = nullptr;
+    void (APIENTRY* vertexAttribIFormat)(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)          = nullptr;
+};
+
+// Resolves all entries of the specified dispatch table. The GL extensions must have been loaded before.
+void LoadGLDispatchTable(GLDispatchTable& table);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -9,7 +9,14 @@
 #include "GLExtensions.h"
 #include "GLExtensionsNull.h"
 #include <LLGL/Log.h>
-#include <functional>
+#include <stdexcept>
+#include <string>
+#include <cstdint>
+#include <cstring>
+
+#ifdef LLGL_GL_ENABLE_EGL
+#include <EGL/egl.h>
+#endif
 
 
 namespace LLGL
@@ -28,58 +35,230 @@ bool LoadGLProc(T& procAddr, const char* procName)
     #if defined(_WIN32)
     procAddr = reinterpret_cast<T>(wglGetProcAddress(procName));
     #elif defined(__linux__)
+    #ifdef LLGL_GL_ENABLE_EGL
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+        procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
+    else
+    #endif
     procAddr = reinterpret_cast<T>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName)));
     #else
     Log::StdErr() << "OS not supported for loading OpenGL extensions" << std::endl;
     return false;
     #endif
     
-    /* Check for errors */
-    if (!procAddr)
-    {
-        Log::StdErr() << "failed to load OpenGL procedure: " << procName << std::endl;
-        return false;
-    }
-    
-    return true;
+    /* Failures are reported per extension by the caller */
+    return (procAddr != nullptr);
 }
 
-static void ExtractExtensionsFromString(GLExtensionList& extensions, const std::string& extString)
+/*
+Names of all entries in the GLExt enumeration (in the same order), with a perfect hash table to look them up by name.
+The hash seed is chosen so that the upper 8 bits of the FNV-1a hashes of all names are distinct, which is verified at compile time.
+If a new extension causes a collision, the seed must be changed to the next value that passes the static assertion.
+*/
+
+#define LLGL_GLEXT_NAME(NAME) "GL_" #NAME
+
+static constexpr const char* g_extNames[] =
 {
-    size_t first = 0, last = 0;
-    
-    /* Find next extension name in string */
-    while ( ( last = extString.find(' ', first) ) != std::string::npos )
+    /* Common extensions */
+    LLGL_GLEXT_NAME( EXT_blend_func_separate          ),
+    LLGL_GLEXT_NAME( EXT_blend_minmax                 ),
+    LLGL_GLEXT_NAME( EXT_blend_color                  ),
+    LLGL_GLEXT_NAME( EXT_blend_equation_separate      ),
+    LLGL_GLEXT_NAME( ARB_draw_buffers                 ),
+    LLGL_GLEXT_NAME( EXT_draw_buffers2                ),
+    LLGL_GLEXT_NAME( ARB_draw_buffers_blend           ),
+    LLGL_GLEXT_NAME( ARB_multitexture                 ),
+    LLGL_GLEXT_NAME( EXT_texture3D                    ),
+    LLGL_GLEXT_NAME( ARB_clear_texture                ),
+    LLGL_GLEXT_NAME( ARB_texture_compression          ),
+    LLGL_GLEXT_NAME( ARB_texture_multisample          ),
+    LLGL_GLEXT_NAME( ARB_texture_storage              ),
+    LLGL_GLEXT_NAME( ARB_texture_storage_multisample  ),
+    LLGL_GLEXT_NAME( ARB_sampler_objects              ),
+    LLGL_GLEXT_NAME( ARB_multi_bind                   ),
+    LLGL_GLEXT_NAME( ARB_vertex_buffer_object         ),
+    LLGL_GLEXT_NAME( ARB_instanced_arrays             ),
+    LLGL_GLEXT_NAME( ARB_vertex_array_object          ),
+    LLGL_GLEXT_NAME( ARB_framebuffer_object           ),
+    LLGL_GLEXT_NAME( ARB_invalidate_subdata           ),
+    LLGL_GLEXT_NAME( ARB_draw_instanced               ),
+    LLGL_GLEXT_NAME( ARB_draw_elements_base_vertex    ),
+    LLGL_GLEXT_NAME( ARB_base_instance                ),
+    LLGL_GLEXT_NAME( ARB_draw_indirect                ),
+    LLGL_GLEXT_NAME( ARB_multi_draw_indirect          ),
+    LLGL_GLEXT_NAME( ARB_shader_objects               ),
+    LLGL_GLEXT_NAME( ARB_tessellation_shader          ),
+    LLGL_GLEXT_NAME( ARB_compute_shader               ),
+    LLGL_GLEXT_NAME( ARB_get_program_binary           ),
+    LLGL_GLEXT_NAME( ARB_program_interface_query      ),
+    LLGL_GLEXT_NAME( ARB_uniform_buffer_object        ),
+    LLGL_GLEXT_NAME( ARB_shader_storage_buffer_object ),
+    LLGL_GLEXT_NAME( ARB_map_buffer_range             ),
+    LLGL_GLEXT_NAME( ARB_sync                         ),
+    LLGL_GLEXT_NAME( ARB_buffer_storage               ),
+    LLGL_GLEXT_NAME( ARB_vertex_attrib_binding        ),
+    LLGL_GLEXT_NAME( ARB_occlusion_query              ),
+    LLGL_GLEXT_NAME( NV_conditional_render            ),
+    LLGL_GLEXT_NAME( ARB_timer_query                  ),
+    LLGL_GLEXT_NAME( ARB_viewport_array               ),
+    LLGL_GLEXT_NAME( EXT_stencil_two_side             ),
+    LLGL_GLEXT_NAME( KHR_debug                        ),
+    LLGL_GLEXT_NAME( ARB_clip_control                 ),
+    LLGL_GLEXT_NAME( EXT_transform_feedback           ),
+    LLGL_GLEXT_NAME( NV_transform_feedback            ),
+    LLGL_GLEXT_NAME( EXT_gpu_shader4                  ),
+    LLGL_GLEXT_NAME( ARB_direct_state_access          ),
+
+    /* Extensions without procedures */
+    LLGL_GLEXT_NAME( ARB_texture_cube_map             ),
+    LLGL_GLEXT_NAME( EXT_texture_array                ),
+    LLGL_GLEXT_NAME( ARB_texture_cube_map_array       ),
+    LLGL_GLEXT_NAME( ARB_geometry_shader4             ),
+    LLGL_GLEXT_NAME( NV_conservative_raster           ),
+    LLGL_GLEXT_NAME( INTEL_conservative_rasterization ),
+    LLGL_GLEXT_NAME( NVX_gpu_memory_info              ),
+    LLGL_GLEXT_NAME( ATI_meminfo                      ),
+};
+
+#undef LLGL_GLEXT_NAME
+
+static constexpr std::size_t g_numExtNames = static_cast<std::size_t>(GLExt::Count);
+
+static_assert(sizeof(g_extNames)/sizeof(g_extNames[0]) == g_numExtNames, "extension name table does not match GLExt enumeration");
+
+static constexpr std::uint32_t g_extHashSeed = 2166136433u;
+
+// Returns the FNV-1a hash of the first 'len' characters of the specified string.
+static constexpr std::uint32_t ExtNameHash(const char* str, std::size_t len, std::uint32_t hash = g_extHashSeed)
+{
+    return (len == 0 ? hash : ExtNameHash(str + 1, len - 1, (hash ^ static_cast<std::uint8_t>(*str)) * 16777619u));
+}
+
+static constexpr std::size_t ExtNameLength(const char* str)
+{
+    return (*str == '\0' ? 0 : 1 + ExtNameLength(str + 1));
+}
+
+static constexpr std::size_t ExtNameSlot(std::size_t idx)
+{
+    return (ExtNameHash(g_extNames[idx], ExtNameLength(g_extNames[idx])) >> 24);
+}
+
+static constexpr bool IsExtNameSlotUnique(std::size_t idx, std::size_t other)
+{
+    return (other >= g_numExtNames ? true : (ExtNameSlot(idx) != ExtNameSlot(other) && IsExtNameSlotUnique(idx, other + 1)));
+}
+
+static constexpr bool IsExtNameHashPerfect(std::size_t idx = 0)
+{
+    return (idx >= g_numExtNames ? true : (IsExtNameSlotUnique(idx, idx + 1) && IsExtNameHashPerfect(idx + 1)));
+}
+
+static_assert(IsExtNameHashPerfect(), "hash seed for extension names has collisions; choose another seed");
+
+// Returns the index of the extension name in the specified hash slot, or 0xFF if the slot is empty.
+static constexpr std::uint8_t FindExtNameInSlot(std::size_t slot, std::size_t idx = 0)
+{
+    return (idx >= g_numExtNames ? 0xFF : (ExtNameSlot(idx) == slot ? static_cast<std::uint8_t>(idx) : FindExtNameInSlot(slot, idx + 1)));
+}
+
+#define LLGL_GLEXT_SLOTS4(N)    FindExtNameInSlot(N), FindExtNameInSlot(N + 1), FindExtNameInSlot(N + 2), FindExtNameInSlot(N + 3)
+#define LLGL_GLEXT_SLOTS16(N)   LLGL_GLEXT_SLOTS4(N), LLGL_GLEXT_SLOTS4(N + 4), LLGL_GLEXT_SLOTS4(N + 8), LLGL_GLEXT_SLOTS4(N + 12)
+#define LLGL_GLEXT_SLOTS64(N)   LLGL_GLEXT_SLOTS16(N), LLGL_GLEXT_SLOTS16(N + 16), LLGL_GLEXT_SLOTS16(N + 32), LLGL_GLEXT_SLOTS16(N + 48)
+
+static constexpr std::uint8_t g_extNameSlots[256] =
+{
+    LLGL_GLEXT_SLOTS64(0), LLGL_GLEXT_SLOTS64(64), LLGL_GLEXT_SLOTS64(128), LLGL_GLEXT_SLOTS64(192)
+};
+
+#undef LLGL_GLEXT_SLOTS4
+#undef LLGL_GLEXT_SLOTS16
+#undef LLGL_GLEXT_SLOTS64
+
+// Marks the specified extension name as supported, if it is part of the GLExt enumeration.
+static void AddExtension(GLExtensionList& extensions, const char* name, std::size_t len)
+{
+    auto idx = g_extNameSlots[ExtNameHash(name, len) >> 24];
+    if (idx < g_numExtNames && std::strncmp(g_extNames[idx], name, len) == 0 && g_extNames[idx][len] == '\0')
+        extensions.set(idx);
+}
+
+static void ExtractExtensionsFromString(GLExtensionList& extensions, const char* extString)
+{
+    /* Find next extension name in string, which are separated by spaces */
+    while (*extString != '\0')
     {
-        /* Store current extension name in hash-map */
-        auto name = extString.substr(first, last - first);
-        extensions[name] = false;
-        first = last + 1;
+        auto len = std::strcspn(extString, " ");
+        if (len > 0)
+            AddExtension(extensions, extString, len);
+        extString += len;
+        if (*extString == ' ')
+            ++extString;
     }
 }
 
-
 #ifndef __APPLE__
 
+/*
+Trampoline for lazily loaded GL procedures. "Proc" provides the address and name of the procedure pointer.
+The first call resolves the procedure, replaces this trampoline in the procedure pointer, and forwards the call.
+*/
+template <typename T, typename Proc>
+struct GLLazyProc;
+
+template <typename Proc, typename R, typename... Args>
+struct GLLazyProc<R (APIENTRY*)(Args...), Proc>
+{
+    static R APIENTRY Resolve(Args... args)
+    {
+        R (APIENTRY* procAddr)(Args...) = nullptr;
+        if (!LoadGLProc(procAddr, Proc::Name()))
+            throw std::runtime_error("failed to load OpenGL procedure: " + std::string(Proc::Name()));
+        Proc::Address() = procAddr;
+        return procAddr(args...);
+    }
+};
+
+
 #define LOAD_GLPROC_SIMPLE(NAME) \
     LoadGLProc(NAME, #NAME)
 
+// Procedure loading modes of the extension loading functions
+enum class GLProcLoad
+{
+    Eager,          // Resolve all procedures immediately
+    Lazy,           // Resolve each procedure with its first call (see GLLazyProc)
+    Placeholder,    // Assign the placeholder procedures of unsupported extensions (see GLExtensionsNull.h)
+};
+
 #ifdef LLGL_GL_ENABLE_EXT_PLACEHOLDERS
 
-#define LOAD_GLPROC(NAME)               \
-    if (usePlaceHolder)                 \
-        NAME = Dummy_##NAME;            \
-    else if (!LoadGLProc(NAME, #NAME))  \
-        return false
+#define LOAD_GLPROC_PLACEHOLDER(NAME)       \
+    if (loading == GLProcLoad::Placeholder) \
+        NAME = Dummy_##NAME;                \
+    else
 
 #else
 
-#define LOAD_GLPROC(NAME)           \
-    if (!LoadGLProc(NAME, #NAME))   \
-        return false
+#define LOAD_GLPROC_PLACEHOLDER(NAME)
 
 #endif
 
+#define LOAD_GLPROC(NAME)                                                   \
+    LOAD_GLPROC_PLACEHOLDER(NAME)                                           \
+    if (loading == GLProcLoad::Lazy)                                        \
+    {                                                                       \
+        struct Proc                                                         \
+        {                                                                   \
+            static decltype(NAME)& Address() { return NAME; }               \
+            static const char* Name() { return #NAME; }                     \
+        };                                                                  \
+        NAME = GLLazyProc<decltype(NAME), Proc>::Resolve;                   \
+    }                                                                       \
+    else if (!LoadGLProc(NAME, #NAME))                                      \
+        return false
+
 /* --- Common GL extensions --- */
 
 bool LoadSwapIntervalProcs()
@@ -113,7 +292,7 @@ bool LoadCreateContextProcs()
 
 /* --- Hardware buffer extensions --- */
 
-static bool Load_GL_ARB_vertex_buffer_object(bool usePlaceHolder)
+static bool Load_GL_ARB_vertex_buffer_object(GLProcLoad loading)
 {
     LOAD_GLPROC( glGenBuffers    );
     LOAD_GLPROC( glDeleteBuffers );
@@ -132,7 +311,7 @@ static bool Load_GL_ARB_vertex_buffer_object(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_vertex_array_object(bool usePlaceHolder)
+static bool Load_GL_ARB_vertex_array_object(GLProcLoad loading)
 {
     LOAD_GLPROC( glGenVertexArrays    );
     LOAD_GLPROC( glDeleteVertexArrays );
@@ -140,7 +319,7 @@ static bool Load_GL_ARB_vertex_array_object(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_framebuffer_object(bool usePlaceHolder)
+static bool Load_GL_ARB_framebuffer_object(GLProcLoad loading)
 {
     LOAD_GLPROC( glGenRenderbuffers                    );
     LOAD_GLPROC( glDeleteRenderbuffers                 );
@@ -164,7 +343,18 @@ static bool Load_GL_ARB_framebuffer_object(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_uniform_buffer_object(bool usePlaceHolder)
+static bool Load_GL_ARB_invalidate_subdata(GLProcLoad loading)
+{
+    LOAD_GLPROC( glInvalidateTexSubImage    );
+    LOAD_GLPROC( glInvalidateTexImage       );
+    LOAD_GLPROC( glInvalidateBufferSubData  );
+    LOAD_GLPROC( glInvalidateBufferData     );
+    LOAD_GLPROC( glInvalidateFramebuffer    );
+    LOAD_GLPROC( glInvalidateSubFramebuffer );
+    return true;
+}
+
+static bool Load_GL_ARB_uniform_buffer_object(GLProcLoad loading)
 {
     LOAD_GLPROC( glGetUniformBlockIndex      );
     LOAD_GLPROC( glGetActiveUniformBlockiv   );
@@ -174,22 +364,56 @@ static bool Load_GL_ARB_uniform_buffer_object(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_shader_storage_buffer_object(bool usePlaceHolder)
+static bool Load_GL_ARB_shader_storage_buffer_object(GLProcLoad loading)
 {
     LOAD_GLPROC( glShaderStorageBlockBinding );
     return true;
 }
 
+static bool Load_GL_ARB_map_buffer_range(GLProcLoad loading)
+{
+    LOAD_GLPROC( glMapBufferRange         );
+    LOAD_GLPROC( glFlushMappedBufferRange );
+    return true;
+}
+
+static bool Load_GL_ARB_sync(GLProcLoad loading)
+{
+    LOAD_GLPROC( glFenceSync      );
+    LOAD_GLPROC( glIsSync         );
+    LOAD_GLPROC( glDeleteSync     );
+    LOAD_GLPROC( glClientWaitSync );
+    LOAD_GLPROC( glWaitSync       );
+    return true;
+}
+
+static bool Load_GL_ARB_buffer_storage(GLProcLoad loading)
+{
+    LOAD_GLPROC( glBufferStorage );
+    return true;
+}
+
+static bool Load_GL_ARB_vertex_attrib_binding(GLProcLoad loading)
+{
+    LOAD_GLPROC( glBindVertexBuffer     );
+    LOAD_GLPROC( glVertexAttribFormat   );
+    LOAD_GLPROC( glVertexAttribIFormat  );
+    LOAD_GLPROC( glVertexAttribLFormat  );
+    LOAD_GLPROC( glVertexAttribBinding  );
+    LOAD_GLPROC( glVertexBindingDivisor );
+    return true;
+}
+
 /* --- Drawing extensions --- */
 
-static bool Load_GL_ARB_draw_instanced(bool usePlaceHolder)
+static bool Load_GL_ARB_draw_instanced(GLProcLoad loading)
 {
     LOAD_GLPROC( glDrawArraysInstanced   );
     LOAD_GLPROC( glDrawElementsInstanced );
     return true;
 }
 
-static bool Load_GL_ARB_base_instance(bool usePlaceHolder)
+static bool Load_GL_ARB_base_instance(GLProcLoad loading)
 {
     LOAD_GLPROC( glDrawArraysInstancedBaseInstance             );
     LOAD_GLPROC( glDrawElementsInstancedBaseInstance           );
@@ -197,7 +421,21 @@ static bool Load_GL_ARB_base_instance(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_draw_elements_base_vertex(bool usePlaceHolder)
+static bool Load_GL_ARB_draw_indirect(GLProcLoad loading)
+{
+    LOAD_GLPROC( glDrawArraysIndirect   );
+    LOAD_GLPROC( glDrawElementsIndirect );
+    return true;
+}
+
+static bool Load_GL_ARB_multi_draw_indirect(GLProcLoad loading)
+{
+    LOAD_GLPROC( glMultiDrawArraysIndirect   );
+    LOAD_GLPROC( glMultiDrawElementsIndirect );
+    return true;
+}
+
+static bool Load_GL_ARB_draw_elements_base_vertex(GLProcLoad loading)
 {
     LOAD_GLPROC( glDrawElementsBaseVertex          );
     LOAD_GLPROC( glDrawElementsInstancedBaseVertex );
@@ -206,7 +444,7 @@ static bool Load_GL_ARB_draw_elements_base_vertex(bool usePlaceHolder)
 
 /* --- Shader extensions --- */
 
-static bool Load_GL_ARB_shader_objects(bool usePlaceHolder)
+static bool Load_GL_ARB_shader_objects(GLProcLoad loading)
 {
     LOAD_GLPROC( glCreateShader       );
     LOAD_GLPROC( glShaderSource       );
@@ -242,27 +480,27 @@ static bool Load_GL_ARB_shader_objects(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_instanced_arrays(bool usePlaceHolder)
+static bool Load_GL_ARB_instanced_arrays(GLProcLoad loading)
 {
     LOAD_GLPROC( glVertexAttribDivisor );
     return true;
 }
 
-static bool Load_GL_ARB_tessellation_shader(bool usePlaceHolder)
+static bool Load_GL_ARB_tessellation_shader(GLProcLoad loading)
 {
     LOAD_GLPROC( glPatchParameteri  );
     LOAD_GLPROC( glPatchParameterfv );
     return true;
 }
 
-static bool Load_GL_ARB_compute_shader(bool usePlaceHolder)
+static bool Load_GL_ARB_compute_shader(GLProcLoad loading)
 {
     LOAD_GLPROC( glDispatchCompute         );
     LOAD_GLPROC( glDispatchComputeIndirect );
     return true;
 }
 
-static bool Load_GL_ARB_get_program_binary(bool usePlaceHolder)
+static bool Load_GL_ARB_get_program_binary(GLProcLoad loading)
 {
     LOAD_GLPROC( glGetProgramBinary  );
     LOAD_GLPROC( glProgramBinary     );
@@ -270,7 +508,7 @@ static bool Load_GL_ARB_get_program_binary(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_program_interface_query(bool usePlaceHolder)
+static bool Load_GL_ARB_program_interface_query(GLProcLoad loading)
 {
     LOAD_GLPROC( glGetProgramInterfaceiv           );
     LOAD_GLPROC( glGetProgramResourceIndex         );
@@ -281,7 +519,7 @@ static bool Load_GL_ARB_program_interface_query(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_EXT_gpu_shader4(bool usePlaceHolder)
+static bool Load_GL_EXT_gpu_shader4(GLProcLoad loading)
 {
     LOAD_GLPROC( glVertexAttribIPointer );
     LOAD_GLPROC( glBindFragDataLocation );
@@ -291,27 +529,27 @@ static bool Load_GL_EXT_gpu_shader4(bool usePlaceHolder)
 
 /* --- Texture extensions --- */
 
-static bool Load_GL_ARB_multitexture(bool usePlaceHolder)
+static bool Load_GL_ARB_multitexture(GLProcLoad loading)
 {
     LOAD_GLPROC( glActiveTexture );
     return true;
 }
 
-static bool Load_GL_EXT_texture3D(bool usePlaceHolder)
+static bool Load_GL_EXT_texture3D(GLProcLoad loading)
 {
     LOAD_GLPROC( glTexImage3D    );
     LOAD_GLPROC( glTexSubImage3D );
     return true;
 }
 
-static bool Load_GL_ARB_clear_texture(bool usePlaceHolder)
+static bool Load_GL_ARB_clear_texture(GLProcLoad loading)
 {
     LOAD_GLPROC( glClearTexImage    );
     LOAD_GLPROC( glClearTexSubImage );
     return true;
 }
 
-static bool Load_GL_ARB_texture_compression(bool usePlaceHolder)
+static bool Load_GL_ARB_texture_compression(GLProcLoad loading)
 {
     LOAD_GLPROC( glCompressedTexImage1D    );
     LOAD_GLPROC( glCompressedTexImage2D    );
@@ -323,7 +561,7 @@ static bool Load_GL_ARB_texture_compression(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_texture_multisample(bool usePlaceHolder)
+static bool Load_GL_ARB_texture_multisample(GLProcLoad loading)
 {
     LOAD_GLPROC( glTexImage2DMultisample );
     LOAD_GLPROC( glTexImage3DMultisample );
@@ -332,7 +570,22 @@ static bool Load_GL_ARB_texture_multisample(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_sampler_objects(bool usePlaceHolder)
+static bool Load_GL_ARB_texture_storage(GLProcLoad loading)
+{
+    LOAD_GLPROC( glTexStorage1D );
+    LOAD_GLPROC( glTexStorage2D );
+    LOAD_GLPROC( glTexStorage3D );
+    return true;
+}
+
+static bool Load_GL_ARB_texture_storage_multisample(GLProcLoad loading)
+{
+    LOAD_GLPROC( glTexStorage2DMultisample );
+    LOAD_GLPROC( glTexStorage3DMultisample );
+    return true;
+}
+
+static bool Load_GL_ARB_sampler_objects(GLProcLoad loading)
 {
     LOAD_GLPROC( glGenSamplers        );
     LOAD_GLPROC( glDeleteSamplers     );
@@ -346,7 +599,7 @@ static bool Load_GL_ARB_sampler_objects(bool usePlaceHolder)
 
 /* --- Other extensions --- */
 
-static bool Load_GL_ARB_occlusion_query(bool usePlaceHolder)
+static bool Load_GL_ARB_occlusion_query(GLProcLoad loading)
 {
     LOAD_GLPROC( glGenQueries        );
     LOAD_GLPROC( glDeleteQueries     );
@@ -357,14 +610,14 @@ static bool Load_GL_ARB_occlusion_query(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_NV_conditional_render(bool usePlaceHolder)
+static bool Load_GL_NV_conditional_render(GLProcLoad loading)
 {
     LOAD_GLPROC( glBeginConditionalRender );
     LOAD_GLPROC( glEndConditionalRender   );
     return true;
 }
 
-static bool Load_GL_ARB_timer_query(bool usePlaceHolder)
+static bool Load_GL_ARB_timer_query(GLProcLoad loading)
 {
     LOAD_GLPROC( glQueryCounter        );
     LOAD_GLPROC( glGetQueryObjecti64v  );
@@ -372,7 +625,7 @@ static bool Load_GL_ARB_timer_query(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_viewport_array(bool usePlaceHolder)
+static bool Load_GL_ARB_viewport_array(GLProcLoad loading)
 {
     LOAD_GLPROC( glViewportArrayv   );
     LOAD_GLPROC( glScissorArrayv    );
@@ -380,31 +633,31 @@ static bool Load_GL_ARB_viewport_array(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_EXT_blend_minmax(bool usePlaceHolder)
+static bool Load_GL_EXT_blend_minmax(GLProcLoad loading)
 {
     LOAD_GLPROC( glBlendEquation );
     return true;
 }
 
-static bool Load_GL_EXT_blend_color(bool usePlaceHolder)
+static bool Load_GL_EXT_blend_color(GLProcLoad loading)
 {
     LOAD_GLPROC( glBlendColor );
     return true;
 }
 
-static bool Load_GL_EXT_blend_func_separate(bool usePlaceHolder)
+static bool Load_GL_EXT_blend_func_separate(GLProcLoad loading)
 {
     LOAD_GLPROC( glBlendFuncSeparate );
     return true;
 }
 
-static bool Load_GL_EXT_blend_equation_separate(bool usePlaceHolder)
+static bool Load_GL_EXT_blend_equation_separate(GLProcLoad loading)
 {
     LOAD_GLPROC( glBlendEquationSeparate );
     return true;
 }
 
-static bool Load_GL_ARB_draw_buffers_blend(bool usePlaceHolder)
+static bool Load_GL_ARB_draw_buffers_blend(GLProcLoad loading)
 {
     LOAD_GLPROC( glBlendEquationi         );
     LOAD_GLPROC( glBlendEquationSeparatei );
@@ -413,7 +666,7 @@ static bool Load_GL_ARB_draw_buffers_blend(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_ARB_multi_bind(bool usePlaceHolder)
+static bool Load_GL_ARB_multi_bind(GLProcLoad loading)
 {
     LOAD_GLPROC( glBindBuffersBase   );
     LOAD_GLPROC( glBindBuffersRange  );
@@ -424,7 +677,7 @@ static bool Load_GL_ARB_multi_bind(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_EXT_stencil_two_side(bool usePlaceHolder)
+static bool Load_GL_EXT_stencil_two_side(GLProcLoad loading)
 {
     //correct extension ??? maybe "GL_ATI_separate_stencil"
     LOAD_GLPROC( glStencilFuncSeparate );
@@ -433,25 +686,25 @@ static bool Load_GL_EXT_stencil_two_side(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_KHR_debug(bool usePlaceHolder)
+static bool Load_GL_KHR_debug(GLProcLoad loading)
 {
     LOAD_GLPROC( glDebugMessageCallback );
     return true;
 }
 
-static bool Load_GL_ARB_clip_control(bool usePlaceHolder)
+static bool Load_GL_ARB_clip_control(GLProcLoad loading)
 {
     LOAD_GLPROC( glClipControl );
     return true;
 }
 
-static bool Load_GL_ARB_draw_buffers(bool usePlaceHolder)
+static bool Load_GL_ARB_draw_buffers(GLProcLoad loading)
 {
     LOAD_GLPROC( glDrawBuffers );
     return true;
 }
 
-static bool Load_GL_EXT_draw_buffers2(bool usePlaceHolder)
+static bool Load_GL_EXT_draw_buffers2(GLProcLoad loading)
 {
     LOAD_GLPROC( glColorMaski    );
     LOAD_GLPROC( glGetBooleani_v );
@@ -462,7 +715,7 @@ static bool Load_GL_EXT_draw_buffers2(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_EXT_transform_feedback(bool usePlaceHolder)
+static bool Load_GL_EXT_transform_feedback(GLProcLoad loading)
 {
     LOAD_GLPROC( glBindBufferRange             );
     LOAD_GLPROC( glBeginTransformFeedback      );
@@ -472,7 +725,7 @@ static bool Load_GL_EXT_transform_feedback(bool usePlaceHolder)
     return true;
 }
 
-static bool Load_GL_NV_transform_feedback(bool usePlaceHolder)
+static bool Load_GL_NV_transform_feedback(GLProcLoad loading)
 {
     LOAD_GLPROC( glBindBufferRangeNV           );
     LOAD_GLPROC( glBeginTransformFeedbackNV    );
@@ -483,7 +736,33 @@ static bool Load_GL_NV_transform_feedback(bool usePlaceHolder)
     return true;
 }
 
+#ifdef GL_ARB_direct_state_access
+
+static bool Load_GL_ARB_direct_state_access(GLProcLoad loading)
+{
+    LOAD_GLPROC( glCreateBuffers               );
+    LOAD_GLPROC( glNamedBufferData             );
+    LOAD_GLPROC( glNamedBufferSubData          );
+    LOAD_GLPROC( glMapNamedBuffer              );
+    LOAD_GLPROC( glUnmapNamedBuffer            );
+    LOAD_GLPROC( glTextureSubImage1D           );
+    LOAD_GLPROC( glTextureSubImage2D           );
+    LOAD_GLPROC( glTextureSubImage3D           );
+    LOAD_GLPROC( glCompressedTextureSubImage1D );
+    LOAD_GLPROC( glCompressedTextureSubImage2D );
+    LOAD_GLPROC( glCompressedTextureSubImage3D );
+    LOAD_GLPROC( glTextureParameteri           );
+    LOAD_GLPROC( glGenerateTextureMipmap       );
+    LOAD_GLPROC( glGetTextureImage             );
+    LOAD_GLPROC( glGetTextureLevelParameteriv  );
+    LOAD_GLPROC( glGetTextureParameteriv       );
+    return true;
+}
+
+#endif
+
 #undef LOAD_GLPROC_SIMPLE
+#undef LOAD_GLPROC_PLACEHOLDER
 #undef LOAD_GLPROC
     
 #endif
@@ -515,7 +794,7 @@ GLExtensionList QueryExtensions(bool coreProfile)
                 /* Get current extension string */
                 extString = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
                 if (extString)
-                    extensions[extString] = false;
+                    AddExtension(extensions, extString, std::strlen(extString));
             }
         }
         
@@ -565,11 +844,14 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( ARB_framebuffer_object           );
     ENABLE_GLEXT( ARB_uniform_buffer_object        );
     ENABLE_GLEXT( ARB_shader_storage_buffer_object );
+    ENABLE_GLEXT( ARB_map_buffer_range             );
+    ENABLE_GLEXT( ARB_sync                         );
     
     /* Enable drawing extensions */
     ENABLE_GLEXT( ARB_draw_instanced               );
     ENABLE_GLEXT( ARB_base_instance                );
     ENABLE_GLEXT( ARB_draw_elements_base_vertex    );
+    ENABLE_GLEXT( ARB_draw_indirect                );
     
     /* Enable shader extensions */
     ENABLE_GLEXT( ARB_shader_objects               );
@@ -621,62 +903,97 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     
     #else
     
-    auto LoadExtension = [&](const std::string& extName, const std::function<bool(bool)>& extLoadingProc, GLExt viewerExt) -> void
+    std::string failedExtensions;
+
+    auto LoadExtension = [&](GLExt extension, bool (*extLoadingProc)(GLProcLoad), GLProcLoad loading) -> void
     {
-        /* Try to load OpenGL extension */
-        auto it = extensions.find(extName);
-        if (it != extensions.end() && !extLoadingProc(false))
+        auto idx = static_cast<std::size_t>(extension);
+        if (extensions.test(idx))
         {
-            /* Loading extension failed */
-            Log::StdErr() << "failed to load OpenGL extension: " << extName << std::endl;
+            /* Try to load OpenGL extension */
+            if (extLoadingProc(loading))
+            {
+                /* Enable extension in viewer */
+                RegisterExtension(extension);
+            }
+            else
+            {
+                /* Loading extension failed */
+                extensions.reset(idx);
+                if (!failedExtensions.empty())
+                    failedExtensions += ", ";
+                failedExtensions += g_extNames[idx];
+            }
         }
         #ifdef LLGL_GL_ENABLE_EXT_PLACEHOLDERS
-        else if (it == extensions.end())
+        else
         {
-            /* If failed, use dummy procedures to detect illegal use of OpenGL extension */
-            extLoadingProc(true);
+            /* Use dummy procedures to detect illegal use of OpenGL extension */
+            extLoadingProc(GLProcLoad::Placeholder);
         }
         #endif
-        else if (it != extensions.end())
-        {
-            /* Enable extension in viewer */
-            RegisterExtension(viewerExt);
-            it->second = true;
-        }
     };
 
-    auto EnableExtension = [&](const std::string& extName, GLExt viewerExt) -> void
+    auto EnableExtension = [&](GLExt extension) -> void
     {
         /* Try to enable OpenGL extension */
-        if (extensions.find(extName) != extensions.end())
-            RegisterExtension(viewerExt);
+        if (extensions.test(static_cast<std::size_t>(extension)))
+            RegisterExtension(extension);
     };
 
+    /*
+    Procedures are resolved with their first call, except for the following extensions, which are resolved immediately with LOAD_GLEXT_EAGER:
+    - Extensions whose procedures are copied into the GLDispatchTable of each context.
+    - Extensions with a fallback path (selected by "HasExtension"), since a missing procedure must unregister
+      the extension here to take the fallback path, instead of throwing with its first call (see GLLazyProc).
+    */
     #define LOAD_GLEXT(NAME) \
-        LoadExtension("GL_" + std::string(#NAME), Load_GL_##NAME, GLExt::NAME)
+        LoadExtension(GLExt::NAME, Load_GL_##NAME, GLProcLoad::Lazy)
+
+    #define LOAD_GLEXT_EAGER(NAME) \
+        LoadExtension(GLExt::NAME, Load_GL_##NAME, GLProcLoad::Eager)
 
     #define ENABLE_GLEXT(NAME) \
-        EnableExtension("GL_" + std::string(#NAME), GLExt::NAME)
+        EnableExtension(GLExt::NAME)
         
     /* Add standard extensions */
     if (coreProfile)
     {
-        extensions["GL_ARB_shader_objects"] = false;
-        extensions["GL_ARB_vertex_buffer_object"] = false;
-        extensions["GL_EXT_texture3D"] = false;
+        extensions.set(static_cast<std::size_t>(GLExt::ARB_shader_objects));
+        extensions.set(static_cast<std::size_t>(GLExt::ARB_vertex_buffer_object));
+        extensions.set(static_cast<std::size_t>(GLExt::EXT_texture3D));
     }
 
+    #ifdef GL_ARB_direct_state_access
+
+    /* Direct state access is a core feature since GL 4.5 */
+    GLint majorVersion = 0, minorVersion = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+    glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+
+    if (majorVersion > 4 || (majorVersion == 4 && minorVersion >= 5))
+        extensions.set(static_cast<std::size_t>(GLExt::ARB_direct_state_access));
+
+    #endif
+
     /* Load hardware buffer extensions */
     LOAD_GLEXT( ARB_vertex_buffer_object         );
     LOAD_GLEXT( ARB_vertex_array_object          );
     LOAD_GLEXT( ARB_framebuffer_object           );
+    LOAD_GLEXT_EAGER( ARB_invalidate_subdata           );
     LOAD_GLEXT( ARB_uniform_buffer_object        );
     LOAD_GLEXT( ARB_shader_storage_buffer_object );
+    LOAD_GLEXT_EAGER( ARB_map_buffer_range             );
+    LOAD_GLEXT_EAGER( ARB_sync                         );
+    LOAD_GLEXT_EAGER( ARB_buffer_storage               );
+    LOAD_GLEXT_EAGER( ARB_vertex_attrib_binding        );
 
     /* Load drawing extensions */
     LOAD_GLEXT( ARB_draw_instanced               );
-    LOAD_GLEXT( ARB_base_instance                );
+    LOAD_GLEXT_EAGER( ARB_base_instance                );
     LOAD_GLEXT( ARB_draw_elements_base_vertex    );
+    LOAD_GLEXT( ARB_draw_indirect                );
+    LOAD_GLEXT_EAGER( ARB_multi_draw_indirect          );
 
     /* Load shader extensions */
     LOAD_GLEXT( ARB_shader_objects               );
@@ -685,14 +1002,16 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_compute_shader               );
     LOAD_GLEXT( ARB_get_program_binary           );
     LOAD_GLEXT( ARB_program_interface_query      );
-    LOAD_GLEXT( EXT_gpu_shader4                  );
+    LOAD_GLEXT_EAGER( EXT_gpu_shader4                  );
 
     /* Load texture extensions */
     LOAD_GLEXT( ARB_multitexture                 );
     LOAD_GLEXT( EXT_texture3D                    );
-    LOAD_GLEXT( ARB_clear_texture                );
+    LOAD_GLEXT_EAGER( ARB_clear_texture                );
     LOAD_GLEXT( ARB_texture_compression          );
     LOAD_GLEXT( ARB_texture_multisample          );
+    LOAD_GLEXT_EAGER( ARB_texture_storage              );
+    LOAD_GLEXT_EAGER( ARB_texture_storage_multisample  );
     LOAD_GLEXT( ARB_sampler_objects              );
 
     /* Load blending extensions */
@@ -700,21 +1019,24 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( EXT_blend_func_separate          );
     LOAD_GLEXT( EXT_blend_equation_separate      );
     LOAD_GLEXT( EXT_blend_color                  );
-    LOAD_GLEXT( ARB_draw_buffers_blend           );
+    LOAD_GLEXT_EAGER( ARB_draw_buffers_blend           );
 
     /* Load misc extensions */
     LOAD_GLEXT( ARB_viewport_array               );
     LOAD_GLEXT( ARB_occlusion_query              );
     LOAD_GLEXT( NV_conditional_render            );
-    LOAD_GLEXT( ARB_timer_query                  );
-    LOAD_GLEXT( ARB_multi_bind                   );
+    LOAD_GLEXT_EAGER( ARB_timer_query                  );
+    LOAD_GLEXT_EAGER( ARB_multi_bind                   );
     LOAD_GLEXT( EXT_stencil_two_side             );
     LOAD_GLEXT( KHR_debug                        );
-    LOAD_GLEXT( ARB_clip_control                 );
+    LOAD_GLEXT_EAGER( ARB_clip_control                 );
     LOAD_GLEXT( ARB_draw_buffers                 );
     LOAD_GLEXT( EXT_draw_buffers2                );
-    LOAD_GLEXT( EXT_transform_feedback           );
-    LOAD_GLEXT( NV_transform_feedback            );
+    LOAD_GLEXT_EAGER( EXT_transform_feedback           );
+    LOAD_GLEXT_EAGER( NV_transform_feedback            );
+    #ifdef GL_ARB_direct_state_access
+    LOAD_GLEXT_EAGER( ARB_direct_state_access          );
+    #endif
 
     /* Enable extensions without procedures */
     ENABLE_GLEXT( ARB_texture_cube_map             );
@@ -723,9 +1045,15 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( ARB_geometry_shader4             );
     ENABLE_GLEXT( NV_conservative_raster           );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
+    ENABLE_GLEXT( NVX_gpu_memory_info              );
+    ENABLE_GLEXT( ATI_meminfo                      );
 
     #undef LOAD_GLEXT
+    #undef LOAD_GLEXT_EAGER
     #undef ENABLE_GLEXT
+
+    if (!failedExtensions.empty())
+        Log::StdErr() << "failed to load OpenGL extensions: " << failedExtensions << std::endl;
     
     #endif
     
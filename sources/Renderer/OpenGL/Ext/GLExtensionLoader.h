@@ -10,32 +10,32 @@
 
 
 #include "../../GLCommon/GLExtensionRegistry.h"
-#include <string>
-#include <array>
-#include <map>
+#include <bitset>
 
 
 namespace LLGL
 {
 
 
-//! OpenGL extension map type.
-using GLExtensionList = std::map<std::string, bool>;
+//! OpenGL extension set type. Each bit specifies whether the respective GLExt entry is supported.
+using GLExtensionList = std::bitset<static_cast<std::size_t>(GLExt::Count)>;
 
 /* --- Common extension loading functions --- */
 
 /**
-Returns a hash-map with all supported OpenGL extensions.
-The hash-map can be used for faster single-extension queries.
+Returns the set of all supported OpenGL extensions that are part of the GLExt enumeration.
+The extension names are looked up in a perfect hash table, all other extensions are ignored.
 \param[in] coreProfile Specifies whether the extension are to be loaded via GL core profile or not.
 */
 GLExtensionList QueryExtensions(bool coreProfile);
 
 /**
-Loads all available extensions and prints errors if an extension is available,
-but their respective functions could not be loaded.
-\param[in,out] extensions Specifies the extension map. This can be queried by the "QueryExtensions" function.
-The respective entry will be set to true if all its functions have been loaded successfully.
+Loads all available extensions and prints a single error message for all extensions
+that are available, but whose functions could not be loaded.
+Most procedures are only resolved with their first call, so a missing procedure of these extensions
+will throw an exception when it is called instead of being reported here.
+\param[in,out] extensions Specifies the extension set. This can be queried by the "QueryExtensions" function.
+The respective bit will be cleared if the functions of an extension could not be loaded.
 \see QueryExtensions
 */
 void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile);
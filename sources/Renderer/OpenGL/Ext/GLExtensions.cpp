@@ -106,6 +106,17 @@ PFNGLTEXIMAGE3DMULTISAMPLEPROC                          glTexImage3DMultisample
 PFNGLGETMULTISAMPLEFVPROC                               glGetMultisamplefv                              = nullptr;
 PFNGLSAMPLEMASKIPROC                                    glSampleMaski                                   = nullptr;
 
+/* GL_ARB_texture_storage */
+
+PFNGLTEXSTORAGE1DPROC                                   glTexStorage1D                                  = nullptr;
+PFNGLTEXSTORAGE2DPROC                                   glTexStorage2D                                  = nullptr;
+PFNGLTEXSTORAGE3DPROC                                   glTexStorage3D                                  = nullptr;
+
+/* GL_ARB_texture_storage_multisample */
+
+PFNGLTEXSTORAGE2DMULTISAMPLEPROC                        glTexStorage2DMultisample                       = nullptr;
+PFNGLTEXSTORAGE3DMULTISAMPLEPROC                        glTexStorage3DMultisample                       = nullptr;
+
 /* GL_ARB_sampler_objects */
 
 PFNGLGENSAMPLERSPROC                                    glGenSamplers                                   = nullptr;
@@ -183,6 +194,15 @@ PFNGLGENERATEMIPMAPPROC                                 glGenerateMipmap
 PFNGLCLEARBUFFERFVPROC                                  glClearBufferfv                                 = nullptr;
 #endif
 
+/* GL_ARB_invalidate_subdata */
+
+PFNGLINVALIDATETEXSUBIMAGEPROC                          glInvalidateTexSubImage                         = nullptr;
+PFNGLINVALIDATETEXIMAGEPROC                             glInvalidateTexImage                            = nullptr;
+PFNGLINVALIDATEBUFFERSUBDATAPROC                        glInvalidateBufferSubData                       = nullptr;
+PFNGLINVALIDATEBUFFERDATAPROC                           glInvalidateBufferData                          = nullptr;
+PFNGLINVALIDATEFRAMEBUFFERPROC                          glInvalidateFramebuffer                         = nullptr;
+PFNGLINVALIDATESUBFRAMEBUFFERPROC                       glInvalidateSubFramebuffer                      = nullptr;
+
 /* GL_ARB_draw_instanced */
 
 PFNGLDRAWARRAYSINSTANCEDPROC                            glDrawArraysInstanced                           = nullptr;
@@ -199,6 +219,16 @@ PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC                glDrawArraysInstancedBas
 PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC              glDrawElementsInstancedBaseInstance             = nullptr;
 PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC    glDrawElementsInstancedBaseVertexBaseInstance   = nullptr;
 
+/* GL_ARB_draw_indirect */
+
+PFNGLDRAWARRAYSINDIRECTPROC                             glDrawArraysIndirect                            = nullptr;
+PFNGLDRAWELEMENTSINDIRECTPROC                           glDrawElementsIndirect                          = nullptr;
+
+/* GL_ARB_multi_draw_indirect */
+
+PFNGLMULTIDRAWARRAYSINDIRECTPROC                        glMultiDrawArraysIndirect                       = nullptr;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC                      glMultiDrawElementsIndirect                     = nullptr;
+
 /* GL_ARB_shader_objects */
 
 PFNGLCREATESHADERPROC                                   glCreateShader                                  = nullptr;
@@ -270,6 +300,32 @@ PFNGLBINDBUFFERBASEPROC                                 glBindBufferBase
 
 PFNGLSHADERSTORAGEBLOCKBINDINGPROC                      glShaderStorageBlockBinding                     = nullptr;
 
+/* GL_ARB_map_buffer_range */
+
+PFNGLMAPBUFFERRANGEPROC                                 glMapBufferRange                                = nullptr;
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC                         glFlushMappedBufferRange                        = nullptr;
+
+/* GL_ARB_sync */
+
+PFNGLFENCESYNCPROC                                      glFenceSync                                     = nullptr;
+PFNGLISSYNCPROC                                         glIsSync                                        = nullptr;
+PFNGLDELETESYNCPROC                                     glDeleteSync                                    = nullptr;
+PFNGLCLIENTWAITSYNCPROC                                 glClientWaitSync                                = nullptr;
+PFNGLWAITSYNCPROC                                       glWaitSync                                      = nullptr;
+
+/* GL_ARB_buffer_storage */
+
+PFNGLBUFFERSTORAGEPROC                                  glBufferStorage                                 = nullptr;
+
+/* GL_ARB_vertex_attrib_binding */
+
+PFNGLBINDVERTEXBUFFERPROC                               glBindVertexBuffer                              = nullptr;
+PFNGLVERTEXATTRIBFORMATPROC                             glVertexAttribFormat                            = nullptr;
+PFNGLVERTEXATTRIBIFORMATPROC                            glVertexAttribIFormat                           = nullptr;
+PFNGLVERTEXATTRIBLFORMATPROC                            glVertexAttribLFormat                           = nullptr;
+PFNGLVERTEXATTRIBBINDINGPROC                            glVertexAttribBinding                           = nullptr;
+PFNGLVERTEXBINDINGDIVISORPROC                           glVertexBindingDivisor                          = nullptr;
+
 /* GL_ARB_occlusion_query */
 
 PFNGLGENQUERIESPROC                                     glGenQueries                                    = nullptr;
@@ -327,6 +383,29 @@ PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC                    glTransformFeedbackVaryi
 PFNGLGETVARYINGLOCATIONNVPROC                           glGetVaryingLocationNV                          = nullptr;
 PFNGLGETACTIVEVARYINGNVPROC                             glGetActiveVaryingNV                            = nullptr;
 
+/* GL_ARB_direct_state_access */
+
+#ifdef GL_ARB_direct_state_access
+
+PFNGLCREATEBUFFERSPROC                                  glCreateBuffers                                 = nullptr;
+PFNGLNAMEDBUFFERDATAPROC                                glNamedBufferData                               = nullptr;
+PFNGLNAMEDBUFFERSUBDATAPROC                             glNamedBufferSubData                            = nullptr;
+PFNGLMAPNAMEDBUFFERPROC                                 glMapNamedBuffer                                = nullptr;
+PFNGLUNMAPNAMEDBUFFERPROC                               glUnmapNamedBuffer                              = nullptr;
+PFNGLTEXTURESUBIMAGE1DPROC                              glTextureSubImage1D                             = nullptr;
+PFNGLTEXTURESUBIMAGE2DPROC                              glTextureSubImage2D                             = nullptr;
+PFNGLTEXTURESUBIMAGE3DPROC                              glTextureSubImage3D                             = nullptr;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC                    glCompressedTextureSubImage1D                   = nullptr;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC                    glCompressedTextureSubImage2D                   = nullptr;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC                    glCompressedTextureSubImage3D                   = nullptr;
+PFNGLTEXTUREPARAMETERIPROC                              glTextureParameteri                             = nullptr;
+PFNGLGENERATETEXTUREMIPMAPPROC                          glGenerateTextureMipmap                         = nullptr;
+PFNGLGETTEXTUREIMAGEPROC                                glGetTextureImage                               = nullptr;
+PFNGLGETTEXTURELEVELPARAMETERIVPROC                     glGetTextureLevelParameteriv                    = nullptr;
+PFNGLGETTEXTUREPARAMETERIVPROC                          glGetTextureParameteriv                         = nullptr;
+
+#endif
+
 #endif // /ifndef(__APPLE__)
 
 
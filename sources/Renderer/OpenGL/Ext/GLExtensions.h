@@ -109,6 +109,17 @@ extern PFNGLTEXIMAGE3DMULTISAMPLEPROC                       glTexImage3DMultisam
 extern PFNGLGETMULTISAMPLEFVPROC                            glGetMultisamplefv;
 extern PFNGLSAMPLEMASKIPROC                                 glSampleMaski;
 
+/* GL_ARB_texture_storage */
+
+extern PFNGLTEXSTORAGE1DPROC                                glTexStorage1D;
+extern PFNGLTEXSTORAGE2DPROC                                glTexStorage2D;
+extern PFNGLTEXSTORAGE3DPROC                                glTexStorage3D;
+
+/* GL_ARB_texture_storage_multisample */
+
+extern PFNGLTEXSTORAGE2DMULTISAMPLEPROC                     glTexStorage2DMultisample;
+extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC                     glTexStorage3DMultisample;
+
 /* GL_ARB_sampler_objects */
 
 extern PFNGLGENSAMPLERSPROC                                 glGenSamplers;
@@ -186,6 +197,15 @@ extern PFNGLGENERATEMIPMAPPROC                              glGenerateMipmap;
 extern PFNGLCLEARBUFFERFVPROC                               glClearBufferfv;
 #endif
 
+/* GL_ARB_invalidate_subdata */
+
+extern PFNGLINVALIDATETEXSUBIMAGEPROC                       glInvalidateTexSubImage;
+extern PFNGLINVALIDATETEXIMAGEPROC                          glInvalidateTexImage;
+extern PFNGLINVALIDATEBUFFERSUBDATAPROC                     glInvalidateBufferSubData;
+extern PFNGLINVALIDATEBUFFERDATAPROC                        glInvalidateBufferData;
+extern PFNGLINVALIDATEFRAMEBUFFERPROC                       glInvalidateFramebuffer;
+extern PFNGLINVALIDATESUBFRAMEBUFFERPROC                    glInvalidateSubFramebuffer;
+
 /* GL_ARB_draw_instanced */
 
 extern PFNGLDRAWARRAYSINSTANCEDPROC                         glDrawArraysInstanced;
@@ -202,6 +222,16 @@ extern PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC             glDrawArraysInstance
 extern PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC           glDrawElementsInstancedBaseInstance;
 extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glDrawElementsInstancedBaseVertexBaseInstance;
 
+/* GL_ARB_draw_indirect */
+
+extern PFNGLDRAWARRAYSINDIRECTPROC                          glDrawArraysIndirect;
+extern PFNGLDRAWELEMENTSINDIRECTPROC                        glDrawElementsIndirect;
+
+/* GL_ARB_multi_draw_indirect */
+
+extern PFNGLMULTIDRAWARRAYSINDIRECTPROC                     glMultiDrawArraysIndirect;
+extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC                   glMultiDrawElementsIndirect;
+
 /* GL_ARB_shader_objects */
 
 extern PFNGLCREATESHADERPROC                                glCreateShader;
@@ -273,6 +303,32 @@ extern PFNGLBINDBUFFERBASEPROC                              glBindBufferBase;
 
 extern PFNGLSHADERSTORAGEBLOCKBINDINGPROC                   glShaderStorageBlockBinding;
 
+/* GL_ARB_map_buffer_range */
+
+extern PFNGLMAPBUFFERRANGEPROC                              glMapBufferRange;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC                      glFlushMappedBufferRange;
+
+/* GL_ARB_sync */
+
+extern PFNGLFENCESYNCPROC                                   glFenceSync;
+extern PFNGLISSYNCPROC                                      glIsSync;
+extern PFNGLDELETESYNCPROC                                  glDeleteSync;
+extern PFNGLCLIENTWAITSYNCPROC                              glClientWaitSync;
+extern PFNGLWAITSYNCPROC                                    glWaitSync;
+
+/* GL_ARB_buffer_storage */
+
+extern PFNGLBUFFERSTORAGEPROC                               glBufferStorage;
+
+/* GL_ARB_vertex_attrib_binding */
+
+extern PFNGLBINDVERTEXBUFFERPROC                            glBindVertexBuffer;
+extern PFNGLVERTEXATTRIBFORMATPROC                          glVertexAttribFormat;
+extern PFNGLVERTEXATTRIBIFORMATPROC                         glVertexAttribIFormat;
+extern PFNGLVERTEXATTRIBLFORMATPROC                         glVertexAttribLFormat;
+extern PFNGLVERTEXATTRIBBINDINGPROC                         glVertexAttribBinding;
+extern PFNGLVERTEXBINDINGDIVISORPROC                        glVertexBindingDivisor;
+
 /* GL_ARB_occlusion_query */
 
 extern PFNGLGENQUERIESPROC                                  glGenQueries;
@@ -329,6 +385,29 @@ extern PFNGLENDTRANSFORMFEEDBACKNVPROC                      glEndTransformFeedba
 extern PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC                 glTransformFeedbackVaryingsNV;
 extern PFNGLGETVARYINGLOCATIONNVPROC                        glGetVaryingLocationNV;
 extern PFNGLGETACTIVEVARYINGNVPROC                          glGetActiveVaryingNV;
+
+/* GL_ARB_direct_state_access */
+
+#ifdef GL_ARB_direct_state_access
+
+extern PFNGLCREATEBUFFERSPROC                               glCreateBuffers;
+extern PFNGLNAMEDBUFFERDATAPROC                             glNamedBufferData;
+extern PFNGLNAMEDBUFFERSUBDATAPROC                          glNamedBufferSubData;
+extern PFNGLMAPNAMEDBUFFERPROC                              glMapNamedBuffer;
+extern PFNGLUNMAPNAMEDBUFFERPROC                            glUnmapNamedBuffer;
+extern PFNGLTEXTURESUBIMAGE1DPROC                           glTextureSubImage1D;
+extern PFNGLTEXTURESUBIMAGE2DPROC                           glTextureSubImage2D;
+extern PFNGLTEXTURESUBIMAGE3DPROC                           glTextureSubImage3D;
+extern PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC                 glCompressedTextureSubImage1D;
+extern PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC                 glCompressedTextureSubImage2D;
+extern PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC                 glCompressedTextureSubImage3D;
+extern PFNGLTEXTUREPARAMETERIPROC                           glTextureParameteri;
+extern PFNGLGENERATETEXTUREMIPMAPPROC                       glGenerateTextureMipmap;
+extern PFNGLGETTEXTUREIMAGEPROC                             glGetTextureImage;
+extern PFNGLGETTEXTURELEVELPARAMETERIVPROC                  glGetTextureLevelParameteriv;
+extern PFNGLGETTEXTUREPARAMETERIVPROC                       glGetTextureParameteriv;
+
+#endif
     
 #endif
 
@@ -139,6 +139,17 @@ DECL_GLPROC(void, glTexImage3DMultisample, (GLenum, GLsizei, GLenum, GLsizei, GL
 DECL_GLPROC(void, glGetMultisamplefv, (GLenum, GLuint, GLfloat*));
 DECL_GLPROC(void, glSampleMaski, (GLuint, GLbitfield));
 
+/* GL_ARB_texture_storage */
+
+DECL_GLPROC(void, glTexStorage1D, (GLenum, GLsizei, GLenum, GLsizei));
+DECL_GLPROC(void, glTexStorage2D, (GLenum, GLsizei, GLenum, GLsizei, GLsizei));
+DECL_GLPROC(void, glTexStorage3D, (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei));
+
+/* GL_ARB_texture_storage_multisample */
+
+DECL_GLPROC(void, glTexStorage2DMultisample, (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean));
+DECL_GLPROC(void, glTexStorage3DMultisample, (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei, GLboolean));
+
 /* GL_ARB_sampler_objects */
 
 DECL_GLPROC(void, glGenSamplers, (GLsizei, GLuint*));
@@ -216,6 +227,15 @@ DECL_GLPROC(void, glGenerateMipmap, (GLenum));
 DECL_GLPROC(void, glClearBufferfv, (GLenum, GLint, const GLfloat*));
 #endif
 
+/* GL_ARB_invalidate_subdata */
+
+DECL_GLPROC(void, glInvalidateTexSubImage, (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei));
+DECL_GLPROC(void, glInvalidateTexImage, (GLuint, GLint));
+DECL_GLPROC(void, glInvalidateBufferSubData, (GLuint, GLintptr, GLsizeiptr));
+DECL_GLPROC(void, glInvalidateBufferData, (GLuint));
+DECL_GLPROC(void, glInvalidateFramebuffer, (GLenum, GLsizei, const GLenum*));
+DECL_GLPROC(void, glInvalidateSubFramebuffer, (GLenum, GLsizei, const GLenum*, GLint, GLint, GLsizei, GLsizei));
+
 /* GL_ARB_draw_instanced */
 
 DECL_GLPROC(void, glDrawArraysInstanced, (GLenum, GLint, GLsizei, GLsizei));
@@ -232,6 +252,16 @@ DECL_GLPROC(void, glDrawArraysInstancedBaseInstance, (GLenum, GLint, GLsizei, GL
 DECL_GLPROC(void, glDrawElementsInstancedBaseInstance, (GLenum, GLsizei, GLenum, const void*, GLsizei, GLuint));
 DECL_GLPROC(void, glDrawElementsInstancedBaseVertexBaseInstance, (GLenum, GLsizei, GLenum, const void*, GLsizei, GLint, GLuint));
 
+/* GL_ARB_draw_indirect */
+
+DECL_GLPROC(void, glDrawArraysIndirect, (GLenum, const void*));
+DECL_GLPROC(void, glDrawElementsIndirect, (GLenum, GLenum, const void*));
+
+/* GL_ARB_multi_draw_indirect */
+
+DECL_GLPROC(void, glMultiDrawArraysIndirect, (GLenum, const void*, GLsizei, GLsizei));
+DECL_GLPROC(void, glMultiDrawElementsIndirect, (GLenum, GLenum, const void*, GLsizei, GLsizei));
+
 /* GL_ARB_shader_objects */
 
 DECL_GLPROC(GLuint, glCreateShader, (GLenum));
@@ -303,6 +333,32 @@ DECL_GLPROC(void, glBindBufferBase, (GLenum, GLuint, GLuint));
 
 DECL_GLPROC(void, glShaderStorageBlockBinding, (GLuint, GLuint, GLuint));
 
+/* GL_ARB_map_buffer_range */
+
+DECL_GLPROC(void*, glMapBufferRange, (GLenum, GLintptr, GLsizeiptr, GLbitfield));
+DECL_GLPROC(void, glFlushMappedBufferRange, (GLenum, GLintptr, GLsizeiptr));
+
+/* GL_ARB_sync */
+
+DECL_GLPROC(GLsync, glFenceSync, (GLenum, GLbitfield));
+DECL_GLPROC(GLboolean, glIsSync, (GLsync));
+DECL_GLPROC(void, glDeleteSync, (GLsync));
+DECL_GLPROC(GLenum, glClientWaitSync, (GLsync, GLbitfield, GLuint64));
+DECL_GLPROC(void, glWaitSync, (GLsync, GLbitfield, GLuint64));
+
+/* GL_ARB_buffer_storage */
+
+DECL_GLPROC(void, glBufferStorage, (GLenum, GLsizeiptr, const void*, GLbitfield));
+
+/* GL_ARB_vertex_attrib_binding */
+
+DECL_GLPROC(void, glBindVertexBuffer, (GLuint, GLuint, GLintptr, GLsizei));
+DECL_GLPROC(void, glVertexAttribFormat, (GLuint, GLint, GLenum, GLboolean, GLuint));
+DECL_GLPROC(void, glVertexAttribIFormat, (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(void, glVertexAttribLFormat, (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(void, glVertexAttribBinding, (GLuint, GLuint));
+DECL_GLPROC(void, glVertexBindingDivisor, (GLuint, GLuint));
+
 /* GL_ARB_occlusion_query */
 
 DECL_GLPROC(void, glGenQueries, (GLsizei, GLuint*));
@@ -360,6 +416,29 @@ DECL_GLPROC(void, glTransformFeedbackVaryingsNV, (GLuint, GLsizei, const GLint*,
 DECL_GLPROC(GLint, glGetVaryingLocationNV, (GLuint, const GLchar*));
 DECL_GLPROC(void, glGetActiveVaryingNV, (GLuint, GLuint, GLsizei, GLsizei*, GLsizei*, GLenum*, GLchar*));
 
+/* GL_ARB_direct_state_access */
+
+#ifdef GL_ARB_direct_state_access
+
+DECL_GLPROC(void, glCreateBuffers, (GLsizei, GLuint*));
+DECL_GLPROC(void, glNamedBufferData, (GLuint, GLsizeiptr, const void*, GLenum));
+DECL_GLPROC(void, glNamedBufferSubData, (GLuint, GLintptr, GLsizeiptr, const void*));
+DECL_GLPROC(void*, glMapNamedBuffer, (GLuint, GLenum));
+DECL_GLPROC(GLboolean, glUnmapNamedBuffer, (GLuint));
+DECL_GLPROC(void, glTextureSubImage1D, (GLuint, GLint, GLint, GLsizei, GLenum, GLenum, const void*));
+DECL_GLPROC(void, glTextureSubImage2D, (GLuint, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void*));
+DECL_GLPROC(void, glTextureSubImage3D, (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void*));
+DECL_GLPROC(void, glCompressedTextureSubImage1D, (GLuint, GLint, GLint, GLsizei, GLenum, GLsizei, const void*));
+DECL_GLPROC(void, glCompressedTextureSubImage2D, (GLuint, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLsizei, const void*));
+DECL_GLPROC(void, glCompressedTextureSubImage3D, (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLsizei, const void*));
+DECL_GLPROC(void, glTextureParameteri, (GLuint, GLenum, GLint));
+DECL_GLPROC(void, glGenerateTextureMipmap, (GLuint));
+DECL_GLPROC(void, glGetTextureImage, (GLuint, GLint, GLenum, GLenum, GLsizei, void*));
+DECL_GLPROC(void, glGetTextureLevelParameteriv, (GLuint, GLint, GLenum, GLint*));
+DECL_GLPROC(void, glGetTextureParameteriv, (GLuint, GLenum, GLint*));
+
+#endif
+
 #endif // /ifndef(__APPLE__)
 
 #undef DECL_GLPROC
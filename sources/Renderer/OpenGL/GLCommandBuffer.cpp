@@ -30,6 +30,10 @@
 #include "RenderState/GLGraphicsPipeline.h"
 #include "RenderState/GLComputePipeline.h"
 #include "RenderState/GLQuery.h"
+#include "RenderState/GLFence.h"
+#include "RenderState/GLResourceHeap.h"
+
+#include <algorithm>
 
 
 namespace LLGL
@@ -37,7 +41,8 @@ namespace LLGL
 
 
 GLCommandBuffer::GLCommandBuffer(const std::shared_ptr<GLStateManager>& stateMngr) :
-    stateMngr_ { stateMngr }
+    stateMngr_     { stateMngr                      },
+    dispatchTable_ { stateMngr->GetDispatchTable()  }
 {
 }
 
@@ -61,23 +66,23 @@ void GLCommandBuffer::SetViewport(const Viewport& viewport)
 
 void GLCommandBuffer::SetViewportArray(unsigned int numViewports, const Viewport* viewportArray)
 {
-    /* Setup GL viewports and depth-ranges */
-    std::vector<GLViewport> viewportsGL;
-    viewportsGL.reserve(numViewports);
+    if (numViewports > GLStateManager::maxNumViewports)
+        throw std::invalid_argument("number of viewports exceeds limit of GL_MAX_VIEWPORTS");
 
-    std::vector<GLDepthRange> depthRangesGL;
-    depthRangesGL.reserve(numViewports);
+    /* Setup GL viewports and depth-ranges in local storage */
+    std::array<GLViewport, GLStateManager::maxNumViewports> viewportsGL;
+    std::array<GLDepthRange, GLStateManager::maxNumViewports> depthRangesGL;
 
     for (unsigned int i = 0; i < numViewports; ++i)
     {
         const auto& vp = viewportArray[i];
-        viewportsGL.push_back({ vp.x, vp.y, vp.width, vp.height });
-        depthRangesGL.push_back({ static_cast<GLdouble>(vp.minDepth), static_cast<GLdouble>(vp.maxDepth) });
+        viewportsGL[i] = { vp.x, vp.y, vp.width, vp.height };
+        depthRangesGL[i] = { static_cast<GLdouble>(vp.minDepth), static_cast<GLdouble>(vp.maxDepth) };
     }
 
     /* Submit viewports and depth-ranges to state manager */
-    stateMngr_->SetViewportArray(std::move(viewportsGL));
-    stateMngr_->SetDepthRangeArray(std::move(depthRangesGL));
+    stateMngr_->SetViewportArray(static_cast<GLsizei>(numViewports), viewportsGL.data());
+    stateMngr_->SetDepthRangeArray(static_cast<GLsizei>(numViewports), depthRangesGL.data());
 }
 
 void GLCommandBuffer::SetScissor(const Scissor& scissor)
@@ -89,23 +94,29 @@ void GLCommandBuffer::SetScissor(const Scissor& scissor)
 
 void GLCommandBuffer::SetScissorArray(unsigned int numScissors, const Scissor* scissorArray)
 {
-    /* Setup GL scissors */
-    std::vector<GLScissor> scissorsGL;
-    scissorsGL.reserve(numScissors);
+    if (numScissors > GLStateManager::maxNumViewports)
+        throw std::invalid_argument("number of scissors exceeds limit of GL_MAX_VIEWPORTS");
+
+    /* Setup GL scissors in local storage */
+    std::array<GLScissor, GLStateManager::maxNumViewports> scissorsGL;
 
     for (unsigned int i = 0; i < numScissors; ++i)
     {
         const auto& sc = scissorArray[i];
-        scissorsGL.push_back({ sc.x, sc.y, sc.width, sc.height });
+        scissorsGL[i] = { sc.x, sc.y, sc.width, sc.height };
     }
 
     /* Submit scissors to state manager */
-    stateMngr_->SetScissorArray(std::move(scissorsGL));
+    stateMngr_->SetScissorArray(static_cast<GLsizei>(numScissors), scissorsGL.data());
 }
 
 void GLCommandBuffer::SetClearColor(const ColorRGBAf& color)
 {
     glClearColor(color.r, color.g, color.b, color.a);
+    clearColor_[0] = color.r;
+    clearColor_[1] = color.g;
+    clearColor_[2] = color.b;
+    clearColor_[3] = color.a;
 }
 
 void GLCommandBuffer::SetClearDepth(float depth)
@@ -157,6 +168,10 @@ void GLCommandBuffer::SetVertexBuffer(Buffer& buffer)
     /* Bind vertex buffer */
     auto& vertexBufferGL = LLGL_CAST(GLVertexBuffer&, buffer);
     stateMngr_->BindVertexArray(vertexBufferGL.GetVaoID());
+
+    /* Bind buffer to the shared VAO of its vertex format (no-op if it is already bound) */
+    if (auto sharedVao = vertexBufferGL.GetSharedVertexArray())
+        sharedVao->BindVertexBuffer(0, vertexBufferGL.GetID());
 }
 
 void GLCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
@@ -164,6 +179,14 @@ void GLCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
     /* Bind vertex buffer */
     auto& vertexBufferArrayGL = LLGL_CAST(GLVertexBufferArray&, bufferArray);
     stateMngr_->BindVertexArray(vertexBufferArrayGL.GetVaoID());
+
+    /* Bind each buffer to its binding point of the shared VAO */
+    if (auto sharedVao = vertexBufferArrayGL.GetSharedVertexArray())
+    {
+        const auto& vertexBufferIDs = vertexBufferArrayGL.GetVertexBufferIDs();
+        for (GLuint i = 0, n = static_cast<GLuint>(vertexBufferIDs.size()); i < n; ++i)
+            sharedVao->BindVertexBuffer(i, vertexBufferIDs[i]);
+    }
 }
 
 void GLCommandBuffer::SetIndexBuffer(Buffer& buffer)
@@ -210,30 +233,12 @@ void GLCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
 
 void GLCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
 {
-    #ifdef __APPLE__
-    glBeginTransformFeedback(GLTypes::Map(primitiveType));
-    #else
-    if (HasExtension(GLExt::EXT_transform_feedback))
-        glBeginTransformFeedback(GLTypes::Map(primitiveType));
-    else if (HasExtension(GLExt::NV_transform_feedback))
-        glBeginTransformFeedbackNV(GLTypes::Map(primitiveType));
-    else
-        ThrowNotSupported("stream-outputs");
-    #endif
+    dispatchTable_.beginTransformFeedback(GLTypes::Map(primitiveType));
 }
 
 void GLCommandBuffer::EndStreamOutput()
 {
-    #ifdef __APPLE__
-    glEndTransformFeedback();
-    #else
-    if (HasExtension(GLExt::EXT_transform_feedback))
-        glEndTransformFeedback();
-    else if (HasExtension(GLExt::NV_transform_feedback))
-        glEndTransformFeedbackNV();
-    else
-        ThrowNotSupported("stream-outputs");
-    #endif
+    dispatchTable_.endTransformFeedback();
 }
 
 /* ----- Textures ----- */
@@ -242,8 +247,7 @@ void GLCommandBuffer::SetTexture(Texture& texture, unsigned int slot, long /*sha
 {
     /* Bind texture to layer */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
-    stateMngr_->ActiveTexture(slot);
-    stateMngr_->BindTexture(textureGL);
+    stateMngr_->BindTexture(slot, textureGL);
 }
 
 void GLCommandBuffer::SetTextureArray(TextureArray& textureArray, unsigned int startSlot, long /*shaderStageFlags*/)
@@ -276,16 +280,99 @@ void GLCommandBuffer::SetSamplerArray(SamplerArray& samplerArray, unsigned int s
     );
 }
 
+/* ----- Resource Heaps ----- */
+
+void GLCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap)
+{
+    auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
+    resourceHeapGL.Bind(*stateMngr_);
+}
+
 /* ----- Render Targets ----- */
 
 //private
 void GLCommandBuffer::BlitBoundRenderTarget()
 {
     if (boundRenderTarget_)
-        boundRenderTarget_->BlitOntoFrameBuffer();
+        boundRenderTarget_->BlitOntoFrameBuffer(hasRenderPass_ ? &storeOps_ : nullptr);
+    else if (boundRenderContext_)
+        boundRenderContext_->InvalidateDiscardedAttachments();
+
+    hasRenderPass_ = false;
 }
 
-void GLCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
+//private
+void GLCommandBuffer::BeginRenderPass(const RenderPassDescriptor& renderPassDesc, std::size_t numColorAttachments, bool defaultFramebuffer)
+{
+    GLenum invalidAttachments[GLRenderTarget::maxNumColorAttachments + 2];
+    GLsizei numInvalidAttachments = 0;
+    GLbitfield clearMask = 0;
+
+    /* Gather color attachments to invalidate and to clear */
+    auto numColorOps = std::min(numColorAttachments, renderPassDesc.colorAttachments.size());
+    std::size_t numColorClears = 0;
+
+    for (std::size_t i = 0; i < numColorOps; ++i)
+    {
+        const auto loadOp = renderPassDesc.colorAttachments[i].loadOp;
+        if (loadOp == AttachmentLoadOp::DontCare)
+            invalidAttachments[numInvalidAttachments++] = (defaultFramebuffer ? GL_COLOR : GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i));
+        else if (loadOp == AttachmentLoadOp::Clear)
+            ++numColorClears;
+    }
+
+    if (numColorClears == numColorAttachments && numColorClears > 0)
+    {
+        /* Clear all color attachments with a single clear command */
+        clearMask |= GL_COLOR_BUFFER_BIT;
+    }
+    else if (numColorClears > 0)
+    {
+        /* Clear individual color attachments */
+        for (std::size_t i = 0; i < numColorOps; ++i)
+        {
+            if (renderPassDesc.colorAttachments[i].loadOp == AttachmentLoadOp::Clear)
+                glClearBufferfv(GL_COLOR, static_cast<GLint>(i), clearColor_);
+        }
+    }
+
+    /* Gather depth and stencil attachments to invalidate and to clear */
+    if (renderPassDesc.depthAttachment.loadOp == AttachmentLoadOp::DontCare)
+        invalidAttachments[numInvalidAttachments++] = (defaultFramebuffer ? GL_DEPTH : GL_DEPTH_ATTACHMENT);
+    else if (renderPassDesc.depthAttachment.loadOp == AttachmentLoadOp::Clear)
+    {
+        stateMngr_->SetDepthMask(GL_TRUE);
+        clearMask |= GL_DEPTH_BUFFER_BIT;
+    }
+
+    if (renderPassDesc.stencilAttachment.loadOp == AttachmentLoadOp::DontCare)
+        invalidAttachments[numInvalidAttachments++] = (defaultFramebuffer ? GL_STENCIL : GL_STENCIL_ATTACHMENT);
+    else if (renderPassDesc.stencilAttachment.loadOp == AttachmentLoadOp::Clear)
+        clearMask |= GL_STENCIL_BUFFER_BIT;
+
+    /* Invalidate attachments whose previous content is not needed, then clear the remaining attachments at once */
+    GLFramebuffer::Invalidate(GL_DRAW_FRAMEBUFFER, numInvalidAttachments, invalidAttachments);
+
+    if (clearMask != 0)
+        glClear(clearMask);
+
+    /* Keep the store operations to apply them when the render pass ends */
+    if (defaultFramebuffer)
+        boundRenderContext_->SetDiscardedAttachments(renderPassDesc);
+    else
+    {
+        storeOps_.numColorOps = numColorOps;
+        for (std::size_t i = 0; i < numColorOps; ++i)
+            storeOps_.colorOps[i] = renderPassDesc.colorAttachments[i].storeOp;
+
+        storeOps_.depthOp   = renderPassDesc.depthAttachment.storeOp;
+        storeOps_.stencilOp = renderPassDesc.stencilAttachment.storeOp;
+
+        hasRenderPass_ = true;
+    }
+}
+
+void GLCommandBuffer::SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc)
 {
     /* Blit previously bound render target (in case mutli-sampling is used) */
     BlitBoundRenderTarget();
@@ -298,10 +385,15 @@ void GLCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
     stateMngr_->NotifyRenderTargetHeight(renderTarget.GetResolution().y);
 
     /* Store current render target */
-    boundRenderTarget_ = &renderTargetGL;
+    boundRenderTarget_  = &renderTargetGL;
+    boundRenderContext_ = nullptr;
+
+    /* Apply load operations of render pass */
+    if (renderPassDesc)
+        BeginRenderPass(*renderPassDesc, renderTargetGL.GetNumColorAttachments(), false);
 }
 
-void GLCommandBuffer::SetRenderTarget(RenderContext& renderContext)
+void GLCommandBuffer::SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc)
 {
     auto& renderContextGL = LLGL_CAST(GLRenderContext&, renderContext);
 
@@ -317,8 +409,13 @@ void GLCommandBuffer::SetRenderTarget(RenderContext& renderContext)
     */
     GLRenderContext::GLMakeCurrent(&renderContextGL);
 
-    /* Reset reference to render target */
-    boundRenderTarget_ = nullptr;
+    /* Store current render context and reset reference to render target */
+    boundRenderTarget_  = nullptr;
+    boundRenderContext_ = &renderContextGL;
+
+    /* Apply load operations of render pass (store operations are applied by the render context, at the latest in "Present") */
+    if (renderPassDesc)
+        BeginRenderPass(*renderPassDesc, 1, true);
 }
 
 /* ----- Pipeline States ----- */
@@ -438,15 +535,13 @@ void GLCommandBuffer::DrawInstanced(unsigned int numVertices, unsigned int first
 
 void GLCommandBuffer::DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset)
 {
-    #ifndef __APPLE__
-    glDrawArraysInstancedBaseInstance(
+    dispatchTable_.drawArraysInstancedBaseInstance(
         renderState_.drawMode,
         static_cast<GLint>(firstVertex),
         static_cast<GLsizei>(numVertices),
         static_cast<GLsizei>(numInstances),
         instanceOffset
     );
-    #endif
 }
 
 void GLCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex)
@@ -474,8 +569,7 @@ void GLCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned in
 
 void GLCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset)
 {
-    #ifndef __APPLE__
-    glDrawElementsInstancedBaseVertexBaseInstance(
+    dispatchTable_.drawElementsInstancedBaseVertexBaseInstance(
         renderState_.drawMode,
         static_cast<GLsizei>(numVertices),
         renderState_.indexBufferDataType,
@@ -484,7 +578,54 @@ void GLCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned in
         vertexOffset,
         instanceOffset
     );
-    #endif
+}
+
+static void BindIndirectBuffer(GLStateManager& stateMngr, GLBufferTarget target, Buffer& buffer)
+{
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    stateMngr.BindBuffer(target, bufferGL.GetID());
+}
+
+void GLCommandBuffer::DrawIndirect(Buffer& buffer, unsigned int offset)
+{
+    BindIndirectBuffer(*stateMngr_, GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer);
+    glDrawArraysIndirect(
+        renderState_.drawMode,
+        reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset))
+    );
+}
+
+void GLCommandBuffer::DrawIndexedIndirect(Buffer& buffer, unsigned int offset)
+{
+    BindIndirectBuffer(*stateMngr_, GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer);
+    glDrawElementsIndirect(
+        renderState_.drawMode,
+        renderState_.indexBufferDataType,
+        reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset))
+    );
+}
+
+void GLCommandBuffer::MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    BindIndirectBuffer(*stateMngr_, GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer);
+    dispatchTable_.multiDrawArraysIndirect(
+        renderState_.drawMode,
+        reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset)),
+        static_cast<GLsizei>(numCommands),
+        static_cast<GLsizei>(stride)
+    );
+}
+
+void GLCommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    BindIndirectBuffer(*stateMngr_, GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer);
+    dispatchTable_.multiDrawElementsIndirect(
+        renderState_.drawMode,
+        renderState_.indexBufferDataType,
+        reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(offset)),
+        static_cast<GLsizei>(numCommands),
+        static_cast<GLsizei>(stride)
+    );
 }
 
 /* ----- Compute ----- */
@@ -496,8 +637,22 @@ void GLCommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY,
     #endif
 }
 
+void GLCommandBuffer::DispatchIndirect(Buffer& buffer, unsigned int offset)
+{
+    #ifndef __APPLE__
+    BindIndirectBuffer(*stateMngr_, GLBufferTarget::DISPATCH_INDIRECT_BUFFER, buffer);
+    glDispatchComputeIndirect(static_cast<GLintptr>(offset));
+    #endif
+}
+
 /* ----- Misc ----- */
 
+void GLCommandBuffer::SignalFence(Fence& fence)
+{
+    auto& fenceGL = LLGL_CAST(GLFence&, fence);
+    fenceGL.Signal();
+}
+
 void GLCommandBuffer::SyncGPU()
 {
     glFinish();
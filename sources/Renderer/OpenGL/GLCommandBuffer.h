@@ -11,6 +11,7 @@
 
 #include <LLGL/CommandBuffer.h>
 #include "RenderState/GLState.h"
+#include "Texture/GLRenderTarget.h"
 #include "OpenGL.h"
 
 
@@ -18,8 +19,9 @@ namespace LLGL
 {
 
 
-class GLRenderTarget;
+class GLRenderContext;
 class GLStateManager;
+struct GLDispatchTable;
 
 class GLCommandBuffer : public CommandBuffer
 {
@@ -76,10 +78,14 @@ class GLCommandBuffer : public CommandBuffer
         void SetSampler(Sampler& sampler, unsigned int layer, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetSamplerArray(SamplerArray& samplerArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
 
+        /* ----- Resource Heaps ----- */
+
+        void SetResourceHeap(ResourceHeap& resourceHeap) override;
+
         /* ----- Render Targets ----- */
 
-        void SetRenderTarget(RenderTarget& renderTarget) override;
-        void SetRenderTarget(RenderContext& renderContext) override;
+        void SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc = nullptr) override;
+        void SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc = nullptr) override;
 
         /* ----- Pipeline States ----- */
 
@@ -110,12 +116,21 @@ class GLCommandBuffer : public CommandBuffer
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset) override;
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) override;
 
+        void DrawIndirect(Buffer& buffer, unsigned int offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, unsigned int offset) override;
+
+        void MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+        void MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, unsigned int offset) override;
 
         /* ----- Misc ----- */
 
+        void SignalFence(Fence& fence) override;
+
         void SyncGPU() override;
 
     private:
@@ -130,13 +145,25 @@ class GLCommandBuffer : public CommandBuffer
         void SetGenericBuffer(const GLBufferTarget bufferTarget, Buffer& buffer, unsigned int slot);
         void SetGenericBufferArray(const GLBufferTarget bufferTarget, BufferArray& bufferArray, unsigned int startSlot);
 
-        // Blits the currently bound render target
+        // Blits the currently bound render target and applies the store operations of the active render pass
         void BlitBoundRenderTarget();
 
+        // Applies the load operations of the specified render pass to the bound framebuffer
+        void BeginRenderPass(const RenderPassDescriptor& renderPassDesc, std::size_t numColorAttachments, bool defaultFramebuffer);
+
         std::shared_ptr<GLStateManager> stateMngr_;
+        const GLDispatchTable&          dispatchTable_;     // Dispatch table of the state manager's GL context
         RenderState                     renderState_;
 
         GLRenderTarget*                 boundRenderTarget_  = nullptr;
+        GLRenderContext*                boundRenderContext_ = nullptr;
+
+        // Store operations of the active render pass on the bound render target (store operations on the default framebuffer are kept by the render context)
+        GLRenderTarget::StoreOps        storeOps_;
+        bool                            hasRenderPass_      = false;
+
+        // Clear color is tracked to clear individual color attachments in a render pass
+        GLfloat                         clearColor_[4]      = { 0.0f, 0.0f, 0.0f, 0.0f };
 
 };
 
@@ -6,6 +6,11 @@
  */
 
 #include "GLRenderContext.h"
+#include "Texture/GLFramebuffer.h"
+
+#ifdef __linux__
+#include "Platform/Linux/LinuxOffscreenSurface.h"
+#endif
 
 
 namespace LLGL
@@ -18,13 +23,27 @@ GLRenderContext::GLRenderContext(RenderContextDescriptor desc, const std::shared
 {
     #ifdef __linux__
 
-    /* Setup surface for the render context and pass native context handle */
-    NativeContextHandle windowContext;
-    GetNativeContextHandle(windowContext);
-    SetOrCreateSurface(surface, desc.videoMode, &windowContext);
+    if (desc.profileOpenGL.headless)
+    {
+        /* Setup offscreen surface for the headless context, which requires no X11 display */
+        if (surface)
+            SetOrCreateSurface(surface, desc.videoMode, nullptr);
+        else
+            SetOrCreateSurface(std::make_shared<LinuxOffscreenSurface>(desc.videoMode.resolution), desc.videoMode, nullptr);
+    }
+    else
+    {
+        /* Setup surface for the render context and pass native context handle */
+        NativeContextHandle windowContext;
+        GetNativeContextHandle(windowContext);
+        SetOrCreateSurface(surface, desc.videoMode, &windowContext);
+    }
 
     #else
 
+    if (desc.profileOpenGL.headless)
+        throw std::runtime_error("headless OpenGL contexts are only supported on Linux");
+
     /* Setup surface for the render context */
     SetOrCreateSurface(surface, desc.videoMode, nullptr);
 
@@ -47,6 +66,8 @@ GLRenderContext::GLRenderContext(RenderContextDescriptor desc, const std::shared
 
 void GLRenderContext::Present()
 {
+    /* End the render pass on the default framebuffer before its buffers are swapped */
+    InvalidateDiscardedAttachments();
     context_->SwapBuffers();
 }
 
@@ -77,6 +98,27 @@ void GLRenderContext::SetVsync(const VsyncDescriptor& vsyncDesc)
     }
 }
 
+void GLRenderContext::SetDiscardedAttachments(const RenderPassDescriptor& renderPassDesc)
+{
+    numDiscardedAttachments_ = 0;
+
+    if (!renderPassDesc.colorAttachments.empty() && renderPassDesc.colorAttachments.front().storeOp == AttachmentStoreOp::Discard)
+        discardedAttachments_[numDiscardedAttachments_++] = GL_COLOR;
+    if (renderPassDesc.depthAttachment.storeOp == AttachmentStoreOp::Discard)
+        discardedAttachments_[numDiscardedAttachments_++] = GL_DEPTH;
+    if (renderPassDesc.stencilAttachment.storeOp == AttachmentStoreOp::Discard)
+        discardedAttachments_[numDiscardedAttachments_++] = GL_STENCIL;
+}
+
+void GLRenderContext::InvalidateDiscardedAttachments()
+{
+    if (numDiscardedAttachments_ > 0)
+    {
+        GLFramebuffer::Invalidate(GL_DRAW_FRAMEBUFFER, numDiscardedAttachments_, discardedAttachments_);
+        numDiscardedAttachments_ = 0;
+    }
+}
+
 bool GLRenderContext::GLMakeCurrent(GLRenderContext* renderContext)
 {
     if (renderContext)
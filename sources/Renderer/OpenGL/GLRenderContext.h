@@ -11,6 +11,7 @@
 
 #include <LLGL/Window.h>
 #include <LLGL/RenderContext.h>
+#include <LLGL/RenderPassFlags.h>
 #include "OpenGL.h"
 #include "RenderState/GLStateManager.h"
 #include "Platform/GLContext.h"
@@ -52,6 +53,15 @@ class GLRenderContext : public RenderContext
             return stateMngr_;
         }
 
+        /*
+        Stores which attachments of the default framebuffer are discarded by the store operations of the specified render pass.
+        These attachments are invalidated when the render pass ends, at the latest before the buffers are swapped in "Present".
+        */
+        void SetDiscardedAttachments(const RenderPassDescriptor& renderPassDesc);
+
+        // Invalidates the discarded attachments of the default framebuffer (if any), which must be bound as draw framebuffer.
+        void InvalidateDiscardedAttachments();
+
     private:
 
         struct RenderState
@@ -77,6 +87,10 @@ class GLRenderContext : public RenderContext
 
         GLint                           contextHeight_      = 0;
 
+        // Attachments of the default framebuffer, which are discarded by the active render pass (GL_COLOR, GL_DEPTH, GL_STENCIL)
+        GLenum                          discardedAttachments_[3];
+        GLsizei                         numDiscardedAttachments_    = 0;
+
 };
 
 
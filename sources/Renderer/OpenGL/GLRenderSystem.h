@@ -12,12 +12,15 @@
 #include <LLGL/RenderSystem.h>
 #include "Ext/GLExtensionLoader.h"
 #include "../ContainerTypes.h"
+#include "../MemoryAccounting.h"
 
 #include "GLCommandBuffer.h"
 #include "GLRenderContext.h"
 
 #include "Buffer/GLBuffer.h"
 #include "Buffer/GLBufferArray.h"
+#include "Buffer/GLStagingBufferRing.h"
+#include "Buffer/GLVertexArrayCache.h"
 
 #include "Shader/GLShader.h"
 #include "Shader/GLShaderProgram.h"
@@ -27,10 +30,13 @@
 #include "Texture/GLSampler.h"
 #include "Texture/GLSamplerArray.h"
 #include "Texture/GLRenderTarget.h"
+#include "Texture/GLTextureReadbackQueue.h"
 
 #include "RenderState/GLQuery.h"
+#include "RenderState/GLFence.h"
 #include "RenderState/GLGraphicsPipeline.h"
 #include "RenderState/GLComputePipeline.h"
+#include "RenderState/GLResourceHeap.h"
 
 #include <string>
 #include <memory>
@@ -58,6 +64,8 @@ class GLRenderSystem : public RenderSystem
 
         void SetConfiguration(const RenderSystemConfiguration& config) override;
 
+        MemoryStatistics QueryMemoryStatistics() override;
+
         /* ----- Render Context ----- */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -94,9 +102,16 @@ class GLRenderSystem : public RenderSystem
         TextureDescriptor QueryTextureDescriptor(const Texture& texture) override;
 
         void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
+
+        std::uint64_t WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
+        bool IsTextureUploadComplete(std::uint64_t ticket) override;
         
         void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) override;
 
+        std::uint64_t ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc) override;
+        bool MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize) override;
+        void UnmapTextureReadback(std::uint64_t ticket) override;
+
         void GenerateMips(Texture& texture) override;
 
         /* ----- Sampler States ---- */
@@ -107,6 +122,12 @@ class GLRenderSystem : public RenderSystem
         void Release(Sampler& sampler) override;
         void Release(SamplerArray& samplerArray) override;
 
+        /* ----- Resource Heaps ----- */
+
+        ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
+
+        void Release(ResourceHeap& resourceHeap) override;
+
         /* ----- Render Targets ----- */
 
         RenderTarget* CreateRenderTarget(const RenderTargetDescriptor& desc) override;
@@ -135,6 +156,14 @@ class GLRenderSystem : public RenderSystem
 
         void Release(Query& query) override;
 
+        /* ----- Fences ----- */
+
+        Fence* CreateFence() override;
+
+        void Release(Fence& fence) override;
+
+        bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+
     protected:
 
         RenderContext* AddRenderContext(std::unique_ptr<GLRenderContext>&& renderContext, const RenderContextDescriptor& desc);
@@ -161,12 +190,21 @@ class GLRenderSystem : public RenderSystem
         HWObjectContainer<GLTextureArray>       textureArrays_;
         HWObjectContainer<GLSampler>            samplers_;
         HWObjectContainer<GLSamplerArray>       samplerArrays_;
+        HWObjectContainer<GLResourceHeap>       resourceHeaps_;
         HWObjectContainer<GLRenderTarget>       renderTargets_;
         HWObjectContainer<GLShader>             shaders_;
         HWObjectContainer<GLShaderProgram>      shaderPrograms_;
         HWObjectContainer<GLGraphicsPipeline>   graphicsPipelines_;
         HWObjectContainer<GLComputePipeline>    computePipelines_;
         HWObjectContainer<GLQuery>              queries_;
+        HWObjectContainer<GLFence>              fences_;
+
+        std::unique_ptr<GLStagingBufferRing>    unpackBufferRing_;
+        std::unique_ptr<GLTextureReadbackQueue> readbackQueue_;
+
+        GLVertexArrayCache                      vertexArrayCache_;
+
+        MemoryAccounting                        memoryAccounting_;
 
         DebugCallback                           debugCallback_;
 
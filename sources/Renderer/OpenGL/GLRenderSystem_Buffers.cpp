@@ -20,6 +20,13 @@ namespace LLGL
 
 /* ----- Buffers ------ */
 
+// Binds the specified buffer, unless it can be modified with direct state access, which leaves the bindings for rendering untouched.
+static void BindBufferForModification(GLBuffer& bufferGL)
+{
+    if (!GLBuffer::HasDirectStateAccess())
+        GLStateManager::active->BindBuffer(bufferGL);
+}
+
 static GLenum GetGLBufferUsage(long flags)
 {
     return ((flags & BufferFlags::DynamicUsage) != 0 ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
@@ -27,6 +34,8 @@ static GLenum GetGLBufferUsage(long flags)
 
 Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
 {
+    std::unique_ptr<GLBuffer> buffer;
+
     /* Create either base of sub-class GLBuffer object */
     switch (desc.type)
     {
@@ -35,11 +44,11 @@ Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
             /* Create vertex buffer and build vertex array */
             auto bufferGL = MakeUnique<GLVertexBuffer>();
             {
-                GLStateManager::active->BindBuffer(*bufferGL);
+                BindBufferForModification(*bufferGL);
                 bufferGL->BufferData(initialData, desc.size, GetGLBufferUsage(desc.flags));
-                bufferGL->BuildVertexArray(desc.vertexBuffer.format);
+                bufferGL->BuildVertexArray(desc.vertexBuffer.format, vertexArrayCache_);
             }
-            return TakeOwnership(buffers_, std::move(bufferGL));
+            buffer = std::move(bufferGL);
         }
         break;
 
@@ -48,24 +57,29 @@ Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
             /* Create index buffer and store index format */
             auto bufferGL = MakeUnique<GLIndexBuffer>(desc.indexBuffer.format);
             {
-                GLStateManager::active->BindBuffer(*bufferGL);
+                BindBufferForModification(*bufferGL);
                 bufferGL->BufferData(initialData, desc.size, GetGLBufferUsage(desc.flags));
             }
-            return TakeOwnership(buffers_, std::move(bufferGL));
+            buffer = std::move(bufferGL);
         }
         break;
 
         default:
         {
             /* Create generic buffer */
-            auto bufferGL = MakeUnique<GLBuffer>(desc.type);
+            buffer = MakeUnique<GLBuffer>(desc.type);
             {
-                GLStateManager::active->BindBuffer(*bufferGL);
-                bufferGL->BufferData(initialData, desc.size, GetGLBufferUsage(desc.flags));
+                BindBufferForModification(*buffer);
+                buffer->BufferData(initialData, desc.size, GetGLBufferUsage(desc.flags));
             }
-            return TakeOwnership(buffers_, std::move(bufferGL));
         }
+        break;
     }
+
+    /* Tally buffer memory only after the buffer has been created successfully */
+    memoryAccounting_.Allocate(MemoryAccounting::Type::Buffer, desc.size);
+
+    return TakeOwnership(buffers_, std::move(buffer));
 }
 
 BufferArray* GLRenderSystem::CreateBufferArray(unsigned int numBuffers, Buffer* const * bufferArray)
@@ -77,7 +91,7 @@ BufferArray* GLRenderSystem::CreateBufferArray(unsigned int numBuffers, Buffer*
     {
         /* Create vertex buffer array and build VAO */
         auto vertexBufferArray = MakeUnique<GLVertexBufferArray>();
-        vertexBufferArray->BuildVertexArray(numBuffers, bufferArray);
+        vertexBufferArray->BuildVertexArray(numBuffers, bufferArray, vertexArrayCache_);
         return TakeOwnership(bufferArrays_, std::move(vertexBufferArray));
     }
 
@@ -86,6 +100,15 @@ BufferArray* GLRenderSystem::CreateBufferArray(unsigned int numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    /* Notify state manager about buffer release */
+    auto& bufferGL = LLGL_CAST(const GLBuffer&, buffer);
+    GLStateManager::active->NotifyBufferRelease(bufferGL.GetID());
+
+    /* Unbind buffer from all shared VAOs, since the buffer ID might be reused */
+    vertexArrayCache_.NotifyBufferRelease(bufferGL.GetID());
+
+    /* Release object */
+    memoryAccounting_.Release(MemoryAccounting::Type::Buffer, static_cast<std::uint64_t>(bufferGL.GetSize()));
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
@@ -97,7 +120,7 @@ void GLRenderSystem::Release(BufferArray& bufferArray)
 static GLBuffer& BindAndGetGLBuffer(Buffer& buffer)
 {
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
-    GLStateManager::active->BindBuffer(bufferGL);
+    BindBufferForModification(bufferGL);
     return bufferGL;
 }
 
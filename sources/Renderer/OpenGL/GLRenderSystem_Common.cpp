@@ -8,6 +8,7 @@
 #include "GLRenderSystem.h"
 #include "../GLCommon/GLTypes.h"
 #include "../GLCommon/GLCore.h"
+#include "../GLCommon/GLExtensionRegistry.h"
 #include "../GLCommon/Texture/GLTexImage.h"
 #include "Ext/GLExtensions.h"
 #include "../CheckedCast.h"
@@ -39,6 +40,36 @@ void GLRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
     GLTexImageInitialization(config.imageInitialization);
 }
 
+MemoryStatistics GLRenderSystem::QueryMemoryStatistics()
+{
+    MemoryStatistics stats;
+    memoryAccounting_.GetStatistics(stats);
+
+    /* Query device memory reported by the driver (in kilobytes) */
+    #ifdef GL_NVX_gpu_memory_info
+    if (HasExtension(GLExt::NVX_gpu_memory_info))
+    {
+        GLint totalMemory = 0, availableMemory = 0;
+        glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX, &totalMemory);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &availableMemory);
+        stats.totalDeviceMemory     = static_cast<std::uint64_t>(totalMemory) * 1024;
+        stats.availableDeviceMemory = static_cast<std::uint64_t>(availableMemory) * 1024;
+    }
+    else
+    #endif
+    #ifdef GL_ATI_meminfo
+    if (HasExtension(GLExt::ATI_meminfo))
+    {
+        /* First value is the total free memory in the texture pool */
+        GLint freeMemory[4] = { 0, 0, 0, 0 };
+        glGetIntegerv(GL_TEXTURE_FREE_MEMORY_ATI, freeMemory);
+        stats.availableDeviceMemory = static_cast<std::uint64_t>(freeMemory[0]) * 1024;
+    }
+    #endif
+
+    return stats;
+}
+
 /* ----- Render Context ----- */
 
 // private
@@ -102,6 +133,11 @@ SamplerArray* GLRenderSystem::CreateSamplerArray(unsigned int numSamplers, Sampl
 
 void GLRenderSystem::Release(Sampler& sampler)
 {
+    /* Notify state manager about sampler release */
+    auto& samplerGL = LLGL_CAST(const GLSampler&, sampler);
+    GLStateManager::active->NotifySamplerRelease(samplerGL.GetID());
+
+    /* Release object */
     RemoveFromUniqueSet(samplers_, &sampler);
 }
 
@@ -110,16 +146,33 @@ void GLRenderSystem::Release(SamplerArray& samplerArray)
     RemoveFromUniqueSet(samplerArrays_, &samplerArray);
 }
 
+/* ----- Resource Heaps ----- */
+
+ResourceHeap* GLRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    AssertCreateResourceHeap(desc);
+    return TakeOwnership(resourceHeaps_, MakeUnique<GLResourceHeap>(desc));
+}
+
+void GLRenderSystem::Release(ResourceHeap& resourceHeap)
+{
+    RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
+}
+
 /* ----- Render Targets ----- */
 
 RenderTarget* GLRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
 {
     LLGL_ASSERT_CAP(hasRenderTargets);
-    return TakeOwnership(renderTargets_, MakeUnique<GLRenderTarget>(desc));
+    auto renderTarget = MakeUnique<GLRenderTarget>(memoryAccounting_, desc);
+    memoryAccounting_.Allocate(MemoryAccounting::Type::RenderTarget, 0);
+    return TakeOwnership(renderTargets_, std::move(renderTarget));
 }
 
 void GLRenderSystem::Release(RenderTarget& renderTarget)
 {
+    /* Internal renderbuffers are removed from the tally when the render target is destroyed */
+    memoryAccounting_.Release(MemoryAccounting::Type::RenderTarget, 0);
     RemoveFromUniqueSet(renderTargets_, &renderTarget);
 }
 
@@ -197,6 +250,24 @@ void GLRenderSystem::Release(Query& query)
     RemoveFromUniqueSet(queries_, &query);
 }
 
+/* ----- Fences ----- */
+
+Fence* GLRenderSystem::CreateFence()
+{
+    return TakeOwnership(fences_, MakeUnique<GLFence>());
+}
+
+void GLRenderSystem::Release(Fence& fence)
+{
+    RemoveFromUniqueSet(fences_, &fence);
+}
+
+bool GLRenderSystem::WaitFence(Fence& fence, std::uint64_t timeout)
+{
+    auto& fenceGL = LLGL_CAST(GLFence&, fence);
+    return fenceGL.Wait(timeout);
+}
+
 
 /*
  * ======= Protected: =======
@@ -362,6 +433,7 @@ void GLRenderSystem::QueryRenderingCaps()
     caps.hasViewportArrays              = HasExtension(GLExt::ARB_viewport_array);
     caps.hasConservativeRasterization   = ( HasExtension(GLExt::NV_conservative_raster) || HasExtension(GLExt::INTEL_conservative_rasterization) );
     caps.hasStreamOutputs               = ( HasExtension(GLExt::EXT_transform_feedback) || HasExtension(GLExt::NV_transform_feedback) );
+    caps.hasIndirectDrawing             = HasExtension(GLExt::ARB_draw_indirect);
 
     /* Query integral attributes */
     auto GetInt = [](GLenum param)
@@ -13,6 +13,7 @@
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
 #include "../Assertion.h"
+#include <limits>
 
 
 namespace LLGL
@@ -84,6 +85,14 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             break;
     }
 
+    /* Initialize texture image with default color or depth */
+    if (!imageDesc)
+        GLTexImageFillDefault(texture->GetID(), textureDesc);
+
+    /* Tally estimated texture memory */
+    texture->SetMemoryFootprint(TextureMemoryFootprint(textureDesc));
+    memoryAccounting_.Allocate(MemoryAccounting::Type::Texture, texture->GetMemoryFootprint());
+
     return TakeOwnership(textures_, std::move(texture));
 }
 
@@ -100,6 +109,7 @@ void GLRenderSystem::Release(Texture& texture)
     GLStateManager::active->NotifyTextureRelease(GLStateManager::GetTextureTarget(textureGL.GetType()), textureGL.GetID());
 
     /* Release object */
+    memoryAccounting_.Release(MemoryAccounting::Type::Texture, textureGL.GetMemoryFootprint());
     RemoveFromUniqueSet(textures_, &texture);
 }
 
@@ -119,29 +129,39 @@ void GLRenderSystem::Release(TextureArray& textureArray)
     RemoveFromUniqueSet(textureArrays_, &textureArray);
 }
 
+// Queries a parameter of the first MIP-map level, which requires the texture to be bound unless direct state access is available.
+static void GetTexLevelParameter(const GLTexture& textureGL, GLenum param, GLint* value)
+{
+    #ifdef GL_ARB_direct_state_access
+    if (GLTexture::HasDirectStateAccess())
+        glGetTextureLevelParameteriv(textureGL.GetID(), 0, param, value);
+    else
+    #endif
+        glGetTexLevelParameteriv(GLTypes::Map(textureGL.GetType()), 0, param, value);
+}
+
 TextureDescriptor GLRenderSystem::QueryTextureDescriptor(const Texture& texture)
 {
-    /* Bind texture */
+    /* Bind texture, unless it can be queried with direct state access */
     auto& textureGL = LLGL_CAST(const GLTexture&, texture);
-    GLStateManager::active->BindTexture(textureGL);
+    if (!GLTexture::HasDirectStateAccess())
+        GLStateManager::active->BindTexture(textureGL);
 
     /* Setup texture descriptor */
     TextureDescriptor desc;
 
     desc.type = texture.GetType();
 
-    auto target = GLTypes::Map(texture.GetType());
-
     /* Query hardware texture format */
     GLint internalFormat = 0;
-    glGetTexLevelParameteriv(target, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+    GetTexLevelParameter(textureGL, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
     GLTypes::Unmap(desc.format, static_cast<GLenum>(internalFormat));
 
     /* Query texture size */
     GLint texSize[3] = { 0 };
-    glGetTexLevelParameteriv(target, 0, GL_TEXTURE_WIDTH,  &texSize[0]);
-    glGetTexLevelParameteriv(target, 0, GL_TEXTURE_HEIGHT, &texSize[1]);
-    glGetTexLevelParameteriv(target, 0, GL_TEXTURE_DEPTH,  &texSize[2]);
+    GetTexLevelParameter(textureGL, GL_TEXTURE_WIDTH,  &texSize[0]);
+    GetTexLevelParameter(textureGL, GL_TEXTURE_HEIGHT, &texSize[1]);
+    GetTexLevelParameter(textureGL, GL_TEXTURE_DEPTH,  &texSize[2]);
 
     desc.texture3D.width    = static_cast<unsigned int>(texSize[0]);
     desc.texture3D.height   = static_cast<unsigned int>(texSize[1]);
@@ -150,6 +170,21 @@ TextureDescriptor GLRenderSystem::QueryTextureDescriptor(const Texture& texture)
     if (desc.type == TextureType::TextureCube || desc.type == TextureType::TextureCubeArray)
         desc.texture3D.depth /= 6;
 
+    #ifdef GL_ARB_texture_storage
+    if (HasExtension(GLExt::ARB_texture_storage))
+    {
+        /* Query number of MIP-map levels of immutable texture storage */
+        GLint mipLevels = 0;
+        #ifdef GL_ARB_direct_state_access
+        if (GLTexture::HasDirectStateAccess())
+            glGetTextureParameteriv(textureGL.GetID(), GL_TEXTURE_IMMUTABLE_LEVELS, &mipLevels);
+        else
+        #endif
+            glGetTexParameteriv(GLTypes::Map(texture.GetType()), GL_TEXTURE_IMMUTABLE_LEVELS, &mipLevels);
+        desc.mipLevels = static_cast<unsigned int>(mipLevels);
+    }
+    #endif
+
     return desc;
 }
 
@@ -157,8 +192,18 @@ TextureDescriptor GLRenderSystem::QueryTextureDescriptor(const Texture& texture)
 
 void GLRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
 {
-    /* Bind texture and write texture sub data */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
+
+    #ifdef GL_ARB_direct_state_access
+    if (GLTexture::HasDirectStateAccess())
+    {
+        /* Write texture sub data without binding the texture (capabilities were already validated by "CreateTexture") */
+        GLTextureSubImage(textureGL.GetID(), texture.GetType(), subTextureDesc, imageDesc);
+        return;
+    }
+    #endif
+
+    /* Bind texture and write texture sub data */
     GLStateManager::active->BindTexture(textureGL);
 
     /* Write data into specific texture type */
@@ -202,12 +247,107 @@ void GLRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor&
     }
 }
 
+// Returns the size (in bytes) of the image data for the specified sub-texture
+static std::size_t GetSubTextureDataSize(const TextureType type, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
+{
+    if (IsCompressedFormat(imageDesc.format))
+        return imageDesc.compressedSize;
+
+    std::size_t numTexels = 0;
+
+    switch (type)
+    {
+        case TextureType::Texture1D:
+            numTexels = subTextureDesc.texture1D.width;
+            break;
+        case TextureType::Texture1DArray:
+            numTexels = subTextureDesc.texture1D.width * subTextureDesc.texture1D.layers;
+            break;
+        case TextureType::Texture2D:
+            numTexels = subTextureDesc.texture2D.width * subTextureDesc.texture2D.height;
+            break;
+        case TextureType::Texture2DArray:
+            numTexels = subTextureDesc.texture2D.width * subTextureDesc.texture2D.height * subTextureDesc.texture2D.layers;
+            break;
+        case TextureType::Texture3D:
+            numTexels = subTextureDesc.texture3D.width * subTextureDesc.texture3D.height * subTextureDesc.texture3D.depth;
+            break;
+        case TextureType::TextureCube:
+            numTexels = subTextureDesc.textureCube.width * subTextureDesc.textureCube.height;
+            break;
+        case TextureType::TextureCubeArray:
+            numTexels = subTextureDesc.textureCube.width * subTextureDesc.textureCube.height * subTextureDesc.textureCube.cubeFaces;
+            break;
+        default:
+            break;
+    }
+
+    return numTexels * imageDesc.GetElementSize();
+}
+
+std::uint64_t GLRenderSystem::WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
+{
+    auto dataSize = static_cast<GLsizeiptr>(GetSubTextureDataSize(texture.GetType(), subTextureDesc, imageDesc));
+    auto stagingBufferSize = static_cast<GLsizeiptr>(GetConfiguration().stagingBufferSize);
+
+    /* Fall back to synchronous upload if fences are not supported or the image data does not fit into the staging buffer */
+    if (!HasExtension(GLExt::ARB_sync) || !HasExtension(GLExt::ARB_map_buffer_range) || dataSize == 0 || dataSize > stagingBufferSize)
+    {
+        WriteTexture(texture, subTextureDesc, imageDesc);
+        return 0;
+    }
+
+    /* Create staging buffer ring with the first asynchronous upload */
+    if (!unpackBufferRing_)
+        unpackBufferRing_ = MakeUnique<GLStagingBufferRing>(GLBufferTarget::PIXEL_UNPACK_BUFFER, stagingBufferSize);
+
+    /* Copy image data into staging buffer */
+    auto offset = unpackBufferRing_->Write(imageDesc.buffer, dataSize);
+
+    /* Upload image data from the staging buffer, i.e. the image buffer is interpreted as offset into the bound PBO */
+    auto stagingImageDesc = imageDesc;
+    stagingImageDesc.buffer = reinterpret_cast<const void*>(offset);
+
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, unpackBufferRing_->GetID());
+    {
+        WriteTexture(texture, subTextureDesc, stagingImageDesc);
+    }
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
+
+    return unpackBufferRing_->InsertFence();
+}
+
+bool GLRenderSystem::IsTextureUploadComplete(std::uint64_t ticket)
+{
+    return (!unpackBufferRing_ || unpackBufferRing_->IsComplete(ticket));
+}
+
 void GLRenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer)
 {
     LLGL_ASSERT_PTR(buffer);
 
-    /* Bind texture */
     auto& textureGL = LLGL_CAST(const GLTexture&, texture);
+
+    #ifdef GL_ARB_direct_state_access
+    if (GLTexture::HasDirectStateAccess())
+    {
+        /*
+        Read image data without binding the texture. The output buffer size is unknown to this function,
+        so the maximal size is specified, just like with the unbounded "glGetTexImage" below.
+        */
+        glGetTextureImage(
+            textureGL.GetID(),
+            mipLevel,
+            GLTypes::Map(imageFormat),
+            GLTypes::Map(dataType),
+            std::numeric_limits<GLsizei>::max(),
+            buffer
+        );
+        return;
+    }
+    #endif
+
+    /* Bind texture */
     GLStateManager::active->BindTexture(textureGL);
 
     /* Read image data from texture */
@@ -220,10 +360,42 @@ void GLRenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageForm
     );
 }
 
+std::uint64_t GLRenderSystem::ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc)
+{
+    /* Create readback queue with its pixel pack buffer ring on first use */
+    if (!readbackQueue_)
+        readbackQueue_ = MakeUnique<GLTextureReadbackQueue>(static_cast<GLsizeiptr>(GetConfiguration().stagingBufferSize));
+
+    auto& textureGL = LLGL_CAST(const GLTexture&, texture);
+    return readbackQueue_->ReadTexture(textureGL, desc);
+}
+
+bool GLRenderSystem::MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize)
+{
+    return (readbackQueue_ && readbackQueue_->Map(ticket, data, dataSize));
+}
+
+void GLRenderSystem::UnmapTextureReadback(std::uint64_t ticket)
+{
+    if (readbackQueue_)
+        readbackQueue_->Unmap(ticket);
+}
+
 void GLRenderSystem::GenerateMips(Texture& texture)
 {
-    /* Bind texture to active layer */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
+
+    #ifdef GL_ARB_direct_state_access
+    if (GLTexture::HasDirectStateAccess())
+    {
+        /* Generate MIP-maps and update minification filter without binding the texture */
+        glGenerateTextureMipmap(textureGL.GetID());
+        glTextureParameteri(textureGL.GetID(), GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        return;
+    }
+    #endif
+
+    /* Bind texture to active layer */
     GLStateManager::active->BindTexture(textureGL);
 
     auto target = GLTypes::Map(textureGL.GetType());
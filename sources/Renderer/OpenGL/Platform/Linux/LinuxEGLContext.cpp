@@ -0,0 +1,291 @@
+/*
+ * LinuxEGLContext.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifdef LLGL_GL_ENABLE_EGL
+
+
+#include "LinuxEGLContext.h"
+#include <LLGL/Log.h>
+#include <EGL/eglext.h>
+#include <stdexcept>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+// Returns true if the specified extension is contained in the space separated extension string.
+static bool HasEGLExtension(const char* extensions, const char* name)
+{
+    if (!extensions)
+        return false;
+
+    const auto nameLen = std::strlen(name);
+
+    for (auto s = std::strstr(extensions, name); s != nullptr; s = std::strstr(s + nameLen, name))
+    {
+        if ((s == extensions || s[-1] == ' ') && (s[nameLen] == ' ' || s[nameLen] == '\0'))
+            return true;
+    }
+
+    return false;
+}
+
+// EGL display of all EGL contexts, which is only held by weak reference so that it gets terminated with the last context.
+static std::weak_ptr<void> g_eglDisplayRef;
+
+
+/*
+ * Display structure
+ */
+
+LinuxEGLContext::Display::Display()
+{
+    /* Prefer the surfaceless platform (Mesa), which requires no display server at all */
+    auto clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    if (HasEGLExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+    {
+        auto eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (eglGetPlatformDisplayEXT)
+            handle = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    }
+
+    /* Fall back to default display */
+    if (handle == EGL_NO_DISPLAY)
+        handle = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    if (handle == EGL_NO_DISPLAY)
+        throw std::runtime_error("failed to get EGL display for headless OpenGL context");
+
+    if (eglInitialize(handle, nullptr, nullptr) != EGL_TRUE)
+        throw std::runtime_error("failed to initialize EGL display for headless OpenGL context");
+}
+
+LinuxEGLContext::Display::~Display()
+{
+    eglTerminate(handle);
+}
+
+
+/*
+ * LinuxEGLContext class
+ */
+
+LinuxEGLContext::LinuxEGLContext(RenderContextDescriptor& desc, Surface& surface, LinuxEGLContext* sharedContext) :
+    GLContext { sharedContext }
+{
+    /* Get display from other EGL contexts or initialize a new one */
+    display_ = std::static_pointer_cast<Display>(g_eglDisplayRef.lock());
+    if (!display_)
+    {
+        display_ = std::make_shared<Display>();
+        g_eglDisplayRef = display_;
+    }
+
+    /* Create context and pbuffer (unless the context is surfaceless) */
+    desc.videoMode.resolution = surface.GetContentSize();
+    CreateContext(desc, sharedContext);
+}
+
+LinuxEGLContext::~LinuxEGLContext()
+{
+    DeleteContext();
+}
+
+bool LinuxEGLContext::SetSwapInterval(int /*interval*/)
+{
+    /* Swap interval has no effect on pbuffers, since they are never presented */
+    return true;
+}
+
+bool LinuxEGLContext::SwapBuffers()
+{
+    /* Pbuffers are single buffered, so there is nothing to swap */
+    return true;
+}
+
+void LinuxEGLContext::Resize(const Size& resolution)
+{
+    /* Recreate pbuffer with new size (surfaceless contexts remain surfaceless) */
+    if (pbuffer_ != EGL_NO_SURFACE && resolution.x > 0 && resolution.y > 0)
+    {
+        const bool isCurrent = (eglGetCurrentContext() == eglc_);
+
+        if (isCurrent)
+            eglMakeCurrent(display_->handle, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+        DeletePbuffer();
+        CreatePbuffer(resolution);
+
+        if (isCurrent)
+            eglMakeCurrent(display_->handle, pbuffer_, pbuffer_, eglc_);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool LinuxEGLContext::Activate(bool activate)
+{
+    if (activate)
+        return (eglMakeCurrent(display_->handle, pbuffer_, pbuffer_, eglc_) == EGL_TRUE);
+    else
+        return (eglMakeCurrent(display_->handle, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE);
+}
+
+void LinuxEGLContext::CreateContext(const RenderContextDescriptor& contextDesc, LinuxEGLContext* sharedContext)
+{
+    EGLContext eglcShared = (sharedContext != nullptr ? sharedContext->eglc_ : EGL_NO_CONTEXT);
+
+    /* Use pbuffer as default framebuffer, or no surface at all if the resolution is zero */
+    const auto& resolution = contextDesc.videoMode.resolution;
+    const bool pbuffer = (resolution.x > 0 && resolution.y > 0);
+
+    if (!pbuffer && !HasEGLExtension(eglQueryString(display_->handle, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context"))
+        throw std::runtime_error("cannot create surfaceless OpenGL context, due to missing EGL extension: EGL_KHR_surfaceless_context");
+
+    if (eglBindAPI(EGL_OPENGL_API) != EGL_TRUE)
+        throw std::runtime_error("failed to bind OpenGL API for EGL context");
+
+    config_ = ChooseConfig(contextDesc, pbuffer);
+
+    /* Create OpenGL context with EGL */
+    const auto& profileDesc = contextDesc.profileOpenGL;
+
+    if (profileDesc.extProfile && profileDesc.coreProfile)
+    {
+        /* Create core profile */
+        int major = GetMajorVersion(profileDesc.version);
+        int minor = GetMinorVersion(profileDesc.version);
+        eglc_ = CreateContextCoreProfile(eglcShared, major, minor);
+    }
+
+    if (eglc_ == EGL_NO_CONTEXT)
+    {
+        /* Create compatibility profile */
+        eglc_ = CreateContextCompatibilityProfile(eglcShared);
+    }
+
+    if (eglc_ == EGL_NO_CONTEXT)
+        throw std::runtime_error("failed to create OpenGL context with EGL");
+
+    if (pbuffer)
+        CreatePbuffer(resolution);
+
+    /* Make new OpenGL context current */
+    if (eglMakeCurrent(display_->handle, pbuffer_, pbuffer_, eglc_) != EGL_TRUE)
+        Log::StdErr() << "failed to make OpenGL render context current (eglMakeCurrent)" << std::endl;
+}
+
+void LinuxEGLContext::DeleteContext()
+{
+    if (eglGetCurrentContext() == eglc_)
+        eglMakeCurrent(display_->handle, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+    DeletePbuffer();
+    eglDestroyContext(display_->handle, eglc_);
+}
+
+EGLConfig LinuxEGLContext::ChooseConfig(const RenderContextDescriptor& contextDesc, bool pbuffer)
+{
+    const EGLint samples = (pbuffer && contextDesc.multiSampling.enabled ? static_cast<EGLint>(contextDesc.multiSampling.samples) : 0);
+
+    const EGLint configAttribs[] =
+    {
+        EGL_SURFACE_TYPE,       (pbuffer ? EGL_PBUFFER_BIT : 0),
+        EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+        EGL_RED_SIZE,           8,
+        EGL_GREEN_SIZE,         8,
+        EGL_BLUE_SIZE,          8,
+        EGL_ALPHA_SIZE,         8,
+        EGL_DEPTH_SIZE,         24,
+        EGL_STENCIL_SIZE,       8,
+        EGL_SAMPLE_BUFFERS,     (samples > 0 ? 1 : 0),
+        EGL_SAMPLES,            samples,
+        EGL_NONE
+    };
+
+    EGLConfig config = nullptr;
+    EGLint numConfigs = 0;
+
+    if (eglChooseConfig(display_->handle, configAttribs, &config, 1, &numConfigs) != EGL_TRUE || numConfigs == 0)
+        throw std::runtime_error("failed to choose EGL configuration for headless OpenGL context");
+
+    return config;
+}
+
+EGLContext LinuxEGLContext::CreateContextCoreProfile(EGLContext eglcShared, int major, int minor)
+{
+    if (HasEGLExtension(eglQueryString(display_->handle, EGL_EXTENSIONS), "EGL_KHR_create_context"))
+    {
+        /* Create core profile */
+        const EGLint contextAttribs[] =
+        {
+            EGL_CONTEXT_MAJOR_VERSION_KHR,          major,
+            EGL_CONTEXT_MINOR_VERSION_KHR,          minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR,    EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+            EGL_NONE
+        };
+
+        auto eglc = eglCreateContext(display_->handle, config_, eglcShared, contextAttribs);
+        if (eglc != EGL_NO_CONTEXT)
+            return eglc;
+    }
+
+    /* Context creation failed */
+    Log::StdErr() << "failed to create OpenGL core profile" << std::endl;
+
+    return EGL_NO_CONTEXT;
+}
+
+EGLContext LinuxEGLContext::CreateContextCompatibilityProfile(EGLContext eglcShared)
+{
+    /* Create compatibility profile */
+    return eglCreateContext(display_->handle, config_, eglcShared, nullptr);
+}
+
+void LinuxEGLContext::CreatePbuffer(const Size& size)
+{
+    const EGLint pbufferAttribs[] =
+    {
+        EGL_WIDTH,  size.x,
+        EGL_HEIGHT, size.y,
+        EGL_NONE
+    };
+
+    pbuffer_ = eglCreatePbufferSurface(display_->handle, config_, pbufferAttribs);
+
+    if (pbuffer_ == EGL_NO_SURFACE)
+        throw std::runtime_error("failed to create EGL pbuffer surface for headless OpenGL context");
+}
+
+void LinuxEGLContext::DeletePbuffer()
+{
+    if (pbuffer_ != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(display_->handle, pbuffer_);
+        pbuffer_ = EGL_NO_SURFACE;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
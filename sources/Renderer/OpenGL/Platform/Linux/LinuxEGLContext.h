@@ -0,0 +1,83 @@
+/*
+ * LinuxEGLContext.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_LINUX_EGL_CONTEXT_H
+#define LLGL_LINUX_EGL_CONTEXT_H
+
+
+#ifdef LLGL_GL_ENABLE_EGL
+
+
+#include "../GLContext.h"
+#include "../../OpenGL.h"
+#include <EGL/egl.h>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+/*
+Headless GL context, which is created with EGL instead of GLX and requires neither an X11 display nor a window.
+The default framebuffer is a pbuffer of the surface size, or there is no default framebuffer at all if the surface size is zero.
+*/
+class LinuxEGLContext : public GLContext
+{
+
+    public:
+
+        LinuxEGLContext(RenderContextDescriptor& desc, Surface& surface, LinuxEGLContext* sharedContext);
+        ~LinuxEGLContext();
+
+        bool SetSwapInterval(int interval) override;
+        bool SwapBuffers() override;
+        void Resize(const Size& resolution) override;
+
+    private:
+
+        // EGL display which is shared between all EGL contexts, and terminated when the last context is destroyed.
+        struct Display
+        {
+            Display();
+            ~Display();
+
+            EGLDisplay handle = EGL_NO_DISPLAY;
+        };
+
+        bool Activate(bool activate) override;
+
+        void CreateContext(const RenderContextDescriptor& contextDesc, LinuxEGLContext* sharedContext);
+        void DeleteContext();
+
+        EGLConfig ChooseConfig(const RenderContextDescriptor& contextDesc, bool pbuffer);
+
+        EGLContext CreateContextCoreProfile(EGLContext eglcShared, int major, int minor);
+        EGLContext CreateContextCompatibilityProfile(EGLContext eglcShared);
+
+        void CreatePbuffer(const Size& size);
+        void DeletePbuffer();
+
+        std::shared_ptr<Display>    display_;
+        EGLConfig                   config_     = nullptr;
+        EGLContext                  eglc_       = EGL_NO_CONTEXT;
+        EGLSurface                  pbuffer_    = EGL_NO_SURFACE;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+#endif
+
+
+
+// ================================================================================
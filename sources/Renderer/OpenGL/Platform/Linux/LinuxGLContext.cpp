@@ -6,6 +6,7 @@
  */
 
 #include "LinuxGLContext.h"
+#include "LinuxEGLContext.h"
 #include "../../Ext/GLExtensions.h"
 #include "../../Ext/GLExtensionLoader.h"
 #include "../../../CheckedCast.h"
@@ -35,6 +36,16 @@ typedef GLXContext (*GXLCREATECONTEXTATTRIBARBPROC)(Display*, GLXFBConfig, GLXCo
 
 std::unique_ptr<GLContext> GLContext::Create(RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext)
 {
+    if (desc.profileOpenGL.headless)
+    {
+        #ifdef LLGL_GL_ENABLE_EGL
+        LinuxEGLContext* sharedContextEGL = (sharedContext != nullptr ? LLGL_CAST(LinuxEGLContext*, sharedContext) : nullptr);
+        return MakeUnique<LinuxEGLContext>(desc, surface, sharedContextEGL);
+        #else
+        throw std::runtime_error("cannot create headless OpenGL context, because LLGL was built without EGL (LLGL_GL_ENABLE_EGL)");
+        #endif
+    }
+
     LinuxGLContext* sharedContextGLX = (sharedContext != nullptr ? LLGL_CAST(LinuxGLContext*, sharedContext) : nullptr);
     return MakeUnique<LinuxGLContext>(desc, surface, sharedContextGLX);
 }
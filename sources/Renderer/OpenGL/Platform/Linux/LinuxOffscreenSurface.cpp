@@ -0,0 +1,56 @@
+/*
+ * LinuxOffscreenSurface.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "LinuxOffscreenSurface.h"
+#include <LLGL/Platform/NativeHandle.h>
+
+
+namespace LLGL
+{
+
+
+LinuxOffscreenSurface::LinuxOffscreenSurface(const Size& size) :
+    size_ { size }
+{
+}
+
+void LinuxOffscreenSurface::GetNativeHandle(void* nativeHandle) const
+{
+    auto& handle = *reinterpret_cast<NativeHandle*>(nativeHandle);
+    handle.display  = nullptr;
+    handle.window   = 0;
+    handle.visual   = nullptr;
+}
+
+void LinuxOffscreenSurface::Recreate()
+{
+    // dummy
+}
+
+Size LinuxOffscreenSurface::GetContentSize() const
+{
+    return size_;
+}
+
+bool LinuxOffscreenSurface::AdaptForVideoMode(VideoModeDescriptor& videoModeDesc)
+{
+    /* Offscreen surface can not be in fullscreen mode */
+    size_ = videoModeDesc.resolution;
+    if (videoModeDesc.fullscreen)
+    {
+        videoModeDesc.fullscreen = false;
+        return false;
+    }
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,49 @@
+/*
+ * LinuxOffscreenSurface.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_LINUX_OFFSCREEN_SURFACE_H
+#define LLGL_LINUX_OFFSCREEN_SURFACE_H
+
+
+#include <LLGL/Surface.h>
+
+
+namespace LLGL
+{
+
+
+// Surface without a window, which is used for headless GL contexts. The native handle is always empty.
+class LinuxOffscreenSurface : public Surface
+{
+
+    public:
+
+        LinuxOffscreenSurface(const Size& size);
+
+        void GetNativeHandle(void* nativeHandle) const override;
+
+        void Recreate() override;
+
+        Size GetContentSize() const override;
+
+        bool AdaptForVideoMode(VideoModeDescriptor& videoModeDesc) override;
+
+    private:
+
+        Size size_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,79 @@
+/*
+ * GLFence.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLFence.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+GLFence::~GLFence()
+{
+    DeleteSync();
+}
+
+bool GLFence::IsSignaled()
+{
+    return Wait(0);
+}
+
+void GLFence::Signal()
+{
+    DeleteSync();
+
+    #ifdef GL_ARB_sync
+    if (HasExtension(GLExt::ARB_sync))
+        sync_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    else
+    #endif
+        glFinish();
+}
+
+bool GLFence::Wait(GLuint64 timeout)
+{
+    if (!sync_)
+        return true;
+
+    /* Flush the command stream, so the fence is guaranteed to be signaled eventually */
+    auto result = glClientWaitSync(sync_, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+    switch (result)
+    {
+        case GL_ALREADY_SIGNALED:
+        case GL_CONDITION_SATISFIED:
+            DeleteSync();
+            return true;
+        case GL_WAIT_FAILED:
+            throw std::runtime_error("failed to wait for GL fence");
+        default:
+            return false;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLFence::DeleteSync()
+{
+    if (sync_)
+    {
+        glDeleteSync(sync_);
+        sync_ = nullptr;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,51 @@
+/*
+ * GLFence.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_FENCE_H
+#define LLGL_GL_FENCE_H
+
+
+#include <LLGL/Fence.h>
+#include "../OpenGL.h"
+
+
+namespace LLGL
+{
+
+
+class GLFence : public Fence
+{
+
+    public:
+
+        ~GLFence();
+
+        bool IsSignaled() override;
+
+        // Inserts a new sync object into the GL command stream. Without "GL_ARB_sync", this waits for all pending commands instead.
+        void Signal();
+
+        // Waits until the sync object has been signaled or the timeout (in nanoseconds) has expired.
+        bool Wait(GLuint64 timeout);
+
+    private:
+
+        void DeleteSync();
+
+        GLsync sync_ = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,124 @@
+/*
+ * GLResourceHeap.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLResourceHeap.h"
+#include "../Buffer/GLBuffer.h"
+#include "../Texture/GLTexture.h"
+#include "../Texture/GLSampler.h"
+#include "../../CheckedCast.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+GLResourceHeap::GLResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    std::vector<GLBindingSlot> uniformBufferSlots, storageBufferSlots, textureSlots, samplerSlots;
+
+    /* Gather binding slots for each resource type */
+    for (const auto& resourceViewDesc : desc.resourceViews)
+    {
+        switch (resourceViewDesc.type)
+        {
+            case ResourceType::ConstantBuffer:
+            {
+                auto bufferGL = LLGL_CAST(GLBuffer*, resourceViewDesc.buffer);
+                uniformBufferSlots.push_back({ resourceViewDesc.slot, bufferGL->GetID(), GLTextureTarget::TEXTURE_1D });
+            }
+            break;
+
+            case ResourceType::StorageBuffer:
+            {
+                auto bufferGL = LLGL_CAST(GLBuffer*, resourceViewDesc.buffer);
+                storageBufferSlots.push_back({ resourceViewDesc.slot, bufferGL->GetID(), GLTextureTarget::TEXTURE_1D });
+            }
+            break;
+
+            case ResourceType::Texture:
+            {
+                auto textureGL = LLGL_CAST(GLTexture*, resourceViewDesc.texture);
+                textureSlots.push_back({ resourceViewDesc.slot, textureGL->GetID(), GLStateManager::GetTextureTarget(textureGL->GetType()) });
+            }
+            break;
+
+            case ResourceType::Sampler:
+            {
+                auto samplerGL = LLGL_CAST(GLSampler*, resourceViewDesc.sampler);
+                samplerSlots.push_back({ resourceViewDesc.slot, samplerGL->GetID(), GLTextureTarget::TEXTURE_1D });
+            }
+            break;
+        }
+    }
+
+    /* Precompute the arrays for the multi-bind functions */
+    BuildBindingRanges(uniformBufferSlots, uniformBufferRanges_, uniformBuffers_);
+    BuildBindingRanges(storageBufferSlots, storageBufferRanges_, storageBuffers_);
+    BuildBindingRanges(textureSlots, textureRanges_, textures_, &textureTargets_);
+    BuildBindingRanges(samplerSlots, samplerRanges_, samplers_);
+}
+
+void GLResourceHeap::Bind(GLStateManager& stateMngr)
+{
+    for (const auto& range : uniformBufferRanges_)
+        stateMngr.BindBuffersBase(GLBufferTarget::UNIFORM_BUFFER, range.first, range.count, &(uniformBuffers_[range.offset]));
+
+    for (const auto& range : storageBufferRanges_)
+        stateMngr.BindBuffersBase(GLBufferTarget::SHADER_STORAGE_BUFFER, range.first, range.count, &(storageBuffers_[range.offset]));
+
+    for (const auto& range : textureRanges_)
+        stateMngr.BindTextures(range.first, range.count, &(textureTargets_[range.offset]), &(textures_[range.offset]));
+
+    for (const auto& range : samplerRanges_)
+        stateMngr.BindSamplers(range.first, static_cast<unsigned int>(range.count), &(samplers_[range.offset]));
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLResourceHeap::BuildBindingRanges(
+    std::vector<GLBindingSlot>&     slots,
+    std::vector<GLBindingRange>&    ranges,
+    std::vector<GLuint>&            ids,
+    std::vector<GLTextureTarget>*   targets)
+{
+    /* Sort binding slots in ascending order */
+    std::sort(
+        slots.begin(), slots.end(),
+        [](const GLBindingSlot& lhs, const GLBindingSlot& rhs)
+        {
+            return (lhs.slot < rhs.slot);
+        }
+    );
+
+    ids.reserve(slots.size());
+    if (targets)
+        targets->reserve(slots.size());
+
+    /* Merge consecutive binding slots into a single range */
+    for (const auto& slot : slots)
+    {
+        if (ranges.empty() || ranges.back().first + static_cast<GLuint>(ranges.back().count) != slot.slot)
+            ranges.push_back({ slot.slot, 0, ids.size() });
+
+        ++ranges.back().count;
+
+        ids.push_back(slot.id);
+        if (targets)
+            targets->push_back(slot.target);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,79 @@
+/*
+ * GLResourceHeap.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_RESOURCE_HEAP_H
+#define LLGL_GL_RESOURCE_HEAP_H
+
+
+#include <LLGL/ResourceHeap.h>
+#include "GLStateManager.h"
+#include "../OpenGL.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class GLResourceHeap : public ResourceHeap
+{
+
+    public:
+
+        GLResourceHeap(const ResourceHeapDescriptor& desc);
+
+        // Binds all resource views of this heap with the multi-bind functions of the specified state manager.
+        void Bind(GLStateManager& stateMngr);
+
+    private:
+
+        // Range of consecutive binding slots, which are bound with a single multi-bind call.
+        struct GLBindingRange
+        {
+            GLuint      first;
+            GLsizei     count;
+            std::size_t offset;
+        };
+
+        struct GLBindingSlot
+        {
+            unsigned int    slot;
+            GLuint          id;
+            GLTextureTarget target;
+        };
+
+        static void BuildBindingRanges(
+            std::vector<GLBindingSlot>&     slots,
+            std::vector<GLBindingRange>&    ranges,
+            std::vector<GLuint>&            ids,
+            std::vector<GLTextureTarget>*   targets = nullptr
+        );
+
+        std::vector<GLBindingRange>     uniformBufferRanges_;
+        std::vector<GLuint>             uniformBuffers_;
+
+        std::vector<GLBindingRange>     storageBufferRanges_;
+        std::vector<GLuint>             storageBuffers_;
+
+        std::vector<GLBindingRange>     textureRanges_;
+        std::vector<GLuint>             textures_;
+        std::vector<GLTextureTarget>    textureTargets_;
+
+        std::vector<GLBindingRange>     samplerRanges_;
+        std::vector<GLuint>             samplers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
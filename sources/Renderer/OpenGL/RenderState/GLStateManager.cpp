@@ -11,6 +11,8 @@
 #include "../../GLCommon/GLTypes.h"
 #include "../../Assertion.h"
 #include "../../../Core/Helper.h"
+#include <algorithm>
+#include <cstring>
 
 
 namespace LLGL
@@ -112,6 +114,8 @@ GLStateManager::GLStateManager()
     /* Initialize all states with zero */
     Fill(renderState_.values, false);
     Fill(bufferState_.boundBuffers, 0);
+    for (auto& indices : bufferState_.boundIndexedBuffers)
+        Fill(indices, 0);
     Fill(framebufferState_.boundFramebuffers, 0);
     Fill(samplerState_.boundSamplers, 0);
 
@@ -126,6 +130,9 @@ GLStateManager::GLStateManager()
 
 void GLStateManager::DetermineExtensions()
 {
+    /* Resolve extension dependent entry points once for this context */
+    LoadGLDispatchTable(dispatchTable_);
+
     #ifdef LLGL_GL_ENABLE_VENDOR_EXT
 
     /* Initialize extenstion states */
@@ -312,6 +319,24 @@ bool GLStateManager::IsEnabled(GLStateExt state) const
 
 /* ----- Common states ----- */
 
+/*
+Compares the first 'count' entries with the cached entries of the last array submission.
+Returns true if they differ, in which case the entries are stored in the cache and must be submitted to GL.
+*/
+template <typename T, std::size_t N>
+static bool UpdateCachedArray(std::array<T, N>& cache, GLsizei& numCached, GLsizei count, const T* entries)
+{
+    const auto size = sizeof(T) * static_cast<std::size_t>(count);
+
+    if (count <= numCached && std::memcmp(cache.data(), entries, size) == 0)
+        return false;
+
+    std::memcpy(cache.data(), entries, size);
+    numCached = std::max(numCached, count);
+
+    return true;
+}
+
 //private
 void GLStateManager::AdjustViewport(GLViewport& viewport)
 {
@@ -329,49 +354,51 @@ void GLStateManager::SetViewport(GLViewport& viewport)
         static_cast<GLsizei>(viewport.width),
         static_cast<GLsizei>(viewport.height)
     );
+
+    /* 'glViewport' overrides all viewports */
+    viewportArrayState_.numViewports = 0;
 }
 
-void GLStateManager::SetViewportArray(std::vector<GLViewport>&& viewports)
+void GLStateManager::SetViewportArray(GLsizei count, GLViewport* viewports)
 {
-    if (viewports.size() > 1)
+    if (count > 1)
     {
         AssertExtViewportArray();
 
         if (emulateClipControl_ && !gfxDependentState_.stateOpenGL.screenSpaceOriginLowerLeft)
         {
-            for (auto& vp : viewports)
-                AdjustViewport(vp);
+            for (GLsizei i = 0; i < count; ++i)
+                AdjustViewport(viewports[i]);
         }
 
-        glViewportArrayv(
-            0,
-            static_cast<GLsizei>(viewports.size()),
-            reinterpret_cast<const GLfloat*>(viewports.data())
-        );
+        /* Only submit viewports that differ from the last submission */
+        if (UpdateCachedArray(viewportArrayState_.viewports, viewportArrayState_.numViewports, count, viewports))
+            glViewportArrayv(0, count, reinterpret_cast<const GLfloat*>(viewports));
     }
-    else if (viewports.size() == 1)
-        SetViewport(viewports.front());
+    else if (count == 1)
+        SetViewport(viewports[0]);
 }
 
-void GLStateManager::SetDepthRange(GLDepthRange& depthRange)
+void GLStateManager::SetDepthRange(const GLDepthRange& depthRange)
 {
     glDepthRange(depthRange.minDepth, depthRange.maxDepth);
+
+    /* 'glDepthRange' overrides all depth-ranges */
+    viewportArrayState_.numDepthRanges = 0;
 }
 
-void GLStateManager::SetDepthRangeArray(std::vector<GLDepthRange>&& depthRanges)
+void GLStateManager::SetDepthRangeArray(GLsizei count, const GLDepthRange* depthRanges)
 {
-    if (depthRanges.size() > 1)
+    if (count > 1)
     {
         AssertExtViewportArray();
 
-        glDepthRangeArrayv(
-            0,
-            static_cast<GLsizei>(depthRanges.size()),
-            reinterpret_cast<const GLdouble*>(depthRanges.data())
-        );
+        /* Only submit depth-ranges that differ from the last submission */
+        if (UpdateCachedArray(viewportArrayState_.depthRanges, viewportArrayState_.numDepthRanges, count, depthRanges))
+            glDepthRangeArrayv(0, count, reinterpret_cast<const GLdouble*>(depthRanges));
     }
-    else if (depthRanges.size() == 1)
-        SetDepthRange(depthRanges.front());
+    else if (count == 1)
+        SetDepthRange(depthRanges[0]);
 }
 
 //private
@@ -386,28 +413,29 @@ void GLStateManager::SetScissor(GLScissor& scissor)
         AdjustScissor(scissor);
 
     glScissor(scissor.x, scissor.y, scissor.width, scissor.height);
+
+    /* 'glScissor' overrides all scissors */
+    viewportArrayState_.numScissors = 0;
 }
 
-void GLStateManager::SetScissorArray(std::vector<GLScissor>&& scissors)
+void GLStateManager::SetScissorArray(GLsizei count, GLScissor* scissors)
 {
-    if (scissors.size() > 1)
+    if (count > 1)
     {
         AssertExtViewportArray();
 
         if (emulateClipControl_)
         {
-            for (auto& sc : scissors)
-                AdjustScissor(sc);
+            for (GLsizei i = 0; i < count; ++i)
+                AdjustScissor(scissors[i]);
         }
 
-        glScissorArrayv(
-            0,
-            static_cast<GLsizei>(scissors.size()),
-            reinterpret_cast<const GLint*>(scissors.data())
-        );
+        /* Only submit scissors that differ from the last submission */
+        if (UpdateCachedArray(viewportArrayState_.scissors, viewportArrayState_.numScissors, count, scissors))
+            glScissorArrayv(0, count, reinterpret_cast<const GLint*>(scissors));
     }
-    else if (scissors.size() == 1)
-        SetScissor(scissors.front());
+    else if (count == 1)
+        SetScissor(scissors[0]);
 }
 
 void GLStateManager::SetBlendStates(const std::vector<GLBlend>& blendStates, bool blendEnabled)
@@ -608,30 +636,48 @@ void GLStateManager::BindBuffer(GLBufferTarget target, GLuint buffer)
 
 void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint buffer)
 {
-    /* Always bind buffer with a base index */
+    /* Only bind buffer if the buffer at the base index has changed */
     auto targetIdx = static_cast<std::size_t>(target);
-    glBindBufferBase(bufferTargetsMap[targetIdx], index, buffer);
-    bufferState_.boundBuffers[targetIdx] = buffer;
+    if (!IsIndexedBufferBound(targetIdx, index, buffer))
+    {
+        /* glBindBufferBase also modifies the generic binding point */
+        glBindBufferBase(bufferTargetsMap[targetIdx], index, buffer);
+        bufferState_.boundBuffers[targetIdx] = buffer;
+        StoreIndexedBuffer(targetIdx, index, buffer);
+    }
 }
 
 void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers)
 {
-    /* Always bind buffers with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     auto targetGL = bufferTargetsMap[targetIdx];
-    
-    #ifdef GL_ARB_multi_bind
-    if (HasExtension(GLExt::ARB_multi_bind))
+
+    /* Reduce binding range to the subrange of buffers that have changed */
+    while (count > 0 && IsIndexedBufferBound(targetIdx, first, *buffers))
+    {
+        ++first;
+        ++buffers;
+        --count;
+    }
+
+    while (count > 0 && IsIndexedBufferBound(targetIdx, first + count - 1, buffers[count - 1]))
+        --count;
+
+    if (count == 0)
+        return;
+
+    for (GLsizei i = 0; i < count; ++i)
+        StoreIndexedBuffer(targetIdx, first + i, buffers[i]);
+
+    if (dispatchTable_.bindBuffersBase)
     {
         /*
         Bind buffer array, but don't reset the currently bound buffer.
         The spec. of GL_ARB_multi_bind says, that the generic binding point is not modified by this function!
         */
-        glBindBuffersBase(targetGL, first, count, buffers);
+        dispatchTable_.bindBuffersBase(targetGL, first, count, buffers);
     }
     else
-    #endif
-    if (count > 0)
     {
         /* Bind each individual buffer, and store last bound buffer */
         bufferState_.boundBuffers[targetIdx] = buffers[count - 1];
@@ -709,6 +755,7 @@ static GLBufferTarget GetGLBufferTarget(const BufferType type)
         case BufferType::Constant:      return GLBufferTarget::UNIFORM_BUFFER;
         case BufferType::Storage:       return GLBufferTarget::SHADER_STORAGE_BUFFER;
         case BufferType::StreamOutput:  return GLBufferTarget::TRANSFORM_FEEDBACK_BUFFER;
+        case BufferType::Indirect:      return GLBufferTarget::DRAW_INDIRECT_BUFFER;
     }
     throw std::invalid_argument("failed to map 'BufferType' to internal type 'GLBufferTarget'");
 }
@@ -718,6 +765,25 @@ void GLStateManager::BindBuffer(const GLBuffer& buffer)
     BindBuffer(GetGLBufferTarget(buffer.GetType()), buffer.GetID());
 }
 
+void GLStateManager::NotifyBufferRelease(GLuint buffer)
+{
+    /* Deleted buffers are unbound from all binding points, so invalidate the binding memory for this buffer */
+    for (auto& boundBuffer : bufferState_.boundBuffers)
+    {
+        if (boundBuffer == buffer)
+            boundBuffer = 0;
+    }
+
+    for (auto& indices : bufferState_.boundIndexedBuffers)
+    {
+        for (auto& boundBuffer : indices)
+        {
+            if (boundBuffer == buffer)
+                boundBuffer = 0;
+        }
+    }
+}
+
 /* ----- Framebuffer ----- */
 
 void GLStateManager::BindFramebuffer(GLFramebufferTarget target, GLuint framebuffer)
@@ -789,30 +855,61 @@ void GLStateManager::BindTexture(GLTextureTarget target, GLuint texture)
 
 void GLStateManager::BindTextures(GLuint first, GLsizei count, const GLTextureTarget* targets, const GLuint* textures)
 {
-    #ifdef GL_ARB_multi_bind
-    if (HasExtension(GLExt::ARB_multi_bind))
+    #ifdef LLGL_DEBUG
+    LLGL_ASSERT_RANGE(first + count, numTextureLayers + 1);
+    #endif
+
+    /* Reduce binding range to the subrange of texture layers that have changed */
+    auto IsTextureBound = [this](GLuint layer, GLTextureTarget target, GLuint texture)
+    {
+        return (textureState_.layers[layer].boundTextures[static_cast<std::size_t>(target)] == texture);
+    };
+
+    while (count > 0 && IsTextureBound(first, *targets, *textures))
+    {
+        ++first;
+        ++targets;
+        ++textures;
+        --count;
+    }
+
+    while (count > 0 && IsTextureBound(first + count - 1, targets[count - 1], textures[count - 1]))
+        --count;
+
+    if (count == 0)
+        return;
+
+    if (dispatchTable_.bindTextures)
     {
         /* Store bound textures */
         for (GLsizei i = 0; i < count; ++i)
         {
-            auto targetIdx = static_cast<std::size_t>(targets[i]);
-            textureState_.layers[i].boundTextures[targetIdx] = textures[i];
+            auto& layer = textureState_.layers[first + i];
+            if (textures[i] != 0)
+                layer.boundTextures[static_cast<std::size_t>(targets[i])] = textures[i];
+            else
+            {
+                /* A texture ID of zero unbinds all targets of this layer */
+                Fill(layer.boundTextures, 0);
+            }
         }
 
         /*
         Bind all textures at once, but don't reset the currently active texture layer.
         The spec. of GL_ARB_multi_bind says, that the active texture slot is not modified by this function!
         */
-        glBindTextures(first, count, textures);
+        dispatchTable_.bindTextures(first, count, textures);
     }
     else
-    #endif
     {
-        /* Bind each texture layer individually */
+        /* Bind each changed texture layer individually */
         while (count-- > 0)
         {
-            ActiveTexture(first);
-            BindTexture(*targets, *textures);
+            if (!IsTextureBound(first, *targets, *textures))
+            {
+                ActiveTexture(first);
+                BindTexture(*targets, *textures);
+            }
             ++targets;
             ++textures;
             ++first;
@@ -855,6 +952,14 @@ void GLStateManager::BindTexture(const GLTexture& texture)
     BindTexture(GLStateManager::GetTextureTarget(texture.GetType()), texture.GetID());
 }
 
+void GLStateManager::BindTexture(unsigned int layer, const GLTexture& texture)
+{
+    /* Bind texture with the multi-bind path, which avoids switching the active texture layer */
+    auto target     = GLStateManager::GetTextureTarget(texture.GetType());
+    auto textureID  = texture.GetID();
+    BindTextures(layer, 1, &target, &textureID);
+}
+
 void GLStateManager::NotifyTextureRelease(GLTextureTarget target, GLuint texture)
 {
     auto targetIdx = static_cast<std::size_t>(target);
@@ -885,18 +990,34 @@ void GLStateManager::BindSampler(unsigned int layer, GLuint sampler)
 
 void GLStateManager::BindSamplers(unsigned int first, unsigned int count, const GLuint* samplers)
 {
-    #ifdef GL_ARB_multi_bind
-    if (HasExtension(GLExt::ARB_multi_bind))
+    #ifdef LLGL_DEBUG
+    LLGL_ASSERT_RANGE(first + count, numTextureLayers + 1);
+    #endif
+
+    /* Reduce binding range to the subrange of samplers that have changed */
+    while (count > 0 && samplerState_.boundSamplers[first] == *samplers)
+    {
+        ++first;
+        ++samplers;
+        --count;
+    }
+
+    while (count > 0 && samplerState_.boundSamplers[first + count - 1] == samplers[count - 1])
+        --count;
+
+    if (count == 0)
+        return;
+
+    if (dispatchTable_.bindSamplers)
     {
         /* Bind all samplers at once */
-        glBindSamplers(first, static_cast<GLsizei>(count), samplers);
+        dispatchTable_.bindSamplers(first, static_cast<GLsizei>(count), samplers);
 
-        /* Store bound textures */
+        /* Store bound samplers */
         for (unsigned int i = 0; i < count; ++i)
-            samplerState_.boundSamplers[i] = samplers[i];
+            samplerState_.boundSamplers[first + i] = samplers[i];
     }
     else
-    #endif
     {
         /* Bind each sampler individually */
         for (unsigned int i = 0; i < count; ++i)
@@ -904,6 +1025,16 @@ void GLStateManager::BindSamplers(unsigned int first, unsigned int count, const
     }
 }
 
+void GLStateManager::NotifySamplerRelease(GLuint sampler)
+{
+    /* Invalidate sampler binding memory for this sampler on all layers */
+    for (auto& boundSampler : samplerState_.boundSamplers)
+    {
+        if (boundSampler == sampler)
+            boundSampler = 0;
+    }
+}
+
 /* ----- Shader binding ----- */
 
 void GLStateManager::BindShaderProgram(GLuint program)
@@ -943,6 +1074,18 @@ void GLStateManager::SetActiveTextureLayer(unsigned int layer)
     activeTextureLayer_ = &(textureState_.layers[textureState_.activeTexture]);
 }
 
+bool GLStateManager::IsIndexedBufferBound(std::size_t targetIdx, GLuint index, GLuint buffer) const
+{
+    /* Indices beyond the cached range are always considered as changed */
+    return (index < numBufferIndices && bufferState_.boundIndexedBuffers[targetIdx][index] == buffer);
+}
+
+void GLStateManager::StoreIndexedBuffer(std::size_t targetIdx, GLuint index, GLuint buffer)
+{
+    if (index < numBufferIndices)
+        bufferState_.boundIndexedBuffers[targetIdx][index] = buffer;
+}
+
 
 } // /namespace LLGL
 
@@ -12,6 +12,7 @@
 #include "GLState.h"
 #include "../Buffer/GLBuffer.h"
 #include "../Texture/GLTexture.h"
+#include "../Ext/GLDispatchTable.h"
 #include <LLGL/RenderContextFlags.h>
 #include <array>
 #include <vector>
@@ -35,8 +36,15 @@ class GLStateManager
         // Active state manager. Each GL context has its own states, thus its own state manager.
         static GLStateManager* active;
 
+        // Determines the extension dependent states and resolves the dispatch table of this GL context.
         void DetermineExtensions();
 
+        // Returns the dispatch table of this GL context, which is valid after "DetermineExtensions" has been called.
+        inline const GLDispatchTable& GetDispatchTable() const
+        {
+            return dispatchTable_;
+        }
+
         //! Notifies the state manager about a new render-target height.
         void NotifyRenderTargetHeight(GLint height);
 
@@ -70,13 +78,13 @@ class GLStateManager
         /* ----- Common states ----- */
 
         void SetViewport(GLViewport& viewport);
-        void SetViewportArray(std::vector<GLViewport>&& viewports);
+        void SetViewportArray(GLsizei count, GLViewport* viewports);
 
-        void SetDepthRange(GLDepthRange& depthRange);
-        void SetDepthRangeArray(std::vector<GLDepthRange>&& depthRanges);
+        void SetDepthRange(const GLDepthRange& depthRange);
+        void SetDepthRangeArray(GLsizei count, const GLDepthRange* depthRanges);
 
         void SetScissor(GLScissor& scissor);
-        void SetScissorArray(std::vector<GLScissor>&& scissors);
+        void SetScissorArray(GLsizei count, GLScissor* scissors);
 
         void SetBlendStates(const std::vector<GLBlend>& blendStates, bool blendEnabled);
 
@@ -110,6 +118,8 @@ class GLStateManager
 
         void BindBuffer(const GLBuffer& buffer);
 
+        void NotifyBufferRelease(GLuint buffer);
+
         /* ----- Framebuffer ----- */
 
         void BindFramebuffer(GLFramebufferTarget target, GLuint framebuffer);
@@ -132,6 +142,7 @@ class GLStateManager
         void PopBoundTexture();
 
         void BindTexture(const GLTexture& texture);
+        void BindTexture(unsigned int layer, const GLTexture& texture);
 
         void NotifyTextureRelease(GLTextureTarget target, GLuint texture);
 
@@ -140,6 +151,8 @@ class GLStateManager
         void BindSampler(unsigned int layer, GLuint sampler);
         void BindSamplers(unsigned int first, unsigned int count, const GLuint* samplers);
 
+        void NotifySamplerRelease(GLuint sampler);
+
         /* ----- Shader ----- */
 
         void BindShaderProgram(GLuint program);
@@ -147,6 +160,11 @@ class GLStateManager
         void PushShaderProgram();
         void PopShaderProgram();
 
+        /* ----- Constants ----- */
+
+        // Maximal number of viewports and scissors per array (minimum of GL_MAX_VIEWPORTS guaranteed by GL_ARB_viewport_array).
+        static const unsigned int maxNumViewports       = 16;
+
     private:
 
         /* ----- Functions ----- */
@@ -160,9 +178,13 @@ class GLStateManager
 
         void SetActiveTextureLayer(unsigned int layer);
 
+        bool IsIndexedBufferBound(std::size_t targetIdx, GLuint index, GLuint buffer) const;
+        void StoreIndexedBuffer(std::size_t targetIdx, GLuint index, GLuint buffer);
+
         /* ----- Constants ----- */
 
         static const unsigned int numTextureLayers      = 32;
+        static const unsigned int numBufferIndices      = 32;
         static const unsigned int numStates             = (static_cast<unsigned int>(GLState::PROGRAM_POINT_SIZE) + 1);
         static const unsigned int numBufferTargets      = (static_cast<unsigned int>(GLBufferTarget::UNIFORM_BUFFER) + 1);
         static const unsigned int numFramebufferTargets = (static_cast<unsigned int>(GLFramebufferTarget::READ_FRAMEBUFFER) + 1);
@@ -225,6 +247,9 @@ class GLStateManager
 
             std::array<GLuint, numBufferTargets>    boundBuffers;
             std::stack<StackEntry>                  boundBufferStack;
+
+            // Buffers bound to the indexed binding points (only the first 'numBufferIndices' indices are cached)
+            std::array<std::array<GLuint, numBufferIndices>, numBufferTargets> boundIndexedBuffers;
         };
 
         struct GLFramebufferState
@@ -273,6 +298,17 @@ class GLStateManager
             std::array<GLuint, numTextureLayers> boundSamplers;
         };
 
+        // Viewports, depth-ranges, and scissors of the last array submissions (only the first 'num...' entries are valid)
+        struct GLViewportArrayState
+        {
+            GLsizei                                     numViewports    = 0;
+            GLsizei                                     numDepthRanges  = 0;
+            GLsizei                                     numScissors     = 0;
+            std::array<GLViewport, maxNumViewports>     viewports;
+            std::array<GLDepthRange, maxNumViewports>   depthRanges;
+            std::array<GLScissor, maxNumViewports>      scissors;
+        };
+
         /* ----- Members ----- */
 
         GraphicsAPIDependentStateDescriptor gfxDependentState_;
@@ -286,11 +322,14 @@ class GLStateManager
         GLVertexArrayState                  vertexArrayState_;
         GLShaderState                       shaderState_;
         GLSamplerState                      samplerState_;
+        GLViewportArrayState                viewportArrayState_;
 
         #ifdef LLGL_GL_ENABLE_VENDOR_EXT
         GLRenderStateExt                    renderStateExt_;
         #endif
 
+        GLDispatchTable                     dispatchTable_;
+
         GLTextureLayer*                     activeTextureLayer_ = nullptr;
 
         bool                                emulateClipControl_ = false;
@@ -17,6 +17,8 @@
 #include <LLGL/VertexFormat.h>
 #include <vector>
 #include <stdexcept>
+#include <algorithm>
+#include <functional>
 
 
 namespace LLGL
@@ -85,6 +87,8 @@ bool GLShaderProgram::LinkShaders()
         {
             auto result = LinkShaderProgram();
             BuildTransformFeedbackVaryingsNV(streamOutputFormat_.attributes);
+            if (result)
+                ReflectStreamOutputAttributes();
             return result;
         }
         #endif
@@ -159,7 +163,198 @@ static std::pair<VectorType, unsigned int> UnmapAttribType(GLenum type)
     return { VectorType::Float, 0 };
 }
 
-std::vector<VertexAttribute> GLShaderProgram::QueryVertexAttributes() const
+const std::vector<VertexAttribute>& GLShaderProgram::QueryVertexAttributes() const
+{
+    return reflection_.vertexAttributes;
+}
+
+const std::vector<StreamOutputAttribute>& GLShaderProgram::QueryStreamOutputAttributes() const
+{
+    #ifndef __APPLE__
+    if (!HasExtension(GLExt::EXT_transform_feedback) && !HasExtension(GLExt::NV_transform_feedback))
+        ThrowNotSupported("stream-outputs");
+    #endif
+    return reflection_.streamOutputAttributes;
+}
+
+const std::vector<ConstantBufferViewDescriptor>& GLShaderProgram::QueryConstantBuffers() const
+{
+    return reflection_.constantBuffers;
+}
+
+const std::vector<StorageBufferViewDescriptor>& GLShaderProgram::QueryStorageBuffers() const
+{
+    return reflection_.storageBuffers;
+}
+
+const std::vector<UniformDescriptor>& GLShaderProgram::QueryUniforms() const
+{
+    return reflection_.uniforms;
+}
+
+void GLShaderProgram::BuildInputLayout(const VertexFormat& vertexFormat)
+{
+    if (vertexFormat.attributes.size() > GL_MAX_VERTEX_ATTRIBS)
+    {
+        throw std::invalid_argument(
+            "failed to bind vertex attributes, because too many attributes are specified (maximum is " +
+            std::to_string(GL_MAX_VERTEX_ATTRIBS) + ")"
+        );
+    }
+
+    /* Bind all vertex attribute locations */
+    GLuint index = 0;
+
+    for (const auto& attrib : vertexFormat.attributes)
+    {
+        /* Bind attribute location (matrices only use the column) */
+        if (attrib.semanticIndex == 0)
+            glBindAttribLocation(id_, index, attrib.name.c_str());
+        ++index;
+    }
+
+    /* Re-link shader program if the shader has already been linked */
+    if (isLinked_)
+        LinkShaderProgram();
+}
+
+// Returns the descriptor with the specified name by its flat name hash, or null if there is no such descriptor.
+template <typename T>
+static const T* FindReflectionDesc(const std::vector<T>& descs, const std::vector<GLReflectionName>& names, const std::string& name)
+{
+    const auto hash = std::hash<std::string>()(name);
+
+    auto it = std::lower_bound(
+        names.begin(), names.end(), hash,
+        [](const GLReflectionName& entry, std::size_t value)
+        {
+            return (entry.hash < value);
+        }
+    );
+
+    for (; it != names.end() && it->hash == hash; ++it)
+    {
+        const auto& desc = descs[it->index];
+        if (desc.name == name)
+            return (&desc);
+    }
+
+    return nullptr;
+}
+
+void GLShaderProgram::BindConstantBuffer(const std::string& name, unsigned int bindingIndex)
+{
+    /* Find uniform block index in the cached reflection and bind it to the specified binding index */
+    if (auto desc = FindReflectionDesc(reflection_.constantBuffers, reflection_.constantBufferNames, name))
+        glUniformBlockBinding(id_, desc->index, bindingIndex);
+    else
+        throw std::invalid_argument("failed to bind constant buffer, because uniform block name is invalid");
+}
+
+void GLShaderProgram::BindStorageBuffer(const std::string& name, unsigned int bindingIndex)
+{
+    #ifndef __APPLE__
+    /* Find shader storage block index in the cached reflection and bind it to the specified binding index */
+    if (auto desc = FindReflectionDesc(reflection_.storageBuffers, reflection_.storageBufferNames, name))
+        glShaderStorageBlockBinding(id_, desc->index, bindingIndex);
+    else
+        throw std::invalid_argument("failed to bind storage buffer, because storage block name is invalid");
+    #else
+    throw std::runtime_error("storage buffers not supported on this platform");
+    #endif
+}
+
+ShaderUniform* GLShaderProgram::LockShaderUniform()
+{
+    GLStateManager::active->PushShaderProgram();
+    GLStateManager::active->BindShaderProgram(id_);
+    return (&uniform_);
+}
+
+void GLShaderProgram::UnlockShaderUniform()
+{
+    GLStateManager::active->PopShaderProgram();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLShaderProgram::QueryActiveAttribs(
+    GLenum attribCountType, GLenum attribNameLengthType,
+    GLint& numAttribs, GLint& maxNameLength, std::vector<char>& nameBuffer) const
+{
+    /* Query number of active attributes */
+    glGetProgramiv(id_, attribCountType, &numAttribs);
+    if (numAttribs <= 0)
+        return false;
+
+    /* Query maximal name length of all attributes */
+    glGetProgramiv(id_, attribNameLengthType, &maxNameLength);
+    if (maxNameLength <= 0)
+        return false;
+
+    nameBuffer.resize(maxNameLength, '\0');
+
+    return true;
+}
+
+bool GLShaderProgram::LinkShaderProgram()
+{
+    /* Link shader program */
+    glLinkProgram(id_);
+
+    /* Query linking status */
+    GLint linkStatus = 0;
+    glGetProgramiv(id_, GL_LINK_STATUS, &linkStatus);
+
+    /* Store if program is linked successful */
+    isLinked_ = (linkStatus != GL_FALSE);
+
+    /* Cache reflection data of the new program binary */
+    if (isLinked_)
+        BuildReflection();
+
+    return isLinked_;
+}
+
+// Builds the flat name hash for the specified descriptors, which is sorted by hash value.
+template <typename T>
+static void BuildReflectionNames(const std::vector<T>& descs, std::vector<GLReflectionName>& names)
+{
+    names.reserve(descs.size());
+
+    for (std::size_t i = 0; i < descs.size(); ++i)
+        names.push_back({ std::hash<std::string>()(descs[i].name), i });
+
+    std::sort(
+        names.begin(), names.end(),
+        [](const GLReflectionName& lhs, const GLReflectionName& rhs)
+        {
+            return (lhs.hash < rhs.hash);
+        }
+    );
+}
+
+void GLShaderProgram::BuildReflection()
+{
+    /* Reset previous reflection data */
+    reflection_ = GLShaderReflection();
+
+    /* Query all reflection data once, so the query functions don't need to call into GL again */
+    ReflectVertexAttributes();
+    ReflectStreamOutputAttributes();
+    ReflectConstantBuffers();
+    ReflectStorageBuffers();
+    ReflectUniforms();
+
+    /* Build name hashes for the block lookups by name */
+    BuildReflectionNames(reflection_.constantBuffers, reflection_.constantBufferNames);
+    BuildReflectionNames(reflection_.storageBuffers, reflection_.storageBufferNames);
+}
+
+void GLShaderProgram::ReflectVertexAttributes()
 {
     VertexFormat vertexFormat;
 
@@ -167,7 +362,7 @@ std::vector<VertexAttribute> GLShaderProgram::QueryVertexAttributes() const
     std::vector<char> attribName;
     GLint numAttribs = 0, maxNameLength = 0;
     if (!QueryActiveAttribs(GL_ACTIVE_ATTRIBUTES, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, numAttribs, maxNameLength, attribName))
-        return {};
+        return;
 
     /* Iterate over all vertex attributes */
     for (GLuint i = 0; i < static_cast<GLuint>(numAttribs); ++i)
@@ -188,10 +383,10 @@ std::vector<VertexAttribute> GLShaderProgram::QueryVertexAttributes() const
             vertexFormat.AppendAttribute({ name, attr.first });
     }
 
-    return vertexFormat.attributes;
+    reflection_.vertexAttributes = std::move(vertexFormat.attributes);
 }
 
-std::vector<StreamOutputAttribute> GLShaderProgram::QueryStreamOutputAttributes() const
+void GLShaderProgram::ReflectStreamOutputAttributes()
 {
     StreamOutputFormat streamOutputFormat;
     StreamOutputAttribute soAttrib;
@@ -204,7 +399,7 @@ std::vector<StreamOutputAttribute> GLShaderProgram::QueryStreamOutputAttributes(
         std::vector<char> attribName;
         GLint numVaryings = 0, maxNameLength = 0;
         if (!QueryActiveAttribs(GL_TRANSFORM_FEEDBACK_VARYINGS, GL_TRANSFORM_FEEDBACK_VARYING_MAX_LENGTH, numVaryings, maxNameLength, attribName))
-            return {};
+            return;
 
         /* Iterate over all vertex attributes */
         for (GLuint i = 0; i < static_cast<GLuint>(numVaryings); ++i)
@@ -236,7 +431,7 @@ std::vector<StreamOutputAttribute> GLShaderProgram::QueryStreamOutputAttributes(
         std::vector<char> attribName;
         GLint numVaryings = 0, maxNameLength = 0;
         if (!QueryActiveAttribs(GL_ACTIVE_VARYINGS_NV, GL_ACTIVE_VARYING_MAX_LENGTH_NV, numVaryings, maxNameLength, attribName))
-            return {};
+            return;
 
         /* Iterate over all vertex attributes */
         for (GLuint i = 0; i < static_cast<GLuint>(numVaryings); ++i)
@@ -261,22 +456,23 @@ std::vector<StreamOutputAttribute> GLShaderProgram::QueryStreamOutputAttributes(
             #endif
         }
     }
-    else
-        ThrowNotSupported("stream-outputs");
     #endif
 
-    return streamOutputFormat.attributes;
+    reflection_.streamOutputAttributes = std::move(streamOutputFormat.attributes);
 }
 
-std::vector<ConstantBufferViewDescriptor> GLShaderProgram::QueryConstantBuffers() const
+void GLShaderProgram::ReflectConstantBuffers()
 {
-    std::vector<ConstantBufferViewDescriptor> descList;
+    if (!HasExtension(GLExt::ARB_uniform_buffer_object))
+        return;
 
     /* Query active uniform blocks */
     std::vector<char> blockName;
     GLint numUniformBlocks = 0, maxNameLength = 0;
     if (!QueryActiveAttribs(GL_ACTIVE_UNIFORM_BLOCKS, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, numUniformBlocks, maxNameLength, blockName))
-        return {};
+        return;
+
+    reflection_.constantBuffers.reserve(static_cast<std::size_t>(numUniformBlocks));
 
     /* Iterate over all uniform blocks */
     for (GLuint i = 0; i < static_cast<GLuint>(numUniformBlocks); ++i)
@@ -295,34 +491,33 @@ std::vector<ConstantBufferViewDescriptor> GLShaderProgram::QueryConstantBuffers(
         desc.size = blockSize;
 
         /* Insert uniform block into list */
-        descList.push_back(desc);
+        reflection_.constantBuffers.push_back(std::move(desc));
     }
-
-    return descList;
 }
 
-std::vector<StorageBufferViewDescriptor> GLShaderProgram::QueryStorageBuffers() const
+void GLShaderProgram::ReflectStorageBuffers()
 {
-    std::vector<StorageBufferViewDescriptor> descList;
-
     #ifndef __APPLE__
-    
+
+    if (!HasExtension(GLExt::ARB_program_interface_query) || !HasExtension(GLExt::ARB_shader_storage_buffer_object))
+        return;
+
     /* Query number of shader storage blocks */
-    GLenum properties[3] = { 0 };
-    properties[0] = GL_NUM_ACTIVE_VARIABLES;
     GLint numStorageBlocks = 0;
-    glGetProgramResourceiv(id_, GL_SHADER_STORAGE_BLOCK, 0, 1, properties, 1, nullptr, &numStorageBlocks);
+    glGetProgramInterfaceiv(id_, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES, &numStorageBlocks);
     if (numStorageBlocks <= 0)
-        return descList;
+        return;
 
     /* Query maximal name length of all shader storage blocks */
     GLint maxNameLength = 0;
     glGetProgramInterfaceiv(id_, GL_SHADER_STORAGE_BLOCK, GL_MAX_NAME_LENGTH, &maxNameLength);
     if (maxNameLength <= 0)
-        return descList;
+        return;
 
     std::vector<char> blockName(maxNameLength, 0);
 
+    reflection_.storageBuffers.reserve(static_cast<std::size_t>(numStorageBlocks));
+
     /* Iterate over all shader storage blocks */
     for (GLuint i = 0; i < static_cast<GLuint>(numStorageBlocks); ++i)
     {
@@ -335,23 +530,21 @@ std::vector<StorageBufferViewDescriptor> GLShaderProgram::QueryStorageBuffers()
         desc.name = std::string(blockName.data());
 
         /* Insert shader storage block into list */
-        descList.push_back(desc);
+        reflection_.storageBuffers.push_back(std::move(desc));
     }
-    
-    #endif
 
-    return descList;
+    #endif
 }
 
-std::vector<UniformDescriptor> GLShaderProgram::QueryUniforms() const
+void GLShaderProgram::ReflectUniforms()
 {
-    std::vector<UniformDescriptor> descList;
-
     /* Query active uniforms */
     std::vector<char> uniformName;
     GLint numUniforms = 0, maxNameLength = 0;
     if (!QueryActiveAttribs(GL_ACTIVE_UNIFORMS, GL_ACTIVE_UNIFORM_MAX_LENGTH, numUniforms, maxNameLength, uniformName))
-        return {};
+        return;
+
+    reflection_.uniforms.reserve(static_cast<std::size_t>(numUniforms));
 
     /* Iterate over all uniforms */
     for (GLuint i = 0; i < static_cast<GLuint>(numUniforms); ++i)
@@ -374,116 +567,13 @@ std::vector<UniformDescriptor> GLShaderProgram::QueryUniforms() const
             GLTypes::Unmap(desc.type, type);
 
             /* Insert uniform block into list */
-            descList.push_back(desc);
+            reflection_.uniforms.push_back(std::move(desc));
         }
         catch (const std::exception& e)
         {
             Log::StdOut() << e.what() << std::endl;
         }
     }
-
-    return descList;
-}
-
-void GLShaderProgram::BuildInputLayout(const VertexFormat& vertexFormat)
-{
-    if (vertexFormat.attributes.size() > GL_MAX_VERTEX_ATTRIBS)
-    {
-        throw std::invalid_argument(
-            "failed to bind vertex attributes, because too many attributes are specified (maximum is " +
-            std::to_string(GL_MAX_VERTEX_ATTRIBS) + ")"
-        );
-    }
-
-    /* Bind all vertex attribute locations */
-    GLuint index = 0;
-
-    for (const auto& attrib : vertexFormat.attributes)
-    {
-        /* Bind attribute location (matrices only use the column) */
-        if (attrib.semanticIndex == 0)
-            glBindAttribLocation(id_, index, attrib.name.c_str());
-        ++index;
-    }
-
-    /* Re-link shader program if the shader has already been linked */
-    if (isLinked_)
-        LinkShaderProgram();
-}
-
-void GLShaderProgram::BindConstantBuffer(const std::string& name, unsigned int bindingIndex)
-{
-    /* Query uniform block index and bind it to the specified binding index */
-    auto blockIndex = glGetUniformBlockIndex(id_, name.c_str());
-    if (blockIndex != GL_INVALID_INDEX)
-        glUniformBlockBinding(id_, blockIndex, bindingIndex);
-    else
-        throw std::invalid_argument("failed to bind constant buffer, because uniform block name is invalid");
-}
-
-void GLShaderProgram::BindStorageBuffer(const std::string& name, unsigned int bindingIndex)
-{
-    #ifndef __APPLE__
-    /* Query shader storage block index and bind it to the specified binding index */
-    auto blockIndex = glGetProgramResourceIndex(id_, GL_SHADER_STORAGE_BLOCK, name.c_str());
-    if (blockIndex != GL_INVALID_INDEX)
-        glShaderStorageBlockBinding(id_, blockIndex, bindingIndex);
-    else
-        throw std::invalid_argument("failed to bind storage buffer, because storage block name is invalid");
-    #else
-    throw std::runtime_error("storage buffers not supported on this platform");
-    #endif
-}
-
-ShaderUniform* GLShaderProgram::LockShaderUniform()
-{
-    GLStateManager::active->PushShaderProgram();
-    GLStateManager::active->BindShaderProgram(id_);
-    return (&uniform_);
-}
-
-void GLShaderProgram::UnlockShaderUniform()
-{
-    GLStateManager::active->PopShaderProgram();
-}
-
-
-/*
- * ======= Private: =======
- */
-
-bool GLShaderProgram::QueryActiveAttribs(
-    GLenum attribCountType, GLenum attribNameLengthType,
-    GLint& numAttribs, GLint& maxNameLength, std::vector<char>& nameBuffer) const
-{
-    /* Query number of active attributes */
-    glGetProgramiv(id_, attribCountType, &numAttribs);
-    if (numAttribs <= 0)
-        return false;
-
-    /* Query maximal name length of all attributes */
-    glGetProgramiv(id_, attribNameLengthType, &maxNameLength);
-    if (maxNameLength <= 0)
-        return false;
-
-    nameBuffer.resize(maxNameLength, '\0');
-
-    return true;
-}
-
-bool GLShaderProgram::LinkShaderProgram()
-{
-    /* Link shader program */
-    glLinkProgram(id_);
-
-    /* Query linking status */
-    GLint linkStatus = 0;
-    glGetProgramiv(id_, GL_LINK_STATUS, &linkStatus);
-
-    /* Store if program is linked successful */
-    isLinked_ = (linkStatus != GL_FALSE);
-
-    return isLinked_;
 }
 
 void GLShaderProgram::BuildTransformFeedbackVaryingsEXT(const std::vector<StreamOutputAttribute>& attributes)
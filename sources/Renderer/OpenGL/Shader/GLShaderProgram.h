@@ -12,12 +12,35 @@
 #include <LLGL/ShaderProgram.h>
 #include "GLShaderUniform.h"
 #include "../OpenGL.h"
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+// Entry of a flat name hash, which refers to a descriptor of the reflection data by its index.
+struct GLReflectionName
+{
+    std::size_t hash;   // Hash of the descriptor name
+    std::size_t index;  // Index of the descriptor within its list
+};
+
+/*
+Reflection data of a linked GLSL shader program.
+Each resource name is only stored once within its descriptor, and the name hashes (sorted by hash value) only refer to these descriptors.
+*/
+struct GLShaderReflection
+{
+    std::vector<VertexAttribute>                vertexAttributes;
+    std::vector<StreamOutputAttribute>          streamOutputAttributes;
+    std::vector<ConstantBufferViewDescriptor>   constantBuffers;
+    std::vector<StorageBufferViewDescriptor>    storageBuffers;
+    std::vector<UniformDescriptor>              uniforms;
+    std::vector<GLReflectionName>               constantBufferNames;
+    std::vector<GLReflectionName>               storageBufferNames;
+};
+
 class GLShaderProgram : public ShaderProgram
 {
 
@@ -33,11 +56,11 @@ class GLShaderProgram : public ShaderProgram
 
         std::string QueryInfoLog() override;
 
-        std::vector<VertexAttribute> QueryVertexAttributes() const override;
-        std::vector<StreamOutputAttribute> QueryStreamOutputAttributes() const override;
-        std::vector<ConstantBufferViewDescriptor> QueryConstantBuffers() const override;
-        std::vector<StorageBufferViewDescriptor> QueryStorageBuffers() const override;
-        std::vector<UniformDescriptor> QueryUniforms() const override;
+        const std::vector<VertexAttribute>& QueryVertexAttributes() const override;
+        const std::vector<StreamOutputAttribute>& QueryStreamOutputAttributes() const override;
+        const std::vector<ConstantBufferViewDescriptor>& QueryConstantBuffers() const override;
+        const std::vector<StorageBufferViewDescriptor>& QueryStorageBuffers() const override;
+        const std::vector<UniformDescriptor>& QueryUniforms() const override;
 
         void BuildInputLayout(const VertexFormat& vertexFormat) override;
         void BindConstantBuffer(const std::string& name, unsigned int bindingIndex) override;
@@ -58,6 +81,12 @@ class GLShaderProgram : public ShaderProgram
             return hasFragmentShader_;
         }
 
+        // Returns the reflection data, which has been cached when the shader program was linked.
+        inline const GLShaderReflection& GetReflection() const
+        {
+            return reflection_;
+        }
+
     private:
 
         bool QueryActiveAttribs(
@@ -67,6 +96,13 @@ class GLShaderProgram : public ShaderProgram
 
         bool LinkShaderProgram();
 
+        void BuildReflection();
+        void ReflectVertexAttributes();
+        void ReflectStreamOutputAttributes();
+        void ReflectConstantBuffers();
+        void ReflectStorageBuffers();
+        void ReflectUniforms();
+
         void BuildTransformFeedbackVaryingsEXT(const std::vector<StreamOutputAttribute>& attributes);
     
         #ifndef __APPLE__
@@ -82,6 +118,8 @@ class GLShaderProgram : public ShaderProgram
 
         StreamOutputFormat  streamOutputFormat_;
 
+        GLShaderReflection  reflection_;
+
 };
 
 
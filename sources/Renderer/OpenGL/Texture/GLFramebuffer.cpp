@@ -8,6 +8,7 @@
 #include "GLFramebuffer.h"
 #include "../Ext/GLExtensions.h"
 #include "../RenderState/GLStateManager.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
 
 
 namespace LLGL
@@ -87,6 +88,14 @@ void GLFramebuffer::Blit(
     );
 }
 
+void GLFramebuffer::Invalidate(GLenum target, GLsizei numAttachments, const GLenum* attachments)
+{
+    #ifdef GL_ARB_invalidate_subdata
+    if (numAttachments > 0 && HasExtension(GLExt::ARB_invalidate_subdata))
+        glInvalidateFramebuffer(target, numAttachments, attachments);
+    #endif
+}
+
 
 } // /namespace LLGL
 
@@ -50,6 +50,9 @@ class GLFramebuffer
             GLenum mask, GLenum filter
         );
 
+        // Invalidates the specified attachments of the framebuffer bound to 'target' (only if "GL_ARB_invalidate_subdata" is supported).
+        static void Invalidate(GLenum target, GLsizei numAttachments, const GLenum* attachments);
+
         // Returns the hardware buffer ID.
         inline GLuint GetID() const
         {
@@ -12,6 +12,7 @@
 #include "../../GLCommon/GLTypes.h"
 #include "../../GLCommon/GLCore.h"
 #include "../../../Core/Helper.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -24,13 +25,19 @@ static void DepthAttachmentFailed()
     throw std::runtime_error("attachment to render target failed, because render target already has a depth- or depth-stencil buffer");
 }
 
-GLRenderTarget::GLRenderTarget(const RenderTargetDescriptor& desc) :
-    multiSamples_ { static_cast<GLsizei>(desc.multiSampling.SampleCount()) }
+GLRenderTarget::GLRenderTarget(MemoryAccounting& memoryAccounting, const RenderTargetDescriptor& desc) :
+    multiSamples_       { static_cast<GLsizei>(desc.multiSampling.SampleCount()) },
+    memoryAccounting_   { memoryAccounting                                       }
 {
     if (HasMultiSampling() && !desc.customMultiSampling)
         CreateOnceFramebufferMS();
 }
 
+GLRenderTarget::~GLRenderTarget()
+{
+    SetRenderbufferMemory(0);
+}
+
 void GLRenderTarget::AttachDepthBuffer(const Gs::Vector2ui& size)
 {
     AttachRenderbuffer(size, GL_DEPTH_COMPONENT, GL_DEPTH_ATTACHMENT);
@@ -166,6 +173,8 @@ void GLRenderTarget::DetachAll()
     renderbuffersMS_.clear();
 
     blitMask_ = 0;
+
+    SetRenderbufferMemory(0);
 }
 
 /* ----- Extended Internal Functions ----- */
@@ -174,24 +183,56 @@ void GLRenderTarget::DetachAll()
 Blit (or rather copy) each multi-sample attachment from the
 multi-sample framebuffer (read) into the main framebuffer (draw)
 */
-void GLRenderTarget::BlitOntoFrameBuffer()
+void GLRenderTarget::BlitOntoFrameBuffer(const StoreOps* storeOps)
 {
     if (framebufferMS_)
     {
         framebuffer_.Bind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
         framebufferMS_->Bind(GLFramebufferTarget::READ_FRAMEBUFFER);
 
-        for (auto attachment : colorAttachments_)
+        /* Blit depth and stencil buffers only once together with the first color attachment */
+        auto depthStencilMask = (blitMask_ & (GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
+
+        if (storeOps)
         {
-            glReadBuffer(attachment);
-            glDrawBuffer(attachment);
+            if (storeOps->depthOp == AttachmentStoreOp::Discard)
+                depthStencilMask &= ~GL_DEPTH_BUFFER_BIT;
+            if (storeOps->stencilOp == AttachmentStoreOp::Discard)
+                depthStencilMask &= ~GL_STENCIL_BUFFER_BIT;
+        }
 
-            GLFramebuffer::Blit(GetResolution().Cast<int>(), blitMask_);
+        for (std::size_t i = 0; i < colorAttachments_.size(); ++i)
+        {
+            /* Skip color attachments that are discarded */
+            if (storeOps && i < storeOps->numColorOps && storeOps->colorOps[i] == AttachmentStoreOp::Discard)
+                continue;
+
+            glReadBuffer(colorAttachments_[i]);
+            glDrawBuffer(colorAttachments_[i]);
+
+            GLFramebuffer::Blit(GetResolution().Cast<int>(), GL_COLOR_BUFFER_BIT | depthStencilMask);
+            depthStencilMask = 0;
+        }
+
+        if (depthStencilMask != 0)
+            GLFramebuffer::Blit(GetResolution().Cast<int>(), depthStencilMask);
+
+        if (storeOps)
+        {
+            /* Invalidate multi-sampled attachments that have been resolved or discarded, and non-multi-sampled attachments that have been discarded */
+            InvalidateAttachments(GL_READ_FRAMEBUFFER, *storeOps, true);
+            InvalidateAttachments(GL_DRAW_FRAMEBUFFER, *storeOps, false);
         }
 
         framebufferMS_->Unbind(GLFramebufferTarget::READ_FRAMEBUFFER);
         framebuffer_.Unbind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
     }
+    else if (storeOps)
+    {
+        /* Invalidate attachments that have been discarded */
+        framebuffer_.Bind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
+        InvalidateAttachments(GL_DRAW_FRAMEBUFFER, *storeOps, false);
+    }
 }
 
 /*
@@ -224,13 +265,61 @@ const GLFramebuffer& GLRenderTarget::GetFramebuffer() const
  * ======= Private: =======
  */
 
+// Returns the estimated size (in bytes) of a single sample of the specified renderbuffer format.
+static std::uint64_t GetRenderbufferSampleSize(GLenum internalFormat)
+{
+    switch (internalFormat)
+    {
+        case GL_STENCIL_INDEX:
+        case GL_R8:
+        case GL_R8_SNORM:
+            return 1;
+        case GL_RG8:
+        case GL_RG8_SNORM:
+        case GL_R16:
+        case GL_R16_SNORM:
+        case GL_R16F:
+            return 2;
+        case GL_RGB8:
+        case GL_RGB8_SNORM:
+            return 3;
+        case GL_RGB16:
+        case GL_RGB16_SNORM:
+        case GL_RGB16F:
+            return 6;
+        case GL_RG32UI:
+        case GL_RG32I:
+        case GL_RG32F:
+        case GL_RGBA16:
+        case GL_RGBA16_SNORM:
+        case GL_RGBA16F:
+            return 8;
+        case GL_RGB32UI:
+        case GL_RGB32I:
+        case GL_RGB32F:
+            return 12;
+        case GL_RGBA32UI:
+        case GL_RGBA32I:
+        case GL_RGBA32F:
+            return 16;
+        default:
+            return 4;
+    }
+}
+
 void GLRenderTarget::InitRenderbufferStorage(GLRenderbuffer& renderbuffer, GLenum internalFormat)
 {
+    const auto& resolution = GetResolution();
+
     renderbuffer.Bind();
     {
-        GLRenderbuffer::Storage(internalFormat, GetResolution().Cast<int>(), multiSamples_);
+        GLRenderbuffer::Storage(internalFormat, resolution.Cast<int>(), multiSamples_);
     }
     renderbuffer.Unbind();
+
+    /* Tally estimated renderbuffer memory */
+    auto size = static_cast<std::uint64_t>(resolution.x) * resolution.y * GetRenderbufferSampleSize(internalFormat);
+    SetRenderbufferMemory(renderbufferMemory_ + size * static_cast<std::uint64_t>(std::max(1, multiSamples_)));
 }
 
 GLenum GLRenderTarget::AttachDefaultRenderbuffer(GLFramebuffer& framebuffer, GLenum attachment)
@@ -304,6 +393,9 @@ GLenum GLRenderTarget::MakeFramebufferAttachment(GLint internalFormat)
     else
     {
         /* Add color attachment and color buffer bit to blit mask */
+        if (colorAttachments_.size() >= maxNumColorAttachments)
+            throw std::runtime_error("too many color attachments for render target (limit is " + std::to_string(maxNumColorAttachments) + ")");
+
         blitMask_ |= GL_COLOR_BUFFER_BIT;
         const GLenum attachment = (GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(colorAttachments_.size()));
         colorAttachments_.push_back(attachment);
@@ -331,12 +423,46 @@ void GLRenderTarget::CheckFramebufferStatus(GLenum status, const std::string& in
         throw std::runtime_error(info + " failed (error code = " + GLErrorToStr(status) + ")");
 }
 
+static bool IsAttachmentInvalidated(const AttachmentStoreOp storeOp, bool resolved)
+{
+    return (storeOp == AttachmentStoreOp::Discard || (resolved && storeOp == AttachmentStoreOp::Resolve));
+}
+
+void GLRenderTarget::InvalidateAttachments(GLenum target, const StoreOps& storeOps, bool resolved)
+{
+    GLenum attachments[maxNumColorAttachments + 2];
+    GLsizei numAttachments = 0;
+
+    /* Gather color attachments (attachments without an entry in the render pass are stored) */
+    auto numColorAttachments = std::min(colorAttachments_.size(), storeOps.numColorOps);
+
+    for (std::size_t i = 0; i < numColorAttachments; ++i)
+    {
+        if (IsAttachmentInvalidated(storeOps.colorOps[i], resolved))
+            attachments[numAttachments++] = colorAttachments_[i];
+    }
+
+    /* Gather depth and stencil attachments (attachments that do not exist are ignored by GL) */
+    if (IsAttachmentInvalidated(storeOps.depthOp, resolved))
+        attachments[numAttachments++] = GL_DEPTH_ATTACHMENT;
+    if (IsAttachmentInvalidated(storeOps.stencilOp, resolved))
+        attachments[numAttachments++] = GL_STENCIL_ATTACHMENT;
+
+    GLFramebuffer::Invalidate(target, numAttachments, attachments);
+}
+
 void GLRenderTarget::CreateOnceFramebufferMS()
 {
     if (!framebufferMS_)
         framebufferMS_ = MakeUnique<GLFramebuffer>();
 }
 
+void GLRenderTarget::SetRenderbufferMemory(std::uint64_t size)
+{
+    memoryAccounting_.Resize(MemoryAccounting::Type::RenderTarget, renderbufferMemory_, size);
+    renderbufferMemory_ = size;
+}
+
 bool GLRenderTarget::HasMultiSampling() const
 {
     return (multiSamples_ > 1);
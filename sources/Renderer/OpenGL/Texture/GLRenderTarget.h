@@ -10,9 +10,11 @@
 
 
 #include <LLGL/RenderTarget.h>
+#include <LLGL/RenderPassFlags.h>
 #include "GLFramebuffer.h"
 #include "GLRenderbuffer.h"
 #include "GLTexture.h"
+#include "../../MemoryAccounting.h"
 #include <functional>
 #include <vector>
 #include <memory>
@@ -27,7 +29,20 @@ class GLRenderTarget : public RenderTarget
 
     public:
 
-        GLRenderTarget(const RenderTargetDescriptor& desc);
+        // Maximal number of color attachments, which is the minimum of GL_MAX_COLOR_ATTACHMENTS required by the GL specification.
+        static const std::size_t maxNumColorAttachments = 8;
+
+        // Store operations of a render pass, which are applied when the render pass ends.
+        struct StoreOps
+        {
+            AttachmentStoreOp   colorOps[maxNumColorAttachments];
+            std::size_t         numColorOps                         = 0;
+            AttachmentStoreOp   depthOp                             = AttachmentStoreOp::Store;
+            AttachmentStoreOp   stencilOp                           = AttachmentStoreOp::Store;
+        };
+
+        GLRenderTarget(MemoryAccounting& memoryAccounting, const RenderTargetDescriptor& desc);
+        ~GLRenderTarget();
 
         void AttachDepthBuffer(const Gs::Vector2ui& size) override;
         void AttachStencilBuffer(const Gs::Vector2ui& size) override;
@@ -39,8 +54,11 @@ class GLRenderTarget : public RenderTarget
 
         /* ----- Extended Internal Functions ----- */
 
-        // Blits the multi-sample framebuffer onto the default framebuffer.
-        void BlitOntoFrameBuffer();
+        /*
+        Blits the multi-sample framebuffer onto the default framebuffer, and invalidates all attachments
+        whose content is no longer needed according to the specified store operations (if not null).
+        */
+        void BlitOntoFrameBuffer(const StoreOps* storeOps = nullptr);
 
         // Blits the specified color attachment from the framebuffer onto the screen.
         void BlitOntoScreen(std::size_t colorAttachmentIndex);
@@ -48,6 +66,12 @@ class GLRenderTarget : public RenderTarget
         // Returns the active framebuffer (i.e. either the default framebuffer or the multi-sample framebuffer).
         const GLFramebuffer& GetFramebuffer() const;
 
+        // Returns the number of color attachments.
+        inline std::size_t GetNumColorAttachments() const
+        {
+            return colorAttachments_.size();
+        }
+
     private:
 
         void InitRenderbufferStorage(GLRenderbuffer& renderbuffer, GLenum internalFormat);
@@ -62,8 +86,14 @@ class GLRenderTarget : public RenderTarget
 
         void CheckFramebufferStatus(GLenum status, const std::string& info);
 
+        // Invalidates all attachments of the framebuffer bound to 'target' which are discarded (or resolved, if 'resolved' is true).
+        void InvalidateAttachments(GLenum target, const StoreOps& storeOps, bool resolved);
+
         void CreateOnceFramebufferMS();
 
+        // Changes the tallied memory of all internal renderbuffers.
+        void SetRenderbufferMemory(std::uint64_t size);
+
         bool HasMultiSampling() const;
         bool HasCustomMultiSampling() const;
         bool HasDepthAttachment() const;
@@ -89,6 +119,9 @@ class GLRenderTarget : public RenderTarget
         GLsizei                                         multiSamples_           = 0;
         GLbitfield                                      blitMask_               = 0;
 
+        MemoryAccounting&                               memoryAccounting_;
+        std::uint64_t                                   renderbufferMemory_     = 0;
+
 };
 
 
@@ -8,6 +8,8 @@
 #include "GLTexture.h"
 #include "../RenderState/GLStateManager.h"
 #include "../../GLCommon/GLTypes.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../Ext/GLExtensions.h"
 
 
 namespace LLGL
@@ -29,6 +31,22 @@ Gs::Vector3ui GLTexture::QueryMipLevelSize(unsigned int mipLevel) const
 {
     Gs::Vector3ui size;
 
+    #ifdef GL_ARB_direct_state_access
+    if (HasDirectStateAccess())
+    {
+        GLint texSize[3] = { 0 };
+        glGetTextureLevelParameteriv(id_, mipLevel, GL_TEXTURE_WIDTH,  &texSize[0]);
+        glGetTextureLevelParameteriv(id_, mipLevel, GL_TEXTURE_HEIGHT, &texSize[1]);
+        glGetTextureLevelParameteriv(id_, mipLevel, GL_TEXTURE_DEPTH,  &texSize[2]);
+
+        size.x = static_cast<unsigned int>(texSize[0]);
+        size.y = static_cast<unsigned int>(texSize[1]);
+        size.z = static_cast<unsigned int>(texSize[2]);
+
+        return size;
+    }
+    #endif
+
     GLStateManager::active->PushBoundTexture(GLStateManager::GetTextureTarget(GetType()));
     {
         GLStateManager::active->BindTexture(*this);
@@ -56,6 +74,15 @@ void GLTexture::Recreate()
     glGenTextures(1, &id_);
 }
 
+bool GLTexture::HasDirectStateAccess()
+{
+    #ifdef GL_ARB_direct_state_access
+    return HasExtension(GLExt::ARB_direct_state_access);
+    #else
+    return false;
+    #endif
+}
+
 
 } // /namespace LLGL
 
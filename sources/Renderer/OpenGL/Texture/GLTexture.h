@@ -11,6 +11,7 @@
 
 #include <LLGL/Texture.h>
 #include "../OpenGL.h"
+#include <cstdint>
 
 
 namespace LLGL
@@ -30,15 +31,34 @@ class GLTexture : public Texture
         // Recreates the internal texture object. This will invalidate the previous texture ID.
         void Recreate();
 
+        /*
+        Returns true if textures can be modified and queried with direct state access (GL_ARB_direct_state_access),
+        i.e. without binding them first and thereby perturbing the bindings for rendering.
+        */
+        static bool HasDirectStateAccess();
+
         // Returns the hardware texture ID.
         inline GLuint GetID() const
         {
             return id_;
         }
 
+        // Sets the estimated memory footprint (in bytes), which is used for memory accounting.
+        inline void SetMemoryFootprint(std::uint64_t size)
+        {
+            memoryFootprint_ = size;
+        }
+
+        // Returns the estimated memory footprint (in bytes).
+        inline std::uint64_t GetMemoryFootprint() const
+        {
+            return memoryFootprint_;
+        }
+
     private:
 
-        GLuint id_ = 0;
+        GLuint          id_                 = 0;
+        std::uint64_t   memoryFootprint_    = 0;
 
 };
 
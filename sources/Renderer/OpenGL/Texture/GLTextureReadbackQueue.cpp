@@ -0,0 +1,186 @@
+/*
+ * GLTextureReadbackQueue.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLTextureReadbackQueue.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../../GLCommon/GLTypes.h"
+#include <chrono>
+
+
+namespace LLGL
+{
+
+
+GLTextureReadbackQueue::GLTextureReadbackQueue(GLsizeiptr stagingBufferSize) :
+    packBufferRing_ { GLBufferTarget::PIXEL_PACK_BUFFER, stagingBufferSize }
+{
+}
+
+// Reads the image data of the specified texture, which must be bound unless direct state access is available.
+static void GetTexImage(const GLTexture& texture, GLint mipLevel, GLenum format, GLenum dataType, GLsizeiptr size, void* data)
+{
+    #ifdef GL_ARB_direct_state_access
+    if (GLTexture::HasDirectStateAccess())
+        glGetTextureImage(texture.GetID(), mipLevel, format, dataType, static_cast<GLsizei>(size), data);
+    else
+    #endif
+        glGetTexImage(GLTypes::Map(texture.GetType()), mipLevel, format, dataType, data);
+}
+
+std::uint64_t GLTextureReadbackQueue::ReadTexture(const GLTexture& texture, const TextureReadbackDescriptor& desc)
+{
+    /* Determine image data size of the MIP-map level */
+    auto mipLevelSize   = texture.QueryMipLevelSize(static_cast<unsigned int>(desc.mipLevel));
+    auto elementSize    = ImageFormatSize(desc.format) * DataTypeSize(desc.dataType);
+
+    Readback readback;
+    {
+        readback.desc   = desc;
+        readback.size   = static_cast<GLsizeiptr>(mipLevelSize.x * mipLevelSize.y * mipLevelSize.z * elementSize);
+    }
+
+    /* Bind texture, unless it can be read with direct state access */
+    if (!GLTexture::HasDirectStateAccess())
+        GLStateManager::active->BindTexture(texture);
+
+    auto format     = GLTypes::Map(desc.format);
+    auto dataType   = GLTypes::Map(desc.dataType);
+
+    auto ticket = nextTicket_++;
+
+    if (HasExtension(GLExt::ARB_sync) && HasExtension(GLExt::ARB_map_buffer_range) && readback.size <= packBufferRing_.GetSize())
+    {
+        /* Allocate region in the staging buffer, and copy out all completed readbacks before their regions are overwritten */
+        readback.offset = packBufferRing_.Alloc(readback.size);
+        CopyCompletedReadbacks();
+
+        /* Read image data into the staging buffer, i.e. the output buffer is interpreted as offset into the bound PBO */
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, packBufferRing_.GetID());
+        {
+            GetTexImage(texture, desc.mipLevel, format, dataType, readback.size, reinterpret_cast<void*>(readback.offset));
+        }
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+        readback.ringTicket = packBufferRing_.InsertFence();
+        readbacks_.emplace(ticket, std::move(readback));
+    }
+    else
+    {
+        /* Fall back to synchronous readback, if fences are not supported or the image data does not fit into the staging buffer */
+        readback.data.resize(static_cast<std::size_t>(readback.size));
+        GetTexImage(texture, desc.mipLevel, format, dataType, readback.size, readback.data.data());
+        MakeAvailable(readbacks_.emplace(ticket, std::move(readback)).first->second);
+    }
+
+    return ticket;
+}
+
+bool GLTextureReadbackQueue::Map(std::uint64_t ticket, const void*& data, std::size_t& dataSize)
+{
+    auto it = readbacks_.find(ticket);
+    if (it == readbacks_.end())
+        return false;
+
+    auto& readback = it->second;
+
+    /* Copy image data out of the staging buffer, once the readback has been completed */
+    if (!readback.available)
+    {
+        if (!packBufferRing_.IsComplete(readback.ringTicket))
+            return false;
+        CopyCompletedReadbacks();
+    }
+
+    /* Take the converted image data, once the worker thread has finished */
+    if (readback.conversion.valid())
+    {
+        if (readback.conversion.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return false;
+
+        readback.convertedData = readback.conversion.get();
+
+        const auto& desc = readback.desc;
+        auto numPixels = readback.data.size() / (ImageFormatSize(desc.format) * DataTypeSize(desc.dataType));
+        readback.convertedSize = numPixels * ImageFormatSize(desc.convertFormat) * DataTypeSize(desc.convertDataType);
+    }
+
+    /* Return converted image data, or the original image data if no conversion was necessary */
+    if (readback.convertedData)
+    {
+        data        = readback.convertedData.get();
+        dataSize    = readback.convertedSize;
+    }
+    else
+    {
+        data        = readback.data.data();
+        dataSize    = readback.data.size();
+    }
+
+    return true;
+}
+
+void GLTextureReadbackQueue::Unmap(std::uint64_t ticket)
+{
+    readbacks_.erase(ticket);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLTextureReadbackQueue::CopyCompletedReadbacks()
+{
+    for (auto& entry : readbacks_)
+    {
+        auto& readback = entry.second;
+        if (!readback.available)
+        {
+            /* Readbacks are completed in order, so stop at the first pending one */
+            if (!packBufferRing_.IsComplete(readback.ringTicket))
+                break;
+
+            readback.data.resize(static_cast<std::size_t>(readback.size));
+            packBufferRing_.Read(readback.offset, readback.data.data(), readback.size);
+
+            MakeAvailable(readback);
+        }
+    }
+}
+
+void GLTextureReadbackQueue::MakeAvailable(Readback& readback)
+{
+    readback.available = true;
+
+    if (readback.desc.convert)
+    {
+        /* Convert image data on a worker thread */
+        const auto& desc    = readback.desc;
+        auto srcBuffer      = readback.data.data();
+        auto srcBufferSize  = readback.data.size();
+
+        readback.conversion = std::async(
+            std::launch::async,
+            [desc, srcBuffer, srcBufferSize]()
+            {
+                return ConvertImageBuffer(
+                    desc.format, desc.dataType, srcBuffer, srcBufferSize,
+                    desc.convertFormat, desc.convertDataType
+                );
+            }
+        );
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,78 @@
+/*
+ * GLTextureReadbackQueue.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_TEXTURE_READBACK_QUEUE_H
+#define LLGL_GL_TEXTURE_READBACK_QUEUE_H
+
+
+#include <LLGL/Image.h>
+#include "GLTexture.h"
+#include "../Buffer/GLStagingBufferRing.h"
+#include <map>
+#include <vector>
+#include <future>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Queue of asynchronous texture readbacks through a ring of pixel pack buffer memory.
+The image data of each readback is copied out of the ring as soon as its fence has been signaled,
+so the ring can be recycled independently of when the client maps the result.
+*/
+class GLTextureReadbackQueue
+{
+
+    public:
+
+        GLTextureReadbackQueue(GLsizeiptr stagingBufferSize);
+
+        // Records the readback of the specified texture and returns its ticket.
+        std::uint64_t ReadTexture(const GLTexture& texture, const TextureReadbackDescriptor& desc);
+
+        // Returns the result of the specified readback, or false if the readback has not been completed yet.
+        bool Map(std::uint64_t ticket, const void*& data, std::size_t& dataSize);
+
+        // Releases the result of the specified readback.
+        void Unmap(std::uint64_t ticket);
+
+    private:
+
+        struct Readback
+        {
+            std::uint64_t               ringTicket      = 0;
+            GLintptr                    offset          = 0;
+            GLsizeiptr                  size            = 0;
+            bool                        available       = false;
+            TextureReadbackDescriptor   desc;
+            std::vector<char>           data;
+            std::future<ByteBuffer>     conversion;
+            ByteBuffer                  convertedData;
+            std::size_t                 convertedSize   = 0;
+        };
+
+        void CopyCompletedReadbacks();
+        void MakeAvailable(Readback& readback);
+
+        GLStagingBufferRing                 packBufferRing_;
+        std::map<std::uint64_t, Readback>   readbacks_;
+        std::uint64_t                       nextTicket_     = 1;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
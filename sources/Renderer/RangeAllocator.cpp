@@ -0,0 +1,313 @@
+/*
+ * RangeAllocator.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "RangeAllocator.h"
+#include <stdexcept>
+#include <string>
+
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+// Returns the index of the most significant bit, i.e. floor(log2(value)). The value must not be 0.
+static int FloorLog2(std::uint32_t value)
+{
+    #ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanReverse(&index, value);
+    return static_cast<int>(index);
+    #else
+    return (31 - __builtin_clz(value));
+    #endif
+}
+
+// Returns the index of the least significant bit which is set. The value must not be 0.
+static int LowestBit(std::uint32_t value)
+{
+    #ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward(&index, value);
+    return static_cast<int>(index);
+    #else
+    return __builtin_ctz(value);
+    #endif
+}
+
+RangeAllocator::RangeAllocator(std::uint32_t size) :
+    size_ { size }
+{
+    Reset();
+}
+
+std::uint32_t RangeAllocator::Alloc(std::uint32_t size)
+{
+    if (size == 0 || size > freeSize_)
+        return invalidOffset;
+
+    auto block = FindFreeBlock(size);
+    if (block == invalidBlock)
+        return invalidOffset;
+
+    RemoveFreeBlock(block);
+
+    /* Split block and return its remainder to the free lists */
+    auto offset     = blocks_[block].offset;
+    auto blockSize  = blocks_[block].size;
+
+    if (blockSize > size)
+    {
+        auto remainder = NewBlock(offset + size, blockSize - size);
+        auto next = blocks_[block].nextPhysical;
+
+        blocks_[remainder].prevPhysical = block;
+        blocks_[remainder].nextPhysical = next;
+
+        if (next != invalidBlock)
+            blocks_[next].prevPhysical = remainder;
+
+        blocks_[block].size         = size;
+        blocks_[block].nextPhysical = remainder;
+
+        InsertFreeBlock(remainder);
+    }
+
+    usedBlocks_[offset] = block;
+    freeSize_ -= size;
+
+    return offset;
+}
+
+void RangeAllocator::Free(std::uint32_t offset, std::uint32_t size)
+{
+    if (size == 0)
+        return;
+
+    auto it = usedBlocks_.find(offset);
+    if (it == usedBlocks_.end() || blocks_[it->second].size != size)
+    {
+        throw std::invalid_argument(
+            "cannot release range of " + std::to_string(size) + " elements at offset " + std::to_string(offset) + ", which has not been allocated"
+        );
+    }
+
+    auto block = it->second;
+    usedBlocks_.erase(it);
+
+    freeSize_ += size;
+
+    /* Merge with the next block if it is free */
+    auto next = blocks_[block].nextPhysical;
+    if (next != invalidBlock && blocks_[next].free)
+    {
+        RemoveFreeBlock(next);
+        MergeNextBlock(block);
+    }
+
+    /* Merge with the previous block if it is free */
+    auto prev = blocks_[block].prevPhysical;
+    if (prev != invalidBlock && blocks_[prev].free)
+    {
+        RemoveFreeBlock(prev);
+        MergeNextBlock(prev);
+        block = prev;
+    }
+
+    InsertFreeBlock(block);
+}
+
+void RangeAllocator::Reset()
+{
+    blocks_.clear();
+    unusedBlocks_.clear();
+    usedBlocks_.clear();
+
+    for (int i = 0; i < numBins; ++i)
+    {
+        for (int j = 0; j < numSubBins; ++j)
+            freeLists_[i][j] = invalidBlock;
+        subBinMasks_[i] = 0;
+    }
+
+    binMask_        = 0;
+    freeSize_       = 0;
+    numFreeBlocks_  = 0;
+
+    if (size_ > 0)
+    {
+        InsertFreeBlock(NewBlock(0, size_));
+        freeSize_ = size_;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void RangeAllocator::MapSize(std::uint32_t size, int& bin, int& subBin)
+{
+    if (size < numSubBins)
+    {
+        /* Small sizes are all mapped into the first bin */
+        bin     = 0;
+        subBin  = static_cast<int>(size);
+    }
+    else
+    {
+        /* Map size to its power of two, and subdivide each power of two linearly */
+        auto log2 = FloorLog2(size);
+        bin     = log2 - numSubBinBits + 1;
+        subBin  = static_cast<int>(size >> (log2 - numSubBinBits)) - numSubBins;
+    }
+}
+
+std::uint32_t RangeAllocator::FindFreeBlock(std::uint32_t size) const
+{
+    int bin = 0, subBin = 0;
+
+    /* Round size up to the next size class, so all blocks in the free lists that are found are large enough */
+    auto roundedSize = static_cast<std::uint64_t>(size);
+    if (size >= numSubBins)
+        roundedSize += (1ull << (FloorLog2(size) - numSubBinBits)) - 1;
+
+    if (roundedSize <= 0xFFFFFFFFull)
+    {
+        MapSize(static_cast<std::uint32_t>(roundedSize), bin, subBin);
+
+        /* Find the first non-empty free list in the same bin, or otherwise in the next non-empty bin */
+        auto subBinMask = subBinMasks_[bin] & (~0u << subBin);
+        if (subBinMask == 0)
+        {
+            auto binMask = (bin + 1 < numBins ? binMask_ & (~0u << (bin + 1)) : 0u);
+            if (binMask != 0)
+            {
+                bin         = LowestBit(binMask);
+                subBinMask  = subBinMasks_[bin];
+            }
+        }
+
+        if (subBinMask != 0)
+            return freeLists_[bin][LowestBit(subBinMask)];
+    }
+
+    /* Otherwise, only a block from the size class of the requested size itself can be large enough */
+    MapSize(size, bin, subBin);
+
+    auto block = freeLists_[bin][subBin];
+    if (block != invalidBlock && blocks_[block].size >= size)
+        return block;
+
+    return invalidBlock;
+}
+
+std::uint32_t RangeAllocator::NewBlock(std::uint32_t offset, std::uint32_t size)
+{
+    std::uint32_t block = 0;
+
+    /* Reuse unused block header, or append a new one to the pool */
+    if (!unusedBlocks_.empty())
+    {
+        block = unusedBlocks_.back();
+        unusedBlocks_.pop_back();
+    }
+    else
+    {
+        block = static_cast<std::uint32_t>(blocks_.size());
+        blocks_.emplace_back();
+    }
+
+    auto& newBlock = blocks_[block];
+    {
+        newBlock.offset         = offset;
+        newBlock.size           = size;
+        newBlock.prevPhysical   = invalidBlock;
+        newBlock.nextPhysical   = invalidBlock;
+        newBlock.prevFree       = invalidBlock;
+        newBlock.nextFree       = invalidBlock;
+        newBlock.free           = false;
+    }
+
+    return block;
+}
+
+void RangeAllocator::MergeNextBlock(std::uint32_t block)
+{
+    /* Absorb the adjacent block with higher offset and release its header */
+    auto next = blocks_[block].nextPhysical;
+    auto nextNext = blocks_[next].nextPhysical;
+
+    blocks_[block].size += blocks_[next].size;
+    blocks_[block].nextPhysical = nextNext;
+
+    if (nextNext != invalidBlock)
+        blocks_[nextNext].prevPhysical = block;
+
+    unusedBlocks_.push_back(next);
+}
+
+void RangeAllocator::InsertFreeBlock(std::uint32_t block)
+{
+    int bin = 0, subBin = 0;
+    MapSize(blocks_[block].size, bin, subBin);
+
+    /* Insert block at the front of its free list */
+    auto head = freeLists_[bin][subBin];
+
+    blocks_[block].prevFree = invalidBlock;
+    blocks_[block].nextFree = head;
+    blocks_[block].free     = true;
+
+    if (head != invalidBlock)
+        blocks_[head].prevFree = block;
+
+    freeLists_[bin][subBin] = block;
+    subBinMasks_[bin] |= (1u << subBin);
+    binMask_ |= (1u << bin);
+
+    ++numFreeBlocks_;
+}
+
+void RangeAllocator::RemoveFreeBlock(std::uint32_t block)
+{
+    int bin = 0, subBin = 0;
+    MapSize(blocks_[block].size, bin, subBin);
+
+    /* Unlink block from its free list, and clear the bits of the free list once it is empty */
+    auto prev = blocks_[block].prevFree;
+    auto next = blocks_[block].nextFree;
+
+    if (prev != invalidBlock)
+        blocks_[prev].nextFree = next;
+    else
+        freeLists_[bin][subBin] = next;
+
+    if (next != invalidBlock)
+        blocks_[next].prevFree = prev;
+
+    if (freeLists_[bin][subBin] == invalidBlock)
+    {
+        subBinMasks_[bin] &= ~(1u << subBin);
+        if (subBinMasks_[bin] == 0)
+            binMask_ &= ~(1u << bin);
+    }
+
+    blocks_[block].free = false;
+
+    --numFreeBlocks_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,117 @@
+/*
+ * RangeAllocator.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RANGE_ALLOCATOR_H
+#define LLGL_RANGE_ALLOCATOR_H
+
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Allocator for ranges within a fixed-size address space (e.g. vertices inside a large vertex buffer), implemented as TLSF allocator (two-level segregated fit).
+Free blocks are segregated by the power of two of their size (first level), and each power of two is subdivided linearly (second level).
+A bit mask of non-empty first-level classes and one bit mask of non-empty free lists per first-level class
+allow to find a sufficiently large block with two bit scans, and adjacent free blocks are merged on release, so both operations are O(1).
+The allocator only manages offsets and never touches the memory itself, so the block headers are kept in a separate pool.
+*/
+class RangeAllocator
+{
+
+    public:
+
+        // Offset which is returned if an allocation failed.
+        static const std::uint32_t invalidOffset = 0xFFFFFFFFu;
+
+        RangeAllocator(std::uint32_t size);
+
+        // Allocates a range of the specified size and returns its offset, or 'invalidOffset' if there is no free block large enough.
+        std::uint32_t Alloc(std::uint32_t size);
+
+        // Releases the range at the specified offset, which must have been allocated with the same size. Throws std::invalid_argument otherwise.
+        void Free(std::uint32_t offset, std::uint32_t size);
+
+        // Releases all ranges.
+        void Reset();
+
+        // Returns the size of the entire address space.
+        inline std::uint32_t GetSize() const
+        {
+            return size_;
+        }
+
+        // Returns the sum of all free blocks.
+        inline std::uint32_t GetFreeSize() const
+        {
+            return freeSize_;
+        }
+
+        // Returns the number of free blocks, i.e. a measure of fragmentation.
+        inline std::size_t GetNumFreeBlocks() const
+        {
+            return numFreeBlocks_;
+        }
+
+    private:
+
+        static const std::uint32_t  invalidBlock    = 0xFFFFFFFFu;
+        static const int            numSubBinBits   = 4;
+        static const int            numSubBins      = (1 << numSubBinBits);
+        static const int            numBins         = (32 - numSubBinBits + 1);
+
+        // Block header of a free or allocated range. All indices refer to other blocks in the pool.
+        struct Block
+        {
+            std::uint32_t   offset;
+            std::uint32_t   size;
+            std::uint32_t   prevPhysical;   // Adjacent block with lower offset
+            std::uint32_t   nextPhysical;   // Adjacent block with higher offset
+            std::uint32_t   prevFree;       // Previous block in the same free list
+            std::uint32_t   nextFree;       // Next block in the same free list
+            bool            free;
+        };
+
+        static void MapSize(std::uint32_t size, int& bin, int& subBin);
+
+        std::uint32_t FindFreeBlock(std::uint32_t size) const;
+
+        std::uint32_t NewBlock(std::uint32_t offset, std::uint32_t size);
+        void MergeNextBlock(std::uint32_t block);
+
+        void InsertFreeBlock(std::uint32_t block);
+        void RemoveFreeBlock(std::uint32_t block);
+
+        std::uint32_t                                       size_                           = 0;
+        std::uint32_t                                       freeSize_                       = 0;
+        std::size_t                                         numFreeBlocks_                  = 0;
+
+        std::vector<Block>                                  blocks_;                                // Pool of block headers
+        std::vector<std::uint32_t>                          unusedBlocks_;                          // Indices of unused block headers in the pool
+        std::unordered_map<std::uint32_t, std::uint32_t>    usedBlocks_;                            // Allocated blocks (offset -> block)
+
+        std::uint32_t                                       freeLists_[numBins][numSubBins];        // First block of each free list
+        std::uint32_t                                       subBinMasks_[numBins];                  // Bit j of entry i is set if free list [i][j] is not empty
+        std::uint32_t                                       binMask_                        = 0;    // Bit i is set if any free list [i][j] is not empty
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,232 @@
+/*
+ * RenderQueue.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/RenderQueue.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+std::uint64_t RenderQueue::MakeSortKey(
+    unsigned int    layer,
+    unsigned int    renderTarget,
+    unsigned int    pipeline,
+    unsigned int    texture,
+    unsigned int    vertexBuffer,
+    float           depth)
+{
+    /* Quantize depth value to 16 bits */
+    auto depthBits = static_cast<std::uint64_t>(std::max(0.0f, std::min(depth, 1.0f)) * static_cast<float>(0xffff));
+
+    return
+    (
+        ((static_cast<std::uint64_t>(layer       ) & 0xf  ) << 60) |
+        ((static_cast<std::uint64_t>(renderTarget) & 0xff ) << 52) |
+        ((static_cast<std::uint64_t>(pipeline    ) & 0xfff) << 40) |
+        ((static_cast<std::uint64_t>(texture     ) & 0xfff) << 28) |
+        ((static_cast<std::uint64_t>(vertexBuffer) & 0xfff) << 16) |
+        (depthBits & 0xffff)
+    );
+}
+
+void RenderQueue::Submit(const DrawPacket& packet)
+{
+    packets_.push_back(packet);
+}
+
+// Helper class to submit only those states, which differ from the previous draw packet
+class DrawPacketStateFilter
+{
+
+    public:
+
+        DrawPacketStateFilter(CommandBuffer& commandBuffer, RenderQueueStatistics& stats) :
+            commandBuffer_ { commandBuffer },
+            stats_         { stats         }
+        {
+        }
+
+        void Submit(const DrawPacket& packet)
+        {
+            if (packet.renderTarget && Changed(packet.renderTarget, renderTarget_))
+                commandBuffer_.SetRenderTarget(*packet.renderTarget);
+            if (packet.graphicsPipeline && Changed(packet.graphicsPipeline, graphicsPipeline_))
+                commandBuffer_.SetGraphicsPipeline(*packet.graphicsPipeline);
+            if (packet.vertexBuffer && Changed(packet.vertexBuffer, vertexBuffer_))
+                commandBuffer_.SetVertexBuffer(*packet.vertexBuffer);
+            if (packet.indexBuffer && Changed(packet.indexBuffer, indexBuffer_))
+                commandBuffer_.SetIndexBuffer(*packet.indexBuffer);
+            if (packet.constantBuffer && Changed(packet.constantBuffer, constantBuffer_, packet.constantBufferSlot, constantBufferSlot_))
+                commandBuffer_.SetConstantBuffer(*packet.constantBuffer, packet.constantBufferSlot);
+            if (packet.texture && Changed(packet.texture, texture_, packet.textureSlot, textureSlot_))
+                commandBuffer_.SetTexture(*packet.texture, packet.textureSlot);
+            if (packet.sampler && Changed(packet.sampler, sampler_, packet.textureSlot, samplerSlot_))
+                commandBuffer_.SetSampler(*packet.sampler, packet.textureSlot);
+        }
+
+    private:
+
+        template <typename T>
+        bool Changed(T* obj, T*& prevObj)
+        {
+            if (obj != prevObj)
+            {
+                prevObj = obj;
+                ++stats_.numStateChanges;
+                return true;
+            }
+            ++stats_.numSkippedChanges;
+            return false;
+        }
+
+        template <typename T>
+        bool Changed(T* obj, T*& prevObj, unsigned int slot, unsigned int& prevSlot)
+        {
+            if (obj != prevObj || slot != prevSlot)
+            {
+                prevObj     = obj;
+                prevSlot    = slot;
+                ++stats_.numStateChanges;
+                return true;
+            }
+            ++stats_.numSkippedChanges;
+            return false;
+        }
+
+        CommandBuffer&          commandBuffer_;
+        RenderQueueStatistics&  stats_;
+
+        RenderTarget*           renderTarget_       = nullptr;
+        GraphicsPipeline*       graphicsPipeline_   = nullptr;
+        Buffer*                 vertexBuffer_       = nullptr;
+        Buffer*                 indexBuffer_        = nullptr;
+        Buffer*                 constantBuffer_     = nullptr;
+        Texture*                texture_            = nullptr;
+        Sampler*                sampler_            = nullptr;
+        unsigned int            constantBufferSlot_ = 0;
+        unsigned int            textureSlot_        = 0;
+        unsigned int            samplerSlot_        = 0;
+
+};
+
+static void SubmitDrawCall(CommandBuffer& commandBuffer, const DrawPacket& packet)
+{
+    if (packet.indexBuffer)
+    {
+        if (packet.numInstances > 1)
+            commandBuffer.DrawIndexedInstanced(packet.numVertices, packet.numInstances, packet.firstVertex, packet.vertexOffset);
+        else
+            commandBuffer.DrawIndexed(packet.numVertices, packet.firstVertex, packet.vertexOffset);
+    }
+    else
+    {
+        if (packet.numInstances > 1)
+            commandBuffer.DrawInstanced(packet.numVertices, packet.firstVertex, packet.numInstances);
+        else
+            commandBuffer.Draw(packet.numVertices, packet.firstVertex);
+    }
+}
+
+void RenderQueue::Execute(CommandBuffer& commandBuffer, bool sort)
+{
+    stats_ = RenderQueueStatistics();
+
+    /* Submit draw packets with minimal state changes */
+    DrawPacketStateFilter stateFilter(commandBuffer, stats_);
+
+    auto submitPacket = [&](const DrawPacket& packet)
+    {
+        stateFilter.Submit(packet);
+        SubmitDrawCall(commandBuffer, packet);
+        ++stats_.numDrawCalls;
+    };
+
+    if (sort)
+    {
+        SortPackets();
+        for (const auto& entry : sortEntries_)
+            submitPacket(packets_[entry.index]);
+    }
+    else
+    {
+        for (const auto& packet : packets_)
+            submitPacket(packet);
+    }
+}
+
+void RenderQueue::Reset()
+{
+    packets_.clear();
+    sortEntries_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+/*
+Sorts the draw packets by their sort keys (LSD radix sort with 8 bits per pass).
+The keys are copied into a contiguous array together with the packet indices,
+so the sort passes don't need to access the draw packets themselves.
+*/
+void RenderQueue::SortPackets()
+{
+    /* Copy sort keys in submission order */
+    auto numPackets = packets_.size();
+
+    sortEntries_.resize(numPackets);
+    for (std::size_t i = 0; i < numPackets; ++i)
+        sortEntries_[i] = { packets_[i].sortKey, static_cast<std::uint32_t>(i) };
+
+    if (numPackets < 2)
+        return;
+
+    /* Build histograms for all bytes of the sort keys at once */
+    std::size_t offsets[8][256] = {};
+    for (const auto& entry : sortEntries_)
+    {
+        for (unsigned int pass = 0; pass < 8; ++pass)
+            ++offsets[pass][(entry.key >> (pass * 8)) & 0xff];
+    }
+
+    sortEntriesTemp_.resize(numPackets);
+
+    for (unsigned int pass = 0; pass < 8; ++pass)
+    {
+        auto shift = pass * 8;
+        auto& passOffsets = offsets[pass];
+
+        /* Skip this pass if all keys share the same byte */
+        if (passOffsets[(sortEntries_.front().key >> shift) & 0xff] == numPackets)
+            continue;
+
+        /* Convert histogram to prefix sums */
+        std::size_t sum = 0;
+        for (auto& offset : passOffsets)
+        {
+            auto count = offset;
+            offset = sum;
+            sum += count;
+        }
+
+        /* Scatter sort entries (stable) */
+        for (const auto& entry : sortEntries_)
+            sortEntriesTemp_[passOffsets[(entry.key >> shift) & 0xff]++] = entry;
+
+        sortEntries_.swap(sortEntriesTemp_);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -14,6 +14,7 @@
 #include <LLGL/RenderSystem.h>
 #include <array>
 #include <map>
+#include <set>
 
 #ifdef LLGL_ENABLE_DEBUG_LAYER
 #   include "DebugLayer/DbgRenderSystem.h"
@@ -57,6 +58,9 @@ std::vector<std::string> RenderSystem::FindModules()
         "Direct3D11",
         "Direct3D12",
         #endif
+
+        "Null",
+        "Software",
     };
     
     std::vector<std::string> modules;
@@ -245,7 +249,7 @@ std::vector<ColorRGBAub> RenderSystem::GetDefaultTextureImageRGBAub(int numPixel
 
 void RenderSystem::AssertCreateBuffer(const BufferDescriptor& desc)
 {
-    if (desc.type < BufferType::Vertex || desc.type > BufferType::StreamOutput)
+    if (desc.type < BufferType::Vertex || desc.type > BufferType::Indirect)
         throw std::invalid_argument("can not create buffer of unknown type (0x" + ToHex(static_cast<unsigned char>(desc.type)) + ")");
 }
 
@@ -302,6 +306,54 @@ void RenderSystem::AssertCreateSamplerArray(unsigned int numSamplers, Sampler* c
     AssertCreateResourceArrayCommon(numSamplers, reinterpret_cast<void* const*>(samplerArray), "sampler");
 }
 
+static void AssertResourceViewBuffer(const ResourceViewDescriptor& resourceViewDesc, const BufferType bufferType, const std::string& bufferName)
+{
+    if (resourceViewDesc.buffer == nullptr)
+        throw std::invalid_argument("can not create resource heap with invalid " + bufferName + " buffer pointer");
+    if (resourceViewDesc.buffer->GetType() != bufferType)
+        throw std::invalid_argument("can not create resource heap with buffer type mismatch for " + bufferName + " buffer");
+}
+
+void RenderSystem::AssertCreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    if (desc.resourceViews.empty())
+        throw std::invalid_argument("can not create resource heap without resource views");
+
+    std::set<std::pair<ResourceType, unsigned int>> bindingSlots;
+
+    for (const auto& resourceViewDesc : desc.resourceViews)
+    {
+        /* Validate resource pointer */
+        switch (resourceViewDesc.type)
+        {
+            case ResourceType::ConstantBuffer:
+                AssertResourceViewBuffer(resourceViewDesc, BufferType::Constant, "constant");
+                break;
+
+            case ResourceType::StorageBuffer:
+                AssertResourceViewBuffer(resourceViewDesc, BufferType::Storage, "storage");
+                break;
+
+            case ResourceType::Texture:
+                if (resourceViewDesc.texture == nullptr)
+                    throw std::invalid_argument("can not create resource heap with invalid texture pointer");
+                break;
+
+            case ResourceType::Sampler:
+                if (resourceViewDesc.sampler == nullptr)
+                    throw std::invalid_argument("can not create resource heap with invalid sampler pointer");
+                break;
+
+            default:
+                throw std::invalid_argument("can not create resource heap with unknown resource type");
+        }
+
+        /* Validate binding slot */
+        if (!bindingSlots.insert({ resourceViewDesc.type, resourceViewDesc.slot }).second)
+            throw std::invalid_argument("can not create resource heap with multiple resource views at binding slot " + std::to_string(resourceViewDesc.slot));
+    }
+}
+
 
 } // /namespace LLGL
 
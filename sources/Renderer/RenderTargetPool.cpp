@@ -0,0 +1,182 @@
+/*
+ * RenderTargetPool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/RenderTargetPool.h>
+#include "TextureParams.h"
+#include "../Core/Helper.h"
+#include <functional>
+
+
+namespace LLGL
+{
+
+
+template <typename T>
+static void HashCombine(std::size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+static std::size_t GetDescriptorHash(const TransientRenderTargetDescriptor& desc)
+{
+    std::size_t seed = 0;
+
+    HashCombine(seed, desc.renderTarget.multiSampling.SampleCount());
+    HashCombine(seed, desc.renderTarget.customMultiSampling);
+    HashCombine(seed, desc.depthBuffer);
+    HashCombine(seed, desc.stencilBuffer);
+
+    for (const auto& attachment : desc.attachments)
+    {
+        for (auto param : GetTextureParams(attachment))
+            HashCombine(seed, param);
+    }
+
+    return seed;
+}
+
+static bool CompareDescriptors(const TransientRenderTargetDescriptor& lhs, const TransientRenderTargetDescriptor& rhs)
+{
+    if ( lhs.renderTarget.multiSampling.SampleCount() != rhs.renderTarget.multiSampling.SampleCount() ||
+         lhs.renderTarget.customMultiSampling         != rhs.renderTarget.customMultiSampling         ||
+         lhs.depthBuffer                              != rhs.depthBuffer                              ||
+         lhs.stencilBuffer                            != rhs.stencilBuffer                            ||
+         lhs.attachments.size()                       != rhs.attachments.size() )
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < lhs.attachments.size(); ++i)
+    {
+        if (GetTextureParams(lhs.attachments[i]) != GetTextureParams(rhs.attachments[i]))
+            return false;
+    }
+
+    return true;
+}
+
+RenderTargetPool::RenderTargetPool(RenderSystem& renderSystem, unsigned int maxUnusedFrames) :
+    renderSystem_    { renderSystem    },
+    maxUnusedFrames_ { maxUnusedFrames }
+{
+}
+
+RenderTargetPool::~RenderTargetPool()
+{
+    Clear();
+}
+
+const TransientRenderTarget& RenderTargetPool::Acquire(const TransientRenderTargetDescriptor& desc)
+{
+    /* Find entry with equal descriptor, which has not been acquired in this frame yet */
+    auto hash = GetDescriptorHash(desc);
+    auto range = entries_.equal_range(hash);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        auto& entry = *(it->second);
+        if (entry.lastFrame != frame_ && CompareDescriptors(entry.desc, desc))
+        {
+            entry.lastFrame = frame_;
+            return entry.target;
+        }
+    }
+
+    /* Create new entry */
+    auto entry = MakeUnique<Entry>();
+    {
+        entry->desc         = desc;
+        entry->lastFrame    = frame_;
+        CreateEntry(*entry);
+    }
+    const auto& target = entry->target;
+    entries_.emplace(hash, std::move(entry));
+
+    return target;
+}
+
+void RenderTargetPool::NextFrame()
+{
+    /* Release all entries that have not been used for too many frames */
+    for (auto it = entries_.begin(); it != entries_.end();)
+    {
+        auto& entry = *(it->second);
+        if (frame_ - entry.lastFrame > maxUnusedFrames_)
+        {
+            ReleaseEntry(entry);
+            it = entries_.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    ++frame_;
+}
+
+void RenderTargetPool::Clear()
+{
+    for (auto& it : entries_)
+        ReleaseEntry(*(it.second));
+    entries_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void RenderTargetPool::CreateEntry(Entry& entry)
+{
+    try
+    {
+        /* Create render target and attach a new texture for each attachment */
+        entry.target.renderTarget = renderSystem_.CreateRenderTarget(entry.desc.renderTarget);
+
+        for (const auto& textureDesc : entry.desc.attachments)
+        {
+            auto texture = renderSystem_.CreateTexture(textureDesc);
+            entry.target.attachments.push_back(texture);
+            entry.target.renderTarget->AttachTexture(*texture, {});
+        }
+
+        /* Attach internal depth-stencil buffer with the resolution of the texture attachments */
+        const auto& resolution = entry.target.renderTarget->GetResolution();
+
+        if (entry.desc.depthBuffer && entry.desc.stencilBuffer)
+            entry.target.renderTarget->AttachDepthStencilBuffer(resolution);
+        else if (entry.desc.depthBuffer)
+            entry.target.renderTarget->AttachDepthBuffer(resolution);
+        else if (entry.desc.stencilBuffer)
+            entry.target.renderTarget->AttachStencilBuffer(resolution);
+    }
+    catch (...)
+    {
+        ReleaseEntry(entry);
+        throw;
+    }
+}
+
+void RenderTargetPool::ReleaseEntry(Entry& entry)
+{
+    if (entry.target.renderTarget)
+    {
+        renderSystem_.Release(*entry.target.renderTarget);
+        entry.target.renderTarget = nullptr;
+    }
+
+    for (auto texture : entry.target.attachments)
+        renderSystem_.Release(*texture);
+
+    entry.target.attachments.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,559 @@
+/*
+ * SWCommandBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SWCommandBuffer.h"
+#include "SWRenderContext.h"
+#include "SWRenderTarget.h"
+#include "SWRenderStates.h"
+#include "../CPUCommon/CPUBuffer.h"
+#include "../CPUCommon/CPUBufferArray.h"
+#include "../CheckedCast.h"
+#include <LLGL/RenderPassFlags.h>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/* ----- Common ----- */
+
+SWCommandBuffer::SWCommandBuffer(SWThreadPool& threadPool, const RenderingCaps& caps) :
+    caps_       { caps       },
+    rasterizer_ { threadPool }
+{
+}
+
+/* ----- Configuration ----- */
+
+void SWCommandBuffer::SetGraphicsAPIDependentState(const GraphicsAPIDependentStateDescriptor& /*state*/)
+{
+    // dummy
+}
+
+void SWCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    if (viewport.width < 0.0f || viewport.height < 0.0f)
+        throw std::invalid_argument("viewport must not have a negative size");
+    drawState_.viewport = viewport;
+}
+
+void SWCommandBuffer::SetViewportArray(unsigned int numViewports, const Viewport* viewportArray)
+{
+    if (numViewports > 1 && !caps_.hasViewportArrays)
+        throw std::runtime_error("viewport arrays are not supported");
+    if (numViewports > 0)
+        SetViewport(viewportArray[0]);
+}
+
+void SWCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    if (scissor.width < 0 || scissor.height < 0)
+        throw std::invalid_argument("scissor rectangle must not have a negative size");
+    drawState_.scissor = scissor;
+}
+
+void SWCommandBuffer::SetScissorArray(unsigned int numScissors, const Scissor* scissorArray)
+{
+    if (numScissors > 1 && !caps_.hasViewportArrays)
+        throw std::runtime_error("scissor arrays are not supported");
+    if (numScissors > 0)
+        SetScissor(scissorArray[0]);
+}
+
+void SWCommandBuffer::SetClearColor(const ColorRGBAf& color)
+{
+    clearColor_[0] = color.r;
+    clearColor_[1] = color.g;
+    clearColor_[2] = color.b;
+    clearColor_[3] = color.a;
+}
+
+void SWCommandBuffer::SetClearDepth(float depth)
+{
+    clearDepth_ = depth;
+}
+
+void SWCommandBuffer::SetClearStencil(int /*stencil*/)
+{
+    // dummy
+}
+
+void SWCommandBuffer::Clear(long flags)
+{
+    if (auto framebuffer = drawState_.framebuffer)
+    {
+        if ((flags & ClearFlags::Color) != 0)
+        {
+            for (unsigned int i = 0; i < framebuffer->numColors; ++i)
+                rasterizer_.ClearColor(*framebuffer, i, clearColor_);
+        }
+        if ((flags & ClearFlags::Depth) != 0)
+            rasterizer_.ClearDepth(*framebuffer, clearDepth_);
+    }
+}
+
+void SWCommandBuffer::ClearTarget(unsigned int targetIndex, const LLGL::ColorRGBAf& color)
+{
+    if (targetIndex >= caps_.maxNumRenderTargetAttachments)
+        throw std::out_of_range("render target attachment index out of range: " + std::to_string(targetIndex));
+    if (auto framebuffer = drawState_.framebuffer)
+    {
+        const float clearColor[4] = { color.r, color.g, color.b, color.a };
+        rasterizer_.ClearColor(*framebuffer, targetIndex, clearColor);
+    }
+}
+
+/* ----- Buffers ------ */
+
+void SWCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    auto& bufferSW = LLGL_CAST(CPUBuffer&, buffer);
+    ValidateBufferType(bufferSW, BufferType::Vertex, __FUNCTION__);
+
+    BindVertexBuffer(0, bufferSW);
+    drawState_.numVertexStreams = 1;
+}
+
+void SWCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    auto& bufferArraySW = LLGL_CAST(CPUBufferArray&, bufferArray);
+    const auto& buffers = bufferArraySW.GetBuffers();
+
+    if (buffers.size() > maxSoftwareVertexBuffers)
+        throw std::out_of_range("too many vertex buffers for software renderer");
+
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+    {
+        ValidateBufferType(*buffers[i], BufferType::Vertex, __FUNCTION__);
+        BindVertexBuffer(static_cast<unsigned int>(i), *buffers[i]);
+    }
+
+    drawState_.numVertexStreams = static_cast<unsigned int>(buffers.size());
+}
+
+void SWCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    auto& bufferSW = LLGL_CAST(CPUBuffer&, buffer);
+    ValidateBufferType(bufferSW, BufferType::Index, __FUNCTION__);
+    indexBuffer_ = &bufferSW;
+}
+
+void SWCommandBuffer::SetConstantBuffer(Buffer& buffer, unsigned int slot, long /*shaderStageFlags*/)
+{
+    auto& bufferSW = LLGL_CAST(CPUBuffer&, buffer);
+    ValidateBufferType(bufferSW, BufferType::Constant, __FUNCTION__);
+    BindConstantBuffer(slot, bufferSW);
+}
+
+void SWCommandBuffer::SetConstantBufferArray(BufferArray& bufferArray, unsigned int startSlot, long /*shaderStageFlags*/)
+{
+    auto& bufferArraySW = LLGL_CAST(CPUBufferArray&, bufferArray);
+    for (auto buffer : bufferArraySW.GetBuffers())
+    {
+        ValidateBufferType(*buffer, BufferType::Constant, __FUNCTION__);
+        BindConstantBuffer(startSlot++, *buffer);
+    }
+}
+
+void SWCommandBuffer::SetStorageBuffer(Buffer& /*buffer*/, unsigned int /*slot*/, long /*shaderStageFlags*/)
+{
+    throw std::runtime_error("storage buffers not supported by software renderer");
+}
+
+void SWCommandBuffer::SetStorageBufferArray(BufferArray& /*bufferArray*/, unsigned int /*startSlot*/, long /*shaderStageFlags*/)
+{
+    throw std::runtime_error("storage buffers not supported by software renderer");
+}
+
+void SWCommandBuffer::SetStreamOutputBuffer(Buffer& /*buffer*/)
+{
+    throw std::runtime_error("stream-output not supported by software renderer");
+}
+
+void SWCommandBuffer::SetStreamOutputBufferArray(BufferArray& /*bufferArray*/)
+{
+    throw std::runtime_error("stream-output not supported by software renderer");
+}
+
+void SWCommandBuffer::BeginStreamOutput(const PrimitiveType /*primitiveType*/)
+{
+    throw std::runtime_error("stream-output not supported by software renderer");
+}
+
+void SWCommandBuffer::EndStreamOutput()
+{
+    throw std::runtime_error("stream-output not supported by software renderer");
+}
+
+/* ----- Textures ----- */
+
+void SWCommandBuffer::SetTexture(Texture& /*texture*/, unsigned int /*slot*/, long /*shaderStageFlags*/)
+{
+    // dummy (software shaders access their resources via constant buffers or user data)
+}
+
+void SWCommandBuffer::SetTextureArray(TextureArray& /*textureArray*/, unsigned int /*startSlot*/, long /*shaderStageFlags*/)
+{
+    // dummy
+}
+
+/* ----- Sampler States ----- */
+
+void SWCommandBuffer::SetSampler(Sampler& /*sampler*/, unsigned int /*slot*/, long /*shaderStageFlags*/)
+{
+    // dummy
+}
+
+void SWCommandBuffer::SetSamplerArray(SamplerArray& /*samplerArray*/, unsigned int /*startSlot*/, long /*shaderStageFlags*/)
+{
+    // dummy
+}
+
+/* ----- Resource Heaps ----- */
+
+void SWCommandBuffer::SetResourceHeap(ResourceHeap& /*resourceHeap*/)
+{
+    // dummy
+}
+
+/* ----- Render Targets ----- */
+
+void SWCommandBuffer::SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc)
+{
+    auto& renderTargetSW = LLGL_CAST(SWRenderTarget&, renderTarget);
+    BindFramebuffer(renderTargetSW.GetFramebuffer(), renderPassDesc);
+}
+
+void SWCommandBuffer::SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc)
+{
+    auto& renderContextSW = LLGL_CAST(SWRenderContext&, renderContext);
+    BindFramebuffer(renderContextSW.GetFramebuffer(), renderPassDesc);
+}
+
+/* ----- Pipeline States ----- */
+
+void SWCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
+{
+    drawState_.pipeline = LLGL_CAST(SWGraphicsPipeline*, &graphicsPipeline);
+}
+
+void SWCommandBuffer::SetComputePipeline(ComputePipeline& /*computePipeline*/)
+{
+    throw std::runtime_error("compute pipelines not supported by software renderer");
+}
+
+/* ----- Queries ----- */
+
+void SWCommandBuffer::BeginQuery(Query& query)
+{
+    auto& querySW = LLGL_CAST(SWQuery&, query);
+    if (querySW.active)
+        throw std::runtime_error("query is already active");
+    querySW.active      = true;
+    querySW.finished    = false;
+    querySW.beginValue  = GetQueryCounter(query.GetType());
+}
+
+void SWCommandBuffer::EndQuery(Query& query)
+{
+    auto& querySW = LLGL_CAST(SWQuery&, query);
+    if (!querySW.active)
+        throw std::runtime_error("query has not started");
+    querySW.active      = false;
+    querySW.finished    = true;
+    querySW.result      = GetQueryCounter(query.GetType()) - querySW.beginValue;
+
+    switch (query.GetType())
+    {
+        case QueryType::AnySamplesPassed:
+        case QueryType::AnySamplesPassedConservative:
+            querySW.result = (querySW.result != 0 ? 1 : 0);
+            break;
+        default:
+            break;
+    }
+}
+
+bool SWCommandBuffer::QueryResult(Query& query, std::uint64_t& result)
+{
+    auto& querySW = LLGL_CAST(SWQuery&, query);
+    if (!querySW.finished)
+        return false;
+    result = querySW.result;
+    return true;
+}
+
+void SWCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
+{
+    if (renderCondition_)
+        throw std::runtime_error("render condition is already active");
+
+    renderCondition_ = LLGL_CAST(SWQuery*, &query);
+
+    switch (mode)
+    {
+        case RenderConditionMode::WaitInverted:
+        case RenderConditionMode::NoWaitInverted:
+        case RenderConditionMode::ByRegionWaitInverted:
+        case RenderConditionMode::ByRegionNoWaitInverted:
+            renderConditionInv_ = true;
+            break;
+        default:
+            renderConditionInv_ = false;
+            break;
+    }
+}
+
+void SWCommandBuffer::EndRenderCondition()
+{
+    if (!renderCondition_)
+        throw std::runtime_error("render condition has not started");
+    renderCondition_ = nullptr;
+}
+
+/* ----- Drawing ----- */
+
+void SWCommandBuffer::Draw(unsigned int numVertices, unsigned int firstVertex)
+{
+    DrawArrays(numVertices, firstVertex, 1, 0);
+}
+
+void SWCommandBuffer::DrawIndexed(unsigned int numVertices, unsigned int firstIndex)
+{
+    DrawElements(numVertices, firstIndex, 0, 1, 0);
+}
+
+void SWCommandBuffer::DrawIndexed(unsigned int numVertices, unsigned int firstIndex, int vertexOffset)
+{
+    DrawElements(numVertices, firstIndex, vertexOffset, 1, 0);
+}
+
+void SWCommandBuffer::DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances)
+{
+    DrawArrays(numVertices, firstVertex, numInstances, 0);
+}
+
+void SWCommandBuffer::DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset)
+{
+    DrawArrays(numVertices, firstVertex, numInstances, instanceOffset);
+}
+
+void SWCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex)
+{
+    DrawElements(numVertices, firstIndex, 0, numInstances, 0);
+}
+
+void SWCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset)
+{
+    DrawElements(numVertices, firstIndex, vertexOffset, numInstances, 0);
+}
+
+void SWCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset)
+{
+    DrawElements(numVertices, firstIndex, vertexOffset, numInstances, instanceOffset);
+}
+
+void SWCommandBuffer::DrawIndirect(Buffer& buffer, unsigned int offset)
+{
+    MultiDrawIndirect(buffer, offset, 1, sizeof(DrawIndirectArguments));
+}
+
+void SWCommandBuffer::DrawIndexedIndirect(Buffer& buffer, unsigned int offset)
+{
+    MultiDrawIndexedIndirect(buffer, offset, 1, sizeof(DrawIndexedIndirectArguments));
+}
+
+void SWCommandBuffer::MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    const auto& bufferSW = GetIndirectArguments(buffer, offset, numCommands, stride, sizeof(DrawIndirectArguments));
+    for (unsigned int i = 0; i < numCommands; ++i)
+    {
+        DrawIndirectArguments args;
+        std::memcpy(&args, bufferSW.GetData() + offset + i * stride, sizeof(args));
+        DrawArrays(args.numVertices, args.firstVertex, args.numInstances, args.firstInstance);
+    }
+}
+
+void SWCommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride)
+{
+    const auto& bufferSW = GetIndirectArguments(buffer, offset, numCommands, stride, sizeof(DrawIndexedIndirectArguments));
+    for (unsigned int i = 0; i < numCommands; ++i)
+    {
+        DrawIndexedIndirectArguments args;
+        std::memcpy(&args, bufferSW.GetData() + offset + i * stride, sizeof(args));
+        DrawElements(args.numIndices, args.firstIndex, args.vertexOffset, args.numInstances, args.firstInstance);
+    }
+}
+
+/* ----- Compute ----- */
+
+void SWCommandBuffer::Dispatch(unsigned int /*groupSizeX*/, unsigned int /*groupSizeY*/, unsigned int /*groupSizeZ*/)
+{
+    throw std::runtime_error("compute shaders not supported by software renderer");
+}
+
+void SWCommandBuffer::DispatchIndirect(Buffer& /*buffer*/, unsigned int /*offset*/)
+{
+    throw std::runtime_error("compute shaders not supported by software renderer");
+}
+
+/* ----- Misc ----- */
+
+void SWCommandBuffer::SignalFence(Fence& fence)
+{
+    /* Commands are executed immediately, so the fence is signaled immediately */
+    LLGL_CAST(SWFence&, fence).signaled = true;
+}
+
+void SWCommandBuffer::SyncGPU()
+{
+    // dummy
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SWCommandBuffer::ValidateBufferType(const CPUBuffer& buffer, const BufferType type, const char* source)
+{
+    if (buffer.GetType() != type)
+        throw std::invalid_argument(std::string(source) + ": invalid buffer type");
+}
+
+void SWCommandBuffer::BindVertexBuffer(unsigned int index, const CPUBuffer& buffer)
+{
+    const auto& format = buffer.GetDesc().vertexBuffer.format;
+
+    auto& stream = drawState_.vertexStreams[index];
+    {
+        stream.data         = buffer.GetData();
+        stream.stride       = format.stride;
+        stream.numElements  = buffer.GetNumElements();
+        stream.divisor      = (format.attributes.empty() ? 0 : format.attributes.front().instanceDivisor);
+    }
+}
+
+void SWCommandBuffer::BindConstantBuffer(unsigned int slot, const CPUBuffer& buffer)
+{
+    if (slot >= maxSoftwareConstantBuffers)
+        throw std::out_of_range("constant buffer slot out of range: " + std::to_string(slot));
+    drawState_.constantBuffers[slot] = buffer.GetData();
+}
+
+void SWCommandBuffer::BindFramebuffer(const SWFramebuffer& framebuffer, const RenderPassDescriptor* renderPassDesc)
+{
+    drawState_.framebuffer = &framebuffer;
+
+    /* Clear attachments with the current clear values, if the render pass specifies it */
+    if (renderPassDesc)
+    {
+        for (std::size_t i = 0; i < renderPassDesc->colorAttachments.size(); ++i)
+        {
+            if (renderPassDesc->colorAttachments[i].loadOp == AttachmentLoadOp::Clear)
+                rasterizer_.ClearColor(framebuffer, static_cast<unsigned int>(i), clearColor_);
+        }
+        if (renderPassDesc->depthAttachment.loadOp == AttachmentLoadOp::Clear)
+            rasterizer_.ClearDepth(framebuffer, clearDepth_);
+    }
+}
+
+bool SWCommandBuffer::BeginDraw()
+{
+    if (!drawState_.pipeline)
+        throw std::runtime_error("no graphics pipeline is bound");
+    if (!drawState_.framebuffer)
+        throw std::runtime_error("no render target is set");
+
+    /* Skip draw command if the render condition fails */
+    if (renderCondition_ && renderCondition_->finished)
+        return ((renderCondition_->result != 0) != renderConditionInv_);
+
+    return true;
+}
+
+void SWCommandBuffer::DrawArrays(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset)
+{
+    if (BeginDraw())
+        rasterizer_.Draw(drawState_, numVertices, firstVertex, numInstances, instanceOffset);
+}
+
+void SWCommandBuffer::DrawElements(unsigned int numIndices, unsigned int firstIndex, int vertexOffset, unsigned int numInstances, unsigned int instanceOffset)
+{
+    if (!indexBuffer_)
+        throw std::runtime_error("no index buffer is bound");
+    if (static_cast<std::uint64_t>(firstIndex) + numIndices > indexBuffer_->GetNumElements())
+        throw std::out_of_range("index range exceeds bound index buffer");
+
+    if (BeginDraw())
+    {
+        const auto& indexFormat = indexBuffer_->GetDesc().indexBuffer.format;
+        rasterizer_.DrawIndexed(
+            drawState_,
+            indexBuffer_->GetData() + static_cast<std::size_t>(firstIndex) * indexFormat.GetFormatSize(),
+            indexFormat.GetDataType(),
+            numIndices,
+            vertexOffset,
+            numInstances,
+            instanceOffset
+        );
+    }
+}
+
+const CPUBuffer& SWCommandBuffer::GetIndirectArguments(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride, unsigned int argumentsSize)
+{
+    auto& bufferSW = LLGL_CAST(CPUBuffer&, buffer);
+    ValidateBufferType(bufferSW, BufferType::Indirect, __FUNCTION__);
+
+    if (numCommands > 1 && stride < argumentsSize)
+        throw std::invalid_argument("stride of indirect arguments is too small");
+
+    if (numCommands > 0)
+    {
+        const auto requiredSize = static_cast<std::uint64_t>(offset) + static_cast<std::uint64_t>(stride) * (numCommands - 1) + argumentsSize;
+        if (requiredSize > bufferSW.GetSize())
+            throw std::out_of_range("indirect arguments exceed buffer size");
+    }
+
+    return bufferSW;
+}
+
+std::uint64_t SWCommandBuffer::GetQueryCounter(const QueryType type) const
+{
+    const auto& stats = rasterizer_.GetStatistics();
+    switch (type)
+    {
+        case QueryType::SamplesPassed:
+        case QueryType::AnySamplesPassed:
+        case QueryType::AnySamplesPassedConservative:
+            return stats.samplesPassed;
+        case QueryType::PrimitivesGenerated:
+        case QueryType::ClippingOutputPrimitives:
+            return stats.clippingOutputPrimitives;
+        case QueryType::VerticesSubmitted:
+            return stats.verticesSubmitted;
+        case QueryType::PrimitivesSubmitted:
+        case QueryType::ClippingInputPrimitives:
+            return stats.primitivesSubmitted;
+        case QueryType::VertexShaderInvocations:
+            return stats.vertexShaderInvocations;
+        case QueryType::FragmentShaderInvocations:
+            return stats.fragmentShaderInvocations;
+        default:
+            return 0;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,176 @@
+/*
+ * SWCommandBuffer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SW_COMMAND_BUFFER_H
+#define LLGL_SW_COMMAND_BUFFER_H
+
+
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/RenderSystemFlags.h>
+#include "SWRasterizer.h"
+
+
+namespace LLGL
+{
+
+
+class CPUBuffer;
+class SWQuery;
+
+/*
+Command buffer which executes all commands immediately with the software rasterizer.
+The bound states are kept in a draw state, which is passed to the rasterizer for each draw command.
+*/
+class SWCommandBuffer : public CommandBuffer
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        SWCommandBuffer(SWThreadPool& threadPool, const RenderingCaps& caps);
+
+        /* ----- Configuration ----- */
+
+        void SetGraphicsAPIDependentState(const GraphicsAPIDependentStateDescriptor& state) override;
+
+        void SetViewport(const Viewport& viewport) override;
+        void SetViewportArray(unsigned int numViewports, const Viewport* viewportArray) override;
+
+        void SetScissor(const Scissor& scissor) override;
+        void SetScissorArray(unsigned int numScissors, const Scissor* scissorArray) override;
+
+        void SetClearColor(const ColorRGBAf& color) override;
+        void SetClearDepth(float depth) override;
+        void SetClearStencil(int stencil) override;
+
+        void Clear(long flags) override;
+        void ClearTarget(unsigned int targetIndex, const LLGL::ColorRGBAf& color) override;
+
+        /* ----- Buffers ------ */
+
+        void SetVertexBuffer(Buffer& buffer) override;
+        void SetVertexBufferArray(BufferArray& bufferArray) override;
+
+        void SetIndexBuffer(Buffer& buffer) override;
+
+        void SetConstantBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetConstantBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        void SetStorageBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetStorageBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        void SetStreamOutputBuffer(Buffer& buffer) override;
+        void SetStreamOutputBufferArray(BufferArray& bufferArray) override;
+
+        void BeginStreamOutput(const PrimitiveType primitiveType) override;
+        void EndStreamOutput() override;
+
+        /* ----- Textures ----- */
+
+        void SetTexture(Texture& texture, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetTextureArray(TextureArray& textureArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        /* ----- Sampler States ----- */
+
+        void SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetSamplerArray(SamplerArray& samplerArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        /* ----- Resource Heaps ----- */
+
+        void SetResourceHeap(ResourceHeap& resourceHeap) override;
+
+        /* ----- Render Targets ----- */
+
+        void SetRenderTarget(RenderTarget& renderTarget, const RenderPassDescriptor* renderPassDesc = nullptr) override;
+        void SetRenderTarget(RenderContext& renderContext, const RenderPassDescriptor* renderPassDesc = nullptr) override;
+
+        /* ----- Pipeline States ----- */
+
+        void SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline) override;
+        void SetComputePipeline(ComputePipeline& computePipeline) override;
+
+        /* ----- Queries ----- */
+
+        void BeginQuery(Query& query) override;
+        void EndQuery(Query& query) override;
+
+        bool QueryResult(Query& query, std::uint64_t& result) override;
+
+        void BeginRenderCondition(Query& query, const RenderConditionMode mode) override;
+        void EndRenderCondition() override;
+
+        /* ----- Drawing ----- */
+
+        void Draw(unsigned int numVertices, unsigned int firstVertex) override;
+
+        void DrawIndexed(unsigned int numVertices, unsigned int firstIndex) override;
+        void DrawIndexed(unsigned int numVertices, unsigned int firstIndex, int vertexOffset) override;
+
+        void DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances) override;
+        void DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset) override;
+
+        void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex) override;
+        void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset) override;
+        void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) override;
+
+        void DrawIndirect(Buffer& buffer, unsigned int offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, unsigned int offset) override;
+
+        void MultiDrawIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+        void MultiDrawIndexedIndirect(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride) override;
+
+        /* ----- Compute ----- */
+
+        void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, unsigned int offset) override;
+
+        /* ----- Misc ----- */
+
+        void SignalFence(Fence& fence) override;
+
+        void SyncGPU() override;
+
+    private:
+
+        void ValidateBufferType(const CPUBuffer& buffer, const BufferType type, const char* source);
+
+        void BindVertexBuffer(unsigned int index, const CPUBuffer& buffer);
+        void BindConstantBuffer(unsigned int slot, const CPUBuffer& buffer);
+        void BindFramebuffer(const SWFramebuffer& framebuffer, const RenderPassDescriptor* renderPassDesc);
+
+        bool BeginDraw();
+
+        void DrawArrays(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset);
+        void DrawElements(unsigned int numIndices, unsigned int firstIndex, int vertexOffset, unsigned int numInstances, unsigned int instanceOffset);
+
+        const CPUBuffer& GetIndirectArguments(Buffer& buffer, unsigned int offset, unsigned int numCommands, unsigned int stride, unsigned int argumentsSize);
+
+        std::uint64_t GetQueryCounter(const QueryType type) const;
+
+        const RenderingCaps&    caps_;
+        SWRasterizer            rasterizer_;
+        SWDrawState             drawState_;
+
+        const CPUBuffer*        indexBuffer_        = nullptr;
+        const SWQuery*          renderCondition_    = nullptr;
+        bool                    renderConditionInv_ = false;
+
+        float                   clearColor_[4]      = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float                   clearDepth_         = 1.0f;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,39 @@
+/*
+ * SWModuleInterface.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "../ModuleInterface.h"
+#include "SWRenderSystem.h"
+
+
+extern "C"
+{
+
+LLGL_EXPORT int LLGL_RenderSystem_BuildID()
+{
+    return LLGL_BUILD_ID;
+}
+
+LLGL_EXPORT int LLGL_RenderSystem_RendererID()
+{
+    return LLGL::RendererID::Software;
+}
+
+LLGL_EXPORT const char* LLGL_RenderSystem_Name()
+{
+    return "Software";
+}
+
+LLGL_EXPORT void* LLGL_RenderSystem_Alloc()
+{
+    return new LLGL::SWRenderSystem();
+}
+
+} // /extern "C"
+
+
+
+// ================================================================================
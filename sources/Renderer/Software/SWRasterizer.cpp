@@ -0,0 +1,961 @@
+/*
+ * SWRasterizer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SWRasterizer.h"
+#include "SWRenderStates.h"
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define LLGL_SW_SSE2
+#   include <emmintrin.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal constants ----- */
+
+// Number of vertices per task for vertex shading.
+static const std::size_t g_vertexChunkSize      = 256;
+
+// Number of primitives per task for clipping and triangle setup.
+static const std::size_t g_primitiveChunkSize   = 1024;
+
+// Minimal clip space W, so the reciprocal of W is always finite.
+static const float g_minClipW                   = 1.0e-5f;
+
+// Maximal window coordinate (in pixels) after guard-band clipping, so edge functions stay precise enough.
+static const float g_guardBandSize              = 16384.0f;
+
+// Number of sub-pixel steps vertex positions are snapped to.
+static const float g_subPixelSteps              = 16.0f;
+
+
+/* ----- Internal functions ----- */
+
+static bool CompareDepth(const CompareOp op, float src, float dst)
+{
+    switch (op)
+    {
+        case CompareOp::Never:          return false;
+        case CompareOp::Less:           return (src <  dst);
+        case CompareOp::Equal:          return (src == dst);
+        case CompareOp::LessEqual:      return (src <= dst);
+        case CompareOp::Greater:        return (src >  dst);
+        case CompareOp::NotEqual:       return (src != dst);
+        case CompareOp::GreaterEqual:   return (src >= dst);
+        case CompareOp::Ever:           return true;
+    }
+    return false;
+}
+
+static float GetBlendFactor(
+    const BlendOp op, int c, const float* src, const float* src1, const float* dst, const ColorRGBAf& blendFactor)
+{
+    switch (op)
+    {
+        case BlendOp::Zero:             return 0.0f;
+        case BlendOp::One:              return 1.0f;
+        case BlendOp::SrcColor:         return src[c];
+        case BlendOp::InvSrcColor:      return 1.0f - src[c];
+        case BlendOp::SrcAlpha:         return src[3];
+        case BlendOp::InvSrcAlpha:      return 1.0f - src[3];
+        case BlendOp::DestColor:        return dst[c];
+        case BlendOp::InvDestColor:     return 1.0f - dst[c];
+        case BlendOp::DestAlpha:        return dst[3];
+        case BlendOp::InvDestAlpha:     return 1.0f - dst[3];
+        case BlendOp::SrcAlphaSaturate: return (c < 3 ? std::min(src[3], 1.0f - dst[3]) : 1.0f);
+        case BlendOp::BlendFactor:      return blendFactor[c];
+        case BlendOp::InvBlendFactor:   return 1.0f - blendFactor[c];
+        case BlendOp::Src1Color:        return src1[c];
+        case BlendOp::InvSrc1Color:     return 1.0f - src1[c];
+        case BlendOp::Src1Alpha:        return src1[3];
+        case BlendOp::InvSrc1Alpha:     return 1.0f - src1[3];
+    }
+    return 0.0f;
+}
+
+static float BlendComponent(const BlendArithmetic arithmetic, float src, float srcFactor, float dst, float dstFactor)
+{
+    switch (arithmetic)
+    {
+        case BlendArithmetic::Add:          return src * srcFactor + dst * dstFactor;
+        case BlendArithmetic::Subtract:     return src * srcFactor - dst * dstFactor;
+        case BlendArithmetic::RevSubtract:  return dst * dstFactor - src * srcFactor;
+        case BlendArithmetic::Min:          return std::min(src, dst);
+        case BlendArithmetic::Max:          return std::max(src, dst);
+    }
+    return src;
+}
+
+// Returns true if colors can be blended into the specified format, i.e. all formats except unnormalized integer formats.
+static bool IsBlendableFormat(const SWTexelFormat& format)
+{
+    return (format.normalized || format.halfFloat || format.dataType == DataType::Float || format.dataType == DataType::Double);
+}
+
+static float SnapToSubPixel(float x)
+{
+    return std::floor(x * g_subPixelSteps + 0.5f) * (1.0f / g_subPixelSteps);
+}
+
+static void LerpVertex(
+    SoftwareVertexOutput& dst, const SoftwareVertexOutput& a, const SoftwareVertexOutput& b, float t, unsigned int numVaryings)
+{
+    for (int i = 0; i < 4; ++i)
+        dst.position[i] = a.position[i] + (b.position[i] - a.position[i]) * t;
+    for (unsigned int i = 0; i < numVaryings; ++i)
+        dst.varyings[i] = a.varyings[i] + (b.varyings[i] - a.varyings[i]) * t;
+}
+
+// Clip plane in homogeneous clip space, where a vertex is inside if the distance is non-negative.
+struct SWClipPlane
+{
+    float x, y, z, w;
+
+    inline float Distance(const SoftwareVertexOutput& v) const
+    {
+        return (x * v.position[0] + y * v.position[1] + z * v.position[2] + w * v.position[3]);
+    }
+};
+
+
+/* ----- SWRasterizer class ----- */
+
+SWRasterizer::SWRasterizer(SWThreadPool& threadPool) :
+    threadPool_      { threadPool },
+    fragmentCounter_ { 0          },
+    sampleCounter_   { 0          }
+{
+}
+
+void SWRasterizer::Draw(
+    const SWDrawState&  state,
+    unsigned int        numVertices,
+    unsigned int        firstVertex,
+    unsigned int        numInstances,
+    unsigned int        firstInstance)
+{
+    if (numVertices < 3 || numInstances == 0)
+        return;
+
+    ValidateVertexStreams(state, firstVertex, static_cast<std::int64_t>(firstVertex) + numVertices - 1, numInstances, firstInstance);
+
+    if (!UpdateRenderArea(state))
+        return;
+
+    for (unsigned int instance = 0; instance < numInstances; ++instance)
+    {
+        /* Shade vertices in the range [firstVertex, firstVertex + numVertices) */
+        ShadeVertices(state, numVertices, nullptr, firstVertex, instance, firstInstance);
+        DrawPrimitives(state, numVertices, nullptr);
+    }
+
+    stats_.verticesSubmitted += static_cast<std::uint64_t>(numVertices) * numInstances;
+}
+
+void SWRasterizer::DrawIndexed(
+    const SWDrawState&  state,
+    const char*         indices,
+    const DataType      indexType,
+    unsigned int        numIndices,
+    int                 vertexOffset,
+    unsigned int        numInstances,
+    unsigned int        firstInstance)
+{
+    if (numIndices < 3 || numInstances == 0)
+        return;
+
+    /* Read indices and determine their range */
+    vertexIDs_.resize(numIndices);
+
+    switch (indexType)
+    {
+        case DataType::UInt8:
+            for (unsigned int i = 0; i < numIndices; ++i)
+                vertexIDs_[i] = reinterpret_cast<const std::uint8_t*>(indices)[i];
+            break;
+        case DataType::UInt16:
+            for (unsigned int i = 0; i < numIndices; ++i)
+            {
+                std::uint16_t index;
+                std::memcpy(&index, indices + i * sizeof(index), sizeof(index));
+                vertexIDs_[i] = index;
+            }
+            break;
+        case DataType::UInt32:
+            std::memcpy(vertexIDs_.data(), indices, numIndices * sizeof(std::uint32_t));
+            break;
+        default:
+            throw std::invalid_argument("index format not supported by software renderer");
+    }
+
+    const auto minMaxIndex = std::minmax_element(vertexIDs_.begin(), vertexIDs_.end());
+    const auto minIndex = *minMaxIndex.first;
+    const auto maxIndex = *minMaxIndex.second;
+
+    ValidateVertexStreams(
+        state,
+        static_cast<std::int64_t>(minIndex) + vertexOffset,
+        static_cast<std::int64_t>(maxIndex) + vertexOffset,
+        numInstances,
+        firstInstance
+    );
+
+    if (!UpdateRenderArea(state))
+        return;
+
+    /*
+    If the indices reference a compact range of vertices, each vertex in that range is shaded once and shared by all primitives,
+    otherwise each index is shaded separately, so sparse indices never shade unreferenced vertices
+    */
+    const std::size_t indexRange = static_cast<std::size_t>(maxIndex - minIndex) + 1;
+    const bool shadeIndexRange = (indexRange <= static_cast<std::size_t>(numIndices) * 2);
+
+    slots_.resize(numIndices);
+    if (shadeIndexRange)
+    {
+        for (unsigned int i = 0; i < numIndices; ++i)
+            slots_[i] = vertexIDs_[i] - minIndex;
+    }
+    else
+    {
+        for (unsigned int i = 0; i < numIndices; ++i)
+            slots_[i] = i;
+    }
+
+    for (unsigned int instance = 0; instance < numInstances; ++instance)
+    {
+        if (shadeIndexRange)
+            ShadeVertices(state, indexRange, nullptr, static_cast<std::int64_t>(minIndex) + vertexOffset, instance, firstInstance);
+        else
+            ShadeVertices(state, numIndices, vertexIDs_.data(), vertexOffset, instance, firstInstance);
+        DrawPrimitives(state, numIndices, slots_.data());
+    }
+
+    stats_.verticesSubmitted += static_cast<std::uint64_t>(numIndices) * numInstances;
+}
+
+void SWRasterizer::ClearColor(const SWFramebuffer& framebuffer, unsigned int index, const float (&color)[4])
+{
+    if (index >= framebuffer.numColors)
+        return;
+
+    const auto& attachment = framebuffer.colors[index];
+    const auto  texelSize  = attachment.format.size;
+
+    /* Convert clear color once, then replicate it to all texels */
+    char texel[32] = {};
+    StoreSWTexel(attachment.format, texel, color);
+
+    threadPool_.ParallelFor(
+        framebuffer.height,
+        [&](std::size_t y, std::size_t /*threadIndex*/)
+        {
+            auto dst = attachment.data + y * attachment.rowPitch;
+            for (unsigned int x = 0; x < framebuffer.width; ++x, dst += texelSize)
+                std::memcpy(dst, texel, texelSize);
+        }
+    );
+}
+
+void SWRasterizer::ClearDepth(const SWFramebuffer& framebuffer, float depth)
+{
+    if (!framebuffer.depthData)
+        return;
+
+    threadPool_.ParallelFor(
+        framebuffer.height,
+        [&](std::size_t y, std::size_t /*threadIndex*/)
+        {
+            auto dst = framebuffer.depthData + y * framebuffer.depthRowPitch;
+            for (unsigned int x = 0; x < framebuffer.width; ++x, dst += framebuffer.depthTexelSize)
+                std::memcpy(dst, &depth, sizeof(depth));
+        }
+    );
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SWRasterizer::ValidateVertexStreams(
+    const SWDrawState& state, std::int64_t minVertex, std::int64_t maxVertex, unsigned int numInstances, unsigned int firstInstance)
+{
+    if (minVertex < 0)
+        throw std::out_of_range("negative vertex index in draw command");
+
+    for (unsigned int i = 0; i < state.numVertexStreams; ++i)
+    {
+        const auto& stream = state.vertexStreams[i];
+        if (stream.divisor > 0)
+        {
+            const auto lastInstance = static_cast<std::uint64_t>(firstInstance) + (numInstances - 1) / stream.divisor;
+            if (lastInstance >= stream.numElements)
+                throw std::out_of_range("instance range exceeds bound instance buffers");
+        }
+        else if (static_cast<std::uint64_t>(maxVertex) >= stream.numElements)
+            throw std::out_of_range("vertex range exceeds bound vertex buffers");
+    }
+}
+
+bool SWRasterizer::UpdateRenderArea(const SWDrawState& state)
+{
+    const auto& framebuffer = *state.framebuffer;
+    const auto& viewport    = state.viewport;
+
+    /* Intersect viewport, framebuffer, and optional scissor rectangle */
+    renderMinX_ = std::max(0, static_cast<int>(std::floor(viewport.x)));
+    renderMinY_ = std::max(0, static_cast<int>(std::floor(viewport.y)));
+    renderMaxX_ = std::min(static_cast<int>(framebuffer.width),  static_cast<int>(std::ceil(viewport.x + viewport.width))) - 1;
+    renderMaxY_ = std::min(static_cast<int>(framebuffer.height), static_cast<int>(std::ceil(viewport.y + viewport.height))) - 1;
+
+    if (state.pipeline->GetRasterizerDesc().scissorTestEnabled)
+    {
+        const auto& scissor = state.scissor;
+        renderMinX_ = std::max(renderMinX_, scissor.x);
+        renderMinY_ = std::max(renderMinY_, scissor.y);
+        renderMaxX_ = std::min(renderMaxX_, scissor.x + scissor.width - 1);
+        renderMaxY_ = std::min(renderMaxY_, scissor.y + scissor.height - 1);
+    }
+
+    numTilesX_ = (static_cast<int>(framebuffer.width) + tileSize - 1) / tileSize;
+
+    return (renderMinX_ <= renderMaxX_ && renderMinY_ <= renderMaxY_);
+}
+
+void SWRasterizer::ShadeVertices(
+    const SWDrawState&      state,
+    std::size_t             numVertices,
+    const std::uint32_t*    vertexIDs,
+    std::int64_t            baseVertex,
+    unsigned int            instance,
+    unsigned int            firstInstance)
+{
+    const auto& shader = state.pipeline->GetVertexShader();
+
+    if (vertexCache_.size() < numVertices)
+        vertexCache_.resize(numVertices);
+
+    const auto numChunks = (numVertices + g_vertexChunkSize - 1) / g_vertexChunkSize;
+
+    threadPool_.ParallelFor(
+        numChunks,
+        [&](std::size_t chunk, std::size_t /*threadIndex*/)
+        {
+            const void* vertices[maxSoftwareVertexBuffers] = {};
+
+            /* Per-instance data is the same for all vertices of this chunk */
+            for (unsigned int i = 0; i < state.numVertexStreams; ++i)
+            {
+                const auto& stream = state.vertexStreams[i];
+                if (stream.divisor > 0)
+                    vertices[i] = stream.data + static_cast<std::size_t>(firstInstance + instance / stream.divisor) * stream.stride;
+            }
+
+            SoftwareVertexInput input;
+            {
+                input.vertices          = vertices;
+                input.numVertexBuffers  = state.numVertexStreams;
+                input.vertexID          = 0;
+                input.instanceID        = instance;
+                input.constantBuffers   = state.constantBuffers;
+                input.userData          = shader.userData;
+            }
+
+            const auto begin    = chunk * g_vertexChunkSize;
+            const auto end      = std::min(begin + g_vertexChunkSize, numVertices);
+
+            for (auto i = begin; i < end; ++i)
+            {
+                const auto vertexID = static_cast<std::size_t>((vertexIDs != nullptr ? vertexIDs[i] : i) + baseVertex);
+
+                for (unsigned int j = 0; j < state.numVertexStreams; ++j)
+                {
+                    const auto& stream = state.vertexStreams[j];
+                    if (stream.divisor == 0)
+                        vertices[j] = stream.data + vertexID * stream.stride;
+                }
+
+                input.vertexID = static_cast<unsigned int>(vertexID);
+                shader.vertexFunction(input, vertexCache_[i]);
+            }
+        }
+    );
+
+    stats_.vertexShaderInvocations += numVertices;
+}
+
+void SWRasterizer::DrawPrimitives(const SWDrawState& state, std::size_t numPositions, const std::uint32_t* slots)
+{
+    const auto topology = state.pipeline->GetPrimitiveTopology();
+    const auto numPrimitives = (topology == PrimitiveTopology::TriangleList ? numPositions / 3 : numPositions - 2);
+
+    /* Clip and set up primitives in parallel chunks */
+    const auto numChunks = (numPrimitives + g_primitiveChunkSize - 1) / g_primitiveChunkSize;
+    if (setupChunks_.size() < numChunks)
+        setupChunks_.resize(numChunks);
+
+    threadPool_.ParallelFor(
+        numChunks,
+        [&](std::size_t chunk, std::size_t /*threadIndex*/)
+        {
+            auto& output = setupChunks_[chunk];
+            output.clear();
+
+            const auto begin    = chunk * g_primitiveChunkSize;
+            const auto end      = std::min(begin + g_primitiveChunkSize, numPrimitives);
+
+            for (auto i = begin; i < end; ++i)
+            {
+                /* Assemble primitive (strips alternate the order of the first two vertices to keep the winding) */
+                std::size_t p[3];
+                switch (topology)
+                {
+                    case PrimitiveTopology::TriangleStrip:
+                        p[0] = ((i & 1) == 0 ? i     : i + 1);
+                        p[1] = ((i & 1) == 0 ? i + 1 : i    );
+                        p[2] = i + 2;
+                        break;
+                    case PrimitiveTopology::TriangleFan:
+                        p[0] = 0;
+                        p[1] = i + 1;
+                        p[2] = i + 2;
+                        break;
+                    default:
+                        p[0] = i * 3;
+                        p[1] = i * 3 + 1;
+                        p[2] = i * 3 + 2;
+                        break;
+                }
+
+                if (slots)
+                {
+                    for (auto& slot : p)
+                        slot = slots[slot];
+                }
+
+                ClipAndSetupTriangle(state, vertexCache_[p[0]], vertexCache_[p[1]], vertexCache_[p[2]], output);
+            }
+        }
+    );
+
+    stats_.primitivesSubmitted += numPrimitives;
+
+    /* Bin triangles into tiles in submission order */
+    const auto numTilesY = (static_cast<int>(state.framebuffer->height) + tileSize - 1) / tileSize;
+    const auto numTiles  = static_cast<std::size_t>(numTilesX_ * numTilesY);
+
+    if (tileBins_.size() < numTiles)
+        tileBins_.resize(numTiles);
+
+    activeTiles_.clear();
+
+    for (std::size_t chunk = 0; chunk < numChunks; ++chunk)
+    {
+        for (const auto& tri : setupChunks_[chunk])
+        {
+            for (int tileY = tri.minY / tileSize; tileY <= tri.maxY / tileSize; ++tileY)
+            {
+                for (int tileX = tri.minX / tileSize; tileX <= tri.maxX / tileSize; ++tileX)
+                {
+                    const auto tileIndex = static_cast<std::size_t>(tileY * numTilesX_ + tileX);
+                    auto& bin = tileBins_[tileIndex];
+                    if (bin.empty())
+                        activeTiles_.push_back(tileIndex);
+                    bin.push_back(&tri);
+                }
+            }
+        }
+        stats_.clippingOutputPrimitives += setupChunks_[chunk].size();
+    }
+
+    /* Rasterize each tile on a single thread */
+    fragmentCounter_    = 0;
+    sampleCounter_      = 0;
+
+    threadPool_.ParallelFor(
+        activeTiles_.size(),
+        [&](std::size_t i, std::size_t /*threadIndex*/)
+        {
+            RasterizeTile(state, activeTiles_[i]);
+        }
+    );
+
+    stats_.fragmentShaderInvocations    += fragmentCounter_;
+    stats_.samplesPassed                += sampleCounter_;
+
+    for (auto tileIndex : activeTiles_)
+        tileBins_[tileIndex].clear();
+}
+
+void SWRasterizer::ClipAndSetupTriangle(
+    const SWDrawState&          state,
+    const SoftwareVertexOutput& v0,
+    const SoftwareVertexOutput& v1,
+    const SoftwareVertexOutput& v2,
+    std::vector<SWTriangle>&    output) const
+{
+    /* Guard band, so that only large triangles need to be clipped against the X and Y planes */
+    const auto& viewport = state.viewport;
+    const auto  guardBand = std::max(1.0f, g_guardBandSize / std::max(1.0f, std::max(viewport.width, viewport.height)));
+    const bool  depthClamp = state.pipeline->GetRasterizerDesc().depthClampEnabled;
+
+    const SWClipPlane planes[] =
+    {
+        { 0.0f, 0.0f, 0.0f, 1.0f },                             // W >= min W (distance is offset below)
+        { 0.0f, 0.0f, (depthClamp ? 0.0f : 1.0f), 0.0f },       // Z >= 0
+        { -1.0f, 0.0f, 0.0f, guardBand },                       // X <= G*W
+        { +1.0f, 0.0f, 0.0f, guardBand },                       // X >= -G*W
+        { 0.0f, -1.0f, 0.0f, guardBand },                       // Y <= G*W
+        { 0.0f, +1.0f, 0.0f, guardBand },                       // Y >= -G*W
+    };
+    const int numPlanes = static_cast<int>(sizeof(planes) / sizeof(planes[0]));
+
+    auto PlaneDistance = [&planes](int plane, const SoftwareVertexOutput& v)
+    {
+        return (plane == 0 ? v.position[3] - g_minClipW : planes[plane].Distance(v));
+    };
+
+    /* Trivial accept or reject */
+    const SoftwareVertexOutput* verts[3] = { &v0, &v1, &v2 };
+    unsigned int clipMask = 0;
+
+    for (int plane = 0; plane < numPlanes; ++plane)
+    {
+        int numOutside = 0;
+        for (auto v : verts)
+        {
+            if (PlaneDistance(plane, *v) < 0.0f)
+                ++numOutside;
+        }
+        if (numOutside == 3)
+            return;
+        if (numOutside > 0)
+            clipMask |= (1u << plane);
+    }
+
+    if (clipMask == 0)
+    {
+        EmitTriangle(state, v0, v1, v2, output);
+        return;
+    }
+
+    /* Clip polygon against each intersected plane (Sutherland-Hodgman) */
+    const auto numVaryings = state.pipeline->GetVertexShader().numVaryings;
+
+    SoftwareVertexOutput polygons[2][3 + numPlanes];
+    int numVerts = 3;
+    int current = 0;
+
+    polygons[0][0] = v0;
+    polygons[0][1] = v1;
+    polygons[0][2] = v2;
+
+    for (int plane = 0; plane < numPlanes && numVerts >= 3; ++plane)
+    {
+        if ((clipMask & (1u << plane)) == 0)
+            continue;
+
+        const auto& src = polygons[current];
+        auto&       dst = polygons[1 - current];
+        int numDstVerts = 0;
+
+        for (int i = 0; i < numVerts; ++i)
+        {
+            const auto& a = src[i];
+            const auto& b = src[(i + 1) % numVerts];
+            const auto  da = PlaneDistance(plane, a);
+            const auto  db = PlaneDistance(plane, b);
+
+            if (da >= 0.0f)
+                dst[numDstVerts++] = a;
+            if ((da >= 0.0f) != (db >= 0.0f))
+                LerpVertex(dst[numDstVerts++], a, b, da / (da - db), numVaryings);
+        }
+
+        numVerts = numDstVerts;
+        current = 1 - current;
+    }
+
+    /* Triangulate clipped polygon as fan */
+    for (int i = 1; i + 1 < numVerts; ++i)
+        EmitTriangle(state, polygons[current][0], polygons[current][i], polygons[current][i + 1], output);
+}
+
+void SWRasterizer::EmitTriangle(
+    const SWDrawState&          state,
+    const SoftwareVertexOutput& v0,
+    const SoftwareVertexOutput& v1,
+    const SoftwareVertexOutput& v2,
+    std::vector<SWTriangle>&    output) const
+{
+    const auto& viewport    = state.viewport;
+    const auto& rasterizer  = state.pipeline->GetRasterizerDesc();
+    const auto  numVaryings = state.pipeline->GetVertexShader().numVaryings;
+
+    SWTriangle tri;
+
+    /* Transform vertices into window coordinates (upper-left origin) */
+    const SoftwareVertexOutput* verts[3] = { &v0, &v1, &v2 };
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const auto& pos = verts[i]->position;
+        const auto  invW = 1.0f / pos[3];
+        tri.x[i]    = SnapToSubPixel(viewport.x + (pos[0] * invW + 1.0f) * 0.5f * viewport.width);
+        tri.y[i]    = SnapToSubPixel(viewport.y + (1.0f - pos[1] * invW) * 0.5f * viewport.height);
+        tri.z[i]    = pos[2] * invW;
+        tri.invW[i] = invW;
+    }
+
+    /* Determine orientation and cull faces */
+    auto area = (tri.x[1] - tri.x[0]) * (tri.y[2] - tri.y[0]) - (tri.x[2] - tri.x[0]) * (tri.y[1] - tri.y[0]);
+    if (area == 0.0f)
+        return;
+
+    const bool ccw = (area < 0.0f);
+    tri.frontFacing = (ccw == rasterizer.frontCCW);
+
+    if ( ( rasterizer.cullMode == CullMode::Back  && !tri.frontFacing ) ||
+         ( rasterizer.cullMode == CullMode::Front &&  tri.frontFacing ) )
+    {
+        return;
+    }
+
+    /* Ensure clockwise order, so the edge functions are positive inside the triangle */
+    int order[3] = { 0, 1, 2 };
+    if (ccw)
+    {
+        std::swap(tri.x[1],     tri.x[2]);
+        std::swap(tri.y[1],     tri.y[2]);
+        std::swap(tri.z[1],     tri.z[2]);
+        std::swap(tri.invW[1],  tri.invW[2]);
+        std::swap(order[1],     order[2]);
+        area = -area;
+    }
+
+    tri.invArea = 1.0f / area;
+
+    /* Determine pixel bounds, whose pixel centers can be covered */
+    const auto minX = std::min({ tri.x[0], tri.x[1], tri.x[2] });
+    const auto minY = std::min({ tri.y[0], tri.y[1], tri.y[2] });
+    const auto maxX = std::max({ tri.x[0], tri.x[1], tri.x[2] });
+    const auto maxY = std::max({ tri.y[0], tri.y[1], tri.y[2] });
+
+    tri.minX = std::max(renderMinX_, static_cast<int>(std::ceil(minX - 0.5f)));
+    tri.minY = std::max(renderMinY_, static_cast<int>(std::ceil(minY - 0.5f)));
+    tri.maxX = std::min(renderMaxX_, static_cast<int>(std::floor(maxX - 0.5f)));
+    tri.maxY = std::min(renderMaxY_, static_cast<int>(std::floor(maxY - 0.5f)));
+
+    if (tri.minX > tri.maxX || tri.minY > tri.maxY)
+        return;
+
+    /* Store varyings pre-multiplied with 1/W for perspective correct interpolation */
+    for (int i = 0; i < 3; ++i)
+    {
+        const auto& varyings = verts[order[i]]->varyings;
+        for (unsigned int j = 0; j < numVaryings; ++j)
+            tri.varyings[i][j] = varyings[j] * tri.invW[i];
+    }
+
+    output.push_back(tri);
+}
+
+void SWRasterizer::RasterizeTile(const SWDrawState& state, std::size_t tileIndex)
+{
+    const auto tileX = static_cast<int>(tileIndex % static_cast<std::size_t>(numTilesX_)) * tileSize;
+    const auto tileY = static_cast<int>(tileIndex / static_cast<std::size_t>(numTilesX_)) * tileSize;
+
+    std::uint64_t counters[2] = { 0, 0 };
+
+    for (auto tri : tileBins_[tileIndex])
+        RasterizeTriangle(state, *tri, tileX, tileY, counters);
+
+    fragmentCounter_    += counters[0];
+    sampleCounter_      += counters[1];
+}
+
+/*
+Each edge function is evaluated relative to the lexicographically smaller vertex of its edge,
+so the two triangles that share an edge compute exactly negated values for every pixel (regardless of the floating-point rounding).
+Together with the top-left fill convention, this makes the rasterization watertight.
+*/
+void SWRasterizer::RasterizeTriangle(const SWDrawState& state, const SWTriangle& tri, int tileX, int tileY, std::uint64_t (&counters)[2]) const
+{
+    const int x0 = std::max(tri.minX, tileX);
+    const int y0 = std::max(tri.minY, tileY);
+    const int x1 = std::min(tri.maxX, tileX + tileSize - 1);
+    const int y1 = std::min(tri.maxY, tileY + tileSize - 1);
+
+    if (x0 > x1 || y0 > y1)
+        return;
+
+    /* Set up edge functions E(p) = A*(p.x - origin.x) + B*(p.y - origin.y), where edge i is opposite to vertex i */
+    float edgeA[3], edgeB[3], originX[3], originY[3];
+    bool topLeft[3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const int a = (i + 1) % 3;
+        const int b = (i + 2) % 3;
+
+        edgeA[i]    = tri.y[a] - tri.y[b];
+        edgeB[i]    = tri.x[b] - tri.x[a];
+        topLeft[i]  = (edgeA[i] > 0.0f || (edgeA[i] == 0.0f && edgeB[i] > 0.0f));
+
+        const bool aFirst = (tri.x[a] < tri.x[b] || (tri.x[a] == tri.x[b] && tri.y[a] < tri.y[b]));
+        originX[i]  = (aFirst ? tri.x[a] : tri.x[b]);
+        originY[i]  = (aFirst ? tri.y[a] : tri.y[b]);
+    }
+
+    /* Process pixels in groups of four, which are aligned to the tile */
+    const int xStart = tileX + ((x0 - tileX) & ~3);
+
+    #ifdef LLGL_SW_SSE2
+
+    const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 zero = _mm_setzero_ps();
+
+    __m128 vecA[3], vecOriginX[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        vecA[i]         = _mm_set1_ps(edgeA[i]);
+        vecOriginX[i]   = _mm_set1_ps(originX[i]);
+    }
+
+    for (int y = y0; y <= y1; ++y)
+    {
+        const float py = static_cast<float>(y) + 0.5f;
+
+        __m128 rowB[3];
+        for (int i = 0; i < 3; ++i)
+            rowB[i] = _mm_set1_ps(edgeB[i] * (py - originY[i]));
+
+        for (int x = xStart; x <= x1; x += 4)
+        {
+            const __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+
+            __m128 edge[3];
+            int mask = 0xF;
+
+            for (int i = 0; i < 3; ++i)
+            {
+                edge[i] = _mm_add_ps(_mm_mul_ps(vecA[i], _mm_sub_ps(px, vecOriginX[i])), rowB[i]);
+                const __m128 inside = (topLeft[i] ? _mm_cmpge_ps(edge[i], zero) : _mm_cmpgt_ps(edge[i], zero));
+                mask &= _mm_movemask_ps(inside);
+            }
+
+            /* Remove lanes outside the pixel bounds */
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                if (x + lane < x0 || x + lane > x1)
+                    mask &= ~(1 << lane);
+            }
+
+            if (mask == 0)
+                continue;
+
+            float e[3][4];
+            for (int i = 0; i < 3; ++i)
+                _mm_storeu_ps(e[i], edge[i]);
+
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                if ((mask & (1 << lane)) != 0)
+                    ShadeFragment(state, tri, x + lane, y, e[0][lane], e[1][lane], e[2][lane], counters);
+            }
+        }
+    }
+
+    #else
+
+    for (int y = y0; y <= y1; ++y)
+    {
+        const float py = static_cast<float>(y) + 0.5f;
+
+        float rowB[3];
+        for (int i = 0; i < 3; ++i)
+            rowB[i] = edgeB[i] * (py - originY[i]);
+
+        for (int x = xStart; x <= x1; x += 4)
+        {
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                const int pixelX = x + lane;
+                if (pixelX < x0 || pixelX > x1)
+                    continue;
+
+                const float px = static_cast<float>(pixelX) + 0.5f;
+
+                float e[3];
+                bool inside = true;
+
+                for (int i = 0; i < 3 && inside; ++i)
+                {
+                    e[i] = edgeA[i] * (px - originX[i]) + rowB[i];
+                    inside = (topLeft[i] ? e[i] >= 0.0f : e[i] > 0.0f);
+                }
+
+                if (inside)
+                    ShadeFragment(state, tri, pixelX, y, e[0], e[1], e[2], counters);
+            }
+        }
+    }
+
+    #endif
+}
+
+void SWRasterizer::ShadeFragment(
+    const SWDrawState&  state,
+    const SWTriangle&   tri,
+    int                 x,
+    int                 y,
+    float               e0,
+    float               e1,
+    float               e2,
+    std::uint64_t       (&counters)[2]) const
+{
+    const auto& pipeline    = *state.pipeline;
+    const auto& framebuffer = *state.framebuffer;
+    const auto& viewport    = state.viewport;
+    const auto& depthDesc   = pipeline.GetDepthDesc();
+
+    /* Interpolate depth linearly in window space */
+    const float b0 = e0 * tri.invArea;
+    const float b1 = e1 * tri.invArea;
+    const float b2 = e2 * tri.invArea;
+
+    float z = b0 * tri.z[0] + b1 * tri.z[1] + b2 * tri.z[2];
+
+    if (pipeline.GetRasterizerDesc().depthClampEnabled)
+        z = std::max(0.0f, std::min(z, 1.0f));
+    else if (z < 0.0f || z > 1.0f)
+        return;
+
+    const float depth = viewport.minDepth + z * (viewport.maxDepth - viewport.minDepth);
+
+    /* Early depth test (fragment shaders can not write depth) */
+    float* depthTexel = nullptr;
+    if (depthDesc.testEnabled && framebuffer.depthData != nullptr)
+    {
+        depthTexel = reinterpret_cast<float*>(
+            framebuffer.depthData + static_cast<std::size_t>(y) * framebuffer.depthRowPitch + static_cast<std::size_t>(x) * framebuffer.depthTexelSize
+        );
+        if (!CompareDepth(depthDesc.compareOp, depth, *depthTexel))
+            return;
+    }
+
+    const auto& shader = pipeline.GetFragmentShader();
+
+    if (shader.fragmentFunction)
+    {
+        /* Interpolate varyings with perspective correction */
+        const auto numVaryings = pipeline.GetVertexShader().numVaryings;
+        const float w = 1.0f / (b0 * tri.invW[0] + b1 * tri.invW[1] + b2 * tri.invW[2]);
+
+        float varyings[maxSoftwareVaryings];
+        for (unsigned int i = 0; i < numVaryings; ++i)
+            varyings[i] = (b0 * tri.varyings[0][i] + b1 * tri.varyings[1][i] + b2 * tri.varyings[2][i]) * w;
+
+        SoftwareFragmentInput input;
+        {
+            input.fragCoord[0]      = static_cast<float>(x) + 0.5f;
+            input.fragCoord[1]      = static_cast<float>(y) + 0.5f;
+            input.fragCoord[2]      = depth;
+            input.fragCoord[3]      = 1.0f / w;
+            input.varyings          = varyings;
+            input.frontFacing       = tri.frontFacing;
+            input.constantBuffers   = state.constantBuffers;
+            input.userData          = shader.userData;
+        }
+
+        SoftwareFragmentOutput output;
+        for (unsigned int i = 0; i < framebuffer.numColors; ++i)
+            std::fill(output.colors[i], output.colors[i] + 4, 0.0f);
+
+        ++counters[0];
+
+        if (!shader.fragmentFunction(input, output))
+            return;
+
+        ++counters[1];
+
+        if (depthTexel && depthDesc.writeEnabled)
+            *depthTexel = depth;
+
+        /* Blend and store output colors */
+        for (unsigned int i = 0; i < framebuffer.numColors; ++i)
+        {
+            const auto& attachment  = framebuffer.colors[i];
+            const auto& target      = pipeline.GetBlendTarget(i);
+            const auto& colorMask   = target.colorMask;
+
+            auto texel = attachment.data + static_cast<std::size_t>(y) * attachment.rowPitch + static_cast<std::size_t>(x) * attachment.format.size;
+
+            const float* src = output.colors[i];
+            float color[4] = { src[0], src[1], src[2], src[3] };
+
+            const bool blend    = (pipeline.IsBlendEnabled() && IsBlendableFormat(attachment.format));
+            const bool fullMask = (colorMask.r && colorMask.g && colorMask.b && colorMask.a);
+
+            if (blend || !fullMask)
+            {
+                float dst[4];
+                LoadSWTexel(attachment.format, texel, dst);
+
+                if (blend)
+                {
+                    const float* src1 = output.colors[std::min(1u, maxSoftwareColorTargets - 1)];
+                    const auto& blendFactor = pipeline.GetBlendFactor();
+
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        color[c] = BlendComponent(
+                            target.colorArithmetic,
+                            src[c], GetBlendFactor(target.srcColor, c, src, src1, dst, blendFactor),
+                            dst[c], GetBlendFactor(target.destColor, c, src, src1, dst, blendFactor)
+                        );
+                    }
+                    color[3] = BlendComponent(
+                        target.alphaArithmetic,
+                        src[3], GetBlendFactor(target.srcAlpha, 3, src, src1, dst, blendFactor),
+                        dst[3], GetBlendFactor(target.destAlpha, 3, src, src1, dst, blendFactor)
+                    );
+                }
+
+                if (!colorMask.r) { color[0] = dst[0]; }
+                if (!colorMask.g) { color[1] = dst[1]; }
+                if (!colorMask.b) { color[2] = dst[2]; }
+                if (!colorMask.a) { color[3] = dst[3]; }
+            }
+
+            StoreSWTexel(attachment.format, texel, color);
+        }
+    }
+    else
+    {
+        /* Depth-only rendering */
+        ++counters[1];
+
+        if (depthTexel && depthDesc.writeEnabled)
+            *depthTexel = depth;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,184 @@
+/*
+ * SWRasterizer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SW_RASTERIZER_H
+#define LLGL_SW_RASTERIZER_H
+
+
+#include <LLGL/RenderContextFlags.h>
+#include <LLGL/SoftwareShaderFlags.h>
+#include <LLGL/Format.h>
+#include "SWTexelFormat.h"
+#include "SWThreadPool.h"
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+class SWGraphicsPipeline;
+
+// Color attachment of a framebuffer.
+struct SWColorAttachment
+{
+    char*           data        = nullptr;
+    std::size_t     rowPitch    = 0;
+    SWTexelFormat   format;
+};
+
+// Framebuffer of a render context or render target. The depth buffer stores a 32-bit float at the beginning of each texel.
+struct SWFramebuffer
+{
+    unsigned int        width                               = 0;
+    unsigned int        height                              = 0;
+    SWColorAttachment   colors[maxSoftwareColorTargets];
+    unsigned int        numColors                           = 0;
+    char*               depthData                           = nullptr;
+    std::size_t         depthRowPitch                       = 0;
+    std::size_t         depthTexelSize                      = 0;
+};
+
+// Vertex buffer stream, where instance data uses a divisor greater than zero.
+struct SWVertexStream
+{
+    const char*     data        = nullptr;
+    unsigned int    stride      = 0;
+    unsigned int    numElements = 0;
+    unsigned int    divisor     = 0;
+};
+
+// All states which are bound for a draw command.
+struct SWDrawState
+{
+    const SWGraphicsPipeline*   pipeline                                    = nullptr;
+    const SWFramebuffer*        framebuffer                                 = nullptr;
+    Viewport                    viewport;
+    Scissor                     scissor;
+    SWVertexStream              vertexStreams[maxSoftwareVertexBuffers];
+    unsigned int                numVertexStreams                            = 0;
+    const void*                 constantBuffers[maxSoftwareConstantBuffers] = {};
+};
+
+// Counters of the rasterizer, which are used to determine query results.
+struct SWStatistics
+{
+    std::uint64_t verticesSubmitted         = 0;
+    std::uint64_t primitivesSubmitted       = 0;
+    std::uint64_t vertexShaderInvocations   = 0;
+    std::uint64_t clippingOutputPrimitives  = 0;
+    std::uint64_t fragmentShaderInvocations = 0;
+    std::uint64_t samplesPassed             = 0;
+};
+
+// Triangle after clipping and setup, in window coordinates.
+struct SWTriangle
+{
+    float           x[3];
+    float           y[3];
+    float           z[3];                           // Normalized device depth.
+    float           invW[3];                        // Reciprocal of the clip space W.
+    float           varyings[3][maxSoftwareVaryings]; // Varyings multiplied by the reciprocal of W for perspective correction.
+    float           invArea;
+    bool            frontFacing;
+    int             minX, minY, maxX, maxY;         // Inclusive pixel bounds, clamped to the render area.
+};
+
+/*
+Tiled triangle rasterizer which executes each draw command immediately on a thread pool:
+vertices are shaded in parallel chunks, primitives are clipped and set up in parallel chunks,
+then binned in submission order into screen tiles, and each tile is rasterized by a single thread.
+Since all triangles within a tile are processed in submission order, the output is deterministic.
+*/
+class SWRasterizer
+{
+
+    public:
+
+        SWRasterizer(SWThreadPool& threadPool);
+
+        void Draw(
+            const SWDrawState&  state,
+            unsigned int        numVertices,
+            unsigned int        firstVertex,
+            unsigned int        numInstances,
+            unsigned int        firstInstance
+        );
+
+        void DrawIndexed(
+            const SWDrawState&  state,
+            const char*         indices,
+            const DataType      indexType,
+            unsigned int        numIndices,
+            int                 vertexOffset,
+            unsigned int        numInstances,
+            unsigned int        firstInstance
+        );
+
+        // Clears the specified color attachment of the framebuffer.
+        void ClearColor(const SWFramebuffer& framebuffer, unsigned int index, const float (&color)[4]);
+
+        // Clears the depth buffer of the framebuffer.
+        void ClearDepth(const SWFramebuffer& framebuffer, float depth);
+
+        inline const SWStatistics& GetStatistics() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        static const int tileSize = 64;
+
+        void ValidateVertexStreams(const SWDrawState& state, std::int64_t minVertex, std::int64_t maxVertex, unsigned int numInstances, unsigned int firstInstance);
+        bool UpdateRenderArea(const SWDrawState& state);
+
+        void ShadeVertices(const SWDrawState& state, std::size_t numVertices, const std::uint32_t* vertexIDs, std::int64_t baseVertex, unsigned int instance, unsigned int firstInstance);
+        void DrawPrimitives(const SWDrawState& state, std::size_t numPositions, const std::uint32_t* slots);
+
+        void ClipAndSetupTriangle(const SWDrawState& state, const SoftwareVertexOutput& v0, const SoftwareVertexOutput& v1, const SoftwareVertexOutput& v2, std::vector<SWTriangle>& output) const;
+        void EmitTriangle(const SWDrawState& state, const SoftwareVertexOutput& v0, const SoftwareVertexOutput& v1, const SoftwareVertexOutput& v2, std::vector<SWTriangle>& output) const;
+
+        void RasterizeTile(const SWDrawState& state, std::size_t tileIndex);
+        void RasterizeTriangle(const SWDrawState& state, const SWTriangle& tri, int tileX, int tileY, std::uint64_t (&counters)[2]) const;
+        void ShadeFragment(const SWDrawState& state, const SWTriangle& tri, int x, int y, float e0, float e1, float e2, std::uint64_t (&counters)[2]) const;
+
+        SWThreadPool&                               threadPool_;
+        SWStatistics                                stats_;
+
+        /* Scratch memory which is reused between draw commands */
+        std::vector<SoftwareVertexOutput>           vertexCache_;
+        std::vector<std::uint32_t>                  vertexIDs_;
+        std::vector<std::uint32_t>                  slots_;
+        std::vector<std::vector<SWTriangle>>        setupChunks_;
+        std::vector<std::vector<const SWTriangle*>> tileBins_;
+        std::vector<std::size_t>                    activeTiles_;
+
+        /* Render area of the current draw command */
+        int                                         renderMinX_     = 0;
+        int                                         renderMinY_     = 0;
+        int                                         renderMaxX_     = 0;
+        int                                         renderMaxY_     = 0;
+        int                                         numTilesX_      = 0;
+
+        std::atomic<std::uint64_t>                  fragmentCounter_;
+        std::atomic<std::uint64_t>                  sampleCounter_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,107 @@
+/*
+ * SWRenderContext.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SWRenderContext.h"
+#include <LLGL/Platform/NativeHandle.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/* ----- SWSurface class ----- */
+
+SWSurface::SWSurface(const Size& size) :
+    size_ { size }
+{
+}
+
+void SWSurface::GetNativeHandle(void* nativeHandle) const
+{
+    *reinterpret_cast<NativeHandle*>(nativeHandle) = NativeHandle();
+}
+
+void SWSurface::Recreate()
+{
+    // dummy
+}
+
+Size SWSurface::GetContentSize() const
+{
+    return size_;
+}
+
+bool SWSurface::AdaptForVideoMode(VideoModeDescriptor& videoModeDesc)
+{
+    size_ = videoModeDesc.resolution;
+    return true;
+}
+
+
+/* ----- SWRenderContext class ----- */
+
+SWRenderContext::SWRenderContext(RenderContextDescriptor desc, const std::shared_ptr<Surface>& surface)
+{
+    /* Use surface without a window if no surface is specified */
+    if (surface)
+        SetOrCreateSurface(surface, desc.videoMode, nullptr);
+    else
+        SetOrCreateSurface(std::make_shared<SWSurface>(desc.videoMode.resolution), desc.videoMode, nullptr);
+
+    desc_ = desc;
+
+    ResizeBuffers(desc.videoMode.resolution);
+}
+
+void SWRenderContext::Present()
+{
+    // dummy
+}
+
+void SWRenderContext::SetVideoMode(const VideoModeDescriptor& videoModeDesc)
+{
+    RenderContext::SetVideoMode(videoModeDesc);
+    ResizeBuffers(GetVideoMode().resolution);
+}
+
+void SWRenderContext::SetVsync(const VsyncDescriptor& vsyncDesc)
+{
+    desc_.vsync = vsyncDesc;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SWRenderContext::ResizeBuffers(const Size& resolution)
+{
+    const auto width    = static_cast<unsigned int>(std::max(0, resolution.x));
+    const auto height   = static_cast<unsigned int>(std::max(0, resolution.y));
+    const auto format   = GetSWTexelFormat(TextureFormat::RGBA8);
+
+    colorBuffer_.resize(static_cast<std::size_t>(width) * height * format.size, char(0));
+    depthBuffer_.resize(static_cast<std::size_t>(width) * height, 1.0f);
+
+    framebuffer_.width                  = width;
+    framebuffer_.height                 = height;
+    framebuffer_.numColors              = 1;
+    framebuffer_.colors[0].data         = colorBuffer_.data();
+    framebuffer_.colors[0].rowPitch     = static_cast<std::size_t>(width) * format.size;
+    framebuffer_.colors[0].format       = format;
+    framebuffer_.depthData              = reinterpret_cast<char*>(depthBuffer_.data());
+    framebuffer_.depthRowPitch          = static_cast<std::size_t>(width) * sizeof(float);
+    framebuffer_.depthTexelSize         = sizeof(float);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
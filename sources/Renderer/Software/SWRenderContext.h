@@ -0,0 +1,92 @@
+/*
+ * SWRenderContext.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SW_RENDER_CONTEXT_H
+#define LLGL_SW_RENDER_CONTEXT_H
+
+
+#include <LLGL/RenderContext.h>
+#include <LLGL/Surface.h>
+#include "SWRasterizer.h"
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Surface without a window, which is used when no surface is passed to a Software render context.
+class SWSurface : public Surface
+{
+
+    public:
+
+        SWSurface(const Size& size);
+
+        void GetNativeHandle(void* nativeHandle) const override;
+
+        void Recreate() override;
+
+        Size GetContentSize() const override;
+
+        bool AdaptForVideoMode(VideoModeDescriptor& videoModeDesc) override;
+
+    private:
+
+        Size size_;
+
+};
+
+/*
+Render context with an RGBA8 color buffer and a 32-bit float depth buffer in system memory.
+The color buffer is not presented on the surface; it can be accessed with "GetColorBuffer" instead.
+*/
+class SWRenderContext : public RenderContext
+{
+
+    public:
+
+        SWRenderContext(RenderContextDescriptor desc, const std::shared_ptr<Surface>& surface);
+
+        void Present() override;
+
+        void SetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
+
+        void SetVsync(const VsyncDescriptor& vsyncDesc) override;
+
+        inline const SWFramebuffer& GetFramebuffer() const
+        {
+            return framebuffer_;
+        }
+
+        // Returns the color buffer with RGBA8 texels in rows from top to bottom.
+        inline const std::vector<char>& GetColorBuffer() const
+        {
+            return colorBuffer_;
+        }
+
+    private:
+
+        void ResizeBuffers(const Size& resolution);
+
+        RenderContextDescriptor desc_;
+        std::vector<char>       colorBuffer_;
+        std::vector<float>      depthBuffer_;
+        SWFramebuffer           framebuffer_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,67 @@
+/*
+ * SWRenderStates.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SWRenderStates.h"
+#include "../CheckedCast.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+SWGraphicsPipeline::SWGraphicsPipeline(const GraphicsPipelineDescriptor& desc) :
+    primitiveTopology_  { desc.primitiveTopology     },
+    depth_              { desc.depth                 },
+    rasterizer_         { desc.rasterizer            },
+    blendEnabled_       { desc.blend.blendEnabled    },
+    blendFactor_        { desc.blend.blendFactor     }
+{
+    if (!desc.shaderProgram)
+        throw std::invalid_argument("cannot create graphics pipeline without shader program");
+
+    auto shaderProgramSW = LLGL_CAST(SWShaderProgram*, desc.shaderProgram);
+    if (!shaderProgramSW->IsLinked())
+        throw std::invalid_argument("cannot create graphics pipeline with shader program that is not linked");
+
+    /* Validate states that are not supported by the rasterizer */
+    switch (desc.primitiveTopology)
+    {
+        case PrimitiveTopology::TriangleList:
+        case PrimitiveTopology::TriangleStrip:
+        case PrimitiveTopology::TriangleFan:
+            break;
+        default:
+            throw std::invalid_argument("primitive topology not supported by software renderer (only triangle lists, strips, and fans)");
+    }
+
+    if (desc.rasterizer.polygonMode != PolygonMode::Fill)
+        throw std::invalid_argument("polygon mode not supported by software renderer (only PolygonMode::Fill)");
+    if (desc.stencil.testEnabled)
+        throw std::invalid_argument("stencil test not supported by software renderer");
+
+    /* Store shader functions */
+    vertexShader_ = shaderProgramSW->GetVertexShader()->GetSoftwareDesc();
+    if (auto fragmentShader = shaderProgramSW->GetFragmentShader())
+        fragmentShader_ = fragmentShader->GetSoftwareDesc();
+
+    /* Resolve blend targets, where missing entries use the first target (or the default) */
+    for (unsigned int i = 0; i < maxSoftwareColorTargets; ++i)
+    {
+        if (i < desc.blend.targets.size())
+            blendTargets_[i] = desc.blend.targets[i];
+        else if (!desc.blend.targets.empty())
+            blendTargets_[i] = desc.blend.targets.front();
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
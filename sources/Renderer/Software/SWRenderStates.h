@@ -0,0 +1,130 @@
+/*
+ * SWRenderStates.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SW_RENDER_STATES_H
+#define LLGL_SW_RENDER_STATES_H
+
+
+#include <LLGL/GraphicsPipeline.h>
+#include <LLGL/Query.h>
+#include <LLGL/Fence.h>
+#include <LLGL/SoftwareShaderFlags.h>
+#include "SWShader.h"
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Graphics pipeline with all states the rasterizer needs for a draw command.
+Only filled triangle topologies are supported, and the stencil test is not supported.
+*/
+class SWGraphicsPipeline : public GraphicsPipeline
+{
+
+    public:
+
+        SWGraphicsPipeline(const GraphicsPipelineDescriptor& desc);
+
+        inline PrimitiveTopology GetPrimitiveTopology() const
+        {
+            return primitiveTopology_;
+        }
+
+        inline const DepthDescriptor& GetDepthDesc() const
+        {
+            return depth_;
+        }
+
+        inline const RasterizerDescriptor& GetRasterizerDesc() const
+        {
+            return rasterizer_;
+        }
+
+        inline bool IsBlendEnabled() const
+        {
+            return blendEnabled_;
+        }
+
+        inline const ColorRGBAf& GetBlendFactor() const
+        {
+            return blendFactor_;
+        }
+
+        // Returns the blend target for the specified color attachment (in the range [0, maxSoftwareColorTargets)).
+        inline const BlendTargetDescriptor& GetBlendTarget(unsigned int index) const
+        {
+            return blendTargets_[index];
+        }
+
+        inline const SoftwareShaderDescriptor& GetVertexShader() const
+        {
+            return vertexShader_;
+        }
+
+        inline const SoftwareShaderDescriptor& GetFragmentShader() const
+        {
+            return fragmentShader_;
+        }
+
+    private:
+
+        PrimitiveTopology           primitiveTopology_  = PrimitiveTopology::TriangleList;
+        DepthDescriptor             depth_;
+        RasterizerDescriptor        rasterizer_;
+        bool                        blendEnabled_       = false;
+        ColorRGBAf                  blendFactor_;
+        BlendTargetDescriptor       blendTargets_[maxSoftwareColorTargets];
+        SoftwareShaderDescriptor    vertexShader_;
+        SoftwareShaderDescriptor    fragmentShader_;
+
+};
+
+// Query whose result is determined from the counters of the rasterizer between the begin and end of the query.
+class SWQuery : public Query
+{
+
+    public:
+
+        SWQuery(const QueryDescriptor& desc) :
+            Query { desc.type }
+        {
+        }
+
+        std::uint64_t   beginValue  = 0;
+        std::uint64_t   result      = 0;
+        bool            active      = false;
+        bool            finished    = false;
+
+};
+
+// Fence which is signaled as soon as it is submitted, since all commands are executed immediately.
+class SWFence : public Fence
+{
+
+    public:
+
+        bool IsSignaled() override
+        {
+            return signaled;
+        }
+
+        bool signaled = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
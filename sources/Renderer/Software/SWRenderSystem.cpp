@@ -0,0 +1,417 @@
+/*
+ * SWRenderSystem.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SWRenderSystem.h"
+#include "../CheckedCast.h"
+#include "../Assertion.h"
+#include "../../Core/Helper.h"
+#include <LLGL/Image.h>
+#include <LLGL/Format.h>
+#include <stdexcept>
+#include <cstring>
+#include <thread>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal functions ----- */
+
+// Returns the number of threads for the specified configuration, where maxThreadCount refers to all hardware threads.
+static std::size_t GetNumThreads(const RenderSystemConfiguration& config)
+{
+    const auto numHardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    return (config.threadCount == maxThreadCount ? numHardwareThreads : std::max<std::size_t>(1, config.threadCount));
+}
+
+
+/* ----- Render System ----- */
+
+SWRenderSystem::SWRenderSystem() :
+    threadPool_ { GetNumThreads(GetConfiguration()) }
+{
+    RendererInfo info;
+    {
+        info.rendererName           = "Software";
+        info.deviceName             = "CPU Rasterizer";
+        info.vendorName             = "LLGL";
+        info.shadingLanguageName    = "Software Shader Functions";
+    }
+    SetRendererInfo(info);
+
+    QueryRenderingCaps();
+}
+
+void SWRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
+{
+    RenderSystem::SetConfiguration(config);
+    threadPool_.SetNumThreads(GetNumThreads(config));
+}
+
+MemoryStatistics SWRenderSystem::QueryMemoryStatistics()
+{
+    MemoryStatistics stats;
+    memoryAccounting_.GetStatistics(stats);
+    return stats;
+}
+
+/* ----- Render Context ----- */
+
+RenderContext* SWRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
+{
+    return TakeOwnership(renderContexts_, MakeUnique<SWRenderContext>(desc, surface));
+}
+
+void SWRenderSystem::Release(RenderContext& renderContext)
+{
+    RemoveFromUniqueSet(renderContexts_, &renderContext);
+}
+
+/* ----- Command buffers ----- */
+
+CommandBuffer* SWRenderSystem::CreateCommandBuffer()
+{
+    return TakeOwnership(commandBuffers_, MakeUnique<SWCommandBuffer>(threadPool_, GetRenderingCaps()));
+}
+
+void SWRenderSystem::Release(CommandBuffer& commandBuffer)
+{
+    RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
+}
+
+/* ----- Buffers ------ */
+
+Buffer* SWRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
+{
+    AssertCreateBuffer(desc);
+
+    /* Validate buffer formats, since the rasterizer reads vertices and indices with them */
+    if (desc.type == BufferType::Vertex && desc.vertexBuffer.format.stride == 0)
+        throw std::invalid_argument("cannot create vertex buffer with zero vertex stride");
+    if (desc.type == BufferType::Index && desc.indexBuffer.format.GetFormatSize() == 0)
+        throw std::invalid_argument("cannot create index buffer with invalid index format");
+
+    auto buffer = MakeUnique<CPUBuffer>(desc, initialData);
+    memoryAccounting_.Allocate(MemoryAccounting::Type::Buffer, desc.size);
+    return TakeOwnership(buffers_, std::move(buffer));
+}
+
+BufferArray* SWRenderSystem::CreateBufferArray(unsigned int numBuffers, Buffer* const * bufferArray)
+{
+    AssertCreateBufferArray(numBuffers, bufferArray);
+    return TakeOwnership(bufferArrays_, MakeUnique<CPUBufferArray>((*bufferArray)->GetType(), numBuffers, bufferArray));
+}
+
+void SWRenderSystem::Release(Buffer& buffer)
+{
+    auto& bufferSW = LLGL_CAST(CPUBuffer&, buffer);
+    memoryAccounting_.Release(MemoryAccounting::Type::Buffer, static_cast<std::uint64_t>(bufferSW.GetSize()));
+    RemoveFromUniqueSet(buffers_, &buffer);
+}
+
+void SWRenderSystem::Release(BufferArray& bufferArray)
+{
+    RemoveFromUniqueSet(bufferArrays_, &bufferArray);
+}
+
+void SWRenderSystem::WriteBuffer(Buffer& buffer, const void* data, std::size_t dataSize, std::size_t offset)
+{
+    LLGL_ASSERT_PTR(data);
+    auto& bufferSW = LLGL_CAST(CPUBuffer&, buffer);
+    bufferSW.Write(data, dataSize, offset);
+}
+
+void* SWRenderSystem::MapBuffer(Buffer& buffer, const BufferCPUAccess access)
+{
+    auto& bufferSW = LLGL_CAST(CPUBuffer&, buffer);
+    return bufferSW.Map(access);
+}
+
+void SWRenderSystem::UnmapBuffer(Buffer& buffer)
+{
+    auto& bufferSW = LLGL_CAST(CPUBuffer&, buffer);
+    bufferSW.Unmap();
+}
+
+/* ----- Textures ----- */
+
+Texture* SWRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* imageDesc)
+{
+    auto texture = MakeUnique<SWTexture>(textureDesc, imageDesc);
+    memoryAccounting_.Allocate(MemoryAccounting::Type::Texture, TextureMemoryFootprint(texture->GetDesc()));
+    return TakeOwnership(textures_, std::move(texture));
+}
+
+TextureArray* SWRenderSystem::CreateTextureArray(unsigned int numTextures, Texture* const * textureArray)
+{
+    AssertCreateTextureArray(numTextures, textureArray);
+    return TakeOwnership(textureArrays_, MakeUnique<CPUTextureArray>(numTextures, textureArray));
+}
+
+void SWRenderSystem::Release(Texture& texture)
+{
+    auto& textureSW = LLGL_CAST(SWTexture&, texture);
+    memoryAccounting_.Release(MemoryAccounting::Type::Texture, TextureMemoryFootprint(textureSW.GetDesc()));
+    RemoveFromUniqueSet(textures_, &texture);
+}
+
+void SWRenderSystem::Release(TextureArray& textureArray)
+{
+    RemoveFromUniqueSet(textureArrays_, &textureArray);
+}
+
+TextureDescriptor SWRenderSystem::QueryTextureDescriptor(const Texture& texture)
+{
+    auto& textureSW = LLGL_CAST(const SWTexture&, texture);
+    return textureSW.GetDesc();
+}
+
+void SWRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
+{
+    LLGL_ASSERT_PTR(imageDesc.buffer);
+    auto& textureSW = LLGL_CAST(SWTexture&, texture);
+    textureSW.Write(subTextureDesc, imageDesc);
+}
+
+std::uint64_t SWRenderSystem::WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
+{
+    /* Uploads complete immediately, which is reported with ticket 0 */
+    WriteTexture(texture, subTextureDesc, imageDesc);
+    return 0;
+}
+
+bool SWRenderSystem::IsTextureUploadComplete(std::uint64_t /*ticket*/)
+{
+    return true;
+}
+
+void SWRenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer)
+{
+    LLGL_ASSERT_PTR(buffer);
+
+    auto& textureSW = LLGL_CAST(const SWTexture&, texture);
+    textureSW.Read(static_cast<unsigned int>(mipLevel), imageFormat, dataType, buffer);
+}
+
+std::uint64_t SWRenderSystem::ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc)
+{
+    auto& textureSW = LLGL_CAST(const SWTexture&, texture);
+    textureSW.AssertMipLevel(static_cast<unsigned int>(desc.mipLevel));
+
+    /* Read texture immediately in the final format, since all commands have already been executed */
+    const auto format   = (desc.convert ? desc.convertFormat : desc.format);
+    const auto dataType = (desc.convert ? desc.convertDataType : desc.dataType);
+
+    auto size = textureSW.QueryMipLevelSize(static_cast<unsigned int>(desc.mipLevel));
+    auto dataSize = static_cast<std::size_t>(size.x) * size.y * size.z * ImageFormatSize(format) * DataTypeSize(dataType);
+
+    /* Store readback under a new ticket */
+    auto ticket = nextReadbackTicket_++;
+    auto& readback = readbacks_[ticket];
+    readback.resize(dataSize);
+    textureSW.Read(static_cast<unsigned int>(desc.mipLevel), format, dataType, readback.data());
+
+    return ticket;
+}
+
+bool SWRenderSystem::MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize)
+{
+    auto it = readbacks_.find(ticket);
+    if (it != readbacks_.end())
+    {
+        data        = it->second.data();
+        dataSize    = it->second.size();
+        return true;
+    }
+    return false;
+}
+
+void SWRenderSystem::UnmapTextureReadback(std::uint64_t ticket)
+{
+    readbacks_.erase(ticket);
+}
+
+void SWRenderSystem::GenerateMips(Texture& texture)
+{
+    auto& textureSW = LLGL_CAST(SWTexture&, texture);
+    textureSW.GenerateMips();
+}
+
+/* ----- Sampler States ---- */
+
+Sampler* SWRenderSystem::CreateSampler(const SamplerDescriptor& desc)
+{
+    return TakeOwnership(samplers_, MakeUnique<CPUSampler>(desc));
+}
+
+SamplerArray* SWRenderSystem::CreateSamplerArray(unsigned int numSamplers, Sampler* const * samplerArray)
+{
+    AssertCreateSamplerArray(numSamplers, samplerArray);
+    return TakeOwnership(samplerArrays_, MakeUnique<CPUSamplerArray>(numSamplers, samplerArray));
+}
+
+void SWRenderSystem::Release(Sampler& sampler)
+{
+    RemoveFromUniqueSet(samplers_, &sampler);
+}
+
+void SWRenderSystem::Release(SamplerArray& samplerArray)
+{
+    RemoveFromUniqueSet(samplerArrays_, &samplerArray);
+}
+
+/* ----- Resource Heaps ----- */
+
+ResourceHeap* SWRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    AssertCreateResourceHeap(desc);
+    return TakeOwnership(resourceHeaps_, MakeUnique<CPUResourceHeap>(desc));
+}
+
+void SWRenderSystem::Release(ResourceHeap& resourceHeap)
+{
+    RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
+}
+
+/* ----- Render Targets ----- */
+
+RenderTarget* SWRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
+{
+    auto renderTarget = MakeUnique<SWRenderTarget>(desc);
+    memoryAccounting_.Allocate(MemoryAccounting::Type::RenderTarget, 0);
+    return TakeOwnership(renderTargets_, std::move(renderTarget));
+}
+
+void SWRenderSystem::Release(RenderTarget& renderTarget)
+{
+    memoryAccounting_.Release(MemoryAccounting::Type::RenderTarget, 0);
+    RemoveFromUniqueSet(renderTargets_, &renderTarget);
+}
+
+/* ----- Shader ----- */
+
+Shader* SWRenderSystem::CreateShader(const ShaderType type)
+{
+    return TakeOwnership(shaders_, MakeUnique<SWShader>(type));
+}
+
+ShaderProgram* SWRenderSystem::CreateShaderProgram()
+{
+    return TakeOwnership(shaderPrograms_, MakeUnique<SWShaderProgram>());
+}
+
+void SWRenderSystem::Release(Shader& shader)
+{
+    RemoveFromUniqueSet(shaders_, &shader);
+}
+
+void SWRenderSystem::Release(ShaderProgram& shaderProgram)
+{
+    RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
+}
+
+/* ----- Pipeline States ----- */
+
+GraphicsPipeline* SWRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
+{
+    return TakeOwnership(graphicsPipelines_, MakeUnique<SWGraphicsPipeline>(desc));
+}
+
+ComputePipeline* SWRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& /*desc*/)
+{
+    throw std::runtime_error("compute pipelines not supported by software renderer");
+}
+
+void SWRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
+{
+    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+}
+
+void SWRenderSystem::Release(ComputePipeline& /*computePipeline*/)
+{
+    // dummy
+}
+
+/* ----- Queries ----- */
+
+Query* SWRenderSystem::CreateQuery(const QueryDescriptor& desc)
+{
+    return TakeOwnership(queries_, MakeUnique<SWQuery>(desc));
+}
+
+void SWRenderSystem::Release(Query& query)
+{
+    RemoveFromUniqueSet(queries_, &query);
+}
+
+/* ----- Fences ----- */
+
+Fence* SWRenderSystem::CreateFence()
+{
+    return TakeOwnership(fences_, MakeUnique<SWFence>());
+}
+
+void SWRenderSystem::Release(Fence& fence)
+{
+    RemoveFromUniqueSet(fences_, &fence);
+}
+
+bool SWRenderSystem::WaitFence(Fence& fence, std::uint64_t /*timeout*/)
+{
+    auto& fenceSW = LLGL_CAST(SWFence&, fence);
+    return fenceSW.IsSignaled();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SWRenderSystem::QueryRenderingCaps()
+{
+    RenderingCaps caps;
+    {
+        caps.screenOrigin                       = ScreenOrigin::UpperLeft;
+        caps.clippingRange                      = ClippingRange::ZeroToOne;
+        caps.shadingLanguage                    = ShadingLanguage::GLSL_450; // Shader source code is ignored, so any source is accepted
+        caps.hasRenderTargets                   = true;
+        caps.has3DTextures                      = true;
+        caps.hasCubeTextures                    = true;
+        caps.hasTextureArrays                   = true;
+        caps.hasCubeTextureArrays               = true;
+        caps.hasMultiSampleTextures             = false;
+        caps.hasSamplers                        = true;
+        caps.hasConstantBuffers                 = true;
+        caps.hasStorageBuffers                  = false;
+        caps.hasUniforms                        = false;
+        caps.hasGeometryShaders                 = false;
+        caps.hasTessellationShaders             = false;
+        caps.hasComputeShaders                  = false;
+        caps.hasInstancing                      = true;
+        caps.hasOffsetInstancing                = true;
+        caps.hasViewportArrays                  = false;
+        caps.hasConservativeRasterization       = false;
+        caps.hasStreamOutputs                   = false;
+        caps.hasIndirectDrawing                 = true;
+        caps.maxNumTextureArrayLayers           = 2048;
+        caps.maxNumRenderTargetAttachments      = maxSoftwareColorTargets;
+        caps.maxConstantBufferSize              = 65536;
+        caps.max1DTextureSize                   = 16384;
+        caps.max2DTextureSize                   = 16384;
+        caps.max3DTextureSize                   = 2048;
+        caps.maxCubeTextureSize                 = 16384;
+    }
+    SetRenderingCaps(caps);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
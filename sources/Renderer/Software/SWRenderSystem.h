@@ -0,0 +1,191 @@
+/*
+ * SWRenderSystem.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SW_RENDER_SYSTEM_H
+#define LLGL_SW_RENDER_SYSTEM_H
+
+
+#include <LLGL/RenderSystem.h>
+#include "../ContainerTypes.h"
+#include "../MemoryAccounting.h"
+#include "../CPUCommon/CPUBuffer.h"
+#include "../CPUCommon/CPUBufferArray.h"
+#include "../CPUCommon/CPUResourceArrays.h"
+
+#include "SWCommandBuffer.h"
+#include "SWRenderContext.h"
+#include "SWTexture.h"
+#include "SWRenderTarget.h"
+#include "SWShader.h"
+#include "SWRenderStates.h"
+#include "SWThreadPool.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Render system which rasterizes triangles on the CPU, so images can be rendered on machines without a GPU.
+Shaders are not compiled; instead, vertex and fragment functions are registered via "ShaderDescriptor::software".
+All command buffers share one thread pool, whose size is determined by "RenderSystemConfiguration::threadCount".
+*/
+class SWRenderSystem : public RenderSystem
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        SWRenderSystem();
+
+        void SetConfiguration(const RenderSystemConfiguration& config) override;
+
+        MemoryStatistics QueryMemoryStatistics() override;
+
+        /* ----- Render Context ----- */
+
+        RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
+
+        void Release(RenderContext& renderContext) override;
+
+        /* ----- Command buffers ----- */
+
+        CommandBuffer* CreateCommandBuffer() override;
+
+        void Release(CommandBuffer& commandBuffer) override;
+
+        /* ----- Buffers ------ */
+
+        Buffer* CreateBuffer(const BufferDescriptor& desc, const void* initialData = nullptr) override;
+        BufferArray* CreateBufferArray(unsigned int numBuffers, Buffer* const * bufferArray) override;
+
+        void Release(Buffer& buffer) override;
+        void Release(BufferArray& bufferArray) override;
+
+        void WriteBuffer(Buffer& buffer, const void* data, std::size_t dataSize, std::size_t offset) override;
+
+        void* MapBuffer(Buffer& buffer, const BufferCPUAccess access) override;
+        void UnmapBuffer(Buffer& buffer) override;
+
+        /* ----- Textures ----- */
+
+        Texture* CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* imageDesc = nullptr) override;
+        TextureArray* CreateTextureArray(unsigned int numTextures, Texture* const * textureArray) override;
+
+        void Release(Texture& texture) override;
+        void Release(TextureArray& textureArray) override;
+
+        TextureDescriptor QueryTextureDescriptor(const Texture& texture) override;
+
+        void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
+
+        std::uint64_t WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc) override;
+        bool IsTextureUploadComplete(std::uint64_t ticket) override;
+
+        void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) override;
+
+        std::uint64_t ReadTextureAsync(const Texture& texture, const TextureReadbackDescriptor& desc) override;
+        bool MapTextureReadback(std::uint64_t ticket, const void*& data, std::size_t& dataSize) override;
+        void UnmapTextureReadback(std::uint64_t ticket) override;
+
+        void GenerateMips(Texture& texture) override;
+
+        /* ----- Sampler States ---- */
+
+        Sampler* CreateSampler(const SamplerDescriptor& desc) override;
+        SamplerArray* CreateSamplerArray(unsigned int numSamplers, Sampler* const * samplerArray) override;
+
+        void Release(Sampler& sampler) override;
+        void Release(SamplerArray& samplerArray) override;
+
+        /* ----- Resource Heaps ----- */
+
+        ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
+
+        void Release(ResourceHeap& resourceHeap) override;
+
+        /* ----- Render Targets ----- */
+
+        RenderTarget* CreateRenderTarget(const RenderTargetDescriptor& desc) override;
+
+        void Release(RenderTarget& renderTarget) override;
+
+        /* ----- Shader ----- */
+
+        Shader* CreateShader(const ShaderType type) override;
+        ShaderProgram* CreateShaderProgram() override;
+
+        void Release(Shader& shader) override;
+        void Release(ShaderProgram& shaderProgram) override;
+
+        /* ----- Pipeline States ----- */
+
+        GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
+        ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) override;
+
+        void Release(GraphicsPipeline& graphicsPipeline) override;
+        void Release(ComputePipeline& computePipeline) override;
+
+        /* ----- Queries ----- */
+
+        Query* CreateQuery(const QueryDescriptor& desc) override;
+
+        void Release(Query& query) override;
+
+        /* ----- Fences ----- */
+
+        Fence* CreateFence() override;
+
+        void Release(Fence& fence) override;
+
+        bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+
+    private:
+
+        void QueryRenderingCaps();
+
+        /* ----- Hardware object containers ----- */
+
+        HWObjectContainer<SWRenderContext>      renderContexts_;
+        HWObjectContainer<SWCommandBuffer>      commandBuffers_;
+        HWObjectContainer<CPUBuffer>            buffers_;
+        HWObjectContainer<CPUBufferArray>       bufferArrays_;
+        HWObjectContainer<SWTexture>            textures_;
+        HWObjectContainer<CPUTextureArray>      textureArrays_;
+        HWObjectContainer<CPUSampler>           samplers_;
+        HWObjectContainer<CPUSamplerArray>      samplerArrays_;
+        HWObjectContainer<CPUResourceHeap>      resourceHeaps_;
+        HWObjectContainer<SWRenderTarget>       renderTargets_;
+        HWObjectContainer<SWShader>             shaders_;
+        HWObjectContainer<SWShaderProgram>      shaderPrograms_;
+        HWObjectContainer<SWGraphicsPipeline>   graphicsPipelines_;
+        HWObjectContainer<SWQuery>              queries_;
+        HWObjectContainer<SWFence>              fences_;
+
+        std::map<std::uint64_t, std::vector<char>> readbacks_;
+        std::uint64_t                           nextReadbackTicket_ = 1;
+
+        MemoryAccounting                        memoryAccounting_;
+        SWThreadPool                            threadPool_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
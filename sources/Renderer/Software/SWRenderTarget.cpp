@@ -0,0 +1,135 @@
+/*
+ * SWRenderTarget.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SWRenderTarget.h"
+#include "SWTexture.h"
+#include "../CheckedCast.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+SWRenderTarget::SWRenderTarget(const RenderTargetDescriptor& desc) :
+    desc_ { desc }
+{
+}
+
+void SWRenderTarget::AttachDepthBuffer(const Gs::Vector2ui& size)
+{
+    AttachInternalDepthBuffer(size);
+}
+
+void SWRenderTarget::AttachStencilBuffer(const Gs::Vector2ui& /*size*/)
+{
+    throw std::runtime_error("stencil buffers not supported by software renderer");
+}
+
+void SWRenderTarget::AttachDepthStencilBuffer(const Gs::Vector2ui& size)
+{
+    /* Stencil test is not supported, so only the depth part is allocated */
+    AttachInternalDepthBuffer(size);
+}
+
+void SWRenderTarget::AttachTexture(Texture& texture, const RenderTargetAttachmentDescriptor& attachmentDesc)
+{
+    auto& textureSW = LLGL_CAST(SWTexture&, texture);
+
+    /* Multi-sample textures are rendered with a single sample, so they can always be attached */
+    const auto mipLevel = (IsMultiSampleTexture(texture.GetType()) ? 0u : attachmentDesc.mipLevel);
+    textureSW.AssertMipLevel(mipLevel);
+
+    /* Determine first texel of the attached layer or cube face */
+    unsigned int layer = 0;
+
+    switch (texture.GetType())
+    {
+        case TextureType::Texture2DArray:
+        case TextureType::Texture2DMSArray:
+            layer = attachmentDesc.layer;
+            break;
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            layer = attachmentDesc.layer * 6 + static_cast<unsigned int>(attachmentDesc.cubeFace);
+            break;
+        default:
+            break;
+    }
+
+    const auto mipSize = textureSW.QueryMipLevelSize(mipLevel);
+    if (layer >= mipSize.z)
+        throw std::out_of_range("render target attachment layer out of range");
+
+    ApplyMipResolution(texture, mipLevel);
+
+    const auto& format  = textureSW.GetTexelFormat();
+    auto        data    = textureSW.GetTexel(mipLevel, 0, 0, layer);
+    const auto  pitch   = static_cast<std::size_t>(mipSize.x) * format.size;
+
+    if (format.depth)
+    {
+        AssertNoDepthAttachment();
+        framebuffer_.depthData      = data;
+        framebuffer_.depthRowPitch  = pitch;
+        framebuffer_.depthTexelSize = format.size;
+    }
+    else
+    {
+        if (framebuffer_.numColors >= maxSoftwareColorTargets)
+            throw std::out_of_range("too many color attachments for render target");
+
+        auto& attachment = framebuffer_.colors[framebuffer_.numColors++];
+        {
+            attachment.data     = data;
+            attachment.rowPitch = pitch;
+            attachment.format   = format;
+        }
+    }
+
+    framebuffer_.width  = GetResolution().x;
+    framebuffer_.height = GetResolution().y;
+}
+
+void SWRenderTarget::DetachAll()
+{
+    ResetResolution();
+    depthBuffer_.clear();
+    framebuffer_ = SWFramebuffer();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SWRenderTarget::AttachInternalDepthBuffer(const Gs::Vector2ui& size)
+{
+    AssertNoDepthAttachment();
+    ApplyResolution(size);
+
+    depthBuffer_.assign(static_cast<std::size_t>(size.x) * size.y, 1.0f);
+
+    framebuffer_.width          = size.x;
+    framebuffer_.height         = size.y;
+    framebuffer_.depthData      = reinterpret_cast<char*>(depthBuffer_.data());
+    framebuffer_.depthRowPitch  = static_cast<std::size_t>(size.x) * sizeof(float);
+    framebuffer_.depthTexelSize = sizeof(float);
+}
+
+void SWRenderTarget::AssertNoDepthAttachment() const
+{
+    if (framebuffer_.depthData != nullptr)
+        throw std::invalid_argument("cannot attach more than one depth or stencil buffer to render target");
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
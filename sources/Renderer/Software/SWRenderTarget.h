@@ -0,0 +1,63 @@
+/*
+ * SWRenderTarget.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SW_RENDER_TARGET_H
+#define LLGL_SW_RENDER_TARGET_H
+
+
+#include <LLGL/RenderTarget.h>
+#include "SWRasterizer.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class SWTexture;
+
+// Render target which renders directly into the texel memory of its attached textures.
+class SWRenderTarget : public RenderTarget
+{
+
+    public:
+
+        SWRenderTarget(const RenderTargetDescriptor& desc);
+
+        void AttachDepthBuffer(const Gs::Vector2ui& size) override;
+        void AttachStencilBuffer(const Gs::Vector2ui& size) override;
+        void AttachDepthStencilBuffer(const Gs::Vector2ui& size) override;
+
+        void AttachTexture(Texture& texture, const RenderTargetAttachmentDescriptor& attachmentDesc) override;
+
+        void DetachAll() override;
+
+        inline const SWFramebuffer& GetFramebuffer() const
+        {
+            return framebuffer_;
+        }
+
+    private:
+
+        void AttachInternalDepthBuffer(const Gs::Vector2ui& size);
+        void AssertNoDepthAttachment() const;
+
+        RenderTargetDescriptor  desc_;
+        std::vector<float>      depthBuffer_;
+        SWFramebuffer           framebuffer_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
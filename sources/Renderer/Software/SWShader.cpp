@@ -0,0 +1,187 @@
+/*
+ * SWShader.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SWShader.h"
+#include "../CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- SWShader class ----- */
+
+SWShader::SWShader(const ShaderType type) :
+    Shader { type }
+{
+}
+
+bool SWShader::Compile(const std::string& /*sourceCode*/, const ShaderDescriptor& shaderDesc)
+{
+    softwareDesc_ = shaderDesc.software;
+    infoLog_.clear();
+
+    /* Validate shader functions for this shader stage (the source code is ignored) */
+    switch (GetType())
+    {
+        case ShaderType::Vertex:
+            if (!softwareDesc_.vertexFunction)
+                infoLog_ = "missing software vertex function";
+            else if (softwareDesc_.numVaryings > maxSoftwareVaryings)
+                infoLog_ = "too many software varyings";
+            break;
+
+        case ShaderType::Fragment:
+            if (!softwareDesc_.fragmentFunction)
+                infoLog_ = "missing software fragment function";
+            break;
+
+        default:
+            infoLog_ = "shader stage not supported by software renderer";
+            break;
+    }
+
+    compiled_ = infoLog_.empty();
+
+    return compiled_;
+}
+
+bool SWShader::LoadBinary(std::vector<char>&& /*binaryCode*/, const ShaderDescriptor& /*shaderDesc*/)
+{
+    infoLog_    = "shader binaries not supported by software renderer";
+    compiled_   = false;
+    return false;
+}
+
+std::string SWShader::Disassemble(int /*flags*/)
+{
+    return "";
+}
+
+std::string SWShader::QueryInfoLog()
+{
+    return infoLog_;
+}
+
+
+/* ----- SWShaderProgram class ----- */
+
+void SWShaderProgram::AttachShader(Shader& shader)
+{
+    shaders_.push_back(LLGL_CAST(SWShader*, &shader));
+    linked_ = false;
+}
+
+void SWShaderProgram::DetachAll()
+{
+    shaders_.clear();
+    linked_ = false;
+}
+
+bool SWShaderProgram::LinkShaders()
+{
+    infoLog_.clear();
+    vertexShader_   = nullptr;
+    fragmentShader_ = nullptr;
+
+    for (auto shader : shaders_)
+    {
+        if (!shader->IsCompiled())
+        {
+            infoLog_ = "attached shader is not compiled";
+            break;
+        }
+
+        /* Each shader stage can only be attached once */
+        auto& slot = (shader->GetType() == ShaderType::Vertex ? vertexShader_ : fragmentShader_);
+        if (slot)
+        {
+            infoLog_ = "shader stage is attached more than once";
+            break;
+        }
+        slot = shader;
+    }
+
+    if (infoLog_.empty() && !vertexShader_)
+        infoLog_ = "missing vertex shader";
+
+    linked_ = infoLog_.empty();
+
+    if (!linked_)
+    {
+        vertexShader_   = nullptr;
+        fragmentShader_ = nullptr;
+    }
+
+    return linked_;
+}
+
+std::string SWShaderProgram::QueryInfoLog()
+{
+    return infoLog_;
+}
+
+const std::vector<VertexAttribute>& SWShaderProgram::QueryVertexAttributes() const
+{
+    return vertexFormat_.attributes;
+}
+
+const std::vector<StreamOutputAttribute>& SWShaderProgram::QueryStreamOutputAttributes() const
+{
+    static const std::vector<StreamOutputAttribute> empty;
+    return empty;
+}
+
+const std::vector<ConstantBufferViewDescriptor>& SWShaderProgram::QueryConstantBuffers() const
+{
+    static const std::vector<ConstantBufferViewDescriptor> empty;
+    return empty;
+}
+
+const std::vector<StorageBufferViewDescriptor>& SWShaderProgram::QueryStorageBuffers() const
+{
+    static const std::vector<StorageBufferViewDescriptor> empty;
+    return empty;
+}
+
+const std::vector<UniformDescriptor>& SWShaderProgram::QueryUniforms() const
+{
+    static const std::vector<UniformDescriptor> empty;
+    return empty;
+}
+
+void SWShaderProgram::BuildInputLayout(const VertexFormat& vertexFormat)
+{
+    vertexFormat_ = vertexFormat;
+}
+
+void SWShaderProgram::BindConstantBuffer(const std::string& /*name*/, unsigned int /*bindingIndex*/)
+{
+    // dummy
+}
+
+void SWShaderProgram::BindStorageBuffer(const std::string& /*name*/, unsigned int /*bindingIndex*/)
+{
+    // dummy
+}
+
+ShaderUniform* SWShaderProgram::LockShaderUniform()
+{
+    return nullptr; // dummy
+}
+
+void SWShaderProgram::UnlockShaderUniform()
+{
+    // dummy
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,120 @@
+/*
+ * SWShader.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SW_SHADER_H
+#define LLGL_SW_SHADER_H
+
+
+#include <LLGL/Shader.h>
+#include <LLGL/ShaderProgram.h>
+#include <LLGL/ShaderFlags.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Shader which registers the software shader functions of its descriptor, instead of compiling the source code.
+class SWShader : public Shader
+{
+
+    public:
+
+        SWShader(const ShaderType type);
+
+        bool Compile(const std::string& sourceCode, const ShaderDescriptor& shaderDesc = {}) override;
+
+        bool LoadBinary(std::vector<char>&& binaryCode, const ShaderDescriptor& shaderDesc = {}) override;
+
+        std::string Disassemble(int flags = 0) override;
+
+        std::string QueryInfoLog() override;
+
+        inline bool IsCompiled() const
+        {
+            return compiled_;
+        }
+
+        inline const SoftwareShaderDescriptor& GetSoftwareDesc() const
+        {
+            return softwareDesc_;
+        }
+
+    private:
+
+        SoftwareShaderDescriptor    softwareDesc_;
+        std::string                 infoLog_;
+        bool                        compiled_       = false;
+
+};
+
+// Shader program which combines a software vertex shader with an optional software fragment shader.
+class SWShaderProgram : public ShaderProgram
+{
+
+    public:
+
+        void AttachShader(Shader& shader) override;
+        void DetachAll() override;
+
+        bool LinkShaders() override;
+
+        std::string QueryInfoLog() override;
+
+        const std::vector<VertexAttribute>& QueryVertexAttributes() const override;
+        const std::vector<StreamOutputAttribute>& QueryStreamOutputAttributes() const override;
+        const std::vector<ConstantBufferViewDescriptor>& QueryConstantBuffers() const override;
+        const std::vector<StorageBufferViewDescriptor>& QueryStorageBuffers() const override;
+        const std::vector<UniformDescriptor>& QueryUniforms() const override;
+
+        void BuildInputLayout(const VertexFormat& vertexFormat) override;
+
+        void BindConstantBuffer(const std::string& name, unsigned int bindingIndex) override;
+        void BindStorageBuffer(const std::string& name, unsigned int bindingIndex) override;
+
+        ShaderUniform* LockShaderUniform() override;
+        void UnlockShaderUniform() override;
+
+        // Returns true if this shader program has been linked successfully.
+        inline bool IsLinked() const
+        {
+            return linked_;
+        }
+
+        // Returns the attached vertex shader, or null if the program is not linked.
+        inline const SWShader* GetVertexShader() const
+        {
+            return vertexShader_;
+        }
+
+        // Returns the attached fragment shader, or null if there is none.
+        inline const SWShader* GetFragmentShader() const
+        {
+            return fragmentShader_;
+        }
+
+    private:
+
+        std::vector<SWShader*>  shaders_;
+        VertexFormat            vertexFormat_;
+        std::string             infoLog_;
+        const SWShader*         vertexShader_   = nullptr;
+        const SWShader*         fragmentShader_ = nullptr;
+        bool                    linked_         = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
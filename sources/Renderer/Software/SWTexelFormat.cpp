@@ -0,0 +1,386 @@
+/*
+ * SWTexelFormat.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SWTexelFormat.h"
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+static SWTexelFormat MakeTexelFormat(DataType dataType, unsigned int components, bool normalized, bool halfFloat = false, bool depth = false)
+{
+    SWTexelFormat fmt;
+    {
+        fmt.dataType    = dataType;
+        fmt.components  = components;
+        fmt.normalized  = normalized;
+        fmt.halfFloat   = halfFloat;
+        fmt.depth       = depth;
+        fmt.size        = components * DataTypeSize(dataType);
+    }
+    return fmt;
+}
+
+SWTexelFormat GetSWTexelFormat(const TextureFormat format)
+{
+    switch (format)
+    {
+        /* --- Base formats --- */
+        case TextureFormat::DepthComponent: return MakeTexelFormat(DataType::Float,  1, false, false, true);
+        case TextureFormat::DepthStencil:   return MakeTexelFormat(DataType::Float,  2, false, false, true);
+        case TextureFormat::R:              return MakeTexelFormat(DataType::UInt8,  1, true);
+        case TextureFormat::RG:             return MakeTexelFormat(DataType::UInt8,  2, true);
+        case TextureFormat::RGB:            return MakeTexelFormat(DataType::UInt8,  3, true);
+        case TextureFormat::RGBA:           return MakeTexelFormat(DataType::UInt8,  4, true);
+
+        /* --- Sized formats --- */
+        case TextureFormat::R8:             return MakeTexelFormat(DataType::UInt8,  1, true);
+        case TextureFormat::R8Sgn:          return MakeTexelFormat(DataType::Int8,   1, true);
+        case TextureFormat::R16:            return MakeTexelFormat(DataType::UInt16, 1, true);
+        case TextureFormat::R16Sgn:         return MakeTexelFormat(DataType::Int16,  1, true);
+        case TextureFormat::R16Float:       return MakeTexelFormat(DataType::UInt16, 1, false, true);
+        case TextureFormat::R32UInt:        return MakeTexelFormat(DataType::UInt32, 1, false);
+        case TextureFormat::R32SInt:        return MakeTexelFormat(DataType::Int32,  1, false);
+        case TextureFormat::R32Float:       return MakeTexelFormat(DataType::Float,  1, false);
+
+        case TextureFormat::RG8:            return MakeTexelFormat(DataType::UInt8,  2, true);
+        case TextureFormat::RG8Sgn:         return MakeTexelFormat(DataType::Int8,   2, true);
+        case TextureFormat::RG16:           return MakeTexelFormat(DataType::UInt16, 2, true);
+        case TextureFormat::RG16Sgn:        return MakeTexelFormat(DataType::Int16,  2, true);
+        case TextureFormat::RG16Float:      return MakeTexelFormat(DataType::UInt16, 2, false, true);
+        case TextureFormat::RG32UInt:       return MakeTexelFormat(DataType::UInt32, 2, false);
+        case TextureFormat::RG32SInt:       return MakeTexelFormat(DataType::Int32,  2, false);
+        case TextureFormat::RG32Float:      return MakeTexelFormat(DataType::Float,  2, false);
+
+        case TextureFormat::RGB8:           return MakeTexelFormat(DataType::UInt8,  3, true);
+        case TextureFormat::RGB8Sgn:        return MakeTexelFormat(DataType::Int8,   3, true);
+        case TextureFormat::RGB16:          return MakeTexelFormat(DataType::UInt16, 3, true);
+        case TextureFormat::RGB16Sgn:       return MakeTexelFormat(DataType::Int16,  3, true);
+        case TextureFormat::RGB16Float:     return MakeTexelFormat(DataType::UInt16, 3, false, true);
+        case TextureFormat::RGB32UInt:      return MakeTexelFormat(DataType::UInt32, 3, false);
+        case TextureFormat::RGB32SInt:      return MakeTexelFormat(DataType::Int32,  3, false);
+        case TextureFormat::RGB32Float:     return MakeTexelFormat(DataType::Float,  3, false);
+
+        case TextureFormat::RGBA8:          return MakeTexelFormat(DataType::UInt8,  4, true);
+        case TextureFormat::RGBA8Sgn:       return MakeTexelFormat(DataType::Int8,   4, true);
+        case TextureFormat::RGBA16:         return MakeTexelFormat(DataType::UInt16, 4, true);
+        case TextureFormat::RGBA16Sgn:      return MakeTexelFormat(DataType::Int16,  4, true);
+        case TextureFormat::RGBA16Float:    return MakeTexelFormat(DataType::UInt16, 4, false, true);
+        case TextureFormat::RGBA32UInt:     return MakeTexelFormat(DataType::UInt32, 4, false);
+        case TextureFormat::RGBA32SInt:     return MakeTexelFormat(DataType::Int32,  4, false);
+        case TextureFormat::RGBA32Float:    return MakeTexelFormat(DataType::Float,  4, false);
+
+        default:
+            break;
+    }
+    throw std::invalid_argument("texture format not supported by software renderer");
+}
+
+SWTexelFormat GetSWTexelFormat(const ImageFormat format, const DataType dataType)
+{
+    /* Image data of floating-point types is never normalized */
+    const bool normalized = (dataType != DataType::Float && dataType != DataType::Double);
+
+    SWTexelFormat fmt;
+
+    switch (format)
+    {
+        case ImageFormat::R:
+            fmt = MakeTexelFormat(dataType, 1, normalized);
+            break;
+        case ImageFormat::RG:
+            fmt = MakeTexelFormat(dataType, 2, normalized);
+            break;
+        case ImageFormat::RGB:
+            fmt = MakeTexelFormat(dataType, 3, normalized);
+            break;
+        case ImageFormat::BGR:
+            fmt = MakeTexelFormat(dataType, 3, normalized);
+            fmt.swizzle[0] = 2;
+            fmt.swizzle[2] = 0;
+            break;
+        case ImageFormat::RGBA:
+            fmt = MakeTexelFormat(dataType, 4, normalized);
+            break;
+        case ImageFormat::BGRA:
+            fmt = MakeTexelFormat(dataType, 4, normalized);
+            fmt.swizzle[0] = 2;
+            fmt.swizzle[2] = 0;
+            break;
+        case ImageFormat::ARGB:
+            fmt = MakeTexelFormat(dataType, 4, normalized);
+            fmt.swizzle[0] = 1;
+            fmt.swizzle[1] = 2;
+            fmt.swizzle[2] = 3;
+            fmt.swizzle[3] = 0;
+            break;
+        case ImageFormat::ABGR:
+            fmt = MakeTexelFormat(dataType, 4, normalized);
+            fmt.swizzle[0] = 3;
+            fmt.swizzle[1] = 2;
+            fmt.swizzle[2] = 1;
+            fmt.swizzle[3] = 0;
+            break;
+        case ImageFormat::Depth:
+            fmt = MakeTexelFormat(dataType, 1, normalized, false, true);
+            break;
+        case ImageFormat::DepthStencil:
+            fmt = MakeTexelFormat(dataType, 2, normalized, false, true);
+            break;
+        default:
+            throw std::invalid_argument("compressed image format not supported by software renderer");
+    }
+
+    return fmt;
+}
+
+// Converts a 16-bit floating-point value into a 32-bit floating-point value.
+static float HalfToFloat(std::uint16_t h)
+{
+    const std::uint32_t sign        = static_cast<std::uint32_t>(h & 0x8000) << 16;
+    const std::uint32_t exponent    = (h >> 10) & 0x1F;
+    const std::uint32_t mantissa    = h & 0x03FF;
+
+    std::uint32_t bits = 0;
+
+    if (exponent == 0)
+    {
+        /* Zero or denormalized value */
+        const float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return (sign ? -value : value);
+    }
+    else if (exponent == 31)
+    {
+        /* Infinity or NaN */
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    }
+    else
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+    float f = 0.0f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// Converts a 32-bit floating-point value into a 16-bit floating-point value (rounded to nearest).
+static std::uint16_t FloatToHalf(float f)
+{
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &f, sizeof(bits));
+
+    const std::uint16_t sign    = static_cast<std::uint16_t>((bits >> 16) & 0x8000);
+    const std::int32_t exponent = static_cast<std::int32_t>((bits >> 23) & 0xFF) - 127 + 15;
+    const std::uint32_t mantissa = bits & 0x007FFFFF;
+
+    if (((bits >> 23) & 0xFF) == 0xFF)
+    {
+        /* Infinity or NaN */
+        return sign | 0x7C00 | (mantissa ? 0x0200 : 0);
+    }
+    if (exponent >= 31)
+    {
+        /* Overflow to infinity */
+        return sign | 0x7C00;
+    }
+    if (exponent <= 0)
+    {
+        /* Denormalized value or underflow to zero */
+        if (exponent < -10)
+            return sign;
+        const auto m = (mantissa | 0x00800000) >> (1 - exponent);
+        return sign | static_cast<std::uint16_t>((m + 0x00001000) >> 13);
+    }
+
+    return sign | static_cast<std::uint16_t>(((exponent << 10) | (mantissa >> 13)) + ((mantissa >> 12) & 1));
+}
+
+template <typename T>
+float NormalizedToFloat(T value)
+{
+    const float maxValue = static_cast<float>(std::numeric_limits<T>::max());
+    return std::max(-1.0f, static_cast<float>(value) / maxValue);
+}
+
+template <typename T>
+T FloatToNormalized(float value)
+{
+    const float minValue = (std::numeric_limits<T>::is_signed ? -1.0f : 0.0f);
+    const float maxValue = static_cast<float>(std::numeric_limits<T>::max());
+    const float scaled = std::max(minValue, std::min(value, 1.0f)) * maxValue;
+    return static_cast<T>(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+}
+
+template <typename T>
+T FloatToInteger(float value)
+{
+    /* Clamp to range which is exactly representable for 32-bit integers */
+    const float minValue = (std::numeric_limits<T>::is_signed ? -2147483648.0f : 0.0f);
+    const float maxValue = (std::numeric_limits<T>::is_signed ? 2147483520.0f : 4294967040.0f);
+    return static_cast<T>(std::max(minValue, std::min(value, maxValue)));
+}
+
+static float LoadComponent(const SWTexelFormat& format, const char* src, unsigned int index)
+{
+    switch (format.dataType)
+    {
+        case DataType::Int8:
+        {
+            const auto value = reinterpret_cast<const std::int8_t*>(src)[index];
+            return (format.normalized ? NormalizedToFloat(value) : static_cast<float>(value));
+        }
+        case DataType::UInt8:
+        {
+            const auto value = reinterpret_cast<const std::uint8_t*>(src)[index];
+            return (format.normalized ? NormalizedToFloat(value) : static_cast<float>(value));
+        }
+        case DataType::Int16:
+        {
+            std::int16_t value;
+            std::memcpy(&value, src + index * sizeof(value), sizeof(value));
+            return (format.normalized ? NormalizedToFloat(value) : static_cast<float>(value));
+        }
+        case DataType::UInt16:
+        {
+            std::uint16_t value;
+            std::memcpy(&value, src + index * sizeof(value), sizeof(value));
+            if (format.halfFloat)
+                return HalfToFloat(value);
+            return (format.normalized ? NormalizedToFloat(value) : static_cast<float>(value));
+        }
+        case DataType::Int32:
+        {
+            std::int32_t value;
+            std::memcpy(&value, src + index * sizeof(value), sizeof(value));
+            return (format.normalized ? NormalizedToFloat(value) : static_cast<float>(value));
+        }
+        case DataType::UInt32:
+        {
+            std::uint32_t value;
+            std::memcpy(&value, src + index * sizeof(value), sizeof(value));
+            return (format.normalized ? NormalizedToFloat(value) : static_cast<float>(value));
+        }
+        case DataType::Float:
+        {
+            float value;
+            std::memcpy(&value, src + index * sizeof(value), sizeof(value));
+            return value;
+        }
+        case DataType::Double:
+        {
+            double value;
+            std::memcpy(&value, src + index * sizeof(value), sizeof(value));
+            return static_cast<float>(value);
+        }
+    }
+    return 0.0f;
+}
+
+static void StoreComponent(const SWTexelFormat& format, char* dst, unsigned int index, float value)
+{
+    switch (format.dataType)
+    {
+        case DataType::Int8:
+        {
+            const auto v = (format.normalized ? FloatToNormalized<std::int8_t>(value) : static_cast<std::int8_t>(std::max(-128.0f, std::min(value, 127.0f))));
+            reinterpret_cast<std::int8_t*>(dst)[index] = v;
+        }
+        break;
+
+        case DataType::UInt8:
+        {
+            const auto v = (format.normalized ? FloatToNormalized<std::uint8_t>(value) : static_cast<std::uint8_t>(std::max(0.0f, std::min(value, 255.0f))));
+            reinterpret_cast<std::uint8_t*>(dst)[index] = v;
+        }
+        break;
+
+        case DataType::Int16:
+        {
+            const auto v = (format.normalized ? FloatToNormalized<std::int16_t>(value) : static_cast<std::int16_t>(std::max(-32768.0f, std::min(value, 32767.0f))));
+            std::memcpy(dst + index * sizeof(v), &v, sizeof(v));
+        }
+        break;
+
+        case DataType::UInt16:
+        {
+            std::uint16_t v;
+            if (format.halfFloat)
+                v = FloatToHalf(value);
+            else if (format.normalized)
+                v = FloatToNormalized<std::uint16_t>(value);
+            else
+                v = static_cast<std::uint16_t>(std::max(0.0f, std::min(value, 65535.0f)));
+            std::memcpy(dst + index * sizeof(v), &v, sizeof(v));
+        }
+        break;
+
+        case DataType::Int32:
+        {
+            const auto v = (format.normalized ? FloatToNormalized<std::int32_t>(value) : FloatToInteger<std::int32_t>(value));
+            std::memcpy(dst + index * sizeof(v), &v, sizeof(v));
+        }
+        break;
+
+        case DataType::UInt32:
+        {
+            const auto v = (format.normalized ? FloatToNormalized<std::uint32_t>(value) : FloatToInteger<std::uint32_t>(value));
+            std::memcpy(dst + index * sizeof(v), &v, sizeof(v));
+        }
+        break;
+
+        case DataType::Float:
+        {
+            std::memcpy(dst + index * sizeof(value), &value, sizeof(value));
+        }
+        break;
+
+        case DataType::Double:
+        {
+            const auto v = static_cast<double>(value);
+            std::memcpy(dst + index * sizeof(v), &v, sizeof(v));
+        }
+        break;
+    }
+}
+
+void LoadSWTexel(const SWTexelFormat& format, const void* src, float (&color)[4])
+{
+    color[0] = 0.0f;
+    color[1] = 0.0f;
+    color[2] = 0.0f;
+    color[3] = 1.0f;
+
+    auto bytes = reinterpret_cast<const char*>(src);
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        if (format.swizzle[i] < format.components)
+            color[i] = LoadComponent(format, bytes, format.swizzle[i]);
+    }
+}
+
+void StoreSWTexel(const SWTexelFormat& format, void* dst, const float (&color)[4])
+{
+    auto bytes = reinterpret_cast<char*>(dst);
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        if (format.swizzle[i] < format.components)
+            StoreComponent(format, bytes, format.swizzle[i], color[i]);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,53 @@
+/*
+ * SWTexelFormat.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SW_TEXEL_FORMAT_H
+#define LLGL_SW_TEXEL_FORMAT_H
+
+
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Image.h>
+#include <LLGL/Format.h>
+
+
+namespace LLGL
+{
+
+
+// Memory layout of a single texel, which is used to convert texels from and to RGBA floating-point colors.
+struct SWTexelFormat
+{
+    DataType        dataType    = DataType::UInt8;
+    unsigned int    components  = 4;            // Number of components in memory (1 to 4).
+    unsigned int    swizzle[4]  = { 0, 1, 2, 3 }; // Memory index of the R, G, B, and A components.
+    bool            normalized  = true;         // Integer components are mapped to [0, 1] (unsigned) or [-1, 1] (signed).
+    bool            halfFloat   = false;        // 16-bit floating-point components (stored as DataType::UInt16).
+    bool            depth       = false;        // Depth format, where the first component is a 32-bit float depth value.
+    unsigned int    size        = 4;            // Size (in bytes) of a texel.
+};
+
+// Returns the texel format for the specified texture format. Throws std::invalid_argument for compressed formats.
+SWTexelFormat GetSWTexelFormat(const TextureFormat format);
+
+// Returns the texel format for the specified image format and data type. Throws std::invalid_argument for compressed formats.
+SWTexelFormat GetSWTexelFormat(const ImageFormat format, const DataType dataType);
+
+// Loads the texel at the specified address and converts it into an RGBA color. Missing components are filled with (0, 0, 0, 1).
+void LoadSWTexel(const SWTexelFormat& format, const void* src, float (&color)[4]);
+
+// Converts the RGBA color and stores it as texel at the specified address.
+void StoreSWTexel(const SWTexelFormat& format, void* dst, const float (&color)[4]);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
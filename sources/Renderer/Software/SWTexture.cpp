@@ -0,0 +1,322 @@
+/*
+ * SWTexture.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SWTexture.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Returns the size of the first MIP-map level, where the Z component is the number of array layers for array textures.
+static Gs::Vector3ui GetTextureSize(const TextureDescriptor& desc)
+{
+    switch (desc.type)
+    {
+        case TextureType::Texture1D:        return { desc.texture1D.width, 1, 1 };
+        case TextureType::Texture1DArray:   return { desc.texture1D.width, desc.texture1D.layers, 1 };
+        case TextureType::Texture2D:        return { desc.texture2D.width, desc.texture2D.height, 1 };
+        case TextureType::Texture2DArray:   return { desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers };
+        case TextureType::Texture3D:        return { desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth };
+        case TextureType::TextureCube:      return { desc.textureCube.width, desc.textureCube.height, 6 };
+        case TextureType::TextureCubeArray: return { desc.textureCube.width, desc.textureCube.height, desc.textureCube.layers * 6 };
+        case TextureType::Texture2DMS:      return { desc.texture2DMS.width, desc.texture2DMS.height, 1 };
+        case TextureType::Texture2DMSArray: return { desc.texture2DMS.width, desc.texture2DMS.height, desc.texture2DMS.layers };
+    }
+    return { 0, 0, 0 };
+}
+
+// Returns true if the texel format stores integers which are not normalized, i.e. image data must be copied by value.
+static bool IsUnnormalizedIntegerFormat(const SWTexelFormat& format)
+{
+    return (!format.normalized && !format.halfFloat && format.dataType != DataType::Float && format.dataType != DataType::Double);
+}
+
+// Returns the texel format for image data, which is transferred from or to a texture of the specified texel format.
+static SWTexelFormat GetImageTexelFormat(const SWTexelFormat& textureFormat, ImageFormat imageFormat, DataType dataType)
+{
+    auto format = GetSWTexelFormat(imageFormat, dataType);
+    if (IsUnnormalizedIntegerFormat(textureFormat))
+        format.normalized = false;
+    return format;
+}
+
+SWTexture::SWTexture(const TextureDescriptor& desc, const ImageDescriptor* imageDesc) :
+    Texture         { desc.type                     },
+    desc_           { desc                          },
+    texelFormat_    { GetSWTexelFormat(desc.format) }
+{
+    const auto size = GetTextureSize(desc);
+
+    if (size.x == 0 || size.y == 0 || size.z == 0)
+        throw std::invalid_argument("cannot create texture with size of zero");
+
+    /* Resolve number of MIP-map levels (array layers are not reduced per MIP-map level) */
+    if (IsMultiSampleTexture(desc.type))
+        desc_.mipLevels = 1;
+    else
+    {
+        const bool hasDepth = (desc.type == TextureType::Texture3D);
+        const auto maxMipLevels = NumMipLevels(size.x, (desc.type == TextureType::Texture1DArray ? 1 : size.y), (hasDepth ? size.z : 1));
+
+        if (desc_.mipLevels == 0)
+            desc_.mipLevels = maxMipLevels;
+        else
+            desc_.mipLevels = std::min(desc_.mipLevels, maxMipLevels);
+    }
+
+    /* Allocate zero-initialized storage for all MIP-map levels */
+    mipSizes_.reserve(desc_.mipLevels);
+    mipData_.resize(desc_.mipLevels);
+
+    for (unsigned int i = 0; i < desc_.mipLevels; ++i)
+    {
+        const auto mipSize = QueryMipLevelSize(i);
+        mipSizes_.push_back(mipSize);
+        mipData_[i].resize(static_cast<std::size_t>(mipSize.x) * mipSize.y * mipSize.z * texelFormat_.size, char(0));
+    }
+
+    /* Write initial image data into the first MIP-map level */
+    if (imageDesc && imageDesc->buffer)
+    {
+        if (imageDesc->compressedSize > 0)
+            throw std::invalid_argument("compressed image data not supported by software renderer");
+        const auto srcFormat = GetImageTexelFormat(texelFormat_, imageDesc->format, imageDesc->dataType);
+        WriteRegion(0, { 0, 0, 0 }, mipSizes_[0], srcFormat, reinterpret_cast<const char*>(imageDesc->buffer));
+    }
+}
+
+Gs::Vector3ui SWTexture::QueryMipLevelSize(unsigned int mipLevel) const
+{
+    if (mipLevel >= desc_.mipLevels)
+        return { 0, 0, 0 };
+
+    auto size = GetTextureSize(desc_);
+
+    switch (desc_.type)
+    {
+        case TextureType::Texture1D:
+        case TextureType::Texture1DArray:
+            size.x = std::max(1u, size.x >> mipLevel);
+            break;
+        case TextureType::Texture3D:
+            size.x = std::max(1u, size.x >> mipLevel);
+            size.y = std::max(1u, size.y >> mipLevel);
+            size.z = std::max(1u, size.z >> mipLevel);
+            break;
+        default:
+            size.x = std::max(1u, size.x >> mipLevel);
+            size.y = std::max(1u, size.y >> mipLevel);
+            break;
+    }
+
+    return size;
+}
+
+void SWTexture::AssertMipLevel(unsigned int mipLevel) const
+{
+    if (mipLevel >= desc_.mipLevels)
+    {
+        throw std::out_of_range(
+            "MIP-map level " + std::to_string(mipLevel) + " out of range for texture with " +
+            std::to_string(desc_.mipLevels) + " MIP-map level(s)"
+        );
+    }
+}
+
+void SWTexture::Write(const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc)
+{
+    AssertMipLevel(subTextureDesc.mipLevel);
+
+    if (imageDesc.compressedSize > 0)
+        throw std::invalid_argument("compressed image data not supported by software renderer");
+
+    /* Determine region within the MIP-map level storage */
+    Gs::Vector3ui offset, extent;
+
+    switch (desc_.type)
+    {
+        case TextureType::Texture1D:
+            offset = { subTextureDesc.texture1D.x, 0, 0 };
+            extent = { subTextureDesc.texture1D.width, 1, 1 };
+            break;
+        case TextureType::Texture1DArray:
+            offset = { subTextureDesc.texture1D.x, subTextureDesc.texture1D.layerOffset, 0 };
+            extent = { subTextureDesc.texture1D.width, subTextureDesc.texture1D.layers, 1 };
+            break;
+        case TextureType::Texture2D:
+            offset = { subTextureDesc.texture2D.x, subTextureDesc.texture2D.y, 0 };
+            extent = { subTextureDesc.texture2D.width, subTextureDesc.texture2D.height, 1 };
+            break;
+        case TextureType::Texture2DArray:
+        case TextureType::Texture2DMS:
+        case TextureType::Texture2DMSArray:
+            offset = { subTextureDesc.texture2D.x, subTextureDesc.texture2D.y, subTextureDesc.texture2D.layerOffset };
+            extent = { subTextureDesc.texture2D.width, subTextureDesc.texture2D.height, std::max(1u, subTextureDesc.texture2D.layers) };
+            break;
+        case TextureType::Texture3D:
+            offset = { subTextureDesc.texture3D.x, subTextureDesc.texture3D.y, subTextureDesc.texture3D.z };
+            extent = { subTextureDesc.texture3D.width, subTextureDesc.texture3D.height, subTextureDesc.texture3D.depth };
+            break;
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            offset = {
+                subTextureDesc.textureCube.x,
+                subTextureDesc.textureCube.y,
+                subTextureDesc.textureCube.layerOffset * 6 + static_cast<unsigned int>(subTextureDesc.textureCube.cubeFaceOffset)
+            };
+            extent = { subTextureDesc.textureCube.width, subTextureDesc.textureCube.height, subTextureDesc.textureCube.cubeFaces };
+            break;
+    }
+
+    const auto& mipSize = mipSizes_[subTextureDesc.mipLevel];
+
+    if ( static_cast<std::uint64_t>(offset.x) + extent.x > mipSize.x ||
+         static_cast<std::uint64_t>(offset.y) + extent.y > mipSize.y ||
+         static_cast<std::uint64_t>(offset.z) + extent.z > mipSize.z )
+    {
+        throw std::out_of_range("sub-texture region exceeds MIP-map level " + std::to_string(subTextureDesc.mipLevel));
+    }
+
+    const auto srcFormat = GetImageTexelFormat(texelFormat_, imageDesc.format, imageDesc.dataType);
+    WriteRegion(subTextureDesc.mipLevel, offset, extent, srcFormat, reinterpret_cast<const char*>(imageDesc.buffer));
+}
+
+void SWTexture::Read(unsigned int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) const
+{
+    AssertMipLevel(mipLevel);
+
+    const auto  dstFormat   = GetImageTexelFormat(texelFormat_, imageFormat, dataType);
+    const auto& mipSize     = mipSizes_[mipLevel];
+    const auto& mipData     = mipData_[mipLevel];
+    const auto  numTexels   = static_cast<std::size_t>(mipSize.x) * mipSize.y * mipSize.z;
+
+    auto dst = reinterpret_cast<char*>(buffer);
+    auto src = mipData.data();
+
+    float color[4];
+    for (std::size_t i = 0; i < numTexels; ++i)
+    {
+        LoadSWTexel(texelFormat_, src, color);
+        StoreSWTexel(dstFormat, dst, color);
+        src += texelFormat_.size;
+        dst += dstFormat.size;
+    }
+}
+
+void SWTexture::GenerateMips()
+{
+    const bool reduceY = (desc_.type != TextureType::Texture1D && desc_.type != TextureType::Texture1DArray);
+    const bool reduceZ = (desc_.type == TextureType::Texture3D);
+
+    for (unsigned int mipLevel = 1; mipLevel < desc_.mipLevels; ++mipLevel)
+    {
+        const auto& srcSize = mipSizes_[mipLevel - 1];
+        const auto& dstSize = mipSizes_[mipLevel];
+
+        /* Average all source texels that are covered by each destination texel */
+        for (unsigned int z = 0; z < dstSize.z; ++z)
+        {
+            for (unsigned int y = 0; y < dstSize.y; ++y)
+            {
+                for (unsigned int x = 0; x < dstSize.x; ++x)
+                {
+                    float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+                    unsigned int numSamples = 0;
+
+                    for (unsigned int k = 0; k < (reduceZ ? 2u : 1u); ++k)
+                    {
+                        for (unsigned int j = 0; j < (reduceY ? 2u : 1u); ++j)
+                        {
+                            for (unsigned int i = 0; i < 2; ++i)
+                            {
+                                const auto sx = std::min(x * 2 + i, srcSize.x - 1);
+                                const auto sy = (reduceY ? std::min(y * 2 + j, srcSize.y - 1) : y);
+                                const auto sz = (reduceZ ? std::min(z * 2 + k, srcSize.z - 1) : z);
+
+                                float color[4];
+                                LoadSWTexel(texelFormat_, GetTexel(mipLevel - 1, sx, sy, sz), color);
+
+                                for (int c = 0; c < 4; ++c)
+                                    sum[c] += color[c];
+                                ++numSamples;
+                            }
+                        }
+                    }
+
+                    for (int c = 0; c < 4; ++c)
+                        sum[c] /= static_cast<float>(numSamples);
+
+                    StoreSWTexel(texelFormat_, GetTexel(mipLevel, x, y, z), sum);
+                }
+            }
+        }
+    }
+}
+
+char* SWTexture::GetTexel(unsigned int mipLevel, unsigned int x, unsigned int y, unsigned int z)
+{
+    const auto& mipSize = mipSizes_[mipLevel];
+    const auto index = (static_cast<std::size_t>(z) * mipSize.y + y) * mipSize.x + x;
+    return mipData_[mipLevel].data() + index * texelFormat_.size;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SWTexture::WriteRegion(
+    unsigned int mipLevel, const Gs::Vector3ui& offset, const Gs::Vector3ui& extent,
+    const SWTexelFormat& srcFormat, const char* srcData)
+{
+    /* Image data can be copied row by row, if it has the same memory layout as the texels */
+    const bool directCopy =
+    (
+        srcFormat.dataType      == texelFormat_.dataType    &&
+        srcFormat.components    == texelFormat_.components  &&
+        srcFormat.size          == texelFormat_.size        &&
+        !texelFormat_.halfFloat                             &&
+        std::equal(srcFormat.swizzle, srcFormat.swizzle + 4, texelFormat_.swizzle)
+    );
+
+    const auto rowSize = static_cast<std::size_t>(extent.x) * srcFormat.size;
+
+    for (unsigned int z = 0; z < extent.z; ++z)
+    {
+        for (unsigned int y = 0; y < extent.y; ++y)
+        {
+            auto src = srcData + (static_cast<std::size_t>(z) * extent.y + y) * rowSize;
+            auto dst = GetTexel(mipLevel, offset.x, offset.y + y, offset.z + z);
+
+            if (directCopy)
+                std::memcpy(dst, src, rowSize);
+            else
+            {
+                float color[4];
+                for (unsigned int x = 0; x < extent.x; ++x)
+                {
+                    LoadSWTexel(srcFormat, src, color);
+                    StoreSWTexel(texelFormat_, dst, color);
+                    src += srcFormat.size;
+                    dst += texelFormat_.size;
+                }
+            }
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,82 @@
+/*
+ * SWTexture.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SW_TEXTURE_H
+#define LLGL_SW_TEXTURE_H
+
+
+#include <LLGL/Texture.h>
+#include <LLGL/Image.h>
+#include "SWTexelFormat.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Texture whose MIP-map levels are kept in system memory in their native texel format.
+Each MIP-map level is stored as a tightly packed (width x height x depthOrLayers) volume, where 1D array layers are stored in the Y axis.
+*/
+class SWTexture : public Texture
+{
+
+    public:
+
+        SWTexture(const TextureDescriptor& desc, const ImageDescriptor* imageDesc);
+
+        Gs::Vector3ui QueryMipLevelSize(unsigned int mipLevel) const override;
+
+        // Throws std::out_of_range if the MIP-map level is not less than the number of MIP-map levels.
+        void AssertMipLevel(unsigned int mipLevel) const;
+
+        // Converts the image data and writes it into the specified sub-texture region.
+        void Write(const SubTextureDescriptor& subTextureDesc, const ImageDescriptor& imageDesc);
+
+        // Reads the entire MIP-map level and converts it into the specified image format.
+        void Read(unsigned int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) const;
+
+        // Generates all MIP-map levels from the first one with a box filter.
+        void GenerateMips();
+
+        // Returns a pointer to the texel at the specified coordinate of the MIP-map level (Z is the layer for array textures).
+        char* GetTexel(unsigned int mipLevel, unsigned int x, unsigned int y, unsigned int z);
+
+        inline const TextureDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+        inline const SWTexelFormat& GetTexelFormat() const
+        {
+            return texelFormat_;
+        }
+
+    private:
+
+        void WriteRegion(
+            unsigned int mipLevel, const Gs::Vector3ui& offset, const Gs::Vector3ui& extent,
+            const SWTexelFormat& srcFormat, const char* srcData
+        );
+
+        TextureDescriptor               desc_;
+        SWTexelFormat                   texelFormat_;
+        std::vector<Gs::Vector3ui>      mipSizes_;
+        std::vector<std::vector<char>>  mipData_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,133 @@
+/*
+ * SWThreadPool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SWThreadPool.h"
+
+
+namespace LLGL
+{
+
+
+SWThreadPool::SWThreadPool(std::size_t numThreads) :
+    nextTask_ { 0 }
+{
+    StartWorkers(numThreads > 1 ? numThreads - 1 : 0);
+}
+
+SWThreadPool::~SWThreadPool()
+{
+    StopWorkers();
+}
+
+void SWThreadPool::SetNumThreads(std::size_t numThreads)
+{
+    if (numThreads == 0)
+        numThreads = 1;
+    if (numThreads != GetNumThreads())
+    {
+        StopWorkers();
+        StartWorkers(numThreads - 1);
+    }
+}
+
+void SWThreadPool::ParallelFor(std::size_t numTasks, const Task& task)
+{
+    if (numTasks == 0)
+        return;
+
+    if (workers_.empty() || numTasks == 1)
+    {
+        /* Execute all tasks on the calling thread */
+        for (std::size_t i = 0; i < numTasks; ++i)
+            task(i, 0);
+        return;
+    }
+
+    /* Wake up worker threads */
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        task_       = &task;
+        numTasks_   = numTasks;
+        nextTask_   = 0;
+        numBusy_    = workers_.size();
+        ++generation_;
+    }
+    startVar_.notify_all();
+
+    /* Participate in the work and wait until all worker threads are done */
+    RunTasks(0);
+
+    std::unique_lock<std::mutex> lock { mutex_ };
+    doneVar_.wait(lock, [this]() { return (numBusy_ == 0); });
+    task_ = nullptr;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SWThreadPool::StartWorkers(std::size_t numWorkers)
+{
+    quit_ = false;
+    workers_.reserve(numWorkers);
+
+    /* Start workers with the current generation, so a restarted pool does not run the previous batch again */
+    for (std::size_t i = 0; i < numWorkers; ++i)
+        workers_.emplace_back(&SWThreadPool::WorkerProc, this, i + 1, generation_);
+}
+
+void SWThreadPool::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        quit_ = true;
+    }
+    startVar_.notify_all();
+
+    for (auto& worker : workers_)
+        worker.join();
+
+    workers_.clear();
+}
+
+void SWThreadPool::WorkerProc(std::size_t threadIndex, std::size_t generation)
+{
+    while (true)
+    {
+        /* Wait for next batch of tasks */
+        {
+            std::unique_lock<std::mutex> lock { mutex_ };
+            startVar_.wait(lock, [this, generation]() { return (quit_ || generation_ != generation); });
+            if (quit_)
+                return;
+            generation = generation_;
+        }
+
+        RunTasks(threadIndex);
+
+        /* Notify the calling thread when the last worker is done */
+        {
+            std::lock_guard<std::mutex> guard { mutex_ };
+            if (--numBusy_ == 0)
+                doneVar_.notify_one();
+        }
+    }
+}
+
+void SWThreadPool::RunTasks(std::size_t threadIndex)
+{
+    for (std::size_t i = nextTask_++; i < numTasks_; i = nextTask_++)
+        (*task_)(i, threadIndex);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
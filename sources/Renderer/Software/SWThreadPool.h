@@ -0,0 +1,86 @@
+/*
+ * SWThreadPool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SW_THREAD_POOL_H
+#define LLGL_SW_THREAD_POOL_H
+
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Thread pool with persistent worker threads, so the rasterizer does not create threads for each draw command.
+The calling thread always participates in the work, i.e. a pool with N threads has N-1 worker threads.
+*/
+class SWThreadPool
+{
+
+    public:
+
+        // Task function with the task index and the index of the executing thread (in the range [0, GetNumThreads())).
+        using Task = std::function<void(std::size_t taskIndex, std::size_t threadIndex)>;
+
+        SWThreadPool(const SWThreadPool&) = delete;
+        SWThreadPool& operator = (const SWThreadPool&) = delete;
+
+        SWThreadPool(std::size_t numThreads);
+        ~SWThreadPool();
+
+        // Stops all worker threads and restarts the pool with the specified number of threads.
+        void SetNumThreads(std::size_t numThreads);
+
+        // Executes the task for all indices in [0, numTasks) and blocks until all tasks are done.
+        void ParallelFor(std::size_t numTasks, const Task& task);
+
+        // Returns the number of threads, including the calling thread.
+        inline std::size_t GetNumThreads() const
+        {
+            return (workers_.size() + 1);
+        }
+
+    private:
+
+        void StartWorkers(std::size_t numWorkers);
+        void StopWorkers();
+
+        void WorkerProc(std::size_t threadIndex, std::size_t generation);
+        void RunTasks(std::size_t threadIndex);
+
+        std::vector<std::thread>    workers_;
+
+        std::mutex                  mutex_;
+        std::condition_variable     startVar_;
+        std::condition_variable     doneVar_;
+
+        const Task*                 task_           = nullptr;
+        std::size_t                 numTasks_       = 0;
+        std::atomic<std::size_t>    nextTask_;
+        std::size_t                 generation_     = 0;
+        std::size_t                 numBusy_        = 0;
+        bool                        quit_           = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
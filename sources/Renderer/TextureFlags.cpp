@@ -7,6 +7,7 @@
 
 #include <LLGL/TextureFlags.h>
 #include <cmath>
+#include <algorithm>
 
 
 namespace LLGL
@@ -40,6 +41,159 @@ LLGL_EXPORT bool IsMultiSampleTexture(const TextureType type)
     return (type >= TextureType::Texture2DMS);
 }
 
+LLGL_EXPORT unsigned int TextureFormatBitSize(const TextureFormat format)
+{
+    switch (format)
+    {
+        case TextureFormat::Unknown:        return 0;
+
+        /* --- Base formats --- */
+        case TextureFormat::DepthComponent: return 32;
+        case TextureFormat::DepthStencil:   return 32;
+        case TextureFormat::R:              return 8;
+        case TextureFormat::RG:             return 16;
+        case TextureFormat::RGB:            return 24;
+        case TextureFormat::RGBA:           return 32;
+
+        /* --- Sized formats --- */
+        case TextureFormat::R8:
+        case TextureFormat::R8Sgn:          return 8;
+
+        case TextureFormat::R16:
+        case TextureFormat::R16Sgn:
+        case TextureFormat::R16Float:       return 16;
+
+        case TextureFormat::R32UInt:
+        case TextureFormat::R32SInt:
+        case TextureFormat::R32Float:       return 32;
+
+        case TextureFormat::RG8:
+        case TextureFormat::RG8Sgn:         return 16;
+
+        case TextureFormat::RG16:
+        case TextureFormat::RG16Sgn:
+        case TextureFormat::RG16Float:      return 32;
+
+        case TextureFormat::RG32UInt:
+        case TextureFormat::RG32SInt:
+        case TextureFormat::RG32Float:      return 64;
+
+        case TextureFormat::RGB8:
+        case TextureFormat::RGB8Sgn:        return 24;
+
+        case TextureFormat::RGB16:
+        case TextureFormat::RGB16Sgn:
+        case TextureFormat::RGB16Float:     return 48;
+
+        case TextureFormat::RGB32UInt:
+        case TextureFormat::RGB32SInt:
+        case TextureFormat::RGB32Float:     return 96;
+
+        case TextureFormat::RGBA8:
+        case TextureFormat::RGBA8Sgn:       return 32;
+
+        case TextureFormat::RGBA16:
+        case TextureFormat::RGBA16Sgn:
+        case TextureFormat::RGBA16Float:    return 64;
+
+        case TextureFormat::RGBA32UInt:
+        case TextureFormat::RGBA32SInt:
+        case TextureFormat::RGBA32Float:    return 128;
+
+        /* --- Compressed formats --- */
+        case TextureFormat::RGB_DXT1:
+        case TextureFormat::RGBA_DXT1:      return 4;
+        case TextureFormat::RGBA_DXT3:
+        case TextureFormat::RGBA_DXT5:      return 8;
+    }
+    return 0;
+}
+
+LLGL_EXPORT std::uint64_t TextureMemoryFootprint(const TextureDescriptor& desc)
+{
+    /* Get texture extent and number of layers (cube faces are stored as layers) */
+    unsigned int width = 1, height = 1, depth = 1, layers = 1, samples = 1;
+
+    switch (desc.type)
+    {
+        case TextureType::Texture1D:
+            width   = desc.texture1D.width;
+            break;
+        case TextureType::Texture1DArray:
+            width   = desc.texture1D.width;
+            layers  = desc.texture1D.layers;
+            break;
+        case TextureType::Texture2D:
+            width   = desc.texture2D.width;
+            height  = desc.texture2D.height;
+            break;
+        case TextureType::Texture2DArray:
+            width   = desc.texture2D.width;
+            height  = desc.texture2D.height;
+            layers  = desc.texture2D.layers;
+            break;
+        case TextureType::Texture3D:
+            width   = desc.texture3D.width;
+            height  = desc.texture3D.height;
+            depth   = desc.texture3D.depth;
+            break;
+        case TextureType::TextureCube:
+            width   = desc.textureCube.width;
+            height  = desc.textureCube.height;
+            layers  = 6;
+            break;
+        case TextureType::TextureCubeArray:
+            width   = desc.textureCube.width;
+            height  = desc.textureCube.height;
+            layers  = desc.textureCube.layers * 6;
+            break;
+        case TextureType::Texture2DMS:
+            width   = desc.texture2DMS.width;
+            height  = desc.texture2DMS.height;
+            samples = desc.texture2DMS.samples;
+            break;
+        case TextureType::Texture2DMSArray:
+            width   = desc.texture2DMS.width;
+            height  = desc.texture2DMS.height;
+            layers  = desc.texture2DMS.layers;
+            samples = desc.texture2DMS.samples;
+            break;
+    }
+
+    if (width == 0 || height == 0 || depth == 0 || layers == 0)
+        return 0;
+
+    /* Determine number of MIP-map levels (multi-sampled textures have only a single level) */
+    auto numMipLevels = NumMipLevels(width, height, depth);
+
+    if (IsMultiSampleTexture(desc.type))
+        numMipLevels = 1;
+    else if (desc.mipLevels > 0)
+        numMipLevels = std::min(desc.mipLevels, numMipLevels);
+
+    /* Sum up the texels of all MIP-map levels (compressed formats are stored in 4x4 blocks) */
+    const auto compressed = IsCompressedFormat(desc.format);
+
+    std::uint64_t numTexels = 0;
+
+    for (unsigned int mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+    {
+        std::uint64_t mipWidth  = std::max(1u, width  >> mipLevel);
+        std::uint64_t mipHeight = std::max(1u, height >> mipLevel);
+        std::uint64_t mipDepth  = std::max(1u, depth  >> mipLevel);
+
+        if (compressed)
+        {
+            mipWidth    = (mipWidth  + 3) & ~3ull;
+            mipHeight   = (mipHeight + 3) & ~3ull;
+        }
+
+        numTexels += mipWidth * mipHeight * mipDepth;
+    }
+
+    return (numTexels * layers * std::max(1u, samples) * TextureFormatBitSize(desc.format) / 8);
+}
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,80 @@
+/*
+ * TextureParams.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TEXTURE_PARAMS_H
+#define LLGL_TEXTURE_PARAMS_H
+
+
+#include <LLGL/TextureFlags.h>
+#include <array>
+
+
+namespace LLGL
+{
+
+
+using TextureParams = std::array<unsigned int, 8>;
+
+// Returns all parameters of the texture descriptor, which are relevant for its texture type (e.g. to compare or hash texture descriptors).
+inline TextureParams GetTextureParams(const TextureDescriptor& desc)
+{
+    TextureParams params = {};
+
+    params[0] = static_cast<unsigned int>(desc.type);
+    params[1] = static_cast<unsigned int>(desc.format);
+    params[2] = desc.mipLevels;
+
+    switch (desc.type)
+    {
+        case TextureType::Texture1D:
+        case TextureType::Texture1DArray:
+            params[3] = desc.texture1D.width;
+            params[4] = desc.texture1D.layers;
+            break;
+
+        case TextureType::Texture2D:
+        case TextureType::Texture2DArray:
+            params[3] = desc.texture2D.width;
+            params[4] = desc.texture2D.height;
+            params[5] = desc.texture2D.layers;
+            break;
+
+        case TextureType::Texture3D:
+            params[3] = desc.texture3D.width;
+            params[4] = desc.texture3D.height;
+            params[5] = desc.texture3D.depth;
+            break;
+
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            params[3] = desc.textureCube.width;
+            params[4] = desc.textureCube.height;
+            params[5] = desc.textureCube.layers;
+            break;
+
+        case TextureType::Texture2DMS:
+        case TextureType::Texture2DMSArray:
+            params[3] = desc.texture2DMS.width;
+            params[4] = desc.texture2DMS.height;
+            params[5] = desc.texture2DMS.layers;
+            params[6] = desc.texture2DMS.samples;
+            params[7] = (desc.texture2DMS.fixedSamples ? 1u : 0u);
+            break;
+    }
+
+    return params;
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
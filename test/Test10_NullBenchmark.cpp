@@ -0,0 +1,119 @@
+/*
+ * Test10_NullBenchmark.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Benchmark for the CPU overhead of the command interface, using the Null renderer which validates every command but renders nothing.
+// Each frame binds a constant buffer and submits an indexed draw call 100,000 times; the average time per draw call is printed.
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utility.h>
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+
+int main()
+{
+    try
+    {
+        auto renderer = LLGL::RenderSystem::Load("Null");
+
+        LLGL::RenderContextDescriptor contextDesc;
+        {
+            contextDesc.videoMode.resolution = { 800, 600 };
+        }
+        auto context = renderer->CreateRenderContext(contextDesc);
+
+        std::cout << "renderer = " << renderer->GetRendererInfo().rendererName << std::endl;
+
+        /* Create vertex, index, and constant buffers for a single quad */
+        LLGL::VertexFormat vertexFormat;
+        vertexFormat.AppendAttribute({ "position", LLGL::VectorType::Float2 });
+
+        const float vertices[] = { -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f };
+        const std::uint16_t indices[] = { 0, 1, 2, 0, 2, 3 };
+        const float constants[16] = {};
+
+        auto vertexBuffer = renderer->CreateBuffer(LLGL::VertexBufferDesc(sizeof(vertices), vertexFormat), vertices);
+        auto indexBuffer = renderer->CreateBuffer(LLGL::IndexBufferDesc(sizeof(indices), LLGL::IndexFormat(LLGL::DataType::UInt16)), indices);
+        auto constantBuffer = renderer->CreateBuffer(LLGL::ConstantBufferDesc(sizeof(constants)), constants);
+
+        /* Create shader program and graphics pipeline */
+        auto vertShader = renderer->CreateShader(LLGL::ShaderType::Vertex);
+        auto fragShader = renderer->CreateShader(LLGL::ShaderType::Fragment);
+
+        vertShader->Compile("void main() {}");
+        fragShader->Compile("void main() {}");
+
+        auto shaderProgram = renderer->CreateShaderProgram();
+        shaderProgram->AttachShader(*vertShader);
+        shaderProgram->AttachShader(*fragShader);
+        shaderProgram->BuildInputLayout(vertexFormat);
+
+        if (!shaderProgram->LinkShaders())
+            throw std::runtime_error(shaderProgram->QueryInfoLog());
+
+        LLGL::GraphicsPipelineDescriptor pipelineDesc;
+        {
+            pipelineDesc.shaderProgram = shaderProgram;
+        }
+        auto pipeline = renderer->CreateGraphicsPipeline(pipelineDesc);
+
+        auto commands = renderer->CreateCommandBuffer();
+
+        /* Measure draw call overhead over several frames */
+        const unsigned int numFrames = 10;
+        const unsigned int numDrawsPerFrame = 100000;
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        for (unsigned int frame = 0; frame < numFrames; ++frame)
+        {
+            commands->SetRenderTarget(*context);
+            commands->Clear(LLGL::ClearFlags::ColorDepth);
+
+            commands->SetGraphicsPipeline(*pipeline);
+            commands->SetVertexBuffer(*vertexBuffer);
+            commands->SetIndexBuffer(*indexBuffer);
+
+            for (unsigned int i = 0; i < numDrawsPerFrame; ++i)
+            {
+                commands->SetConstantBuffer(*constantBuffer, 0, LLGL::ShaderStageFlags::VertexStage);
+                commands->DrawIndexed(6, 0);
+            }
+
+            context->Present();
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+
+        auto totalNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+        auto numDraws = static_cast<double>(numFrames) * numDrawsPerFrame;
+
+        std::cout << "frames = " << numFrames << ", draws per frame = " << numDrawsPerFrame << std::endl;
+        std::cout << "time per frame = " << (static_cast<double>(totalNanoseconds) / numFrames / 1000000.0) << " ms" << std::endl;
+        std::cout << "time per draw = " << (static_cast<double>(totalNanoseconds) / numDraws) << " ns" << std::endl;
+
+        /* Out-of-range draw calls must be rejected */
+        try
+        {
+            commands->DrawIndexed(7, 0);
+            std::cerr << "out-of-range draw call was not rejected" << std::endl;
+            return 1;
+        }
+        catch (const std::out_of_range&)
+        {
+        }
+
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,298 @@
+/*
+ * Test11_SoftwareRenderer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Golden-image test for the Software renderer: renders overlapping quads into a render target with depth test and blending,
+// compares the read back pixels against the analytically expected colors, and prints the triangle throughput of the rasterizer.
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utility.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+
+
+struct Vertex
+{
+    float position[3];
+    float color[4];
+};
+
+static void VertexMain(const LLGL::SoftwareVertexInput& input, LLGL::SoftwareVertexOutput& output)
+{
+    auto vertex = reinterpret_cast<const Vertex*>(input.vertices[0]);
+
+    output.position[0] = vertex->position[0];
+    output.position[1] = vertex->position[1];
+    output.position[2] = vertex->position[2];
+    output.position[3] = 1.0f;
+
+    for (int i = 0; i < 4; ++i)
+        output.varyings[i] = vertex->color[i];
+}
+
+static bool FragmentMain(const LLGL::SoftwareFragmentInput& input, LLGL::SoftwareFragmentOutput& output)
+{
+    for (int i = 0; i < 4; ++i)
+        output.colors[0][i] = input.varyings[i];
+    return true;
+}
+
+// Appends a quad (as two triangles) in clip space with the specified depth and color.
+static void AddQuad(std::vector<Vertex>& vertices, float x0, float y0, float x1, float y1, float z, float r, float g, float b, float a)
+{
+    const Vertex quad[6] =
+    {
+        { { x0, y0, z }, { r, g, b, a } },
+        { { x1, y0, z }, { r, g, b, a } },
+        { { x1, y1, z }, { r, g, b, a } },
+        { { x0, y0, z }, { r, g, b, a } },
+        { { x1, y1, z }, { r, g, b, a } },
+        { { x0, y1, z }, { r, g, b, a } },
+    };
+    vertices.insert(vertices.end(), quad, quad + 6);
+}
+
+static bool ComparePixel(const std::uint8_t* image, unsigned int width, unsigned int x, unsigned int y, int r, int g, int b, int a)
+{
+    auto pixel = image + (y * width + x) * 4;
+    const int expected[4] = { r, g, b, a };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        if (std::abs(static_cast<int>(pixel[i]) - expected[i]) > 1)
+        {
+            std::cerr
+                << "pixel (" << x << ", " << y << ") mismatch: got ("
+                << static_cast<int>(pixel[0]) << ", " << static_cast<int>(pixel[1]) << ", "
+                << static_cast<int>(pixel[2]) << ", " << static_cast<int>(pixel[3]) << "), expected ("
+                << r << ", " << g << ", " << b << ", " << a << ")" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main()
+{
+    try
+    {
+        auto renderer = LLGL::RenderSystem::Load("Software");
+
+        LLGL::RenderContextDescriptor contextDesc;
+        {
+            contextDesc.videoMode.resolution = { 512, 512 };
+        }
+        auto context = renderer->CreateRenderContext(contextDesc);
+
+        std::cout << "renderer = " << renderer->GetRendererInfo().rendererName << std::endl;
+
+        /* Create shader program with software shader functions */
+        LLGL::VertexFormat vertexFormat;
+        vertexFormat.AppendAttribute({ "position", LLGL::VectorType::Float3 });
+        vertexFormat.AppendAttribute({ "color", LLGL::VectorType::Float4 });
+
+        LLGL::ShaderDescriptor vertShaderDesc;
+        {
+            vertShaderDesc.software.vertexFunction  = VertexMain;
+            vertShaderDesc.software.numVaryings     = 4;
+        }
+        LLGL::ShaderDescriptor fragShaderDesc;
+        {
+            fragShaderDesc.software.fragmentFunction = FragmentMain;
+        }
+
+        auto vertShader = renderer->CreateShader(LLGL::ShaderType::Vertex);
+        auto fragShader = renderer->CreateShader(LLGL::ShaderType::Fragment);
+
+        if (!vertShader->Compile("", vertShaderDesc))
+            throw std::runtime_error(vertShader->QueryInfoLog());
+        if (!fragShader->Compile("", fragShaderDesc))
+            throw std::runtime_error(fragShader->QueryInfoLog());
+
+        auto shaderProgram = renderer->CreateShaderProgram();
+        shaderProgram->AttachShader(*vertShader);
+        shaderProgram->AttachShader(*fragShader);
+        shaderProgram->BuildInputLayout(vertexFormat);
+
+        if (!shaderProgram->LinkShaders())
+            throw std::runtime_error(shaderProgram->QueryInfoLog());
+
+        /* Create pipelines with depth test, and with alpha blending */
+        LLGL::GraphicsPipelineDescriptor depthPipelineDesc;
+        {
+            depthPipelineDesc.shaderProgram         = shaderProgram;
+            depthPipelineDesc.depth.testEnabled     = true;
+            depthPipelineDesc.depth.writeEnabled    = true;
+        }
+        auto depthPipeline = renderer->CreateGraphicsPipeline(depthPipelineDesc);
+
+        LLGL::GraphicsPipelineDescriptor blendPipelineDesc;
+        {
+            blendPipelineDesc.shaderProgram         = shaderProgram;
+            blendPipelineDesc.blend.blendEnabled    = true;
+            blendPipelineDesc.blend.targets.resize(1);
+        }
+        auto blendPipeline = renderer->CreateGraphicsPipeline(blendPipelineDesc);
+
+        /*
+        Scene (clip space, Y-axis pointing upwards):
+        - red quad over the entire target at depth 0.5
+        - green quad over the left half at depth 0.25 (passes depth test)
+        - blue quad over the entire target at depth 0.75 (fails depth test)
+        - white quad with 50% alpha over the upper-right quarter (blended, no depth test)
+        */
+        std::vector<Vertex> vertices;
+        AddQuad(vertices, -1.0f, -1.0f, 1.0f, 1.0f, 0.5f, 1.0f, 0.0f, 0.0f, 1.0f);
+        AddQuad(vertices, -1.0f, -1.0f, 0.0f, 1.0f, 0.25f, 0.0f, 1.0f, 0.0f, 1.0f);
+        AddQuad(vertices, -1.0f, -1.0f, 1.0f, 1.0f, 0.75f, 0.0f, 0.0f, 1.0f, 1.0f);
+        AddQuad(vertices, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.5f);
+
+        auto vertexBuffer = renderer->CreateBuffer(
+            LLGL::VertexBufferDesc(static_cast<unsigned int>(vertices.size() * sizeof(Vertex)), vertexFormat),
+            vertices.data()
+        );
+
+        /* Create render target with color texture and depth buffer */
+        const unsigned int size = 64;
+
+        auto targetTexture = renderer->CreateTexture(LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, size, size));
+
+        LLGL::RenderTargetDescriptor targetDesc;
+        auto renderTarget = renderer->CreateRenderTarget(targetDesc);
+        renderTarget->AttachDepthBuffer({ size, size });
+        renderTarget->AttachTexture(*targetTexture, {});
+
+        auto commands = renderer->CreateCommandBuffer();
+
+        /* Render golden image */
+        auto renderGoldenImage = [&]() -> bool
+        {
+            commands->SetRenderTarget(*renderTarget);
+            commands->SetViewport({ 0.0f, 0.0f, static_cast<float>(size), static_cast<float>(size) });
+            commands->SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+            commands->Clear(LLGL::ClearFlags::ColorDepth);
+
+            commands->SetVertexBuffer(*vertexBuffer);
+
+            commands->SetGraphicsPipeline(*depthPipeline);
+            commands->Draw(18, 0);
+
+            commands->SetGraphicsPipeline(*blendPipeline);
+            commands->Draw(6, 18);
+
+            std::vector<std::uint8_t> image(size * size * 4);
+            renderer->ReadTexture(*targetTexture, 0, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, image.data());
+
+            for (unsigned int y = 0; y < size; ++y)
+            {
+                for (unsigned int x = 0; x < size; ++x)
+                {
+                    const bool left = (x < size/2);
+                    const bool top  = (y < size/2);
+
+                    if (left)
+                    {
+                        if (!ComparePixel(image.data(), size, x, y, 0, 255, 0, 255))
+                            return false;
+                    }
+                    else if (top)
+                    {
+                        if (!ComparePixel(image.data(), size, x, y, 255, 128, 128, 191))
+                            return false;
+                    }
+                    else
+                    {
+                        if (!ComparePixel(image.data(), size, x, y, 255, 0, 0, 255))
+                            return false;
+                    }
+                }
+            }
+
+            return true;
+        };
+
+        bool passed = renderGoldenImage();
+
+        /* Render golden image again after the thread pool has been restarted with a different number of threads */
+        for (std::size_t threadCount : { 3, 2, 4 })
+        {
+            auto config = renderer->GetConfiguration();
+            config.threadCount = threadCount;
+            renderer->SetConfiguration(config);
+
+            if (!renderGoldenImage())
+            {
+                std::cerr << "golden image test failed with " << threadCount << " threads" << std::endl;
+                passed = false;
+            }
+        }
+
+        std::cout << "golden image test " << (passed ? "passed" : "failed") << std::endl;
+
+        /* Measure triangle throughput with a grid of small quads */
+        const unsigned int gridSize = 128;
+        const float cellSize = 2.0f / gridSize;
+
+        std::vector<Vertex> gridVertices;
+        gridVertices.reserve(gridSize * gridSize * 6);
+
+        for (unsigned int y = 0; y < gridSize; ++y)
+        {
+            for (unsigned int x = 0; x < gridSize; ++x)
+            {
+                const float x0 = -1.0f + cellSize * x;
+                const float y0 = -1.0f + cellSize * y;
+                const float z  = static_cast<float>((x * 7 + y * 13) % 16) / 16.0f;
+                AddQuad(gridVertices, x0, y0, x0 + cellSize, y0 + cellSize, z, z, 1.0f - z, 0.5f, 1.0f);
+            }
+        }
+
+        auto gridBuffer = renderer->CreateBuffer(
+            LLGL::VertexBufferDesc(static_cast<unsigned int>(gridVertices.size() * sizeof(Vertex)), vertexFormat),
+            gridVertices.data()
+        );
+
+        const unsigned int numFrames    = 20;
+        const unsigned int numVertices  = static_cast<unsigned int>(gridVertices.size());
+        const auto resolution           = contextDesc.videoMode.resolution;
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        for (unsigned int frame = 0; frame < numFrames; ++frame)
+        {
+            commands->SetRenderTarget(*context);
+            commands->SetViewport({ 0.0f, 0.0f, static_cast<float>(resolution.x), static_cast<float>(resolution.y) });
+            commands->Clear(LLGL::ClearFlags::ColorDepth);
+
+            commands->SetGraphicsPipeline(*depthPipeline);
+            commands->SetVertexBuffer(*gridBuffer);
+            commands->Draw(numVertices, 0);
+
+            context->Present();
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+
+        const auto totalMs      = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+        const auto numTriangles = static_cast<double>(numFrames) * (numVertices / 3);
+
+        std::cout << "frames = " << numFrames << ", triangles per frame = " << (numVertices / 3) << std::endl;
+        std::cout << "average frame time = " << (totalMs / numFrames) << " ms" << std::endl;
+        std::cout << "triangle throughput = " << (numTriangles / (totalMs * 1000.0)) << " M triangles/s" << std::endl;
+
+        return (passed ? 0 : 1);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
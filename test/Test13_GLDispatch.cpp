@@ -0,0 +1,177 @@
+/*
+ * Test13_GLDispatch.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Benchmark for the per-context GL dispatch table, which runs without a GL context.
+// All extension procedures are replaced by placeholders, which only count the GL calls.
+// The stream-output commands are compared against the former per-call extension checks, with only GL_NV_transform_feedback available.
+
+#include "../sources/Renderer/OpenGL/GLCommandBuffer.h"
+#include "../sources/Renderer/OpenGL/RenderState/GLStateManager.h"
+#include "../sources/Renderer/OpenGL/Ext/GLExtensions.h"
+#include "../sources/Renderer/GLCommon/GLExtensionRegistry.h"
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+
+using namespace LLGL;
+
+static unsigned int          g_numGLCalls    = 0;
+static unsigned int          g_numErrors     = 0;
+static std::vector<GLintptr> g_indirectOffsets;
+
+static void APIENTRY Placeholder_glBeginTransformFeedbackNV(GLenum)
+{
+    ++g_numGLCalls;
+}
+
+static void APIENTRY Placeholder_glEndTransformFeedbackNV()
+{
+    ++g_numGLCalls;
+}
+
+static void APIENTRY Placeholder_glDrawArraysInstancedBaseInstance(GLenum, GLint, GLsizei, GLsizei, GLuint)
+{
+    ++g_numGLCalls;
+}
+
+static void APIENTRY Placeholder_glDrawArraysIndirect(GLenum, const void* indirect)
+{
+    ++g_numGLCalls;
+    g_indirectOffsets.push_back(reinterpret_cast<GLintptr>(indirect));
+}
+
+// Stream-output commands as they were implemented before the dispatch table, with extension checks on each call
+static void BeginStreamOutputWithExtensionCheck(GLenum primitiveMode)
+{
+    if (HasExtension(GLExt::EXT_transform_feedback))
+        glBeginTransformFeedback(primitiveMode);
+    else if (HasExtension(GLExt::NV_transform_feedback))
+        glBeginTransformFeedbackNV(primitiveMode);
+    else
+        throw std::runtime_error("renderer does not support stream-outputs");
+}
+
+static void EndStreamOutputWithExtensionCheck()
+{
+    if (HasExtension(GLExt::EXT_transform_feedback))
+        glEndTransformFeedback();
+    else if (HasExtension(GLExt::NV_transform_feedback))
+        glEndTransformFeedbackNV();
+    else
+        throw std::runtime_error("renderer does not support stream-outputs");
+}
+
+static void Check(bool condition, const std::string& desc)
+{
+    if (!condition)
+    {
+        std::cerr << "error: " << desc << std::endl;
+        ++g_numErrors;
+    }
+}
+
+template <typename Func>
+static void RunBenchmark(const std::string& name, Func func)
+{
+    const unsigned int numCommands = 1000000;
+
+    g_numGLCalls = 0;
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (unsigned int i = 0; i < numCommands; ++i)
+        func();
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    std::cout << name << "GL calls = " << g_numGLCalls;
+    std::cout << ", time per command = " << (static_cast<double>(duration) / numCommands) << " ns" << std::endl;
+}
+
+int main()
+{
+    // Replace GL extension procedures by placeholders
+    LLGL::glBeginTransformFeedbackNV            = Placeholder_glBeginTransformFeedbackNV;
+    LLGL::glEndTransformFeedbackNV              = Placeholder_glEndTransformFeedbackNV;
+    LLGL::glDrawArraysInstancedBaseInstance     = Placeholder_glDrawArraysInstancedBaseInstance;
+    LLGL::glDrawArraysIndirect                  = Placeholder_glDrawArraysIndirect;
+
+    /* Without any extension, the unsupported entries must throw and multi-draw-indirect must be emulated */
+    {
+        auto stateMngr = std::make_shared<GLStateManager>();
+        stateMngr->DetermineExtensions();
+
+        GLCommandBuffer commandBuffer { stateMngr };
+
+        try
+        {
+            commandBuffer.BeginStreamOutput(PrimitiveType::Triangles);
+            Check(false, "stream-output without extension did not throw");
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+
+        const auto& table = stateMngr->GetDispatchTable();
+
+        Check(table.bindTextures == nullptr, "multi-bind entry without extension is not null");
+
+        g_numGLCalls = 0;
+        table.multiDrawArraysIndirect(GL_TRIANGLES, reinterpret_cast<const GLvoid*>(8), 3, 0);
+
+        Check(g_numGLCalls == 3, "emulated multi-draw-indirect did not submit one draw per command");
+        Check(g_indirectOffsets == std::vector<GLintptr>{ 8, 24, 40 }, "emulated multi-draw-indirect with zero stride is not tightly packed");
+    }
+
+    /* Resolve the NV procedures, which is the worst case for the per-call extension checks */
+    RegisterExtension(GLExt::NV_transform_feedback);
+    RegisterExtension(GLExt::ARB_base_instance);
+
+    auto stateMngr = std::make_shared<GLStateManager>();
+    stateMngr->DetermineExtensions();
+
+    GLCommandBuffer commandBuffer { stateMngr };
+
+    RunBenchmark(
+        "stream-output (extension checks): ",
+        []()
+        {
+            BeginStreamOutputWithExtensionCheck(GL_TRIANGLES);
+            EndStreamOutputWithExtensionCheck();
+        }
+    );
+
+    RunBenchmark(
+        "stream-output (dispatch table):   ",
+        [&commandBuffer]()
+        {
+            commandBuffer.BeginStreamOutput(PrimitiveType::Triangles);
+            commandBuffer.EndStreamOutput();
+        }
+    );
+
+    RunBenchmark(
+        "draw with instance offset:        ",
+        [&commandBuffer]()
+        {
+            commandBuffer.DrawInstanced(3, 0, 1, 1);
+        }
+    );
+
+    Check(g_numGLCalls == 1000000, "draw with instance offset did not reach the placeholder");
+
+    std::cout << "errors = " << g_numErrors << std::endl;
+
+    return (g_numErrors == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,234 @@
+/*
+ * Test14_GLTypes.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Test and benchmark for the GL mapping tables, which runs without a GL context.
+// Every enumeration entry must either be mapped or be one of the known unsupported entries (the table order is verified at compile time).
+// The table lookups are compared against the former switch statements for texture formats and data types.
+
+#include "../sources/Renderer/GLCommon/GLTypes.h"
+#include <iostream>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+
+using namespace LLGL;
+
+static unsigned int g_numErrors = 0;
+
+// Maps all entries from the first one up to and including 'lastEntry', and returns the entries that could not be mapped
+template <typename T>
+static std::vector<T> MapAllEntries(const char* typeName, const T lastEntry)
+{
+    std::vector<T> unmapped;
+
+    for (int i = 0; i <= static_cast<int>(lastEntry); ++i)
+    {
+        try
+        {
+            GLTypes::Map(static_cast<T>(i));
+        }
+        catch (const std::invalid_argument&)
+        {
+            unmapped.push_back(static_cast<T>(i));
+        }
+    }
+
+    /* Entries beyond the last one must always fail */
+    try
+    {
+        GLTypes::Map(static_cast<T>(static_cast<int>(lastEntry) + 1));
+        std::cerr << "out of range entry of " << typeName << " was mapped" << std::endl;
+        ++g_numErrors;
+    }
+    catch (const std::invalid_argument&)
+    {
+    }
+
+    return unmapped;
+}
+
+template <typename T>
+static void TestMapping(const char* typeName, const T lastEntry, const std::vector<T>& expectedUnmapped = {})
+{
+    if (MapAllEntries(typeName, lastEntry) != expectedUnmapped)
+    {
+        std::cerr << "unexpected unmapped entries of " << typeName << std::endl;
+        ++g_numErrors;
+    }
+}
+
+// Former implementation of "GLTypes::Map(TextureFormat)"
+static GLenum SwitchMap(const TextureFormat textureFormat)
+{
+    switch (textureFormat)
+    {
+        case TextureFormat::DepthComponent: return GL_DEPTH_COMPONENT;
+        case TextureFormat::DepthStencil:   return GL_DEPTH_STENCIL;
+        case TextureFormat::R:              return GL_RED;
+        case TextureFormat::RG:             return GL_RG;
+        case TextureFormat::RGB:            return GL_RGB;
+        case TextureFormat::RGBA:           return GL_RGBA;
+        case TextureFormat::R8:             return GL_R8;
+        case TextureFormat::R8Sgn:          return GL_R8_SNORM;
+        case TextureFormat::R16:            return GL_R16;
+        case TextureFormat::R16Sgn:         return GL_R16_SNORM;
+        case TextureFormat::R16Float:       return GL_R16F;
+        case TextureFormat::R32UInt:        return GL_R32I;
+        case TextureFormat::R32SInt:        return GL_R32UI;
+        case TextureFormat::R32Float:       return GL_R32F;
+        case TextureFormat::RG8:            return GL_RG8;
+        case TextureFormat::RG8Sgn:         return GL_RG8_SNORM;
+        case TextureFormat::RG16:           return GL_RG16;
+        case TextureFormat::RG16Sgn:        return GL_RG16_SNORM;
+        case TextureFormat::RG16Float:      return GL_RG16F;
+        case TextureFormat::RG32UInt:       return GL_RG32UI;
+        case TextureFormat::RG32SInt:       return GL_RG32I;
+        case TextureFormat::RG32Float:      return GL_RG32F;
+        case TextureFormat::RGB8:           return GL_RGB8;
+        case TextureFormat::RGB8Sgn:        return GL_RGB8_SNORM;
+        case TextureFormat::RGB16:          return GL_RGB16;
+        case TextureFormat::RGB16Sgn:       return GL_RGB16_SNORM;
+        case TextureFormat::RGB16Float:     return GL_RGB16F;
+        case TextureFormat::RGB32UInt:      return GL_RGB32UI;
+        case TextureFormat::RGB32SInt:      return GL_RGB32I;
+        case TextureFormat::RGB32Float:     return GL_RGB32F;
+        case TextureFormat::RGBA8:          return GL_RGBA8;
+        case TextureFormat::RGBA8Sgn:       return GL_RGBA8_SNORM;
+        case TextureFormat::RGBA16:         return GL_RGBA16;
+        case TextureFormat::RGBA16Sgn:      return GL_RGBA16_SNORM;
+        case TextureFormat::RGBA16Float:    return GL_RGBA16F;
+        case TextureFormat::RGBA32UInt:     return GL_RGBA32UI;
+        case TextureFormat::RGBA32SInt:     return GL_RGBA32I;
+        case TextureFormat::RGBA32Float:    return GL_RGBA32F;
+        case TextureFormat::RGB_DXT1:       return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case TextureFormat::RGBA_DXT1:      return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        case TextureFormat::RGBA_DXT3:      return GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+        case TextureFormat::RGBA_DXT5:      return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        default:                            break;
+    }
+    throw std::invalid_argument("failed to map 'TextureFormat' to OpenGL parameter");
+}
+
+// Former implementation of "GLTypes::Map(DataType)"
+static GLenum SwitchMap(const DataType dataType)
+{
+    switch (dataType)
+    {
+        case DataType::Int8:    return GL_BYTE;
+        case DataType::UInt8:   return GL_UNSIGNED_BYTE;
+        case DataType::Int16:   return GL_SHORT;
+        case DataType::UInt16:  return GL_UNSIGNED_SHORT;
+        case DataType::Int32:   return GL_INT;
+        case DataType::UInt32:  return GL_UNSIGNED_INT;
+        case DataType::Float:   return GL_FLOAT;
+        case DataType::Double:  return GL_DOUBLE;
+    }
+    throw std::invalid_argument("failed to map 'DataType' to OpenGL parameter");
+}
+
+// Returns the average duration (in nanoseconds) of one call to the specified map function.
+// The function is called through a volatile pointer, so neither of the two implementations can be inlined into the loop.
+template <typename T>
+static double MeasureMapping(const std::vector<T>& entries, GLenum (* volatile mapFunc)(T), GLenum& checksum)
+{
+    const int numIterations = 1000000;
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < numIterations; ++i)
+    {
+        for (auto entry : entries)
+            checksum += mapFunc(entry);
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+    return static_cast<double>(duration) / (static_cast<double>(numIterations) * entries.size());
+}
+
+template <typename T>
+static void BenchmarkMapping(const char* typeName, const T firstEntry, const T lastEntry)
+{
+    std::vector<T> entries;
+    for (int i = static_cast<int>(firstEntry); i <= static_cast<int>(lastEntry); ++i)
+        entries.push_back(static_cast<T>(i));
+
+    /* Compare results of table lookup and former switch statement */
+    for (auto entry : entries)
+    {
+        if (GLTypes::Map(entry) != SwitchMap(entry))
+        {
+            std::cerr << "table lookup and switch statement of " << typeName << " differ" << std::endl;
+            ++g_numErrors;
+        }
+    }
+
+    GLenum tableChecksum = 0, switchChecksum = 0;
+
+    auto tableTime  = MeasureMapping<T>(entries, GLTypes::Map, tableChecksum);
+    auto switchTime = MeasureMapping<T>(entries, SwitchMap, switchChecksum);
+
+    if (tableChecksum != switchChecksum)
+        ++g_numErrors;
+
+    std::cout << typeName << ": table = " << tableTime << " ns, switch = " << switchTime << " ns" << std::endl;
+}
+
+int main()
+{
+    try
+    {
+        /* Verify that every enumeration entry is mapped, except the unsupported ones */
+        TestMapping( "BufferCPUAccess",     BufferCPUAccess::ReadWrite                                                                          );
+        TestMapping( "DataType",            DataType::Double                                                                                    );
+        TestMapping( "PrimitiveType",       PrimitiveType::Triangles                                                                            );
+        TestMapping( "PrimitiveTopology",   PrimitiveTopology::Patches32                                                                        );
+        TestMapping( "TextureType",         TextureType::Texture2DMSArray                                                                       );
+        TestMapping( "TextureFormat",       TextureFormat::RGBA_DXT5,                   { TextureFormat::Unknown }                              );
+        TestMapping( "ImageFormat",         ImageFormat::CompressedRGBA,                { ImageFormat::ARGB, ImageFormat::ABGR }                );
+        TestMapping( "CompareOp",           CompareOp::Ever                                                                                     );
+        TestMapping( "StencilOp",           StencilOp::DecWrap                                                                                  );
+        TestMapping( "BlendOp",             BlendOp::InvSrc1Alpha                                                                               );
+        TestMapping( "BlendArithmetic",     BlendArithmetic::Max                                                                                );
+        TestMapping( "PolygonMode",         PolygonMode::Points                                                                                 );
+        TestMapping( "CullMode",            CullMode::Back                                                                                      );
+        TestMapping( "AxisDirection",       AxisDirection::ZNeg                                                                                 );
+        TestMapping( "TextureWrap",         TextureWrap::MirrorOnce                                                                             );
+        TestMapping( "TextureFilter",       TextureFilter::Linear                                                                               );
+        TestMapping( "ShaderType",          ShaderType::Compute                                                                                 );
+        TestMapping( "QueryType",           QueryType::ClippingOutputPrimitives                                                                 );
+        TestMapping( "BufferType",          BufferType::Indirect                                                                                );
+        TestMapping( "RenderConditionMode", RenderConditionMode::ByRegionNoWaitInverted                                                         );
+        TestMapping( "LogicOp",             LogicOp::InvertedOR,                        { LogicOp::Keep, LogicOp::Disabled }                    );
+
+        if (GLTypes::Map(TextureFilter::Linear, TextureFilter::Nearest) != GL_LINEAR_MIPMAP_NEAREST ||
+            GLTypes::Map(TextureFilter::Nearest, TextureFilter::Linear) != GL_NEAREST_MIPMAP_LINEAR)
+        {
+            std::cerr << "unexpected min/MIP-map texture filter" << std::endl;
+            ++g_numErrors;
+        }
+
+        /* Compare table lookups against the former switch statements */
+        BenchmarkMapping("TextureFormat", TextureFormat::DepthComponent, TextureFormat::RGBA_DXT5);
+        BenchmarkMapping("DataType", DataType::Int8, DataType::Double);
+
+        std::cout << "errors = " << g_numErrors << std::endl;
+
+        return (g_numErrors == 0 ? 0 : 1);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,179 @@
+/*
+ * Test15_ViewportArray.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Test for viewport and scissor arrays in the GL command buffer, which runs without a GL context.
+// The viewport array procedures are replaced by placeholders, which only count the GL calls.
+// The global allocation functions are replaced to verify that the command path does not allocate heap memory.
+
+#include "../sources/Renderer/OpenGL/GLCommandBuffer.h"
+#include "../sources/Renderer/OpenGL/RenderState/GLStateManager.h"
+#include "../sources/Renderer/OpenGL/Ext/GLExtensions.h"
+#include "../sources/Renderer/GLCommon/GLExtensionRegistry.h"
+#include <iostream>
+#include <memory>
+#include <new>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+
+using namespace LLGL;
+
+static unsigned int g_numAllocations       = 0;
+static unsigned int g_numViewportCalls     = 0;
+static unsigned int g_numDepthRangeCalls   = 0;
+static unsigned int g_numScissorCalls      = 0;
+static unsigned int g_numErrors            = 0;
+
+void* operator new (std::size_t size)
+{
+    ++g_numAllocations;
+    if (auto ptr = std::malloc(size > 0 ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete (void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete (void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+static void APIENTRY Placeholder_glViewportArrayv(GLuint, GLsizei, const GLfloat*)
+{
+    ++g_numViewportCalls;
+}
+
+static void APIENTRY Placeholder_glDepthRangeArrayv(GLuint, GLsizei, const GLdouble*)
+{
+    ++g_numDepthRangeCalls;
+}
+
+static void APIENTRY Placeholder_glScissorArrayv(GLuint, GLsizei, const GLint*)
+{
+    ++g_numScissorCalls;
+}
+
+static void Check(bool condition, const std::string& desc)
+{
+    if (!condition)
+    {
+        std::cerr << "error: " << desc << std::endl;
+        ++g_numErrors;
+    }
+}
+
+static void ResetCallCounters()
+{
+    g_numViewportCalls      = 0;
+    g_numDepthRangeCalls    = 0;
+    g_numScissorCalls       = 0;
+}
+
+int main()
+{
+    // Replace GL extension procedures by placeholders
+    LLGL::glViewportArrayv      = Placeholder_glViewportArrayv;
+    LLGL::glDepthRangeArrayv    = Placeholder_glDepthRangeArrayv;
+    LLGL::glScissorArrayv       = Placeholder_glScissorArrayv;
+
+    RegisterExtension(GLExt::ARB_viewport_array);
+
+    auto stateMngr = std::make_shared<GLStateManager>();
+    stateMngr->DetermineExtensions();
+
+    GLCommandBuffer commandBuffer { stateMngr };
+
+    /* Viewports for split-screen and cube map rendering */
+    const Viewport splitScreenViewports[2] =
+    {
+        { 0.0f,   0.0f, 320.0f, 480.0f },
+        { 320.0f, 0.0f, 320.0f, 480.0f },
+    };
+
+    Viewport cubeViewports[6];
+    for (int i = 0; i < 6; ++i)
+        cubeViewports[i] = { static_cast<float>(i * 256), 0.0f, 256.0f, 256.0f, 0.0f, 1.0f };
+
+    const Scissor splitScreenScissors[2] =
+    {
+        { 0,   0, 320, 480 },
+        { 320, 0, 320, 480 },
+    };
+
+    /* Redundant viewport arrays must be skipped */
+    ResetCallCounters();
+    {
+        commandBuffer.SetViewportArray(6, cubeViewports);
+        commandBuffer.SetViewportArray(6, cubeViewports);
+        commandBuffer.SetViewportArray(3, cubeViewports);
+    }
+    Check(g_numViewportCalls == 1, "redundant viewport arrays were submitted");
+    Check(g_numDepthRangeCalls == 1, "redundant depth-range arrays were submitted");
+
+    /* Modified viewports must be submitted, while unmodified depth-ranges are still skipped */
+    ResetCallCounters();
+    {
+        cubeViewports[5].x += 1.0f;
+        commandBuffer.SetViewportArray(6, cubeViewports);
+    }
+    Check(g_numViewportCalls == 1, "modified viewport array was not submitted");
+    Check(g_numDepthRangeCalls == 0, "unmodified depth-range array was submitted");
+
+    /* Redundant scissor arrays must be skipped */
+    ResetCallCounters();
+    {
+        commandBuffer.SetScissorArray(2, splitScreenScissors);
+        commandBuffer.SetScissorArray(2, splitScreenScissors);
+    }
+    Check(g_numScissorCalls == 1, "redundant scissor arrays were submitted");
+
+    /* Arrays beyond the limit must throw */
+    Viewport tooManyViewports[GLStateManager::maxNumViewports + 1];
+    try
+    {
+        commandBuffer.SetViewportArray(GLStateManager::maxNumViewports + 1, tooManyViewports);
+        Check(false, "viewport array beyond limit did not throw");
+    }
+    catch (const std::invalid_argument&)
+    {
+    }
+
+    /* Alternate between split-screen and cube map passes, which must not allocate any heap memory */
+    const unsigned int numPasses = 1000;
+
+    ResetCallCounters();
+    g_numAllocations = 0;
+
+    for (unsigned int i = 0; i < numPasses; ++i)
+    {
+        commandBuffer.SetViewportArray(2, splitScreenViewports);
+        commandBuffer.SetScissorArray(2, splitScreenScissors);
+        commandBuffer.SetViewportArray(6, cubeViewports);
+        commandBuffer.SetViewportArray(6, cubeViewports);
+    }
+
+    auto numAllocations = g_numAllocations;
+
+    Check(numAllocations == 0, "viewport and scissor arrays allocated heap memory");
+    Check(g_numViewportCalls == numPasses * 2, "unexpected number of viewport array submissions");
+    Check(g_numDepthRangeCalls == 0, "redundant depth-range arrays were submitted"); // all passes use the depth-range [0, 1]
+    Check(g_numScissorCalls == 0, "redundant scissor arrays were submitted");
+
+    std::cout << "allocations = " << numAllocations << ", viewport array calls = " << g_numViewportCalls << std::endl;
+    std::cout << "errors = " << g_numErrors << std::endl;
+
+    return (g_numErrors == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
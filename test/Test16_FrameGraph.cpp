@@ -0,0 +1,203 @@
+/*
+ * Test16_FrameGraph.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Test for the frame graph and the render target pool, using the Null renderer.
+// Checks that only passes without used results are culled, that transient textures with disjoint lifetimes are aliased,
+// and that textures and render targets are recycled from frame to frame.
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utility.h>
+#include <LLGL/FrameGraph.h>
+#include <LLGL/RenderTargetPool.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+
+static unsigned int g_numErrors = 0;
+
+static void Check(bool condition, const std::string& desc)
+{
+    if (!condition)
+    {
+        std::cerr << "error: " << desc << std::endl;
+        ++g_numErrors;
+    }
+}
+
+// Returns an execution function, which appends the pass name to the specified list
+static LLGL::FrameGraphExecuteFunction RecordPass(std::vector<std::string>& executedPasses, const std::string& name)
+{
+    return [&executedPasses, name](LLGL::CommandBuffer&, const LLGL::FrameGraph&)
+    {
+        executedPasses.push_back(name);
+    };
+}
+
+static void TestCulling(LLGL::RenderSystem& renderer, LLGL::RenderContext& context, LLGL::CommandBuffer& commands)
+{
+    LLGL::FrameGraph graph(renderer);
+    std::vector<std::string> executedPasses;
+
+    const auto texDesc = LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, 64, 64);
+
+    /* "Producer" writes two textures, but only the second one is read by a pass with results */
+    auto texR = graph.CreateTexture(texDesc);
+    auto texS = graph.CreateTexture(texDesc);
+
+    auto producer = graph.AddPass("Producer", RecordPass(executedPasses, "Producer"));
+    graph.WriteAttachment(producer, texR, true);
+    graph.WriteAttachment(producer, texS, true);
+
+    auto debugView = graph.AddPass("DebugView", RecordPass(executedPasses, "DebugView"));
+    graph.Read(debugView, texR);
+
+    auto present = graph.AddPass("Present", RecordPass(executedPasses, "Present"));
+    graph.Read(present, texS);
+    graph.WriteRenderContext(present, context);
+
+    /* "Unused" chain: the result of the second pass is never read, so both passes are culled */
+    auto texT = graph.CreateTexture(texDesc);
+    auto texU = graph.CreateTexture(texDesc);
+
+    auto unused1 = graph.AddPass("Unused1", RecordPass(executedPasses, "Unused1"));
+    graph.WriteAttachment(unused1, texT);
+
+    auto unused2 = graph.AddPass("Unused2", RecordPass(executedPasses, "Unused2"));
+    graph.Read(unused2, texT);
+    graph.WriteAttachment(unused2, texU);
+
+    graph.Execute(commands);
+
+    const auto& stats = graph.GetStatistics();
+
+    Check(executedPasses == std::vector<std::string>{ "Producer", "Present" }, "unexpected passes executed after culling");
+    Check(stats.numPasses == 5, "unexpected number of passes");
+    Check(stats.numCulledPasses == 3, "unexpected number of culled passes");
+}
+
+static void TestAliasing(LLGL::RenderSystem& renderer, LLGL::RenderContext& context, LLGL::CommandBuffer& commands)
+{
+    LLGL::FrameGraph graph(renderer);
+
+    const auto texDesc = LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, 128, 128);
+
+    LLGL::Texture* textures[3] = {};
+    LLGL::Texture* prevTextures[3] = {};
+
+    for (int frame = 0; frame < 2; ++frame)
+    {
+        /* Chain of three passes: the texture of the first pass has expired when the third pass begins */
+        LLGL::FrameGraphResource tex[3];
+        for (int i = 0; i < 3; ++i)
+            tex[i] = graph.CreateTexture(texDesc);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            auto pass = graph.AddPass(
+                "Chain" + std::to_string(i),
+                [&textures, &tex, i](LLGL::CommandBuffer&, const LLGL::FrameGraph& g)
+                {
+                    textures[i] = &(g.GetTexture(tex[i]));
+                }
+            );
+            if (i > 0)
+                graph.Read(pass, tex[i - 1]);
+            graph.WriteAttachment(pass, tex[i], true);
+        }
+
+        auto present = graph.AddPass("Present", nullptr);
+        graph.Read(present, tex[2]);
+        graph.WriteRenderContext(present, context);
+
+        graph.Execute(commands);
+
+        const auto& stats = graph.GetStatistics();
+
+        Check(stats.numTransientTextures == 3, "unexpected number of transient textures");
+        Check(stats.numPhysicalTextures == 2, "transient textures with disjoint lifetimes are not aliased");
+        Check(textures[0] == textures[2], "first and third texture of the chain do not share the same texture object");
+        Check(textures[0] != textures[1], "textures with overlapping lifetimes share the same texture object");
+
+        /* Texture objects must be recycled in the next frame */
+        if (frame > 0)
+        {
+            for (int i = 0; i < 3; ++i)
+                Check(textures[i] == prevTextures[i], "texture objects are not recycled in the next frame");
+        }
+
+        for (int i = 0; i < 3; ++i)
+            prevTextures[i] = textures[i];
+
+        graph.Reset();
+    }
+}
+
+static void TestRenderTargetPool(LLGL::RenderSystem& renderer)
+{
+    LLGL::RenderTargetPool pool(renderer, 1);
+
+    LLGL::TransientRenderTargetDescriptor desc;
+    {
+        desc.attachments = { LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, 256, 256) };
+        desc.depthBuffer = true;
+    }
+
+    /* Render targets which are in use must not be handed out twice in the same frame */
+    auto target0 = pool.Acquire(desc).renderTarget;
+    auto target1 = pool.Acquire(desc).renderTarget;
+
+    Check(target0 != target1, "render target was acquired twice in the same frame");
+    Check(pool.GetSize() == 2, "unexpected number of render targets in the pool");
+
+    /* After the frame, the render targets are recycled */
+    pool.NextFrame();
+
+    auto target2 = pool.Acquire(desc).renderTarget;
+    Check(target2 == target0 || target2 == target1, "render target was not recycled in the next frame");
+
+    /* Entries which are no longer used are released */
+    pool.NextFrame();
+    pool.NextFrame();
+    pool.NextFrame();
+
+    Check(pool.GetSize() == 0, "unused render targets were not released");
+}
+
+int main()
+{
+    try
+    {
+        auto renderer = LLGL::RenderSystem::Load("Null");
+
+        LLGL::RenderContextDescriptor contextDesc;
+        {
+            contextDesc.videoMode.resolution = { 800, 600 };
+        }
+        auto context = renderer->CreateRenderContext(contextDesc);
+
+        auto commands = renderer->CreateCommandBuffer();
+
+        TestCulling(*renderer, *context, *commands);
+        TestAliasing(*renderer, *context, *commands);
+        TestRenderTargetPool(*renderer);
+
+        std::cout << "errors = " << g_numErrors << std::endl;
+
+        return (g_numErrors == 0 ? 0 : 1);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,187 @@
+/*
+ * Test17_RenderPass.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Test for render pass load and store operations with a headless OpenGL context (EGL), e.g. on Mesa llvmpipe.
+// The load operations "Load" and "Clear" are checked by reading back the render target texture.
+// The operations "DontCare" and "Discard" are checked by recording the calls of "glInvalidateFramebuffer",
+// which must be issued at the begin and at the end of a render pass respectively (for the default framebuffer before "Present").
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utility.h>
+#include "../sources/Renderer/OpenGL/Ext/GLExtensions.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <stdexcept>
+
+
+static unsigned int                     g_numErrors = 0;
+static PFNGLINVALIDATEFRAMEBUFFERPROC   g_glInvalidateFramebuffer = nullptr;
+static std::vector<GLenum>              g_invalidatedAttachments;
+static unsigned int                     g_numInvalidateCalls = 0;
+
+static void APIENTRY Recording_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum* attachments)
+{
+    ++g_numInvalidateCalls;
+    g_invalidatedAttachments.assign(attachments, attachments + numAttachments);
+    g_glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+
+static void Check(bool condition, const std::string& desc)
+{
+    if (!condition)
+    {
+        std::cerr << "error: " << desc << std::endl;
+        ++g_numErrors;
+    }
+}
+
+static void ResetInvalidateCalls()
+{
+    g_numInvalidateCalls = 0;
+    g_invalidatedAttachments.clear();
+}
+
+static bool CheckTexels(LLGL::RenderSystem& renderer, LLGL::Texture& texture, unsigned int numTexels, std::uint8_t r, std::uint8_t g, std::uint8_t b)
+{
+    std::vector<std::uint8_t> pixels(numTexels * 4, 0);
+    renderer.ReadTexture(texture, 0, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, pixels.data());
+
+    for (std::size_t i = 0; i < pixels.size(); i += 4)
+    {
+        if (pixels[i] != r || pixels[i + 1] != g || pixels[i + 2] != b)
+            return false;
+    }
+
+    return true;
+}
+
+static LLGL::RenderPassDescriptor MakeRenderPass(
+    LLGL::AttachmentLoadOp colorLoadOp, LLGL::AttachmentStoreOp colorStoreOp,
+    LLGL::AttachmentLoadOp depthLoadOp = LLGL::AttachmentLoadOp::Load, LLGL::AttachmentStoreOp depthStoreOp = LLGL::AttachmentStoreOp::Store)
+{
+    LLGL::RenderPassDescriptor renderPassDesc;
+    {
+        renderPassDesc.colorAttachments = { { colorLoadOp, colorStoreOp } };
+        renderPassDesc.depthAttachment  = { depthLoadOp, depthStoreOp };
+    }
+    return renderPassDesc;
+}
+
+int main()
+{
+    try
+    {
+        auto renderer = LLGL::RenderSystem::Load("OpenGL");
+
+        /* Create headless context with pbuffer as default framebuffer */
+        LLGL::RenderContextDescriptor contextDesc;
+        {
+            contextDesc.videoMode.resolution    = { 64, 64 };
+            contextDesc.profileOpenGL.headless  = true;
+        }
+        auto context = renderer->CreateRenderContext(contextDesc);
+
+        std::cout << "renderer = " << renderer->GetRendererInfo().rendererName << std::endl;
+
+        /* Record invalidated attachments (the procedure is shared with the loaded render system module) */
+        if (!LLGL::glInvalidateFramebuffer)
+            throw std::runtime_error("GL_ARB_invalidate_subdata is not supported");
+
+        g_glInvalidateFramebuffer       = LLGL::glInvalidateFramebuffer;
+        LLGL::glInvalidateFramebuffer   = Recording_glInvalidateFramebuffer;
+
+        auto commands = renderer->CreateCommandBuffer();
+
+        /* Create render target with color texture and depth buffer */
+        const unsigned int size = 16, numTexels = size * size;
+
+        auto texture = renderer->CreateTexture(LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, size, size));
+        auto renderTarget = renderer->CreateRenderTarget({});
+        renderTarget->AttachDepthBuffer({ size, size });
+        renderTarget->AttachTexture(*texture, {});
+
+        /* Load operation "Clear" must clear the attachment, and store operation "Store" must not invalidate it */
+        ResetInvalidateCalls();
+        {
+            commands->SetClearColor({ 1.0f, 0.0f, 0.0f, 1.0f });
+            auto renderPass = MakeRenderPass(LLGL::AttachmentLoadOp::Clear, LLGL::AttachmentStoreOp::Store);
+            commands->SetRenderTarget(*renderTarget, &renderPass);
+            commands->SetRenderTarget(*context);
+        }
+        Check(CheckTexels(*renderer, *texture, numTexels, 255, 0, 0), "load operation 'Clear' did not clear the color attachment");
+        Check(g_numInvalidateCalls == 0, "store operation 'Store' invalidated an attachment");
+
+        /* Load operation "Load" must preserve the previous content */
+        ResetInvalidateCalls();
+        {
+            commands->SetClearColor({ 0.0f, 1.0f, 0.0f, 1.0f });
+            auto renderPass = MakeRenderPass(LLGL::AttachmentLoadOp::Load, LLGL::AttachmentStoreOp::Store);
+            commands->SetRenderTarget(*renderTarget, &renderPass);
+            commands->SetRenderTarget(*context);
+        }
+        Check(CheckTexels(*renderer, *texture, numTexels, 255, 0, 0), "load operation 'Load' did not preserve the color attachment");
+        Check(g_numInvalidateCalls == 0, "load operation 'Load' invalidated an attachment");
+
+        /* Load operation "DontCare" must invalidate the attachments when the render pass begins */
+        ResetInvalidateCalls();
+        {
+            auto renderPass = MakeRenderPass(LLGL::AttachmentLoadOp::DontCare, LLGL::AttachmentStoreOp::Store, LLGL::AttachmentLoadOp::DontCare);
+            commands->SetRenderTarget(*renderTarget, &renderPass);
+        }
+        Check(
+            g_numInvalidateCalls == 1 && g_invalidatedAttachments == std::vector<GLenum>{ GL_COLOR_ATTACHMENT0, GL_DEPTH_ATTACHMENT },
+            "load operation 'DontCare' did not invalidate the attachments when the render pass begins"
+        );
+
+        /* Store operation "Discard" must invalidate the attachments when the render pass ends */
+        ResetInvalidateCalls();
+        {
+            auto renderPass = MakeRenderPass(LLGL::AttachmentLoadOp::Clear, LLGL::AttachmentStoreOp::Store, LLGL::AttachmentLoadOp::Clear, LLGL::AttachmentStoreOp::Discard);
+            commands->SetRenderTarget(*renderTarget, &renderPass);
+            Check(g_numInvalidateCalls == 0, "store operation 'Discard' invalidated an attachment before the render pass ends");
+
+            commands->SetRenderTarget(*context);
+        }
+        Check(
+            g_numInvalidateCalls == 1 && g_invalidatedAttachments == std::vector<GLenum>{ GL_DEPTH_ATTACHMENT },
+            "store operation 'Discard' did not invalidate the attachment when the render pass ends"
+        );
+
+        /* Store operation "Discard" on the default framebuffer must invalidate the attachments before the buffers are swapped */
+        ResetInvalidateCalls();
+        {
+            auto renderPass = MakeRenderPass(LLGL::AttachmentLoadOp::Clear, LLGL::AttachmentStoreOp::Discard, LLGL::AttachmentLoadOp::Clear, LLGL::AttachmentStoreOp::Discard);
+            commands->SetRenderTarget(*context, &renderPass);
+            Check(g_numInvalidateCalls == 0, "store operation 'Discard' invalidated the default framebuffer before the render pass ends");
+
+            context->Present();
+            Check(
+                g_numInvalidateCalls == 1 && g_invalidatedAttachments == std::vector<GLenum>{ GL_COLOR, GL_DEPTH },
+                "store operation 'Discard' did not invalidate the default framebuffer before the buffers are swapped"
+            );
+
+            /* The discarded attachments of the next frame must not be invalidated by the next render pass */
+            commands->SetRenderTarget(*context);
+        }
+        Check(g_numInvalidateCalls == 1, "default framebuffer was invalidated again after the buffers were swapped");
+
+        std::cout << "errors = " << g_numErrors << std::endl;
+
+        return (g_numErrors == 0 ? 0 : 1);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,136 @@
+/*
+ * Test18_BufferHeap.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Test for the buffer heap, using the Null renderer.
+// Checks the sub-allocated vertex and index offsets, that released ranges are reused and merged,
+// that a new page is only created if no page has enough free space, and that the data is written at the sub-allocated offsets.
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utility.h>
+#include <LLGL/BufferHeap.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+
+static unsigned int g_numErrors = 0;
+
+static void Check(bool condition, const std::string& desc)
+{
+    if (!condition)
+    {
+        std::cerr << "error: " << desc << std::endl;
+        ++g_numErrors;
+    }
+}
+
+// Returns true if the buffer contains the specified data at the specified offset (in bytes)
+static bool CompareBufferData(LLGL::RenderSystem& renderer, LLGL::Buffer& buffer, std::size_t offset, const void* data, std::size_t dataSize)
+{
+    bool equal = false;
+
+    if (auto mapped = static_cast<const char*>(renderer.MapBuffer(buffer, LLGL::BufferCPUAccess::ReadOnly)))
+    {
+        equal = (std::memcmp(mapped + offset, data, dataSize) == 0);
+        renderer.UnmapBuffer(buffer);
+    }
+
+    return equal;
+}
+
+int main()
+{
+    try
+    {
+        auto renderer = LLGL::RenderSystem::Load("Null");
+
+        LLGL::BufferHeapDescriptor heapDesc;
+        {
+            heapDesc.vertexFormat.AppendAttribute({ "position", LLGL::VectorType::Float3 });
+            heapDesc.indexFormat        = LLGL::IndexFormat(LLGL::DataType::UInt16);
+            heapDesc.verticesPerPage    = 1024;
+            heapDesc.indicesPerPage     = 4096;
+        }
+        LLGL::BufferHeap heap(*renderer, heapDesc);
+
+        Check(heap.GetNumPages() == 0, "buffer heap created a page before the first allocation");
+
+        /* Allocate two meshes, which must be placed one after another into the first page */
+        std::vector<float> verticesA(100 * 3, 1.0f), verticesB(200 * 3, 2.0f);
+        std::vector<std::uint16_t> indicesA(300, 1), indicesB(600, 2);
+
+        auto meshA = heap.Alloc(100, verticesA.data(), 300, indicesA.data());
+        auto meshB = heap.Alloc(200, verticesB.data(), 600, indicesB.data());
+
+        Check(meshA.page == 0 && meshA.firstVertex == 0 && meshA.firstIndex == 0, "unexpected offsets of first allocation");
+        Check(meshB.page == 0 && meshB.firstVertex == 100 && meshB.firstIndex == 300, "unexpected offsets of second allocation");
+        Check(meshA.vertexBuffer == meshB.vertexBuffer && meshA.indexBuffer == meshB.indexBuffer, "allocations of the same page do not share their buffers");
+        Check(heap.GetNumPages() == 1, "unexpected number of pages after two small allocations");
+
+        /* Vertex and index data must be written at the sub-allocated offsets */
+        const std::size_t stride = heapDesc.vertexFormat.stride;
+
+        Check(
+            CompareBufferData(*renderer, *meshB.vertexBuffer, stride * meshB.firstVertex, verticesB.data(), stride * meshB.numVertices),
+            "vertex data was not written at the sub-allocated offset"
+        );
+        Check(
+            CompareBufferData(*renderer, *meshB.indexBuffer, sizeof(std::uint16_t) * meshB.firstIndex, indicesB.data(), sizeof(std::uint16_t) * meshB.numIndices),
+            "index data was not written at the sub-allocated offset"
+        );
+
+        /* A released range must be reused by the next allocation that fits into it */
+        heap.Free(meshA);
+
+        auto meshC = heap.Alloc(50, nullptr, 150, nullptr);
+        Check(meshC.page == 0 && meshC.firstVertex == 0 && meshC.firstIndex == 0, "released range was not reused");
+
+        /* An allocation that does not fit into the remaining space must create a new page */
+        auto meshD = heap.Alloc(1000, nullptr);
+        Check(meshD.page == 1 && meshD.firstVertex == 0, "unexpected offsets of allocation in second page");
+        Check(meshD.vertexBuffer != meshB.vertexBuffer, "allocation in second page shares the vertex buffer of the first page");
+        Check(heap.GetNumPages() == 2, "unexpected number of pages after large allocation");
+
+        /* After all ranges have been released, they must have been merged into a single range covering the entire page */
+        heap.Free(meshB);
+        heap.Free(meshC);
+        heap.Free(meshD);
+
+        auto meshE = heap.Alloc(heapDesc.verticesPerPage, nullptr, heapDesc.indicesPerPage, nullptr);
+        Check(meshE.page == 0 && meshE.firstVertex == 0 && meshE.firstIndex == 0, "released ranges were not merged");
+        Check(heap.GetNumPages() == 2, "buffer heap created a page although a released page was available");
+
+        /* Allocations that exceed the size of a page must be rejected */
+        try
+        {
+            heap.Alloc(heapDesc.verticesPerPage + 1, nullptr);
+            Check(false, "allocation that exceeds the page size was not rejected");
+        }
+        catch (const std::invalid_argument&)
+        {
+        }
+
+        heap.Clear();
+        Check(heap.GetNumPages() == 0, "buffer heap has pages after it has been cleared");
+
+        std::cout << "buffer heap = " << (g_numErrors == 0 ? "ok" : "failed") << std::endl;
+
+        return (g_numErrors == 0 ? 0 : 1);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
+
+
+
+// ================================================================================
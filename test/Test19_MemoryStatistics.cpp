@@ -0,0 +1,116 @@
+/*
+ * Test19_MemoryStatistics.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Test for the memory statistics, using the Null renderer.
+// Checks that the tallies of buffers, textures, and render targets go up when they are created and back down when they are released,
+// and that a failed resource creation leaves the tallies unchanged.
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utility.h>
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+
+static unsigned int g_numErrors = 0;
+
+static void Check(bool condition, const std::string& desc)
+{
+    if (!condition)
+    {
+        std::cerr << "error: " << desc << std::endl;
+        ++g_numErrors;
+    }
+}
+
+// Returns true if the resource tallies of both statistics are equal
+static bool EqualTallies(const LLGL::MemoryStatistics& lhs, const LLGL::MemoryStatistics& rhs)
+{
+    return
+    (
+        lhs.bufferMemory        == rhs.bufferMemory         &&
+        lhs.numBuffers          == rhs.numBuffers           &&
+        lhs.textureMemory       == rhs.textureMemory        &&
+        lhs.numTextures         == rhs.numTextures          &&
+        lhs.renderTargetMemory  == rhs.renderTargetMemory   &&
+        lhs.numRenderTargets    == rhs.numRenderTargets
+    );
+}
+
+int main()
+{
+    try
+    {
+        auto renderer = LLGL::RenderSystem::Load("Null");
+
+        const auto initialStats = renderer->QueryMemoryStatistics();
+
+        /* Create buffer, texture, and render target, which must be added to the tallies */
+        LLGL::BufferDescriptor bufferDesc;
+        {
+            bufferDesc.type = LLGL::BufferType::Storage;
+            bufferDesc.size = 4096;
+        }
+        auto buffer = renderer->CreateBuffer(bufferDesc);
+
+        auto stats = renderer->QueryMemoryStatistics();
+        Check(stats.numBuffers == initialStats.numBuffers + 1, "number of buffers did not go up after buffer creation");
+        Check(stats.bufferMemory == initialStats.bufferMemory + bufferDesc.size, "buffer memory did not go up by the buffer size");
+
+        auto texture = renderer->CreateTexture(LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, 16, 16));
+
+        stats = renderer->QueryMemoryStatistics();
+        Check(stats.numTextures == initialStats.numTextures + 1, "number of textures did not go up after texture creation");
+        Check(stats.textureMemory >= initialStats.textureMemory + 16 * 16 * 4, "texture memory did not go up by the texture size");
+
+        auto renderTarget = renderer->CreateRenderTarget({});
+        renderTarget->AttachTexture(*texture, {});
+
+        stats = renderer->QueryMemoryStatistics();
+        Check(stats.numRenderTargets == initialStats.numRenderTargets + 1, "number of render targets did not go up after render target creation");
+
+        /* Release all resources, which must be removed from the tallies again */
+        renderer->Release(*renderTarget);
+        renderer->Release(*texture);
+        renderer->Release(*buffer);
+
+        stats = renderer->QueryMemoryStatistics();
+        Check(EqualTallies(stats, initialStats), "memory statistics did not go back down after all resources have been released");
+
+        /* Failed buffer creation must leave the tallies unchanged */
+        LLGL::BufferDescriptor invalidBufferDesc;
+        {
+            invalidBufferDesc.type = LLGL::BufferType::Vertex;
+            invalidBufferDesc.size = 1024;
+        }
+
+        try
+        {
+            renderer->CreateBuffer(invalidBufferDesc);
+            Check(false, "creation of vertex buffer with zero vertex stride did not fail");
+        }
+        catch (const std::invalid_argument&)
+        {
+        }
+
+        stats = renderer->QueryMemoryStatistics();
+        Check(EqualTallies(stats, initialStats), "memory statistics changed after failed buffer creation");
+
+        std::cout << "memory statistics = " << (g_numErrors == 0 ? "ok" : "failed") << std::endl;
+
+        return (g_numErrors == 0 ? 0 : 1);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
+
+
+
+// ================================================================================
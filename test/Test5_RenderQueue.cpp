@@ -0,0 +1,159 @@
+/*
+ * Test5_RenderQueue.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/RenderQueue.h>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <memory>
+#include <vector>
+
+
+// Command buffer which only counts the state changes and draw calls
+class CountingCommandBuffer : public LLGL::CommandBuffer
+{
+
+    public:
+
+        unsigned int stateCalls = 0;
+        unsigned int drawCalls  = 0;
+
+        void SetGraphicsAPIDependentState(const LLGL::GraphicsAPIDependentStateDescriptor&) override {}
+        void SetViewport(const LLGL::Viewport&) override { ++stateCalls; }
+        void SetViewportArray(unsigned int, const LLGL::Viewport*) override { ++stateCalls; }
+        void SetScissor(const LLGL::Scissor&) override { ++stateCalls; }
+        void SetScissorArray(unsigned int, const LLGL::Scissor*) override { ++stateCalls; }
+        void SetClearColor(const LLGL::ColorRGBAf&) override {}
+        void SetClearDepth(float) override {}
+        void SetClearStencil(int) override {}
+        void Clear(long) override {}
+        void ClearTarget(unsigned int, const LLGL::ColorRGBAf&) override {}
+
+        void SetVertexBuffer(LLGL::Buffer&) override { ++stateCalls; }
+        void SetVertexBufferArray(LLGL::BufferArray&) override { ++stateCalls; }
+        void SetIndexBuffer(LLGL::Buffer&) override { ++stateCalls; }
+        void SetConstantBuffer(LLGL::Buffer&, unsigned int, long) override { ++stateCalls; }
+        void SetConstantBufferArray(LLGL::BufferArray&, unsigned int, long) override { ++stateCalls; }
+        void SetStorageBuffer(LLGL::Buffer&, unsigned int, long) override { ++stateCalls; }
+        void SetStorageBufferArray(LLGL::BufferArray&, unsigned int, long) override { ++stateCalls; }
+        void SetStreamOutputBuffer(LLGL::Buffer&) override { ++stateCalls; }
+        void SetStreamOutputBufferArray(LLGL::BufferArray&) override { ++stateCalls; }
+        void BeginStreamOutput(const LLGL::PrimitiveType) override {}
+        void EndStreamOutput() override {}
+
+        void SetTexture(LLGL::Texture&, unsigned int, long) override { ++stateCalls; }
+        void SetTextureArray(LLGL::TextureArray&, unsigned int, long) override { ++stateCalls; }
+        void SetSampler(LLGL::Sampler&, unsigned int, long) override { ++stateCalls; }
+        void SetSamplerArray(LLGL::SamplerArray&, unsigned int, long) override { ++stateCalls; }
+        void SetResourceHeap(LLGL::ResourceHeap&) override { ++stateCalls; }
+
+        void SetRenderTarget(LLGL::RenderTarget&, const LLGL::RenderPassDescriptor*) override { ++stateCalls; }
+        void SetRenderTarget(LLGL::RenderContext&, const LLGL::RenderPassDescriptor*) override { ++stateCalls; }
+
+        void SetGraphicsPipeline(LLGL::GraphicsPipeline&) override { ++stateCalls; }
+        void SetComputePipeline(LLGL::ComputePipeline&) override { ++stateCalls; }
+
+        void BeginQuery(LLGL::Query&) override {}
+        void EndQuery(LLGL::Query&) override {}
+        bool QueryResult(LLGL::Query&, std::uint64_t&) override { return false; }
+        void BeginRenderCondition(LLGL::Query&, const LLGL::RenderConditionMode) override {}
+        void EndRenderCondition() override {}
+
+        void Draw(unsigned int, unsigned int) override { ++drawCalls; }
+        void DrawIndexed(unsigned int, unsigned int) override { ++drawCalls; }
+        void DrawIndexed(unsigned int, unsigned int, int) override { ++drawCalls; }
+        void DrawInstanced(unsigned int, unsigned int, unsigned int) override { ++drawCalls; }
+        void DrawInstanced(unsigned int, unsigned int, unsigned int, unsigned int) override { ++drawCalls; }
+        void DrawIndexedInstanced(unsigned int, unsigned int, unsigned int) override { ++drawCalls; }
+        void DrawIndexedInstanced(unsigned int, unsigned int, unsigned int, int) override { ++drawCalls; }
+        void DrawIndexedInstanced(unsigned int, unsigned int, unsigned int, int, unsigned int) override { ++drawCalls; }
+
+        void DrawIndirect(LLGL::Buffer&, unsigned int) override { ++drawCalls; }
+        void DrawIndexedIndirect(LLGL::Buffer&, unsigned int) override { ++drawCalls; }
+        void MultiDrawIndirect(LLGL::Buffer&, unsigned int, unsigned int, unsigned int) override { ++drawCalls; }
+        void MultiDrawIndexedIndirect(LLGL::Buffer&, unsigned int, unsigned int, unsigned int) override { ++drawCalls; }
+
+        void Dispatch(unsigned int, unsigned int, unsigned int) override {}
+        void DispatchIndirect(LLGL::Buffer&, unsigned int) override {}
+
+        void SignalFence(LLGL::Fence&) override {}
+        void SyncGPU() override {}
+
+};
+
+class DummyBuffer : public LLGL::Buffer
+{
+    public:
+        DummyBuffer() : LLGL::Buffer { LLGL::BufferType::Vertex } {}
+};
+
+class DummyTexture : public LLGL::Texture
+{
+    public:
+        DummyTexture() : LLGL::Texture { LLGL::TextureType::Texture2D } {}
+        Gs::Vector3ui QueryMipLevelSize(unsigned int) const override { return {}; }
+};
+
+class DummyPipeline : public LLGL::GraphicsPipeline
+{
+};
+
+int main()
+{
+    const unsigned int numPackets       = 100000;
+    const unsigned int numPipelines     = 8;
+    const unsigned int numTextures      = 64;
+    const unsigned int numVertexBuffers = 32;
+
+    // Create dummy objects
+    std::vector<DummyPipeline> pipelines(numPipelines);
+    std::vector<DummyTexture> textures(numTextures);
+    std::vector<DummyBuffer> vertexBuffers(numVertexBuffers);
+
+    // Submit randomly ordered draw packets
+    std::mt19937 rng(42);
+    LLGL::RenderQueue queue;
+
+    for (unsigned int i = 0; i < numPackets; ++i)
+    {
+        auto pipelineID = rng() % numPipelines;
+        auto textureID  = rng() % numTextures;
+        auto vertexID   = rng() % numVertexBuffers;
+
+        LLGL::DrawPacket packet;
+        {
+            packet.sortKey          = LLGL::RenderQueue::MakeSortKey(0, 0, pipelineID, textureID, vertexID);
+            packet.graphicsPipeline = &(pipelines[pipelineID]);
+            packet.texture          = &(textures[textureID]);
+            packet.vertexBuffer     = &(vertexBuffers[vertexID]);
+            packet.numVertices      = 36;
+        }
+        queue.Submit(packet);
+    }
+
+    // Execute queue in submission order and in sorted order
+    for (auto sort : { false, true })
+    {
+        CountingCommandBuffer commands;
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        queue.Execute(commands, sort);
+        auto endTime = std::chrono::high_resolution_clock::now();
+
+        const auto& stats = queue.GetStatistics();
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
+
+        std::cout << (sort ? "sorted:   " : "unsorted: ");
+        std::cout << "draw calls = " << commands.drawCalls;
+        std::cout << ", state calls = " << commands.stateCalls;
+        std::cout << ", skipped = " << stats.numSkippedChanges;
+        std::cout << ", time = " << duration << " us" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * Test6_MultiBind.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Benchmark for the GL state manager binding paths, which runs without a GL context.
+// All binding procedures are replaced by placeholders, which only count the GL calls.
+
+#include "../sources/Renderer/OpenGL/RenderState/GLStateManager.h"
+#include "../sources/Renderer/OpenGL/Ext/GLExtensions.h"
+#include "../sources/Renderer/GLCommon/GLExtensionRegistry.h"
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+
+using namespace LLGL;
+
+static unsigned int g_numGLCalls = 0;
+
+// Core GL 1.1 procedure is not loaded as extension, so it is overridden here
+extern "C" void APIENTRY glBindTexture(GLenum, GLuint)
+{
+    ++g_numGLCalls;
+}
+
+static void APIENTRY Placeholder_glActiveTexture(GLenum)
+{
+    ++g_numGLCalls;
+}
+
+static void APIENTRY Placeholder_glBindTextures(GLuint, GLsizei, const GLuint*)
+{
+    ++g_numGLCalls;
+}
+
+static void APIENTRY Placeholder_glBindSampler(GLuint, GLuint)
+{
+    ++g_numGLCalls;
+}
+
+static void APIENTRY Placeholder_glBindSamplers(GLuint, GLsizei, const GLuint*)
+{
+    ++g_numGLCalls;
+}
+
+static void APIENTRY Placeholder_glBindBufferBase(GLenum, GLuint, GLuint)
+{
+    ++g_numGLCalls;
+}
+
+static void APIENTRY Placeholder_glBindBuffersBase(GLenum, GLuint, GLsizei, const GLuint*)
+{
+    ++g_numGLCalls;
+}
+
+// Material with 8 textures, 8 samplers, and 4 constant buffers.
+// The first half of the bindings is shared by all materials (e.g. shadow maps and per-frame constants).
+struct Material
+{
+    GLTextureTarget targets[8];
+    GLuint          textures[8];
+    GLuint          samplers[8];
+    GLuint          buffers[4];
+};
+
+static std::vector<Material> MakeMaterials(unsigned int numMaterials)
+{
+    std::vector<Material> materials(numMaterials);
+
+    for (unsigned int i = 0; i < numMaterials; ++i)
+    {
+        auto& mat = materials[i];
+        for (GLuint j = 0; j < 8; ++j)
+        {
+            mat.targets[j]  = GLTextureTarget::TEXTURE_2D;
+            mat.textures[j] = (j < 4 ? 1 + j : 100 + i * 8 + j);
+            mat.samplers[j] = (j < 4 ? 1 : 1 + (i % 3));
+        }
+        for (GLuint j = 0; j < 4; ++j)
+            mat.buffers[j] = (j < 2 ? 1 + j : 100 + i * 4 + j);
+    }
+
+    return materials;
+}
+
+enum class BindMode
+{
+    PerSlot,
+    Batched,
+};
+
+static void RunFrame(GLStateManager& stateMngr, const std::vector<Material>& materials, const BindMode mode)
+{
+    for (const auto& mat : materials)
+    {
+        if (mode == BindMode::PerSlot)
+        {
+            for (GLuint j = 0; j < 8; ++j)
+            {
+                stateMngr.ActiveTexture(j);
+                stateMngr.BindTexture(mat.targets[j], mat.textures[j]);
+                stateMngr.BindSampler(j, mat.samplers[j]);
+            }
+            for (GLuint j = 0; j < 4; ++j)
+                stateMngr.BindBufferBase(GLBufferTarget::UNIFORM_BUFFER, j, mat.buffers[j]);
+        }
+        else
+        {
+            stateMngr.BindTextures(0, 8, mat.targets, mat.textures);
+            stateMngr.BindSamplers(0, 8, mat.samplers);
+            stateMngr.BindBuffersBase(GLBufferTarget::UNIFORM_BUFFER, 0, 4, mat.buffers);
+        }
+    }
+}
+
+static void RunBenchmark(const std::string& name, const std::vector<Material>& materials, const BindMode mode)
+{
+    const unsigned int numFrames = 100;
+
+    GLStateManager stateMngr;
+    stateMngr.DetermineExtensions();
+
+    g_numGLCalls = 0;
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (unsigned int i = 0; i < numFrames; ++i)
+        RunFrame(stateMngr, materials, mode);
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
+
+    std::cout << name << "GL binding calls per frame = " << (g_numGLCalls / numFrames);
+    std::cout << ", time per frame = " << (duration / numFrames) << " us" << std::endl;
+}
+
+int main()
+{
+    // Replace GL binding procedures by placeholders
+    LLGL::glActiveTexture     = Placeholder_glActiveTexture;
+    LLGL::glBindTextures      = Placeholder_glBindTextures;
+    LLGL::glBindSampler       = Placeholder_glBindSampler;
+    LLGL::glBindSamplers      = Placeholder_glBindSamplers;
+    LLGL::glBindBufferBase    = Placeholder_glBindBufferBase;
+    LLGL::glBindBuffersBase   = Placeholder_glBindBuffersBase;
+
+    auto materials = MakeMaterials(1000);
+
+    std::cout << "materials per frame = " << materials.size() << std::endl;
+
+    RunBenchmark("per-slot:                ", materials, BindMode::PerSlot);
+    RunBenchmark("batched (no multi-bind): ", materials, BindMode::Batched);
+
+    RegisterExtension(GLExt::ARB_multi_bind);
+
+    RunBenchmark("batched (multi-bind):    ", materials, BindMode::Batched);
+
+    return 0;
+}
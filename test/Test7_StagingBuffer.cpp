@@ -0,0 +1,166 @@
+/*
+ * Test7_StagingBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Test for the GL staging buffer ring, which runs without a GL context.
+// The buffer and sync procedures are replaced by placeholders, which simulate a GPU that lags behind the CPU.
+// Each transfer is validated when its fence is signaled, i.e. the ring must never overwrite a region which is still in use.
+
+#include "../sources/Renderer/OpenGL/Buffer/GLStagingBufferRing.h"
+#include "../sources/Renderer/OpenGL/RenderState/GLStateManager.h"
+#include "../sources/Renderer/OpenGL/Ext/GLExtensions.h"
+#include <iostream>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+
+using namespace LLGL;
+
+struct Transfer
+{
+    GLintptr        offset;
+    GLsizeiptr      size;
+    unsigned char   pattern;
+};
+
+static std::vector<unsigned char>   g_bufferStorage;
+static std::vector<Transfer>        g_transfers;            // Transfers indexed by fence ID - 1
+static std::size_t                  g_numCompleted  = 0;    // Number of transfers completed by the simulated GPU
+static unsigned int                 g_numStalls     = 0;
+static unsigned int                 g_numErrors     = 0;
+
+// Simulates the GPU execution of all transfers up to the specified fence
+static void CompleteTransfers(std::size_t fenceID)
+{
+    for (; g_numCompleted < fenceID && g_numCompleted < g_transfers.size(); ++g_numCompleted)
+    {
+        /* Region is valid if its first byte matches the pattern and all bytes are equal to their successors */
+        const auto& transfer = g_transfers[g_numCompleted];
+        auto region = g_bufferStorage.data() + transfer.offset;
+        if (region[0] != transfer.pattern || std::memcmp(region, region + 1, static_cast<std::size_t>(transfer.size - 1)) != 0)
+            ++g_numErrors;
+    }
+}
+
+static void APIENTRY Placeholder_glGenBuffers(GLsizei n, GLuint* buffers)
+{
+    for (GLsizei i = 0; i < n; ++i)
+        buffers[i] = 1;
+}
+
+static void APIENTRY Placeholder_glDeleteBuffers(GLsizei, const GLuint*)
+{
+}
+
+static void APIENTRY Placeholder_glBindBuffer(GLenum, GLuint)
+{
+}
+
+static void APIENTRY Placeholder_glBufferData(GLenum, GLsizeiptr size, const void*, GLenum)
+{
+    g_bufferStorage.resize(static_cast<std::size_t>(size));
+}
+
+static void APIENTRY Placeholder_glBufferSubData(GLenum, GLintptr offset, GLsizeiptr size, const void* data)
+{
+    std::memcpy(g_bufferStorage.data() + offset, data, static_cast<std::size_t>(size));
+}
+
+static void* APIENTRY Placeholder_glMapBufferRange(GLenum, GLintptr offset, GLsizeiptr, GLbitfield)
+{
+    return g_bufferStorage.data() + offset;
+}
+
+static GLboolean APIENTRY Placeholder_glUnmapBuffer(GLenum)
+{
+    return GL_TRUE;
+}
+
+static GLsync APIENTRY Placeholder_glFenceSync(GLenum, GLbitfield)
+{
+    return reinterpret_cast<GLsync>(g_transfers.size());
+}
+
+static void APIENTRY Placeholder_glDeleteSync(GLsync)
+{
+}
+
+static GLenum APIENTRY Placeholder_glClientWaitSync(GLsync sync, GLbitfield, GLuint64 timeout)
+{
+    auto fenceID = reinterpret_cast<std::size_t>(sync);
+    if (fenceID <= g_numCompleted)
+        return GL_ALREADY_SIGNALED;
+    if (timeout == 0)
+        return GL_TIMEOUT_EXPIRED;
+
+    /* Block until the GPU has reached this fence */
+    ++g_numStalls;
+    CompleteTransfers(fenceID);
+    return GL_CONDITION_SATISFIED;
+}
+
+int main()
+{
+    // Replace GL buffer and sync procedures by placeholders
+    LLGL::glGenBuffers      = Placeholder_glGenBuffers;
+    LLGL::glDeleteBuffers   = Placeholder_glDeleteBuffers;
+    LLGL::glBindBuffer      = Placeholder_glBindBuffer;
+    LLGL::glBufferData      = Placeholder_glBufferData;
+    LLGL::glBufferSubData   = Placeholder_glBufferSubData;
+    LLGL::glMapBufferRange  = Placeholder_glMapBufferRange;
+    LLGL::glUnmapBuffer     = Placeholder_glUnmapBuffer;
+    LLGL::glFenceSync       = Placeholder_glFenceSync;
+    LLGL::glDeleteSync      = Placeholder_glDeleteSync;
+    LLGL::glClientWaitSync  = Placeholder_glClientWaitSync;
+
+    const GLsizeiptr    ringSize        = 8 * 1024 * 1024;
+    const unsigned int  numTransfers    = 10000;
+    const std::size_t   gpuLatency      = 6;
+
+    GLStateManager stateMngr;
+    GLStagingBufferRing ring(GLBufferTarget::PIXEL_UNPACK_BUFFER, ringSize);
+
+    std::mt19937 rng(42);
+    std::vector<unsigned char> data;
+    std::uint64_t lastTicket = 0;
+
+    for (unsigned int i = 0; i < numTransfers; ++i)
+    {
+        /* Write transfer with random size and a unique pattern */
+        auto size       = static_cast<GLsizeiptr>(1024 + rng() % (3 * 1024 * 1024));
+        auto pattern    = static_cast<unsigned char>(i % 255 + 1);
+
+        data.assign(static_cast<std::size_t>(size), pattern);
+
+        auto offset = ring.Write(data.data(), size);
+        if (offset < 0 || offset + size > ringSize)
+            ++g_numErrors;
+
+        g_transfers.push_back({ offset, size, pattern });
+        lastTicket = ring.InsertFence();
+
+        if (lastTicket != g_transfers.size())
+            ++g_numErrors;
+
+        /* Let the GPU lag behind by a few transfers */
+        if (g_transfers.size() > gpuLatency)
+            CompleteTransfers(g_transfers.size() - gpuLatency);
+    }
+
+    if (ring.IsComplete(lastTicket))
+        ++g_numErrors;
+
+    CompleteTransfers(g_transfers.size());
+
+    if (!ring.IsComplete(lastTicket))
+        ++g_numErrors;
+
+    std::cout << "transfers = " << numTransfers << ", stalls = " << g_numStalls << ", errors = " << g_numErrors << std::endl;
+
+    return (g_numErrors == 0 ? 0 : 1);
+}
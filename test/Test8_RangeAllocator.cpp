@@ -0,0 +1,105 @@
+/*
+ * Test8_RangeAllocator.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Test for the range allocator behind the buffer heap, which runs without a render system.
+// Random ranges are allocated and released, and each allocation is validated against a map of all occupied elements.
+// At the end all ranges are released and the allocator must have merged all free blocks into a single one.
+
+#include "../sources/Renderer/RangeAllocator.h"
+#include <iostream>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+
+using namespace LLGL;
+
+struct Range
+{
+    std::uint32_t offset;
+    std::uint32_t size;
+};
+
+static std::vector<bool>    g_occupied;
+static unsigned int         g_numErrors = 0;
+
+static void Occupy(const Range& range, bool occupied)
+{
+    for (std::uint32_t i = range.offset; i < range.offset + range.size; ++i)
+    {
+        /* Each element must change its state, otherwise two ranges overlap or a range is released twice */
+        if (g_occupied[i] == occupied)
+            ++g_numErrors;
+        g_occupied[i] = occupied;
+    }
+}
+
+int main()
+{
+    const std::uint32_t heapSize        = 1024 * 1024;
+    const unsigned int  numIterations   = 100000;
+
+    RangeAllocator allocator(heapSize);
+    g_occupied.resize(heapSize, false);
+
+    std::mt19937 rng(42);
+    std::vector<Range> ranges;
+    unsigned int numFailed = 0;
+
+    for (unsigned int i = 0; i < numIterations; ++i)
+    {
+        if (ranges.empty() || rng() % 3 != 0)
+        {
+            /* Allocate range of random size (mostly small, sometimes large) */
+            auto size = static_cast<std::uint32_t>(rng() % 8 == 0 ? 1 + rng() % 65536 : 1 + rng() % 2048);
+            auto offset = allocator.Alloc(size);
+
+            if (offset == RangeAllocator::invalidOffset)
+            {
+                /* Allocation may only fail if there is really no free block large enough */
+                ++numFailed;
+                if (allocator.GetFreeSize() >= size && allocator.GetNumFreeBlocks() == 1)
+                    ++g_numErrors;
+            }
+            else if (offset + size > heapSize)
+                ++g_numErrors;
+            else
+            {
+                Range range = { offset, size };
+                Occupy(range, true);
+                ranges.push_back(range);
+            }
+        }
+        else
+        {
+            /* Release random range */
+            auto index = rng() % ranges.size();
+            Occupy(ranges[index], false);
+            allocator.Free(ranges[index].offset, ranges[index].size);
+            ranges[index] = ranges.back();
+            ranges.pop_back();
+        }
+    }
+
+    /* Release all remaining ranges */
+    for (const auto& range : ranges)
+    {
+        Occupy(range, false);
+        allocator.Free(range.offset, range.size);
+    }
+
+    if (allocator.GetFreeSize() != heapSize || allocator.GetNumFreeBlocks() != 1)
+        ++g_numErrors;
+
+    /* Entire heap must be available as a single block again */
+    if (allocator.Alloc(heapSize) != 0)
+        ++g_numErrors;
+
+    std::cout << "iterations = " << numIterations << ", failed allocations = " << numFailed << ", errors = " << g_numErrors << std::endl;
+
+    return (g_numErrors == 0 ? 0 : 1);
+}
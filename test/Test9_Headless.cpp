@@ -0,0 +1,619 @@
+/*
+ * Test9_Headless.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Test for headless OpenGL contexts (EGL), which runs without an X11 display (e.g. on Mesa llvmpipe).
+// A pbuffer context and a surfaceless context are created, and a render target is cleared and read back.
+// Finally, buffer and texture updates are read back, which use direct state access if the driver supports it,
+// and the cached reflection of a shader program is checked.
+// Textures with base formats are checked, which are allocated with sized formats for immutable texture storage.
+// Asynchronous texture uploads and readbacks are polled until they are complete, and compared with the original image data.
+// Fences are signaled around a render target clear, and the cleared image is read back after waiting for them.
+// Indirect draw and dispatch commands are submitted with arguments from a buffer, and their results are read back.
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utility.h>
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <functional>
+#include <cstddef>
+#include <string>
+#include <stdexcept>
+
+
+static unsigned int g_numErrors = 0;
+
+static void Check(bool condition, const std::string& desc)
+{
+    if (!condition)
+    {
+        std::cerr << "error: " << desc << std::endl;
+        ++g_numErrors;
+    }
+}
+
+static void CheckTextureSize(const LLGL::Texture& texture, unsigned int width, unsigned int height, const std::string& name)
+{
+    auto size = texture.QueryMipLevelSize(0);
+    Check(size.x == width && size.y == height, "unexpected size of " + name + " texture");
+}
+
+static void TestTextureStorage(LLGL::RenderSystem& renderer)
+{
+    const unsigned int width = 8, height = 4, numTexels = width * height;
+
+    /* Create RGBA texture with initial data and read it back */
+    std::vector<std::uint8_t> colors(numTexels * 4);
+    for (std::size_t i = 0; i < colors.size(); ++i)
+        colors[i] = static_cast<std::uint8_t>(i * 7);
+
+    LLGL::ImageDescriptor colorImageDesc { LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, colors.data() };
+    auto colorTexture = renderer.CreateTexture(LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA, width, height), &colorImageDesc);
+
+    CheckTextureSize(*colorTexture, width, height, "RGBA");
+
+    std::vector<std::uint8_t> colorsRead(colors.size(), 0);
+    renderer.ReadTexture(*colorTexture, 0, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, colorsRead.data());
+    Check(colorsRead == colors, "unexpected contents of RGBA texture");
+
+    /* Create depth texture with initial data and read it back */
+    std::vector<float> depths(numTexels);
+    for (std::size_t i = 0; i < depths.size(); ++i)
+        depths[i] = static_cast<float>(i) / static_cast<float>(numTexels);
+
+    LLGL::ImageDescriptor depthImageDesc { LLGL::ImageFormat::Depth, LLGL::DataType::Float, depths.data() };
+    auto depthTexture = renderer.CreateTexture(LLGL::Texture2DDesc(LLGL::TextureFormat::DepthComponent, width, height), &depthImageDesc);
+
+    CheckTextureSize(*depthTexture, width, height, "depth");
+
+    std::vector<float> depthsRead(depths.size(), -1.0f);
+    renderer.ReadTexture(*depthTexture, 0, LLGL::ImageFormat::Depth, LLGL::DataType::Float, depthsRead.data());
+
+    bool depthsEqual = true;
+    for (std::size_t i = 0; i < depths.size(); ++i)
+    {
+        if (std::abs(depthsRead[i] - depths[i]) > 1.0e-4f)
+            depthsEqual = false;
+    }
+    Check(depthsEqual, "unexpected contents of depth texture");
+
+    renderer.Release(*colorTexture);
+    renderer.Release(*depthTexture);
+
+    std::cout << "texture storage = " << (g_numErrors == 0 ? "ok" : "failed") << std::endl;
+}
+
+// Polls the specified function until it returns true, but gives up after about two seconds
+template <typename Func>
+static bool PollUntil(Func func)
+{
+    for (int i = 0; i < 2000; ++i)
+    {
+        if (func())
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+static void TestAsyncTextureUpload(LLGL::RenderSystem& renderer)
+{
+    const unsigned int width = 16, height = 8, numTexels = width * height;
+
+    auto texture = renderer.CreateTexture(LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, width, height));
+
+    /* Upload image data through the staging buffer, and overwrite the client memory right away */
+    std::vector<std::uint8_t> colors(numTexels * 4);
+    for (std::size_t i = 0; i < colors.size(); ++i)
+        colors[i] = static_cast<std::uint8_t>(i * 3 + 1);
+
+    auto clientColors = colors;
+
+    LLGL::SubTextureDescriptor subTextureDesc;
+    {
+        subTextureDesc.texture2D.width  = width;
+        subTextureDesc.texture2D.height = height;
+    }
+    auto uploadTicket = renderer.WriteTextureAsync(*texture, subTextureDesc, { LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, clientColors.data() });
+    std::fill(clientColors.begin(), clientColors.end(), std::uint8_t(0));
+
+    Check(uploadTicket != 0, "asynchronous texture upload fell back to synchronous upload");
+    Check(PollUntil([&]() { return renderer.IsTextureUploadComplete(uploadTicket); }), "asynchronous texture upload did not complete");
+
+    /* Read image data back */
+    std::vector<std::uint8_t> colorsRead(colors.size(), 0);
+    renderer.ReadTexture(*texture, 0, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, colorsRead.data());
+    Check(colorsRead == colors, "unexpected contents of asynchronously uploaded texture");
+
+    renderer.Release(*texture);
+
+    std::cout << "async texture upload = " << (g_numErrors == 0 ? "ok" : "failed") << std::endl;
+}
+
+static void TestAsyncTextureReadback(LLGL::RenderSystem& renderer)
+{
+    const unsigned int width = 16, height = 8, numTexels = width * height;
+
+    std::vector<std::uint8_t> colors(numTexels * 4);
+    for (std::size_t i = 0; i < colors.size(); ++i)
+        colors[i] = static_cast<std::uint8_t>(i * 5 + 2);
+
+    LLGL::ImageDescriptor imageDesc { LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, colors.data() };
+    auto texture = renderer.CreateTexture(LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, width, height), &imageDesc);
+
+    /* Read image data back through the staging buffer, once as is and once converted into BGRA on the worker thread */
+    LLGL::TextureReadbackDescriptor readbackDesc;
+    auto readbackTicket = renderer.ReadTextureAsync(*texture, readbackDesc);
+
+    LLGL::TextureReadbackDescriptor convertedReadbackDesc;
+    {
+        convertedReadbackDesc.convert       = true;
+        convertedReadbackDesc.convertFormat = LLGL::ImageFormat::BGRA;
+    }
+    auto convertedReadbackTicket = renderer.ReadTextureAsync(*texture, convertedReadbackDesc);
+
+    Check(readbackTicket != convertedReadbackTicket, "texture readbacks returned the same ticket");
+
+    const void* data = nullptr;
+    std::size_t dataSize = 0;
+
+    if (PollUntil([&]() { return renderer.MapTextureReadback(readbackTicket, data, dataSize); }))
+    {
+        Check(
+            dataSize == colors.size() && std::equal(colors.begin(), colors.end(), static_cast<const std::uint8_t*>(data)),
+            "unexpected contents of asynchronous texture readback"
+        );
+        renderer.UnmapTextureReadback(readbackTicket);
+    }
+    else
+        Check(false, "asynchronous texture readback did not complete");
+
+    if (PollUntil([&]() { return renderer.MapTextureReadback(convertedReadbackTicket, data, dataSize); }))
+    {
+        auto bgra = static_cast<const std::uint8_t*>(data);
+        bool equal = (dataSize == colors.size());
+
+        for (std::size_t i = 0; equal && i < colors.size(); i += 4)
+        {
+            if (bgra[i] != colors[i + 2] || bgra[i + 1] != colors[i + 1] || bgra[i + 2] != colors[i] || bgra[i + 3] != colors[i + 3])
+                equal = false;
+        }
+
+        Check(equal, "unexpected contents of converted asynchronous texture readback");
+        renderer.UnmapTextureReadback(convertedReadbackTicket);
+    }
+    else
+        Check(false, "converted asynchronous texture readback did not complete");
+
+    renderer.Release(*texture);
+
+    std::cout << "async texture readback = " << (g_numErrors == 0 ? "ok" : "failed") << std::endl;
+}
+
+static void TestFences(LLGL::RenderSystem& renderer, LLGL::CommandBuffer& commands, LLGL::RenderContext& context)
+{
+    /* A fence which has never been signaled is considered to be signaled */
+    auto fence0 = renderer.CreateFence();
+    auto fence1 = renderer.CreateFence();
+
+    Check(fence0->IsSignaled(), "unsubmitted fence is not signaled");
+    Check(renderer.WaitFence(*fence0, 0), "waiting for unsubmitted fence failed");
+
+    /* Clear a render target between two fences, and wait for the second fence */
+    const unsigned int size = 8;
+    auto texture = renderer.CreateTexture(LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, size, size));
+    auto renderTarget = renderer.CreateRenderTarget({});
+    renderTarget->AttachTexture(*texture, {});
+
+    commands.SignalFence(*fence0);
+
+    commands.SetRenderTarget(*renderTarget);
+    commands.SetViewport({ 0.0f, 0.0f, static_cast<float>(size), static_cast<float>(size) });
+    commands.SetClearColor({ 0.0f, 1.0f, 0.0f, 1.0f });
+    commands.Clear(LLGL::ClearFlags::Color);
+
+    commands.SignalFence(*fence1);
+
+    Check(renderer.WaitFence(*fence1, ~0ull), "waiting for fence failed");
+    Check(fence1->IsSignaled(), "fence is not signaled after waiting for it");
+    Check(fence0->IsSignaled(), "fence is not signaled after waiting for a later fence");
+
+    /* All commands before the fence must have been completed */
+    std::vector<std::uint8_t> pixels(size * size * 4, 0);
+    renderer.ReadTexture(*texture, 0, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, pixels.data());
+
+    bool cleared = true;
+    for (std::size_t i = 0; i < pixels.size(); i += 4)
+    {
+        if (pixels[i] != 0 || pixels[i + 1] != 255 || pixels[i + 2] != 0 || pixels[i + 3] != 255)
+            cleared = false;
+    }
+    Check(cleared, "render target was not cleared before the fence was signaled");
+
+    /* A fence can be signaled again after it has been reached */
+    commands.SignalFence(*fence0);
+    Check(PollUntil([&]() { return fence0->IsSignaled(); }), "fence was not signaled again");
+
+    /* Unbind render target before it is released */
+    commands.SetRenderTarget(context);
+
+    renderer.Release(*fence0);
+    renderer.Release(*fence1);
+    renderer.Release(*renderTarget);
+    renderer.Release(*texture);
+
+    std::cout << "fences = " << (g_numErrors == 0 ? "ok" : "failed") << std::endl;
+}
+
+// Returns true if the texel at the specified position has the specified red component
+static bool CheckTexelRed(const std::vector<std::uint8_t>& pixels, unsigned int width, unsigned int x, unsigned int y, std::uint8_t red)
+{
+    return (pixels[(y * width + x) * 4] == red);
+}
+
+static void TestIndirectCommands(LLGL::RenderSystem& renderer, LLGL::CommandBuffer& commands, LLGL::RenderContext& context)
+{
+    const auto& renderCaps = renderer.GetRenderingCaps();
+    if (!renderCaps.hasIndirectDrawing || !renderCaps.hasComputeShaders)
+    {
+        std::cout << "indirect commands = skipped" << std::endl;
+        return;
+    }
+
+    /* Create render target and graphics pipeline, which fills the primitives with red */
+    const unsigned int size = 16;
+    auto texture = renderer.CreateTexture(LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, size, size));
+    auto renderTarget = renderer.CreateRenderTarget({});
+    renderTarget->AttachTexture(*texture, {});
+
+    LLGL::VertexFormat vertexFormat;
+    vertexFormat.AppendAttribute({ "position", LLGL::VectorType::Float2 });
+
+    auto vertShader = renderer.CreateShader(LLGL::ShaderType::Vertex);
+    auto fragShader = renderer.CreateShader(LLGL::ShaderType::Fragment);
+
+    vertShader->Compile(
+        "#version 330\n"
+        "in vec2 position;\n"
+        "void main() { gl_Position = vec4(position, 0, 1); }\n"
+    );
+    fragShader->Compile(
+        "#version 330\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = vec4(1, 0, 0, 1); }\n"
+    );
+
+    auto shaderProgram = renderer.CreateShaderProgram();
+    shaderProgram->AttachShader(*vertShader);
+    shaderProgram->AttachShader(*fragShader);
+    shaderProgram->BuildInputLayout(vertexFormat);
+
+    if (!shaderProgram->LinkShaders())
+    {
+        std::cerr << shaderProgram->QueryInfoLog() << std::endl;
+        ++g_numErrors;
+        return;
+    }
+
+    LLGL::GraphicsPipelineDescriptor pipelineDesc;
+    {
+        pipelineDesc.shaderProgram = shaderProgram;
+    }
+    auto pipeline = renderer.CreateGraphicsPipeline(pipelineDesc);
+
+    /* Create vertex and index buffer for a quad, which is split into a lower-left and upper-right triangle */
+    const float vertices[] = { -1.0f, -1.0f,  -1.0f, 1.0f,  1.0f, -1.0f,  1.0f, 1.0f };
+    const std::uint32_t indices[] = { 0, 1, 2,  2, 1, 3 };
+
+    LLGL::BufferDescriptor vertexBufferDesc;
+    {
+        vertexBufferDesc.type                   = LLGL::BufferType::Vertex;
+        vertexBufferDesc.size                   = sizeof(vertices);
+        vertexBufferDesc.vertexBuffer.format    = vertexFormat;
+    }
+    auto vertexBuffer = renderer.CreateBuffer(vertexBufferDesc, vertices);
+
+    LLGL::BufferDescriptor indexBufferDesc;
+    {
+        indexBufferDesc.type                = LLGL::BufferType::Index;
+        indexBufferDesc.size                = sizeof(indices);
+        indexBufferDesc.indexBuffer.format  = LLGL::IndexFormat(LLGL::DataType::UInt32);
+    }
+    auto indexBuffer = renderer.CreateBuffer(indexBufferDesc, indices);
+
+    /* Create argument buffer with a non-indexed draw command, two indexed draw commands (one for each triangle), and a dispatch command */
+    struct IndirectArguments
+    {
+        LLGL::DrawIndirectArguments         drawArgs;
+        LLGL::DrawIndexedIndirectArguments  drawIndexedArgs[2];
+        LLGL::DispatchIndirectArguments     dispatchArgs;
+    }
+    arguments;
+
+    arguments.drawArgs.numVertices      = 3;
+    arguments.drawArgs.numInstances     = 1;
+    arguments.drawArgs.firstVertex      = 1;
+
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        arguments.drawIndexedArgs[i].numIndices     = 3;
+        arguments.drawIndexedArgs[i].numInstances   = 1;
+        arguments.drawIndexedArgs[i].firstIndex     = i * 3;
+    }
+
+    arguments.dispatchArgs.groupSizeX   = 4;
+    arguments.dispatchArgs.groupSizeY   = 2;
+    arguments.dispatchArgs.groupSizeZ   = 1;
+
+    LLGL::BufferDescriptor argumentBufferDesc;
+    {
+        argumentBufferDesc.type = LLGL::BufferType::Indirect;
+        argumentBufferDesc.size = sizeof(arguments);
+    }
+    auto argumentBuffer = renderer.CreateBuffer(argumentBufferDesc, &arguments);
+
+    std::vector<std::uint8_t> pixels(size * size * 4, 0);
+
+    auto drawToTexture = [&](const std::function<void()>& drawCommand)
+    {
+        commands.SetRenderTarget(*renderTarget);
+        commands.SetViewport({ 0.0f, 0.0f, static_cast<float>(size), static_cast<float>(size) });
+        commands.SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+        commands.Clear(LLGL::ClearFlags::Color);
+        commands.SetGraphicsPipeline(*pipeline);
+        commands.SetVertexBuffer(*vertexBuffer);
+        commands.SetIndexBuffer(*indexBuffer);
+        drawCommand();
+        renderer.ReadTexture(*texture, 0, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, pixels.data());
+    };
+
+    /* Non-indexed indirect draw command must only draw the upper-right triangle, which starts at the second vertex */
+    drawToTexture([&]() { commands.DrawIndirect(*argumentBuffer, offsetof(IndirectArguments, drawArgs)); });
+    Check(
+        CheckTexelRed(pixels, size, size - 2, size - 2, 255) && CheckTexelRed(pixels, size, 1, 1, 0),
+        "indirect draw command did not draw the specified vertices"
+    );
+
+    /* Indexed indirect draw command must only draw the lower-left triangle */
+    drawToTexture([&]() { commands.DrawIndexedIndirect(*argumentBuffer, offsetof(IndirectArguments, drawIndexedArgs)); });
+    Check(
+        CheckTexelRed(pixels, size, 1, 1, 255) && CheckTexelRed(pixels, size, size - 2, size - 2, 0),
+        "indexed indirect draw command did not draw the specified indices"
+    );
+
+    /* Multiple indexed indirect draw commands must draw the entire quad */
+    drawToTexture(
+        [&]()
+        {
+            commands.MultiDrawIndexedIndirect(
+                *argumentBuffer, offsetof(IndirectArguments, drawIndexedArgs), 2, sizeof(LLGL::DrawIndexedIndirectArguments)
+            );
+        }
+    );
+    Check(
+        CheckTexelRed(pixels, size, 1, 1, 255) && CheckTexelRed(pixels, size, size - 2, size - 2, 255),
+        "multiple indexed indirect draw commands did not draw all primitives"
+    );
+
+    /* Indirect dispatch command must run the number of thread groups from the argument buffer */
+    auto compShader = renderer.CreateShader(LLGL::ShaderType::Compute);
+    compShader->Compile(
+        "#version 430\n"
+        "layout(local_size_x = 1) in;\n"
+        "layout(std430, binding = 0) buffer Counters { uint numGroups; uint numGroupsX; };\n"
+        "void main() { atomicAdd(numGroups, 1u); numGroupsX = gl_NumWorkGroups.x; }\n"
+    );
+
+    auto compProgram = renderer.CreateShaderProgram();
+    compProgram->AttachShader(*compShader);
+
+    if (compProgram->LinkShaders())
+    {
+        const std::uint32_t counters[2] = { 0, 0 };
+
+        LLGL::BufferDescriptor storageBufferDesc;
+        {
+            storageBufferDesc.type  = LLGL::BufferType::Storage;
+            storageBufferDesc.size  = sizeof(counters);
+            storageBufferDesc.flags = LLGL::BufferFlags::DynamicUsage;
+        }
+        auto storageBuffer = renderer.CreateBuffer(storageBufferDesc, counters);
+        auto computePipeline = renderer.CreateComputePipeline({ compProgram });
+
+        commands.SetStorageBuffer(*storageBuffer, 0);
+        commands.SetComputePipeline(*computePipeline);
+        commands.DispatchIndirect(*argumentBuffer, offsetof(IndirectArguments, dispatchArgs));
+        commands.SyncGPU();
+
+        if (auto mapped = static_cast<const std::uint32_t*>(renderer.MapBuffer(*storageBuffer, LLGL::BufferCPUAccess::ReadOnly)))
+        {
+            Check(mapped[0] == 8 && mapped[1] == 4, "indirect dispatch command did not run the specified number of thread groups");
+            renderer.UnmapBuffer(*storageBuffer);
+        }
+        else
+            Check(false, "mapping storage buffer failed");
+
+        renderer.Release(*computePipeline);
+        renderer.Release(*storageBuffer);
+    }
+    else
+    {
+        std::cerr << compProgram->QueryInfoLog() << std::endl;
+        ++g_numErrors;
+    }
+
+    /* Unbind render target before it is released */
+    commands.SetRenderTarget(context);
+
+    renderer.Release(*argumentBuffer);
+    renderer.Release(*indexBuffer);
+    renderer.Release(*vertexBuffer);
+    renderer.Release(*pipeline);
+    renderer.Release(*renderTarget);
+    renderer.Release(*texture);
+
+    std::cout << "indirect commands = " << (g_numErrors == 0 ? "ok" : "failed") << std::endl;
+}
+
+int main()
+{
+    try
+    {
+        auto renderer = LLGL::RenderSystem::Load("OpenGL");
+
+        /* Create headless context with pbuffer as default framebuffer */
+        LLGL::RenderContextDescriptor contextDesc;
+        {
+            contextDesc.videoMode.resolution    = { 64, 64 };
+            contextDesc.profileOpenGL.headless  = true;
+        }
+        auto context = renderer->CreateRenderContext(contextDesc);
+
+        /* Create surfaceless context, which shares its objects with the first context */
+        contextDesc.videoMode.resolution = { 0, 0 };
+        auto surfacelessContext = renderer->CreateRenderContext(contextDesc);
+
+        std::cout << "renderer = " << renderer->GetRendererInfo().rendererName << std::endl;
+
+        /* Clear default framebuffer of the pbuffer context */
+        auto commands = renderer->CreateCommandBuffer();
+        commands->SetRenderTarget(*context);
+        commands->SetClearColor({ 0.0f, 0.0f, 1.0f, 1.0f });
+        commands->Clear(LLGL::ClearFlags::Color);
+
+        /* Clear render target in the surfaceless context */
+        commands->SetRenderTarget(*surfacelessContext);
+
+        const unsigned int size = 16;
+        auto texture = renderer->CreateTexture(LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA8, size, size));
+        auto renderTarget = renderer->CreateRenderTarget({});
+        renderTarget->AttachTexture(*texture, {});
+
+        commands->SetRenderTarget(*renderTarget);
+        commands->SetViewport({ 0.0f, 0.0f, static_cast<float>(size), static_cast<float>(size) });
+        commands->SetClearColor({ 1.0f, 0.5f, 0.0f, 1.0f });
+        commands->Clear(LLGL::ClearFlags::Color);
+
+        /* Read back texture and compare pixels with clear color */
+        std::vector<std::uint8_t> pixels(size * size * 4, 0);
+        renderer->ReadTexture(*texture, 0, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, pixels.data());
+
+        for (std::size_t i = 0; i < pixels.size(); i += 4)
+        {
+            if (pixels[i] != 255 || pixels[i + 1] < 127 || pixels[i + 1] > 128 || pixels[i + 2] != 0 || pixels[i + 3] != 255)
+                ++g_numErrors;
+        }
+
+        std::cout << "pixels = " << (size * size) << ", errors = " << g_numErrors << std::endl;
+
+        /* Write texture sub data and read it back */
+        const std::uint8_t texel[4] = { 10, 20, 30, 40 };
+
+        LLGL::SubTextureDescriptor subTextureDesc;
+        {
+            subTextureDesc.texture2D.x      = 3;
+            subTextureDesc.texture2D.y      = 5;
+            subTextureDesc.texture2D.width  = 1;
+            subTextureDesc.texture2D.height = 1;
+        }
+        renderer->WriteTexture(*texture, subTextureDesc, { LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, texel });
+        renderer->ReadTexture(*texture, 0, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, pixels.data());
+
+        auto texelOffset = (5 * size + 3) * 4;
+        if (pixels[texelOffset] != 10 || pixels[texelOffset + 1] != 20 || pixels[texelOffset + 2] != 30 || pixels[texelOffset + 3] != 40)
+            ++g_numErrors;
+
+        /* Write buffer sub data and read it back via mapping */
+        const std::uint32_t values[4] = { 1, 2, 3, 4 };
+
+        LLGL::BufferDescriptor bufferDesc;
+        {
+            bufferDesc.type     = LLGL::BufferType::Storage;
+            bufferDesc.size     = sizeof(values);
+            bufferDesc.flags    = LLGL::BufferFlags::DynamicUsage;
+        }
+        auto buffer = renderer->CreateBuffer(bufferDesc);
+        renderer->WriteBuffer(*buffer, &values[1], sizeof(std::uint32_t) * 3, sizeof(std::uint32_t));
+
+        if (auto mapped = static_cast<const std::uint32_t*>(renderer->MapBuffer(*buffer, LLGL::BufferCPUAccess::ReadOnly)))
+        {
+            if (mapped[1] != 2 || mapped[2] != 3 || mapped[3] != 4)
+                ++g_numErrors;
+            renderer->UnmapBuffer(*buffer);
+        }
+        else
+            ++g_numErrors;
+
+        std::cout << "resource updates = " << (g_numErrors == 0 ? "ok" : "failed") << std::endl;
+
+        /* Link shader program with two uniform blocks and check the cached reflection */
+        auto vertShader = renderer->CreateShader(LLGL::ShaderType::Vertex);
+        auto fragShader = renderer->CreateShader(LLGL::ShaderType::Fragment);
+
+        vertShader->Compile(
+            "#version 330\n"
+            "layout(std140) uniform Scene { mat4 wvpMatrix; };\n"
+            "in vec3 position;\n"
+            "void main() { gl_Position = wvpMatrix * vec4(position, 1); }\n"
+        );
+        fragShader->Compile(
+            "#version 330\n"
+            "layout(std140) uniform Material { vec4 color; };\n"
+            "out vec4 fragColor;\n"
+            "void main() { fragColor = color; }\n"
+        );
+
+        auto shaderProgram = renderer->CreateShaderProgram();
+        shaderProgram->AttachShader(*vertShader);
+        shaderProgram->AttachShader(*fragShader);
+
+        if (shaderProgram->LinkShaders())
+        {
+            const auto& constantBuffers = shaderProgram->QueryConstantBuffers();
+
+            /* Query functions must return the same cached list on every call */
+            if (constantBuffers.size() != 2 || &constantBuffers != &(shaderProgram->QueryConstantBuffers()))
+                ++g_numErrors;
+
+            shaderProgram->BindConstantBuffer("Scene", 0);
+            shaderProgram->BindConstantBuffer("Material", 1);
+
+            try
+            {
+                shaderProgram->BindConstantBuffer("Unknown", 2);
+                ++g_numErrors;
+            }
+            catch (const std::invalid_argument&)
+            {
+            }
+        }
+        else
+        {
+            std::cerr << shaderProgram->QueryInfoLog() << std::endl;
+            ++g_numErrors;
+        }
+
+        std::cout << "shader reflection = " << (g_numErrors == 0 ? "ok" : "failed") << std::endl;
+
+        TestTextureStorage(*renderer);
+        TestAsyncTextureUpload(*renderer);
+        TestAsyncTextureReadback(*renderer);
+        TestFences(*renderer, *commands, *surfacelessContext);
+        TestIndirectCommands(*renderer, *commands, *surfacelessContext);
+
+        return (g_numErrors == 0 ? 0 : 1);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}